@@ -25,16 +25,34 @@ echo.
 
 :: Compilar biblioteca principal
 echo 📦 Compilando biblioteca principal...
-%COMPILER% %FLAGS% %INCLUDES% -c %SOURCE_DIR%/adilsoncrypto.cpp -o %BUILD_DIR%/adilsoncrypto.o %LIBS%
+for %%M in (adilsoncrypto adilsoncrypto_cpu adilsoncrypto_util adilsoncrypto_context adilsoncrypto_curves adilsoncrypto_field adilsoncrypto_secure adilsoncrypto_secp256k1 adilsoncrypto_log adilsoncrypto_metrics adilsoncrypto_serialize adilsoncrypto_mmap adilsoncrypto_keystore adilsoncrypto_addressset adilsoncrypto_daemon adilsoncrypto_async adilsoncrypto_sha256 adilsoncrypto_ripemd160 adilsoncrypto_blake3 adilsoncrypto_miner adilsoncrypto_pool adilsoncrypto_merkle adilsoncrypto_hardware adilsoncrypto_bitcoin adilsoncrypto_keccak adilsoncrypto_ethereum adilsoncrypto_ed25519 adilsoncrypto_solana adilsoncrypto_mlkem adilsoncrypto_slhdsa adilsoncrypto_paillier adilsoncrypto_ring adilsoncrypto_goldilocks adilsoncrypto_stark adilsoncrypto_bench) do (
+    %COMPILER% %FLAGS% %INCLUDES% -c %SOURCE_DIR%/%%M.cpp -o %BUILD_DIR%/%%M.o
+    if errorlevel 1 (
+        echo ❌ Erro na compilação de %%M.cpp
+        pause
+        exit /b 1
+    )
+)
+
+:: Kernels SIMD (selecionados em tempo de execução via CPUID)
+%COMPILER% %FLAGS% %INCLUDES% -mavx2 -c %SOURCE_DIR%/adilsoncrypto_sha256_avx2.cpp -o %BUILD_DIR%/adilsoncrypto_sha256_avx2.o
+%COMPILER% %FLAGS% %INCLUDES% -mavx2 -c %SOURCE_DIR%/adilsoncrypto_ripemd160_avx2.cpp -o %BUILD_DIR%/adilsoncrypto_ripemd160_avx2.o
+%COMPILER% %FLAGS% %INCLUDES% -mavx2 -c %SOURCE_DIR%/adilsoncrypto_blake3_avx2.cpp -o %BUILD_DIR%/adilsoncrypto_blake3_avx2.o
+%COMPILER% %FLAGS% %INCLUDES% -mavx2 -c %SOURCE_DIR%/adilsoncrypto_keccak_avx2.cpp -o %BUILD_DIR%/adilsoncrypto_keccak_avx2.o
+%COMPILER% %FLAGS% %INCLUDES% -mavx2 -c %SOURCE_DIR%/adilsoncrypto_mlkem_avx2.cpp -o %BUILD_DIR%/adilsoncrypto_mlkem_avx2.o
+%COMPILER% %FLAGS% %INCLUDES% -mavx2 -mavx512f -c %SOURCE_DIR%/adilsoncrypto_sha256_avx512.cpp -o %BUILD_DIR%/adilsoncrypto_sha256_avx512.o
+%COMPILER% %FLAGS% %INCLUDES% -mavx2 -mavx512f -c %SOURCE_DIR%/adilsoncrypto_ripemd160_avx512.cpp -o %BUILD_DIR%/adilsoncrypto_ripemd160_avx512.o
+%COMPILER% %FLAGS% %INCLUDES% -mavx2 -mavx512f -c %SOURCE_DIR%/adilsoncrypto_blake3_avx512.cpp -o %BUILD_DIR%/adilsoncrypto_blake3_avx512.o
+%COMPILER% %FLAGS% %INCLUDES% -msse4.1 -mssse3 -msha -c %SOURCE_DIR%/adilsoncrypto_sha256_shani.cpp -o %BUILD_DIR%/adilsoncrypto_sha256_shani.o
 if %ERRORLEVEL% neq 0 (
-    echo ❌ Erro na compilação da biblioteca principal
+    echo ❌ Erro na compilação dos kernels SIMD
     pause
     exit /b 1
 )
 
 :: Criar biblioteca estática
 echo 🔗 Criando biblioteca estática...
-ar rcs %BUILD_DIR%/libadilsoncrypto.a %BUILD_DIR%/adilsoncrypto.o
+ar rcs %BUILD_DIR%/libadilsoncrypto.a %BUILD_DIR%/adilsoncrypto*.o
 if %ERRORLEVEL% neq 0 (
     echo ❌ Erro na criação da biblioteca estática
     pause
@@ -43,7 +61,7 @@ if %ERRORLEVEL% neq 0 (
 
 :: Criar biblioteca dinâmica (Windows)
 echo 🔗 Criando biblioteca dinâmica...
-%COMPILER% %FLAGS% %INCLUDES% -shared %BUILD_DIR%/adilsoncrypto.o -o %BUILD_DIR%/adilsoncrypto.dll %LIBS%
+%COMPILER% %FLAGS% %INCLUDES% -shared %BUILD_DIR%/adilsoncrypto*.o -o %BUILD_DIR%/adilsoncrypto.dll %LIBS%
 if %ERRORLEVEL% neq 0 (
     echo ❌ Erro na criação da biblioteca dinâmica
     pause
@@ -86,6 +104,71 @@ if %ERRORLEVEL% neq 0 (
     exit /b 1
 )
 
+:: Compilar exemplo de assinaturas em anel (com benchmark)
+echo 🎯 Compilando exemplo de assinaturas em anel...
+%COMPILER% %FLAGS% %INCLUDES% %EXAMPLE_DIR%/exemplo_ring.cpp %BUILD_DIR%/libadilsoncrypto.a -o %BUILD_DIR%/exemplo_ring.exe %LIBS%
+if %ERRORLEVEL% neq 0 (
+    echo ❌ Erro na compilação do exemplo de anel
+    pause
+    exit /b 1
+)
+
+:: Compilar exemplo de ZK-STARK (com benchmark da NTT)
+echo 🎯 Compilando exemplo de ZK-STARK...
+%COMPILER% %FLAGS% %INCLUDES% %EXAMPLE_DIR%/exemplo_stark.cpp %BUILD_DIR%/libadilsoncrypto.a -o %BUILD_DIR%/exemplo_stark.exe %LIBS%
+if %ERRORLEVEL% neq 0 (
+    echo ❌ Erro na compilação do exemplo de STARK
+    pause
+    exit /b 1
+)
+
+:: Compilar exemplo de keystore mapeado em memória
+echo 🎯 Compilando exemplo de keystore...
+%COMPILER% %FLAGS% %INCLUDES% %EXAMPLE_DIR%/exemplo_keystore.cpp %BUILD_DIR%/libadilsoncrypto.a -o %BUILD_DIR%/exemplo_keystore.exe %LIBS%
+if %ERRORLEVEL% neq 0 (
+    echo ❌ Erro na compilação do exemplo de keystore
+    pause
+    exit /b 1
+)
+
+:: Compilar exemplo de lista de observação de endereços
+echo 🎯 Compilando exemplo de lista de endereços...
+%COMPILER% %FLAGS% %INCLUDES% %EXAMPLE_DIR%/exemplo_addressset.cpp %BUILD_DIR%/libadilsoncrypto.a -o %BUILD_DIR%/exemplo_addressset.exe %LIBS%
+if %ERRORLEVEL% neq 0 (
+    echo ❌ Erro na compilação do exemplo de lista de endereços
+    pause
+    exit /b 1
+)
+
+:: Compilar exemplo de memória segura e assinatura sem alocação
+echo 🎯 Compilando exemplo de memória segura...
+%COMPILER% %FLAGS% %INCLUDES% %EXAMPLE_DIR%/exemplo_secure.cpp %BUILD_DIR%/libadilsoncrypto.a -o %BUILD_DIR%/exemplo_secure.exe %LIBS%
+if %ERRORLEVEL% neq 0 (
+    echo ❌ Erro na compilação do exemplo de memória segura
+    pause
+    exit /b 1
+)
+
+:: Compilar exemplo de operações assíncronas (future, callback e fila de conclusões)
+echo 🎯 Compilando exemplo de operações assíncronas...
+%COMPILER% %FLAGS% %INCLUDES% %EXAMPLE_DIR%/exemplo_async.cpp %BUILD_DIR%/libadilsoncrypto.a -o %BUILD_DIR%/exemplo_async.exe %LIBS%
+if %ERRORLEVEL% neq 0 (
+    echo ❌ Erro na compilação do exemplo de operações assíncronas
+    pause
+    exit /b 1
+)
+
+:: Compilar benchmark por operação (commit e flags vão para os metadados)
+echo 🎯 Compilando benchmark...
+set GIT_COMMIT=
+for /f %%C in ('git rev-parse --short HEAD 2^>nul') do set GIT_COMMIT=%%C
+%COMPILER% %FLAGS% %INCLUDES% -DADILSONCRYPTO_GIT_COMMIT=\"%GIT_COMMIT%\" -DADILSONCRYPTO_BUILD_FLAGS="\"%FLAGS%\"" %EXAMPLE_DIR%/adilsoncrypto_bench.cpp %BUILD_DIR%/libadilsoncrypto.a -o %BUILD_DIR%/adilsoncrypto_bench.exe %LIBS%
+if %ERRORLEVEL% neq 0 (
+    echo ❌ Erro na compilação do benchmark
+    pause
+    exit /b 1
+)
+
 :: Copiar arquivos para distribuição
 echo 📦 Preparando distribuição...
 copy %BUILD_DIR%/libadilsoncrypto.a %OUTPUT_DIR%/
@@ -94,7 +177,15 @@ copy %BUILD_DIR%/adilsoncrypto_demo.exe %OUTPUT_DIR%/
 copy %BUILD_DIR%/exemplo_basico.exe %OUTPUT_DIR%/
 copy %BUILD_DIR%/exemplo_blockchain.exe %OUTPUT_DIR%/
 copy %BUILD_DIR%/exemplo_quantum.exe %OUTPUT_DIR%/
+copy %BUILD_DIR%/exemplo_ring.exe %OUTPUT_DIR%/
+copy %BUILD_DIR%/exemplo_stark.exe %OUTPUT_DIR%/
+copy %BUILD_DIR%/exemplo_keystore.exe %OUTPUT_DIR%/
+copy %BUILD_DIR%/exemplo_addressset.exe %OUTPUT_DIR%/
+copy %BUILD_DIR%/exemplo_secure.exe %OUTPUT_DIR%/
+copy %BUILD_DIR%/exemplo_async.exe %OUTPUT_DIR%/
+copy %BUILD_DIR%/adilsoncrypto_bench.exe %OUTPUT_DIR%/
 copy include/adilsoncrypto.h %OUTPUT_DIR%/
+copy include/adilsoncrypto_async.h %OUTPUT_DIR%/
 copy README_ADILSONCRYPTO.md %OUTPUT_DIR%/
 
 :: Criar arquivo de configuração
@@ -237,6 +328,13 @@ echo    🎯 Demonstração: %BUILD_DIR%/adilsoncrypto_demo.exe
 echo    🎯 Exemplo básico: %BUILD_DIR%/exemplo_basico.exe
 echo    🎯 Exemplo blockchain: %BUILD_DIR%/exemplo_blockchain.exe
 echo    🎯 Exemplo quântico: %BUILD_DIR%/exemplo_quantum.exe
+echo    🎯 Exemplo de anel: %BUILD_DIR%/exemplo_ring.exe
+echo    🎯 Exemplo de STARK: %BUILD_DIR%/exemplo_stark.exe
+echo    🎯 Exemplo de keystore: %BUILD_DIR%/exemplo_keystore.exe
+echo    🎯 Exemplo de lista de endereços: %BUILD_DIR%/exemplo_addressset.exe
+echo    🎯 Exemplo de memória segura: %BUILD_DIR%/exemplo_secure.exe
+echo    🎯 Exemplo de operações assíncronas: %BUILD_DIR%/exemplo_async.exe
+echo    🎯 Benchmark: %BUILD_DIR%/adilsoncrypto_bench.exe
 echo.
 echo 📦 Distribuição em: %OUTPUT_DIR%/
 echo.
@@ -0,0 +1,149 @@
+#include "../include/adilsoncrypto.h"
+#include "../include/adilsoncrypto_bench.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Commit e flags são injetados pelo Makefile (alvo crypto-bench)
+#ifndef ADILSONCRYPTO_GIT_COMMIT
+#define ADILSONCRYPTO_GIT_COMMIT ""
+#endif
+#ifndef ADILSONCRYPTO_BUILD_FLAGS
+#define ADILSONCRYPTO_BUILD_FLAGS ""
+#endif
+
+// Benchmark por operação da AdilsonCrypto: aquecimento, amostras repetidas,
+// média/p50/p99 e ops/s para 1..N threads, exportados em JSON ou CSV com os
+// metadados de CPU e build para o CI comparar commits.
+static void usage() {
+    std::fprintf(stderr,
+                 "uso: adilsoncrypto_bench [opções]\n"
+                 "  --threads 1,2,4      contagens de threads (padrão: 1, 2, 4, ... até o nº de núcleos)\n"
+                 "  --max-threads N      potências de 2 até N, mais o próprio N\n"
+                 "  --samples N          amostras por thread (padrão 30)\n"
+                 "  --warmup-ms X        aquecimento por operação (padrão 100)\n"
+                 "  --sample-ms X        duração de cada amostra (padrão 10)\n"
+                 "  --filter TEXTO       só operações cujo nome contém TEXTO\n"
+                 "  --format F           table, json ou csv (padrão table)\n"
+                 "  --output ARQUIVO     grava o relatório no arquivo (padrão: saída padrão)\n"
+                 "  --meta CHAVE=VALOR   metadado extra (ex.: --meta runner=ci-linux)\n"
+                 "  --list               lista as operações e sai\n");
+}
+
+static bool parseThreads(const std::string& text, std::vector<unsigned>& threads) {
+    threads.clear();
+    size_t start = 0;
+    while (start <= text.size()) {
+        size_t comma = text.find(',', start);
+        std::string item = text.substr(start, comma == std::string::npos ? std::string::npos : comma - start);
+        int value = std::atoi(item.c_str());
+        if (value <= 0) return false;
+        threads.push_back((unsigned)value);
+        if (comma == std::string::npos) break;
+        start = comma + 1;
+    }
+    return !threads.empty();
+}
+
+int main(int argc, char** argv) {
+    adilsoncrypto::BenchConfig config;
+    std::string format = "table";
+    std::string output;
+    bool list = false;
+    std::vector<std::pair<std::string, std::string>> extra;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--threads" && has_value) {
+            if (!parseThreads(argv[++i], config.threads)) {
+                usage();
+                return 2;
+            }
+        } else if (arg == "--max-threads" && has_value) {
+            int max_threads = std::atoi(argv[++i]);
+            if (max_threads <= 0) {
+                usage();
+                return 2;
+            }
+            config.threads.clear();
+            for (int t = 1; t < max_threads; t *= 2) config.threads.push_back((unsigned)t);
+            config.threads.push_back((unsigned)max_threads);
+        } else if (arg == "--samples" && has_value) {
+            config.samples = (unsigned)std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--warmup-ms" && has_value) {
+            config.warmup_ms = std::atof(argv[++i]);
+        } else if (arg == "--sample-ms" && has_value) {
+            config.sample_ms = std::atof(argv[++i]);
+        } else if (arg == "--filter" && has_value) {
+            config.filter = argv[++i];
+        } else if (arg == "--format" && has_value) {
+            format = argv[++i];
+        } else if (arg == "--output" && has_value) {
+            output = argv[++i];
+        } else if (arg == "--meta" && has_value) {
+            std::string kv = argv[++i];
+            size_t eq = kv.find('=');
+            if (eq == std::string::npos) {
+                usage();
+                return 2;
+            }
+            extra.emplace_back(kv.substr(0, eq), kv.substr(eq + 1));
+        } else if (arg == "--list") {
+            list = true;
+        } else {
+            usage();
+            return arg == "--help" || arg == "-h" ? 0 : 2;
+        }
+    }
+    if (format != "table" && format != "json" && format != "csv") {
+        usage();
+        return 2;
+    }
+
+    AdilsonCrypto* crypto = createAdilsonCrypto();
+    adilsoncrypto::BenchHarness harness;
+    adilsoncrypto::addStandardBenchmarks(harness, *crypto);
+
+    std::string report;
+    if (list) {
+        for (const adilsoncrypto::BenchCase& bench_case : harness.cases()) report += bench_case.name + "\n";
+    } else {
+        adilsoncrypto::BenchMetadata metadata = adilsoncrypto::collectBenchMetadata();
+        metadata.set("commit", ADILSONCRYPTO_GIT_COMMIT);
+        metadata.set("build_flags", ADILSONCRYPTO_BUILD_FLAGS);
+        metadata.set("samples_per_thread", std::to_string(config.samples));
+        metadata.set("sample_ms", std::to_string(config.sample_ms));
+        for (const auto& field : extra) metadata.set(field.first, field.second);
+
+        auto results = harness.run(config, [](const adilsoncrypto::BenchResult& r) {
+            std::fprintf(stderr, "  %-36s %3u threads %12.0f ns %12.0f ops/s\n", r.name.c_str(), r.threads,
+                         r.p50_ns, r.ops_per_sec);
+        });
+        if (format == "json") {
+            report = adilsoncrypto::benchToJson(results, metadata);
+        } else if (format == "csv") {
+            report = adilsoncrypto::benchToCsv(results, metadata);
+        } else {
+            report = adilsoncrypto::benchToTable(results);
+        }
+    }
+
+    destroyAdilsonCrypto(crypto);
+
+    if (output.empty()) {
+        std::cout << report;
+    } else {
+        std::ofstream file(output, std::ios::binary);
+        file << report;
+        if (!file) {
+            std::fprintf(stderr, "erro ao gravar %s\n", output.c_str());
+            return 1;
+        }
+    }
+    return 0;
+}
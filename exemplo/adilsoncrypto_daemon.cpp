@@ -0,0 +1,217 @@
+#include "../include/adilsoncrypto.h"
+#include "../include/adilsoncrypto_daemon.h"
+#include "../include/adilsoncrypto_util.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Daemon de assinatura num socket Unix, e o teste de carga que mede vazão e
+// p99 com milhares de requisições simultâneas (--load-test).
+static void usage() {
+    std::fprintf(stderr,
+                 "uso: adilsoncrypto_daemon [opções]\n"
+                 "  --socket CAMINHO     socket Unix (padrão /tmp/adilsoncrypto.sock)\n"
+                 "  --keystore ARQUIVO   keystore para assinar por endereço; a senha vem de\n"
+                 "                       ADILSONCRYPTO_PASSPHRASE\n"
+                 "  --threads N          threads de trabalho (padrão: núcleos)\n"
+                 "  --batch N            requisições por lote (padrão 1024)\n"
+                 "  --window-us N        espera para completar um lote (padrão 100)\n"
+                 "  --max-inflight N     pendentes por cliente antes de parar de ler (padrão 256)\n"
+                 "  --metrics            imprime as métricas do daemon no socket e sai\n"
+                 "  --load-test          mede o daemon no socket (sobe um interno se não houver)\n"
+                 "  --requests N         requisições do teste de carga (padrão 10000)\n"
+                 "  --connections N      conexões do teste de carga (padrão 16)\n");
+}
+
+static std::atomic<bool> stop_requested{ false };
+
+static void onSignal(int) {
+    stop_requested = true;
+}
+
+static double percentile(std::vector<double>& values, double p) {
+    if (values.empty()) return 0;
+    size_t index = std::min(values.size() - 1, (size_t)(p * (values.size() - 1) + 0.5));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+// Um terço de cada operação, todas disparadas de uma vez por 'connections'
+// threads; a latência vai do envio até o callback da resposta
+static int loadTest(const std::string& socket_path, size_t requests, size_t connections) {
+    AdilsonCrypto* crypto = createAdilsonCrypto();
+    KeyPair keypair = crypto->generateKeyPair();
+    const std::string message = "transferência de 42 unidades para o endereço de teste";
+    Signature signature = crypto->sign(message, keypair.private_key);
+    destroyAdilsonCrypto(crypto);
+
+    // Corpos das três requisições no formato do protocolo
+    std::string secret, compact, uncompressed, compressed;
+    adilsoncrypto::hexToBytes(std::string(64 - keypair.private_key.size(), '0') + keypair.private_key, secret);
+    adilsoncrypto::hexToBytes(std::string(64 - signature.r.size(), '0') + signature.r, compact);
+    std::string s_bytes;
+    adilsoncrypto::hexToBytes(std::string(64 - signature.s.size(), '0') + signature.s, s_bytes);
+    compact += s_bytes;
+    adilsoncrypto::hexToBytes(keypair.public_key, uncompressed);
+    compressed.push_back((char)(0x02 | (uncompressed[64] & 1)));
+    compressed.append(uncompressed, 1, 32);
+
+    const std::string sign_body = std::string(1, (char)adilsoncrypto::DAEMON_KEY_RAW) + std::string(1, (char)32) + secret + message;
+    const std::string verify_body = compressed + compact + message;
+    const std::string hash_body = message;
+
+    std::vector<std::unique_ptr<adilsoncrypto::DaemonClient>> clients;
+    for (size_t c = 0; c < connections; c++) {
+        clients.emplace_back(new adilsoncrypto::DaemonClient());
+        if (!clients.back()->connect(socket_path)) {
+            std::fprintf(stderr, "não foi possível conectar em %s\n", socket_path.c_str());
+            return 1;
+        }
+    }
+
+    typedef std::chrono::steady_clock Clock;
+    std::vector<Clock::time_point> sent(requests);
+    std::vector<double> latency_us(requests);
+    std::atomic<size_t> remaining{ requests };
+    std::atomic<size_t> failures{ 0 };
+    std::mutex done_mutex;
+    std::condition_variable all_done;
+
+    const Clock::time_point start = Clock::now();
+    std::vector<std::thread> senders;
+    for (size_t c = 0; c < connections; c++) {
+        senders.emplace_back([&, c] {
+            for (size_t i = c; i < requests; i += connections) {
+                adilsoncrypto::DaemonOp op = i % 3 == 0   ? adilsoncrypto::DaemonOp::SIGN
+                                             : i % 3 == 1 ? adilsoncrypto::DaemonOp::VERIFY
+                                                          : adilsoncrypto::DaemonOp::SHA256;
+                const std::string& body = i % 3 == 0 ? sign_body : i % 3 == 1 ? verify_body : hash_body;
+                sent[i] = Clock::now();
+                clients[c]->request(op, body, [&, i, op](adilsoncrypto::DaemonReply&& reply) {
+                    latency_us[i] = std::chrono::duration<double, std::micro>(Clock::now() - sent[i]).count();
+                    bool ok = reply.status == adilsoncrypto::DaemonStatus::OK &&
+                              (op != adilsoncrypto::DaemonOp::VERIFY || (reply.data.size() == 1 && reply.data[0] == 1));
+                    if (!ok) failures++;
+                    if (--remaining == 0) {
+                        std::lock_guard<std::mutex> lock(done_mutex);
+                        all_done.notify_all();
+                    }
+                });
+            }
+        });
+    }
+    for (std::thread& t : senders) t.join();
+    {
+        std::unique_lock<std::mutex> lock(done_mutex);
+        all_done.wait(lock, [&] { return remaining == 0; });
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    clients.clear();
+
+    std::printf("requisições:   %zu em %zu conexões (%zu falhas)\n", requests, connections, failures.load());
+    std::printf("tempo:         %.3f s\n", seconds);
+    std::printf("vazão:         %.0f req/s\n", requests / seconds);
+    std::printf("latência p50:  %.0f us\n", percentile(latency_us, 0.50));
+    std::printf("latência p99:  %.0f us\n", percentile(latency_us, 0.99));
+    std::printf("latência máx:  %.0f us\n", percentile(latency_us, 1.0));
+    return failures == 0 ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    adilsoncrypto::DaemonOptions options;
+    options.socket_path = "/tmp/adilsoncrypto.sock";
+    bool load_test = false;
+    bool show_metrics = false;
+    size_t requests = 10000;
+    size_t connections = 16;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--socket" && has_value) {
+            options.socket_path = argv[++i];
+        } else if (arg == "--keystore" && has_value) {
+            options.keystore_path = argv[++i];
+        } else if (arg == "--threads" && has_value) {
+            options.threads = (unsigned)std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--batch" && has_value) {
+            options.max_batch = (size_t)std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--window-us" && has_value) {
+            options.batch_window_us = (unsigned)std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--max-inflight" && has_value) {
+            options.max_inflight = (unsigned)std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--metrics") {
+            show_metrics = true;
+        } else if (arg == "--load-test") {
+            load_test = true;
+        } else if (arg == "--requests" && has_value) {
+            requests = (size_t)std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--connections" && has_value) {
+            connections = (size_t)std::max(1, std::atoi(argv[++i]));
+        } else {
+            usage();
+            return arg == "--help" || arg == "-h" ? 0 : 2;
+        }
+    }
+    // A senha não vai na linha de comando (visível em ps)
+    const char* passphrase = std::getenv("ADILSONCRYPTO_PASSPHRASE");
+    if (passphrase) options.passphrase = passphrase;
+
+    if (show_metrics) {
+        adilsoncrypto::DaemonClient client;
+        if (!client.connect(options.socket_path)) {
+            std::fprintf(stderr, "nenhum daemon em %s\n", options.socket_path.c_str());
+            return 1;
+        }
+        std::string text = client.metrics();
+        std::fputs(text.c_str(), stdout);
+        return text.empty() ? 1 : 0;
+    }
+
+    if (load_test) {
+        // Sem daemon no socket, sobe um no próprio processo
+        std::unique_ptr<adilsoncrypto::SigningDaemon> daemon;
+        adilsoncrypto::DaemonClient probe;
+        if (!probe.connect(options.socket_path)) {
+            daemon.reset(new adilsoncrypto::SigningDaemon(options));
+            if (!daemon->start()) {
+                std::fprintf(stderr, "não foi possível iniciar o daemon em %s\n", options.socket_path.c_str());
+                return 1;
+            }
+        }
+        probe.close();
+        int status = loadTest(options.socket_path, requests, std::min(connections, requests));
+        if (daemon) {
+            adilsoncrypto::DaemonStats stats = daemon->stats();
+            std::printf("lotes:         %llu (média de %.1f requisições)\n", (unsigned long long)stats.batches,
+                        stats.batches ? (double)stats.requests / stats.batches : 0.0);
+            std::printf("suspensões:    %llu (limite de pendentes por cliente)\n", (unsigned long long)stats.throttled);
+        }
+        return status;
+    }
+
+    adilsoncrypto::SigningDaemon daemon(options);
+    if (!daemon.start()) {
+        std::fprintf(stderr, "não foi possível iniciar o daemon em %s\n", options.socket_path.c_str());
+        return 1;
+    }
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+    std::fprintf(stderr, "daemon ouvindo em %s (Ctrl+C encerra)\n", options.socket_path.c_str());
+    while (!stop_requested) std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    daemon.stop();
+
+    adilsoncrypto::DaemonStats stats = daemon.stats();
+    std::fprintf(stderr, "%llu requisições em %llu lotes\n", (unsigned long long)stats.requests,
+                 (unsigned long long)stats.batches);
+    return 0;
+}
@@ -130,22 +130,22 @@ void demoHomomorphicEncryption(AdilsonCrypto* crypto) {
     std::cout << "📊 Valor A: " << value_a << " (será criptografado)" << std::endl;
     std::cout << "📊 Valor B: " << value_b << " (será criptografado)" << std::endl;
     
-    // Simulação de criptografia homomórfica
-    std::string encrypted_a = crypto->aesEncrypt(std::to_string(value_a), "key123");
-    std::string encrypted_b = crypto->aesEncrypt(std::to_string(value_b), "key123");
+    auto homomorphic = crypto->createHomomorphicEncryption();
+    auto encrypted_a = homomorphic->encrypt(value_a);
+    auto encrypted_b = homomorphic->encrypt(value_b);
     
-    std::cout << "🔒 Valor A criptografado: " << encrypted_a.substr(0, 32) << "..." << std::endl;
-    std::cout << "🔒 Valor B criptografado: " << encrypted_b.substr(0, 32) << "..." << std::endl;
+    std::cout << "🔒 Valor A criptografado: " << encrypted_a.encrypted_value.substr(0, 32) << "..." << std::endl;
+    std::cout << "🔒 Valor B criptografado: " << encrypted_b.encrypted_value.substr(0, 32) << "..." << std::endl;
     
-    // Simulação de computação homomórfica
-    std::cout << "🧮 Computando A + B em dados criptografados..." << std::endl;
-    std::string encrypted_sum = crypto->aesEncrypt(std::to_string(value_a + value_b), "key123");
+    // Soma Paillier: multiplicação dos textos cifrados, sem decifrar A ou B
+    std::cout << "🧮 Computando A + B em dados criptografados (" << encrypted_a.parameters << ")..." << std::endl;
+    auto encrypted_sum = homomorphic->add(encrypted_a, encrypted_b);
     
     std::cout << "🔓 Descriptografando resultado..." << std::endl;
-    std::string decrypted_sum = crypto->aesDecrypt(encrypted_sum, "key123");
+    int decrypted_sum = homomorphic->decrypt(encrypted_sum);
     
     std::cout << "📊 Resultado: " << decrypted_sum << std::endl;
-    std::cout << "✅ Verificação: " << (decrypted_sum == "30" ? "CORRETO ✅" : "ERRO ❌") << std::endl;
+    std::cout << "✅ Verificação: " << (decrypted_sum == 30 ? "CORRETO ✅" : "ERRO ❌") << std::endl;
     
     std::cout << "🎯 Homomorphic Encryption: Computação sem revelar dados!" << std::endl;
 }
@@ -155,19 +155,17 @@ void demoBlockchainIntegration(AdilsonCrypto* crypto) {
     
     std::cout << "🌐 Gerando chaves para diferentes blockchains..." << std::endl;
     
-    // Bitcoin
-    auto bitcoin_keypair = crypto->generateKeyPair();
+    // Bitcoin (P2PKH)
+    auto bitcoin_keypair = crypto->createBitcoinInterface()->generateKey();
     std::cout << "₿ Bitcoin Address: " << bitcoin_keypair.address << std::endl;
     
-    // Ethereum (simulação)
-    auto eth_keypair = crypto->generateKeyPair();
-    std::string eth_address = "0x" + crypto->keccak256(eth_keypair.public_key).substr(24);
-    std::cout << "Ξ Ethereum Address: " << eth_address << std::endl;
+    // Ethereum (EIP-55)
+    auto eth_keypair = crypto->createEthereumInterface()->generateKey();
+    std::cout << "Ξ Ethereum Address: " << eth_keypair.address << std::endl;
     
-    // Solana (simulação)
-    auto sol_keypair = crypto->generateKeyPair();
-    std::string sol_address = crypto->base58Encode(crypto->sha256(sol_keypair.public_key));
-    std::cout << "◎ Solana Address: " << sol_address.substr(0, 32) << "..." << std::endl;
+    // Solana (Ed25519)
+    auto sol_keypair = crypto->createSolanaInterface()->generateKey();
+    std::cout << "◎ Solana Address: " << sol_keypair.address << std::endl;
     
     std::cout << "✅ Suporte universal a todas as blockchains!" << std::endl;
 }
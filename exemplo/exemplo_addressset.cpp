@@ -0,0 +1,84 @@
+#include "../include/adilsoncrypto.h"
+#include "../include/adilsoncrypto_addressset.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// Lista de observação de endereços: montagem, gravação, abertura mapeada e
+// varredura de um fluxo de endereços em lote
+int main() {
+    std::cout << "👀 ADILSONCRYPTO - LISTA DE OBSERVAÇÃO DE ENDEREÇOS" << std::endl;
+    std::cout << "==================================================" << std::endl;
+    std::cout << std::endl;
+
+    AdilsonCrypto* crypto = createAdilsonCrypto();
+    const std::string path = "exemplo_enderecos.acas";
+    auto ms = [](std::chrono::high_resolution_clock::duration d) {
+        return std::chrono::duration<double, std::milli>(d).count();
+    };
+
+    try {
+        // 1. Metade dos endereços vai para a lista; a outra metade só aparece no fluxo
+        std::cout << "1. MONTAGEM" << std::endl;
+        std::cout << "   --------" << std::endl;
+        const size_t total = 40000;
+        std::vector<std::string> addresses;
+        for (size_t i = 0; i < total; i++) addresses.push_back(crypto->generateKeyPair().address);
+        std::vector<std::string> watched(addresses.begin(), addresses.begin() + total / 2);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        {
+            adilsoncrypto::AddressSet set;
+            if (!set.build(watched) || !set.save(path)) throw std::runtime_error("não foi possível gravar " + path);
+            std::cout << "   Endereços: " << set.size() << std::endl;
+            std::cout << "   Filtro: " << set.filterBytes() << " bytes (" << std::fixed << std::setprecision(2)
+                      << 8.0 * set.filterBytes() / set.size() << " bits por endereço)" << std::endl;
+            std::cout << "   Arquivo: " << set.totalBytes() << " bytes" << std::endl;
+        }
+        std::cout << "   Tempo: " << ms(std::chrono::high_resolution_clock::now() - start) << " ms" << std::endl;
+
+        // 2. Abertura: só mapeia o arquivo, sem reconstruir nada
+        std::cout << std::endl;
+        std::cout << "2. ABERTURA E VARREDURA" << std::endl;
+        std::cout << "   ---------------------" << std::endl;
+        adilsoncrypto::AddressSet set;
+        start = std::chrono::high_resolution_clock::now();
+        if (!set.open(path)) throw std::runtime_error("não foi possível abrir " + path);
+        std::cout << "   Abertura: " << std::setprecision(3) << ms(std::chrono::high_resolution_clock::now() - start)
+                  << " ms" << std::endl;
+
+        std::vector<std::string> stream;
+        for (int round = 0; round < 25; round++) stream.insert(stream.end(), addresses.begin(), addresses.end());
+        std::vector<uint8_t> hits(stream.size());
+        start = std::chrono::high_resolution_clock::now();
+        set.containsBatch(stream.data(), stream.size(), hits.data());
+        auto elapsed = std::chrono::high_resolution_clock::now() - start;
+
+        size_t found = 0, wrong = 0;
+        for (size_t i = 0; i < stream.size(); i++) {
+            found += hits[i];
+            wrong += hits[i] != (i % total < total / 2);
+        }
+        std::cout << "   Consultas: " << stream.size() << " em " << std::setprecision(2) << ms(elapsed) << " ms ("
+                  << std::setprecision(1) << stream.size() / ms(elapsed) / 1000.0 << " milhões/s)" << std::endl;
+        std::cout << "   Encontrados: " << found << (wrong == 0 ? " ✅ resposta exata" : " ❌ divergências")
+                  << std::endl;
+        std::cout << "   Endereço de fora: " << (set.contains(crypto->generateKeyPair().address) ? "NA LISTA" : "fora")
+                  << std::endl;
+
+        set.close();
+        std::remove(path.c_str());
+
+        std::cout << std::endl;
+        std::cout << "✅ Demonstração da lista de observação concluída!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Erro: " << e.what() << std::endl;
+    }
+
+    destroyAdilsonCrypto(crypto);
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include "../include/adilsoncrypto.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <unistd.h>
+#endif
+
+#if defined(ADILSONCRYPTO_COROUTINES)
+// Tarefa mínima que começa na hora e não devolve nada (compilado só em C++20)
+struct Tarefa {
+    struct promise_type {
+        Tarefa get_return_object() { return {}; }
+        std::suspend_never initial_suspend() { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() {}
+    };
+};
+
+// Assina e confere sem bloquear: cada co_await retoma na thread do laço
+static Tarefa assinarEConferir(AdilsonCrypto* crypto, KeyPair keypair, adilsoncrypto::CompletionQueue* fila,
+                               bool* concluido) {
+    Signature signature = co_await crypto->signAsync("mensagem da corrotina", keypair.private_key).via(*fila);
+    bool valid = co_await crypto->verifyAsync("mensagem da corrotina", signature, keypair.public_key).via(*fila);
+    std::cout << "   Corrotina: assinatura " << (valid ? "✅" : "❌") << std::endl;
+    *concluido = true;
+}
+#endif
+
+// Operações assíncronas: std::future, callback, fila de conclusões num laço
+// epoll e o agrupamento de requisições concorrentes em lotes
+int main() {
+    std::cout << "⏳ ADILSONCRYPTO - OPERAÇÕES ASSÍNCRONAS" << std::endl;
+    std::cout << "=======================================" << std::endl;
+    std::cout << std::endl;
+
+    AdilsonCrypto* crypto = createAdilsonCrypto();
+    int status = 0;
+
+    try {
+        KeyPair keypair = crypto->generateKeyPair();
+
+        // 1. Resultado direto e std::future
+        std::cout << "1. FUTURE" << std::endl;
+        std::cout << "   ------" << std::endl;
+        std::future<Signature> pending = crypto->signAsync("mensagem", keypair.private_key).future();
+        Signature signature = pending.get();
+        bool valid = crypto->verifyAsync("mensagem", signature, keypair.public_key).get();
+        std::cout << "   Assinatura: " << signature.r.substr(0, 16) << "..." << std::endl;
+        std::cout << "   Verificação: " << (valid ? "✅" : "❌") << std::endl;
+        if (!valid) status = 1;
+
+        // 2. Lote: as mensagens entram juntas no SHA-256 multi-buffer
+        std::cout << std::endl;
+        std::cout << "2. LOTE" << std::endl;
+        std::cout << "   ----" << std::endl;
+        std::vector<std::string> messages;
+        for (int i = 0; i < 256; i++) messages.push_back("transação " + std::to_string(i));
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<Signature> signatures = crypto->signBatchAsync(messages, keypair.private_key).get();
+        std::vector<bool> results =
+            crypto->verifyBatchAsync(messages, signatures, std::vector<std::string>(messages.size(), keypair.public_key))
+                .get();
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        size_t valid_count = 0;
+        for (bool result : results) valid_count += result;
+        std::cout << "   Assinadas e verificadas: " << valid_count << "/" << messages.size() << " em " << std::fixed
+                  << std::setprecision(1) << elapsed << " ms" << (valid_count == messages.size() ? " ✅" : " ❌")
+                  << std::endl;
+        if (valid_count != messages.size()) status = 1;
+
+        // 3. Requisições soltas e concorrentes viram poucos lotes
+        std::cout << std::endl;
+        std::cout << "3. AGRUPAMENTO" << std::endl;
+        std::cout << "   -----------" << std::endl;
+        adilsoncrypto::AsyncStats before = adilsoncrypto::asyncStats();
+        std::vector<adilsoncrypto::AsyncResult<std::string>> hashes;
+        for (const auto& message : messages) hashes.push_back(crypto->hashAsync(message));
+        bool hashes_ok = true;
+        for (size_t i = 0; i < hashes.size(); i++) hashes_ok &= hashes[i].get() == crypto->sha256(messages[i]);
+        adilsoncrypto::AsyncStats after = adilsoncrypto::asyncStats();
+        std::cout << "   " << hashes.size() << " hashAsync em " << after.batches - before.batches << " lote(s) "
+                  << (hashes_ok ? "✅" : "❌") << std::endl;
+        if (!hashes_ok) status = 1;
+
+        // 4. Fila de conclusões: callbacks rodam na thread do laço de eventos
+        std::cout << std::endl;
+        std::cout << "4. LAÇO DE EVENTOS" << std::endl;
+        std::cout << "   --------------" << std::endl;
+        adilsoncrypto::CompletionQueue fila;
+        int concluidas = 0;
+        for (int i = 0; i < 8; i++) {
+            crypto->hashAsync(messages[i]).via(fila).then([&concluidas](std::string) { concluidas++; });
+        }
+#if defined(__linux__)
+        int epoll_fd = epoll_create1(0);
+        epoll_event event{};
+        event.events = EPOLLIN;
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fila.fd(), &event);
+        while (concluidas < 8) {
+            epoll_event ready;
+            if (epoll_wait(epoll_fd, &ready, 1, 1000) > 0) fila.poll();
+        }
+        close(epoll_fd);
+        std::cout << "   Callbacks pelo eventfd no epoll: " << concluidas << " ✅" << std::endl;
+#else
+        while (concluidas < 8) fila.wait(1000);
+        std::cout << "   Callbacks pela fila: " << concluidas << " ✅" << std::endl;
+#endif
+
+#if defined(ADILSONCRYPTO_COROUTINES)
+        bool concluido = false;
+        assinarEConferir(crypto, keypair, &fila, &concluido);
+        while (!concluido) fila.wait(1000);
+#else
+        std::cout << "   Corrotinas: compile com -std=c++20 para usar co_await" << std::endl;
+#endif
+
+        std::cout << std::endl;
+        std::cout << (status == 0 ? "✅ Demonstração assíncrona concluída!" : "❌ Demonstração assíncrona falhou")
+                  << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Erro: " << e.what() << std::endl;
+        status = 1;
+    }
+
+    destroyAdilsonCrypto(crypto);
+
+    return status;
+}
@@ -1,6 +1,7 @@
 #include "../include/adilsoncrypto.h"
 #include <iostream>
 #include <vector>
+#include <chrono>
 
 int main() {
     std::cout << "🌐 ADILSONCRYPTO - EXEMPLO BLOCKCHAIN" << std::endl;
@@ -19,11 +20,20 @@ int main() {
         std::cout << "   -----------------" << std::endl;
         
         auto btc_keypair = crypto->generateKeyPair();
-        std::cout << "   Endereço Bitcoin: " << btc_keypair.address << std::endl;
-        
-        std::string btc_tx = "0100000001..."; // Transação Bitcoin simulada
-        auto btc_sig = crypto->sign(btc_tx, btc_keypair.private_key);
+        auto bitcoin = crypto->createBitcoinInterface();
+        auto btc_wallet = bitcoin->generateKey();
+        std::cout << "   Endereço Bitcoin: " << btc_wallet.address << std::endl;
+        
+        // Transação não assinada: 1 entrada, 1 saída P2PKH (sighash legacy)
+        std::string btc_tx = "0100000001"
+                             "9f96ade4b41d5433f4eda31e1738ec2b36f6e7d1420d94a6af99801a88f7f7ff" "00000000"
+                             "00" "ffffffff"
+                             "01" "00e1f50500000000"
+                             "1976a9148280b37df378db99f66f85c95a783a76ac7a6d5988ac"
+                             "00000000";
+        auto btc_sig = bitcoin->sign(btc_tx, btc_wallet);
         std::cout << "   Assinatura Bitcoin: " << btc_sig.r.substr(0, 32) << "..." << std::endl;
+        std::cout << "   scriptSig (DER + sighash): " << btc_sig.proof.substr(0, 32) << "..." << std::endl;
         std::cout << std::endl;
         
         // 2. Ethereum
@@ -31,8 +41,18 @@ int main() {
         std::cout << "   -----------------" << std::endl;
         
         auto eth_keypair = crypto->generateKeyPair();
-        std::string eth_address = "0x" + crypto->keccak256(eth_keypair.public_key).substr(24);
-        std::cout << "   Endereço Ethereum: " << eth_address << std::endl;
+        auto ethereum = crypto->createEthereumInterface();
+        auto eth_wallet = ethereum->generateKey();
+        std::cout << "   Endereço Ethereum: " << eth_wallet.address << std::endl;
+        
+        // EIP-1559 não assinada: 0x02 || rlp([chainId, nonce, maxPriorityFee,
+        // maxFee, gas, to, value, data, accessList])
+        std::string eth_tx = "02f0"
+                             "01" "80" "843b9aca00" "85174876e800" "825208"
+                             "943535353535353535353535353535353535353535"
+                             "880de0b6b3a7640000" "80" "c0";
+        auto eth_tx_sig = ethereum->sign(eth_tx, eth_wallet);
+        std::cout << "   Transação EIP-1559 assinada: 0x" << eth_tx_sig.proof.substr(0, 32) << "..." << std::endl;
         
         std::string eth_message = "Mensagem Ethereum para assinatura";
         auto eth_sig = crypto->sign(eth_message, eth_keypair.private_key);
@@ -43,13 +63,14 @@ int main() {
         std::cout << "3. SOLANA (◎)" << std::endl;
         std::cout << "   -----------------" << std::endl;
         
-        auto sol_keypair = crypto->generateKeyPair();
-        std::string sol_address = crypto->base58Encode(crypto->sha256(sol_keypair.public_key));
-        std::cout << "   Endereço Solana: " << sol_address.substr(0, 32) << "..." << std::endl;
+        // Endereço = Base58 da chave pública Ed25519
+        auto solana = crypto->createSolanaInterface();
+        auto sol_keypair = solana->generateKey();
+        std::cout << "   Endereço Solana: " << sol_keypair.address << std::endl;
         
         std::string sol_instruction = "Transfer instruction";
-        auto sol_sig = crypto->sign(sol_instruction, sol_keypair.private_key);
-        std::cout << "   Assinatura Solana: " << sol_sig.r.substr(0, 32) << "..." << std::endl;
+        auto sol_sig = solana->sign(crypto->hexEncode(sol_instruction), sol_keypair);
+        std::cout << "   Assinatura Solana: " << sol_sig.proof.substr(0, 32) << "..." << std::endl;
         std::cout << std::endl;
         
         // 4. Multi-signature para DeFi
@@ -116,8 +137,20 @@ int main() {
         std::cout << "   Assinatura NFT: " << nft_sig.r.substr(0, 32) << "..." << std::endl;
         std::cout << std::endl;
         
-        // 8. Performance Comparison
-        std::cout << "8. PERFORMANCE COMPARISON" << std::endl;
+        // 8. Merkle root das transações
+        std::cout << "8. MERKLE ROOT" << std::endl;
+        std::cout << "   -------------" << std::endl;
+        
+        std::vector<std::string> tx_hashes;
+        for (int i = 0; i < 5000; i++) {
+            tx_hashes.push_back(crypto->sha256("Transaction " + std::to_string(i)));
+        }
+        std::cout << "   Merkle root (" << tx_hashes.size() << " transações): "
+                  << crypto->merkleRoot(tx_hashes) << std::endl;
+        std::cout << std::endl;
+        
+        // 9. Performance Comparison
+        std::cout << "9. PERFORMANCE COMPARISON" << std::endl;
         std::cout << "   -----------------------" << std::endl;
         
         auto start = std::chrono::high_resolution_clock::now();
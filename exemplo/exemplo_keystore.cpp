@@ -0,0 +1,85 @@
+#include "../include/adilsoncrypto.h"
+#include "../include/adilsoncrypto_keystore.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// Keystore mapeado em memória: criação, abertura, busca por endereço e por
+// chave pública, e tempos de cada etapa
+int main() {
+    std::cout << "🔑 ADILSONCRYPTO - KEYSTORE MAPEADO EM MEMÓRIA" << std::endl;
+    std::cout << "=============================================" << std::endl;
+    std::cout << std::endl;
+
+    AdilsonCrypto* crypto = createAdilsonCrypto();
+    const std::string path = "exemplo_keystore.acks";
+    const std::string passphrase = "senha de demonstração";
+    auto ms = [](std::chrono::high_resolution_clock::duration d) {
+        return std::chrono::duration<double, std::milli>(d).count();
+    };
+
+    try {
+        // 1. Cria o arquivo e grava as chaves (cada add sincroniza com o disco)
+        std::cout << "1. CRIAÇÃO" << std::endl;
+        std::cout << "   --------" << std::endl;
+        const size_t total = 1000;
+        std::vector<KeyPair> keypairs;
+        for (size_t i = 0; i < total; i++) keypairs.push_back(crypto->generateKeyPair());
+
+        auto start = std::chrono::high_resolution_clock::now();
+        {
+            adilsoncrypto::Keystore keystore;
+            if (!keystore.create(path, passphrase, 256)) throw std::runtime_error("não foi possível criar " + path);
+            for (const KeyPair& keypair : keypairs) keystore.add(keypair);
+            std::cout << "   Chaves: " << keystore.size() << " (capacidade " << keystore.capacity() << ")" << std::endl;
+        }
+        std::cout << "   Tempo: " << std::fixed << std::setprecision(2)
+                  << ms(std::chrono::high_resolution_clock::now() - start) << " ms" << std::endl;
+
+        // 2. Abertura: mapeia o arquivo e deriva a chave da senha
+        std::cout << std::endl;
+        std::cout << "2. ABERTURA E BUSCA" << std::endl;
+        std::cout << "   -----------------" << std::endl;
+        adilsoncrypto::Keystore keystore;
+        std::cout << "   Senha errada: " << (keystore.open(path, "errada") ? "ABERTO" : "RECUSADA") << std::endl;
+        start = std::chrono::high_resolution_clock::now();
+        if (!keystore.open(path, passphrase)) throw std::runtime_error("não foi possível abrir " + path);
+        std::cout << "   Abertura: " << ms(std::chrono::high_resolution_clock::now() - start) << " ms" << std::endl;
+
+        const int rounds = 100000;
+        size_t found = 0;
+        start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < rounds; i++) found += keystore.findByAddress(keypairs[i % total].address) != nullptr;
+        auto elapsed = std::chrono::high_resolution_clock::now() - start;
+        std::cout << "   Busca por endereço: " << std::setprecision(0)
+                  << std::chrono::duration<double, std::nano>(elapsed).count() / rounds << " ns (" << found << "/"
+                  << rounds << " encontradas)" << std::endl;
+
+        const KeyPair& sample = keypairs[total / 2];
+        KeyPair loaded;
+        const adilsoncrypto::KeystoreRecord* record = keystore.findByPublicKey(sample.public_key);
+        bool same = record && keystore.load(*record, loaded) && loaded.private_key == sample.private_key &&
+                    loaded.address == sample.address;
+        std::cout << "   Busca por chave pública + decifragem: " << (same ? "✅ confere" : "❌ diverge") << std::endl;
+
+        std::string message = "Pagamento 42";
+        Signature signature = crypto->sign(message, loaded.private_key);
+        std::cout << "   Assinatura com a chave carregada: "
+                  << (crypto->verify(message, signature, loaded.public_key) ? "VÁLIDA" : "INVÁLIDA") << std::endl;
+
+        keystore.close();
+        std::remove(path.c_str());
+
+        std::cout << std::endl;
+        std::cout << "✅ Demonstração do keystore concluída!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Erro: " << e.what() << std::endl;
+    }
+
+    destroyAdilsonCrypto(crypto);
+
+    return 0;
+}
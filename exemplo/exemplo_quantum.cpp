@@ -1,4 +1,5 @@
 #include "../include/adilsoncrypto.h"
+#include "../include/adilsoncrypto_mlkem.h"
 #include <iostream>
 #include <chrono>
 
@@ -31,7 +32,7 @@ int main() {
         std::cout << "   ---------------------------" << std::endl;
         
         auto lattice_key = crypto->generateLatticeKey(1024);
-        std::cout << "   Dimensão do lattice: 1024" << std::endl;
+        std::cout << "   Dimensão do lattice: 1024 (ML-KEM-1024, NTT " << adilsoncrypto::mlKemBackendName() << ")" << std::endl;
         std::cout << "   Chave lattice: " << lattice_key.lattice_key.substr(0, 32) << "..." << std::endl;
         
         std::string lattice_data = "Dados secretos protegidos por lattice cryptography";
@@ -57,8 +58,9 @@ int main() {
         std::cout << "   Mensagem: " << code_message << std::endl;
         
         auto code_signature = crypto->codeSign(code_message, code_key);
-        std::cout << "   Assinatura code-based: " << code_signature.r.substr(0, 32) << "..." << std::endl;
-        std::cout << "   ✅ Assinatura code-based gerada com sucesso!" << std::endl;
+        std::cout << "   Assinatura " << code_signature.v << ": " << code_signature.proof.substr(0, 32) << "... ("
+                  << code_signature.proof.size() / 2 << " bytes)" << std::endl;
+        std::cout << "   ✅ Verificação: " << (crypto->codeVerify(code_message, code_signature) ? "VÁLIDA" : "INVÁLIDA") << std::endl;
         std::cout << std::endl;
         
         // 4. Multivariate Quadratic (MQ)
@@ -0,0 +1,113 @@
+#include "../include/adilsoncrypto.h"
+#include "../include/adilsoncrypto_ring.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+
+// Assinaturas em anel LSAG: demonstração pela interface IMultiSignature e
+// tempos de assinatura/verificação para anéis de 11 a 1024 membros
+int main() {
+    std::cout << "💍 ADILSONCRYPTO - ASSINATURAS EM ANEL (LSAG)" << std::endl;
+    std::cout << "=============================================" << std::endl;
+    std::cout << std::endl;
+
+    AdilsonCrypto* crypto = createAdilsonCrypto();
+
+    try {
+        // 1. Assinatura anônima em um anel de 11 chaves
+        std::cout << "1. ASSINATURA EM ANEL" << std::endl;
+        std::cout << "   -------------------" << std::endl;
+
+        std::vector<KeyPair> keypairs;
+        std::vector<std::string> ring;
+        for (int i = 0; i < 1024; i++) {
+            keypairs.push_back(crypto->generateKeyPair());
+            ring.push_back(keypairs.back().public_key);
+        }
+        std::vector<std::string> small_ring(ring.begin(), ring.begin() + 11);
+
+        auto ring_sig = crypto->createRingSignature(11);
+        std::string message = "Transferência confidencial";
+        auto signature = ring_sig->signRing(message, keypairs[7].private_key, small_ring);
+        std::cout << "   Membros do anel: " << small_ring.size() << std::endl;
+        std::cout << "   Imagem de chave: " << signature.r.substr(0, 32) << "..." << std::endl;
+        std::cout << "   Tamanho: " << signature.proof.size() / 2 << " bytes" << std::endl;
+        std::cout << "   ✅ Verificação: " << (ring_sig->verifyRing(message, signature, small_ring) ? "VÁLIDA" : "INVÁLIDA")
+                  << std::endl;
+        std::cout << "   ❌ Mensagem alterada: "
+                  << (ring_sig->verifyRing(message + "!", signature, small_ring) ? "VÁLIDA" : "INVÁLIDA") << std::endl;
+
+        // 2. Gasto duplo: a mesma chave gera sempre a mesma imagem
+        std::cout << std::endl;
+        std::cout << "2. DETECÇÃO DE GASTO DUPLO" << std::endl;
+        std::cout << "   ------------------------" << std::endl;
+
+        adilsoncrypto::KeyImageSet spent;
+        auto second = ring_sig->signRing("Outra transferência", keypairs[7].private_key, small_ring);
+        std::string first_image, second_image;
+        adilsoncrypto::hexToBytes(signature.r, first_image);
+        adilsoncrypto::hexToBytes(second.r, second_image);
+        std::cout << "   Primeira assinatura aceita: "
+                  << (spent.insert((const uint8_t*)first_image.data()) ? "SIM" : "NÃO") << std::endl;
+        std::cout << "   Segunda assinatura (mesma chave) aceita: "
+                  << (spent.insert((const uint8_t*)second_image.data()) ? "SIM" : "NÃO") << std::endl;
+
+        // 3. Benchmark por tamanho de anel (anel decodificado uma vez)
+        std::cout << std::endl;
+        std::cout << "3. BENCHMARK (threads: " << adilsoncrypto::defaultThreadPool().size() << ")" << std::endl;
+        std::cout << "   --------------------------------" << std::endl;
+        std::cout << "   " << std::setw(8) << "membros" << std::setw(14) << "preparo ms" << std::setw(12) << "sign ms"
+                  << std::setw(12) << "verify ms" << std::setw(12) << "bytes" << std::endl;
+
+        for (size_t size : { 11, 16, 64, 128, 256, 512, 1024 }) {
+            std::vector<std::string> bytes(size);
+            std::vector<adilsoncrypto::ByteView> views(size);
+            for (size_t i = 0; i < size; i++) {
+                adilsoncrypto::hexToBytes(ring[i], bytes[i]);
+                views[i].data = (const uint8_t*)bytes[i].data();
+                views[i].size = bytes[i].size();
+            }
+            std::string private_key;
+            adilsoncrypto::hexToBytes(std::string(64 - keypairs[size / 2].private_key.size(), '0') +
+                                      keypairs[size / 2].private_key, private_key);
+
+            auto start = std::chrono::high_resolution_clock::now();
+            adilsoncrypto::RingContext context;
+            context.init(views);
+            auto prepared = std::chrono::high_resolution_clock::now();
+
+            const int rounds = size <= 64 ? 10 : 2;
+            std::vector<uint8_t> sig;
+            bool valid = true;
+            for (int r = 0; r < rounds; r++) {
+                adilsoncrypto::lsagSign(context, (const uint8_t*)message.data(), message.size(),
+                                        (const uint8_t*)private_key.data(), sig, &adilsoncrypto::defaultThreadPool());
+            }
+            auto signed_at = std::chrono::high_resolution_clock::now();
+            for (int r = 0; r < rounds; r++) {
+                valid = valid && adilsoncrypto::lsagVerify(context, (const uint8_t*)message.data(), message.size(),
+                                                           sig.data(), sig.size(), &adilsoncrypto::defaultThreadPool());
+            }
+            auto verified_at = std::chrono::high_resolution_clock::now();
+
+            auto ms = [](std::chrono::high_resolution_clock::duration d) {
+                return std::chrono::duration<double, std::milli>(d).count();
+            };
+            std::cout << "   " << std::setw(8) << size << std::fixed << std::setprecision(2) << std::setw(14)
+                      << ms(prepared - start) << std::setw(12) << ms(signed_at - prepared) / rounds << std::setw(12)
+                      << ms(verified_at - signed_at) / rounds << std::setw(12) << sig.size()
+                      << (valid ? "" : "  ❌ inválida") << std::endl;
+        }
+
+        std::cout << std::endl;
+        std::cout << "✅ Demonstração de assinaturas em anel concluída!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Erro: " << e.what() << std::endl;
+    }
+
+    destroyAdilsonCrypto(crypto);
+
+    return 0;
+}
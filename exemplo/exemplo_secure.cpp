@@ -0,0 +1,171 @@
+#include "../include/adilsoncrypto.h"
+#include "../include/adilsoncrypto_secp256k1.h"
+#include "../include/adilsoncrypto_secure.h"
+#include "../include/adilsoncrypto_serialize.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+// Contador de alocações do heap geral: malloc/calloc/realloc do processo
+// inteiro (operator new, libstdc++ e OpenSSL incluídos) passam por aqui. Só
+// com a glibc, que permite trocar o malloc no executável.
+#if defined(__GLIBC__)
+#define CONTAGEM_DE_ALOCACOES 1
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+}
+
+static std::atomic<bool> contando{ false };
+static std::atomic<uint64_t> alocacoes{ 0 };
+
+extern "C" void* malloc(size_t size) {
+    if (contando.load(std::memory_order_relaxed)) alocacoes.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+    if (contando.load(std::memory_order_relaxed)) alocacoes.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size) {
+    if (contando.load(std::memory_order_relaxed)) alocacoes.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void* ptr) {
+    __libc_free(ptr);
+}
+#endif
+
+// Alocações no heap geral durante f()
+template <typename F>
+static uint64_t contarAlocacoes(F f) {
+#if defined(CONTAGEM_DE_ALOCACOES)
+    alocacoes.store(0);
+    contando.store(true);
+    f();
+    contando.store(false);
+    return alocacoes.load();
+#else
+    f();
+    return 0;
+#endif
+}
+
+// Arena segura e assinatura secp256k1 sem alocação: confere com o contador
+// de malloc que o caminho quente não toca o heap geral (sai com erro se tocar)
+int main() {
+    std::cout << "🔒 ADILSONCRYPTO - MEMÓRIA SEGURA" << std::endl;
+    std::cout << "================================" << std::endl;
+    std::cout << std::endl;
+
+    AdilsonCrypto* crypto = createAdilsonCrypto();
+    int status = 0;
+    auto us = [](std::chrono::high_resolution_clock::duration d) {
+        return std::chrono::duration<double, std::micro>(d).count();
+    };
+
+    try {
+        // 1. Chave numa página travada da arena
+        std::cout << "1. ARENA" << std::endl;
+        std::cout << "   -----" << std::endl;
+        adilsoncrypto::SecureBuffer secret(adilsoncrypto::SECP256K1_SECRET_BYTES);
+        if (!secret.valid() || !adilsoncrypto::secp256k1RandomSecret(secret.data())) {
+            throw std::runtime_error("não foi possível gerar a chave");
+        }
+        adilsoncrypto::SecureArena::Stats stats = adilsoncrypto::secureArena().stats();
+        std::cout << "   Páginas mapeadas: " << stats.mapped_bytes << " bytes em " << stats.regions << " região(ões)"
+                  << std::endl;
+        std::cout << "   Travadas na RAM: " << stats.locked_bytes << " bytes"
+                  << (adilsoncrypto::secureArena().locked() ? " ✅" : " ⚠️ (limite de mlock do processo)") << std::endl;
+        std::cout << "   Blocos em uso: " << stats.blocks_in_use << " (" << stats.bytes_in_use << " bytes)" << std::endl;
+
+        // 2. Assinatura crua: a primeira chamada da thread pega o rascunho e
+        // monta a tabela do gerador; as seguintes não alocam nada
+        std::cout << std::endl;
+        std::cout << "2. ASSINATURA SEM ALOCAÇÃO" << std::endl;
+        std::cout << "   ----------------------" << std::endl;
+        uint8_t public_key[adilsoncrypto::SECP256K1_PUBLIC_KEY_BYTES];
+        uint8_t digest[32];
+        uint8_t signature[adilsoncrypto::SECP256K1_SIGNATURE_BYTES];
+        adilsoncrypto::sha256Digest((const uint8_t*)"aquecimento", 11, digest);
+        adilsoncrypto::secp256k1PublicKey(secret.data(), public_key);
+        adilsoncrypto::secp256k1SignDigest(secret.data(), digest, signature);
+
+        const int rounds = 2000;
+        bool signed_all = true;
+        auto start = std::chrono::high_resolution_clock::now();
+        uint64_t raw_allocations = contarAlocacoes([&] {
+            for (int i = 0; i < rounds; i++) {
+                digest[0] = (uint8_t)i;
+                digest[1] = (uint8_t)(i >> 8);
+                signed_all &= adilsoncrypto::secp256k1SignDigest(secret.data(), digest, signature);
+            }
+        });
+        double elapsed = us(std::chrono::high_resolution_clock::now() - start);
+        std::cout << "   Assinaturas: " << rounds << " (" << std::fixed << std::setprecision(1) << elapsed / rounds
+                  << " µs cada)" << std::endl;
+#if defined(CONTAGEM_DE_ALOCACOES)
+        std::cout << "   Alocações no heap: " << raw_allocations << (raw_allocations == 0 ? " ✅" : " ❌") << std::endl;
+        if (raw_allocations != 0 || !signed_all) status = 1;
+#else
+        (void)raw_allocations;
+        std::cout << "   Alocações no heap: contagem disponível só com a glibc" << std::endl;
+#endif
+
+        // Confere com o verificador da API de texto (OpenSSL) e o determinismo
+        const std::string message = "mensagem";
+        adilsoncrypto::sha256Digest((const uint8_t*)message.data(), message.size(), digest);
+        uint8_t again[adilsoncrypto::SECP256K1_SIGNATURE_BYTES];
+        adilsoncrypto::secp256k1SignDigest(secret.data(), digest, signature);
+        adilsoncrypto::secp256k1SignDigest(secret.data(), digest, again);
+        Signature check;
+        check.r = adilsoncrypto::scalarToHex(signature, 32);
+        check.s = adilsoncrypto::scalarToHex(signature + 32, 32);
+        check.v = "1b";
+        check.proof = "valid";
+        bool valid = crypto->verify(message, check, adilsoncrypto::scalarToHex(public_key, sizeof(public_key)));
+        std::cout << "   Verificação: " << (valid ? "✅" : "❌") << std::endl;
+        std::cout << "   Nonce RFC 6979: "
+                  << (std::equal(signature, signature + sizeof(signature), again) ? "mesma assinatura para o mesmo digest ✅"
+                                                                                  : "❌")
+                  << std::endl;
+        if (!valid) status = 1;
+
+        // 3. A API de texto: só as strings do resultado vão para o heap
+        std::cout << std::endl;
+        std::cout << "3. API DE TEXTO" << std::endl;
+        std::cout << "   ------------" << std::endl;
+        KeyPair keypair = crypto->generateKeyPair();
+        Signature text_signature = crypto->sign(message, keypair.private_key);
+        uint64_t text_allocations = contarAlocacoes([&] { text_signature = crypto->sign(message, keypair.private_key); });
+        std::cout << "   Verificação: " << (crypto->verify(message, text_signature, keypair.public_key) ? "✅" : "❌")
+                  << std::endl;
+#if defined(CONTAGEM_DE_ALOCACOES)
+        std::cout << "   Alocações por sign(): " << text_allocations << " (texto de r e s)" << std::endl;
+#else
+        (void)text_allocations;
+#endif
+        std::cout << "   Blocos da arena em uso: " << adilsoncrypto::secureArena().stats().blocks_in_use << std::endl;
+
+        std::cout << std::endl;
+        std::cout << (status == 0 ? "✅ Demonstração de memória segura concluída!" : "❌ Demonstração de memória segura falhou")
+                  << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Erro: " << e.what() << std::endl;
+        status = 1;
+    }
+
+    destroyAdilsonCrypto(crypto);
+
+    return status;
+}
@@ -0,0 +1,99 @@
+#include "../include/adilsoncrypto.h"
+#include "../include/adilsoncrypto_goldilocks.h"
+#include "../include/adilsoncrypto_stark.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+
+// STARK sobre Goldilocks: prova pela interface IZeroKnowledge, tempos da NTT
+// de 2^10 a 2^24 e do provador FRI por tamanho de traço
+int main() {
+    std::cout << "⭐ ADILSONCRYPTO - ZK-STARK (GOLDILOCKS + FRI)" << std::endl;
+    std::cout << "=============================================" << std::endl;
+    std::cout << std::endl;
+
+    AdilsonCrypto* crypto = createAdilsonCrypto();
+
+    auto ms = [](std::chrono::steady_clock::duration d) {
+        return std::chrono::duration<double, std::milli>(d).count();
+    };
+
+    try {
+        // 1. Prova de uma computação de 1024 passos
+        std::cout << "1. PROVA STARK" << std::endl;
+        std::cout << "   -----------" << std::endl;
+
+        auto stark = crypto->createZKSTARK();
+        std::string computation = "fibonacci:1024";
+        auto proof = stark->proveSTARK(computation);
+        std::cout << "   Computação: " << computation << std::endl;
+        std::cout << "   Entradas públicas: " << proof.public_inputs << std::endl;
+        std::cout << "   Tamanho: " << proof.proof_data.size() / 2 << " bytes" << std::endl;
+        std::cout << "   ✅ Verificação: " << (stark->verifySTARK(computation, proof) ? "VÁLIDA" : "INVÁLIDA")
+                  << std::endl;
+
+        ZKProof forged = proof;
+        forged.public_inputs += "1";
+        std::cout << "   ❌ Resultado alterado: " << (stark->verifySTARK(computation, forged) ? "VÁLIDA" : "INVÁLIDA")
+                  << std::endl;
+
+        // 2. NTT de Goldilocks
+        adilsoncrypto::ThreadPool& pool = adilsoncrypto::defaultThreadPool();
+        std::cout << std::endl;
+        std::cout << "2. BENCHMARK NTT (threads: " << pool.size() << ")" << std::endl;
+        std::cout << "   ------------------------" << std::endl;
+        std::cout << "   " << std::setw(8) << "log n" << std::setw(14) << "ntt ms" << std::setw(14) << "intt ms"
+                  << std::setw(16) << "ns/elem/nível" << std::endl;
+
+        for (unsigned log_n = 10; log_n <= 24; log_n += 2) {
+            size_t n = (size_t)1 << log_n;
+            std::vector<uint64_t> values(n);
+            for (size_t i = 0; i < n; i++) values[i] = adilsoncrypto::glMul(i + 1, 0x9E3779B97F4A7C15ULL);
+            std::vector<uint64_t> original = values;
+
+            const int rounds = log_n <= 16 ? 20 : (log_n <= 20 ? 3 : 1);
+            auto start = std::chrono::steady_clock::now();
+            for (int r = 0; r < rounds; r++) adilsoncrypto::glNtt(values.data(), log_n, &pool);
+            auto forward = std::chrono::steady_clock::now();
+            for (int r = 0; r < rounds; r++) adilsoncrypto::glInverseNtt(values.data(), log_n, &pool);
+            auto inverse = std::chrono::steady_clock::now();
+
+            double ntt_ms = ms(forward - start) / rounds;
+            std::cout << "   " << std::setw(8) << log_n << std::fixed << std::setprecision(2) << std::setw(14) << ntt_ms
+                      << std::setw(14) << ms(inverse - forward) / rounds << std::setw(16)
+                      << ntt_ms * 1e6 / ((double)n * log_n) << (values == original ? "" : "  ❌ divergente")
+                      << std::endl;
+        }
+
+        // 3. Provador e verificador por tamanho de traço
+        std::cout << std::endl;
+        std::cout << "3. BENCHMARK PROVADOR" << std::endl;
+        std::cout << "   -------------------" << std::endl;
+        std::cout << "   " << std::setw(8) << "passos" << std::setw(14) << "prova ms" << std::setw(14) << "verifica ms"
+                  << std::setw(12) << "bytes" << std::endl;
+
+        for (unsigned log_trace = 10; log_trace <= 18; log_trace += 2) {
+            uint64_t result = 0;
+            std::vector<uint8_t> bytes;
+            auto start = std::chrono::steady_clock::now();
+            adilsoncrypto::starkProveFibonacci(0, 1, log_trace, result, bytes, &pool);
+            auto proved = std::chrono::steady_clock::now();
+            bool valid = adilsoncrypto::starkVerifyFibonacci(0, 1, log_trace, result, bytes.data(), bytes.size());
+            auto verified = std::chrono::steady_clock::now();
+            std::cout << "   " << std::setw(8) << ((size_t)1 << log_trace) << std::setw(14) << ms(proved - start)
+                      << std::setw(14) << ms(verified - proved) << std::setw(12) << bytes.size()
+                      << (valid ? "" : "  ❌ inválida") << std::endl;
+        }
+
+        std::cout << std::endl;
+        std::cout << "✅ Demonstração de ZK-STARK concluída!" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "❌ Erro: " << e.what() << std::endl;
+    }
+
+    destroyAdilsonCrypto(crypto);
+
+    return 0;
+}
@@ -1,10 +1,12 @@
 #ifndef ADILSONCRYPTO_H
 #define ADILSONCRYPTO_H
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <memory>
 #include <functional>
+#include "adilsoncrypto_async.h"
 
 // Estruturas de dados avançadas
 struct KeyPair {
@@ -66,8 +68,11 @@ public:
     virtual std::string latticeDecrypt(const std::string& encrypted, const QuantumKey& key) = 0;
     virtual QuantumKey generateCodeKey(int code_length) = 0;
     virtual Signature codeSign(const std::string& message, const QuantumKey& key) = 0;
+    // Padrão para implementações anteriores à verificação: não verifica nada
+    virtual bool codeVerify(const std::string& /*message*/, const Signature& /*signature*/) { return false; }
     virtual QuantumKey generateMQKey(int variables) = 0;
     virtual ZKProof mqProve(const std::string& statement, const QuantumKey& key) = 0;
+    virtual bool mqVerify(const ZKProof& /*proof*/) { return false; }
 };
 
 class IZeroKnowledge {
@@ -104,6 +109,15 @@ public:
     virtual HomomorphicData encrypt(int value) = 0;
     virtual HomomorphicData add(const HomomorphicData& a, const HomomorphicData& b) = 0;
     virtual HomomorphicData multiply(const HomomorphicData& a, const HomomorphicData& b) = 0;
+    // Padrão para implementações anteriores: vazio (não suportado)
+    virtual HomomorphicData multiplyScalar(const HomomorphicData& /*a*/, int /*scalar*/) { return HomomorphicData(); }
+    // Soma de muitos valores cifrados (agregação em lote); o padrão encadeia add()
+    virtual HomomorphicData sum(const std::vector<HomomorphicData>& values) {
+        if (values.empty()) return HomomorphicData();
+        HomomorphicData total = values[0];
+        for (size_t i = 1; i < values.size(); i++) total = add(total, values[i]);
+        return total;
+    }
     virtual int decrypt(const HomomorphicData& encrypted) = 0;
 };
 
@@ -132,16 +146,27 @@ public:
     virtual std::unique_ptr<IBlockchainInterface> createSolanaInterface() = 0;
 };
 
-// Classe principal AdilsonCrypto
+namespace adilsoncrypto {
+template <typename T>
+class RcuCell;
+class Logger;
+}
+
+// Classe principal AdilsonCrypto. Pode ser usada por várias threads ao mesmo
+// tempo: o estado de rascunho do OpenSSL é por thread e a troca de curva
+// (setCurrentCurve) não bloqueia quem está assinando ou verificando.
 class AdilsonCrypto {
 private:
-    std::unique_ptr<IEllipticCurve> current_curve;
+    std::unique_ptr<adilsoncrypto::Logger> logger;   // declarado primeiro: é destruído por último
+    std::unique_ptr<adilsoncrypto::RcuCell<IEllipticCurve>> current_curve;
     std::unique_ptr<IQuantumCrypto> quantum_crypto;
     std::unique_ptr<IZeroKnowledge> zk_proofs;
     std::unique_ptr<IMultiSignature> multi_sig;
     std::unique_ptr<IHomomorphicEncryption> homomorphic;
     std::unique_ptr<IHardwareAccelerator> hardware;
     std::unique_ptr<IBlockchainInterface> blockchain;
+    std::unique_ptr<adilsoncrypto::AsyncScope> async_scope;   // operações assíncronas em andamento
+    std::atomic<int> hash_algorithm;                           // escolhido em setHashAlgorithm
 
 public:
     AdilsonCrypto();
@@ -152,12 +177,33 @@ public:
     Signature sign(const std::string& message, const std::string& private_key);
     bool verify(const std::string& message, const Signature& signature, const std::string& public_key);
     std::string getAddress(const std::string& public_key);
+    // Endereços de muitas chaves; na secp256k1 o hash160 (SHA-256 e
+    // RIPEMD-160) e os checksums rodam nos kernels multi-lane
+    std::vector<std::string> getAddresses(const std::vector<std::string>& public_keys);
 
     // Curvas elípticas
     std::unique_ptr<IEllipticCurve> createCurve(const std::string& curve_name);
     std::unique_ptr<IEllipticCurve> createCustomCurve(const std::string& p, const std::string& a, const std::string& b);
+    // Publica a nova curva; chamadas em andamento terminam com a anterior,
+    // que é destruída quando a última delas sai
     void setCurrentCurve(std::unique_ptr<IEllipticCurve> curve);
 
+    // Operações assíncronas (adilsoncrypto_async.h): voltam na hora e rodam no
+    // despachante da biblioteca, que junta as requisições concorrentes num lote
+    // (SHA-256 multi-buffer das mensagens, assinaturas e verificações no pool).
+    // Consuma o resultado com get(), future(), then(callback) ou co_await; o
+    // destrutor espera as operações desta instância terminarem.
+    adilsoncrypto::AsyncResult<Signature> signAsync(const std::string& message, const std::string& private_key);
+    adilsoncrypto::AsyncResult<bool> verifyAsync(const std::string& message, const Signature& signature,
+                                                 const std::string& public_key);
+    adilsoncrypto::AsyncResult<std::string> hashAsync(const std::string& data);   // sha256
+    adilsoncrypto::AsyncResult<std::vector<Signature>> signBatchAsync(const std::vector<std::string>& messages,
+                                                                      const std::string& private_key);
+    adilsoncrypto::AsyncResult<std::vector<bool>> verifyBatchAsync(const std::vector<std::string>& messages,
+                                                                   const std::vector<Signature>& signatures,
+                                                                   const std::vector<std::string>& public_keys);
+    adilsoncrypto::AsyncResult<std::vector<std::string>> hashBatchAsync(const std::vector<std::string>& data);
+
     // Criptografia quântica
     QuantumKey generatePostQuantumKey();
     std::string quantumEncrypt(const std::string& data, const QuantumKey& key);
@@ -166,9 +212,12 @@ public:
     std::string latticeEncrypt(const std::string& data, const QuantumKey& key);
     std::string latticeDecrypt(const std::string& encrypted, const QuantumKey& key);
     QuantumKey generateCodeKey(int code_length);
+    // SLH-DSA (FIPS 205): SHA2 em code*, SHAKE em mq*
     Signature codeSign(const std::string& message, const QuantumKey& key);
+    bool codeVerify(const std::string& message, const Signature& signature);
     QuantumKey generateMQKey(int variables);
     ZKProof mqProve(const std::string& statement, const QuantumKey& key);
+    bool mqVerify(const ZKProof& proof);
 
     // Zero-Knowledge Proofs
     std::unique_ptr<IZeroKnowledge> createZKSNARK();
@@ -198,31 +247,52 @@ public:
     std::string sha512(const std::string& data);
     std::string ripemd160(const std::string& data);
     std::string keccak256(const std::string& data);
+    // BLAKE3 com SIMD por chunk; entradas grandes usam o pool de threads
+    std::string blake3(const std::string& data);
+    // Modo keyed_hash; chave de 32 bytes em hex ("" se inválida)
+    std::string blake3Keyed(const std::string& data, const std::string& key);
+    // Hash com o algoritmo de setHashAlgorithm (sha256 por padrão)
+    std::string hash(const std::string& data);
     std::string randomBytes(int length);
     std::string base58Encode(const std::string& data);
     std::string base58Decode(const std::string& encoded);
     std::string hexEncode(const std::string& data);
     std::string hexDecode(const std::string& hex);
+    // Raiz Merkle SHA256d (estilo Bitcoin) de folhas em hex de 64 dígitos
+    std::string merkleRoot(const std::vector<std::string>& leaf_hashes);
 
     // Benchmark e performance
     void runBenchmark();
     void setOptimizationLevel(int level);
     void enableHardwareAcceleration(bool enable);
+    // Tamanho do pool das APIs em lote (<= 0: número de núcleos)
     void setThreadCount(int threads);
 
     // Configuração
     void setSecurityLevel(int bits);
     void setCurveType(const std::string& type);
+    // Um dos HASH_*; nomes desconhecidos são registrados e ignorados
     void setHashAlgorithm(const std::string& algorithm);
+    std::string getHashAlgorithm() const;
     void setRandomSource(const std::string& source);
 
-    // Logging e debug
+    // Logging e debug (adilsoncrypto_log.h): registro assíncrono por thread,
+    // linhas em stderr e histórico das últimas 1024 em getLogs(). O banner do
+    // construtor só aparece com a variável de ambiente ADILSONCRYPTO_BANNER=1.
     void enableLogging(bool enable);
+    // "trace", "debug", "info" (padrão), "warn", "error" ou "off"
     void setLogLevel(const std::string& level);
-    void log(const std::string& message);
+    void log(const std::string& message);                             // nível info
+    void log(const std::string& level, const std::string& message);
     void clearLogs();
     std::vector<std::string> getLogs();
 
+    // Métricas (adilsoncrypto_metrics.h): contagem, bytes e histograma de
+    // latência de cada operação pública, somados entre todas as instâncias e
+    // threads do processo. getMetrics() devolve o texto no formato do Prometheus.
+    void enableMetrics(bool enable);
+    std::string getMetrics();
+
     // Validação e testes
     bool validateKeyPair(const KeyPair& keypair);
     bool validateSignature(const Signature& signature);
@@ -235,6 +305,10 @@ public:
     KeyPair deserializeKeyPair(const std::string& serialized);
     std::string serializeSignature(const Signature& signature);
     Signature deserializeSignature(const std::string& serialized);
+    std::string serializeSignatureDer(const Signature& signature);
+    // Lote binário (adilsoncrypto_serialize.h); "" / vazio se algum item não for ECDSA
+    std::string serializeSignatures(const std::vector<Signature>& signatures);
+    std::vector<Signature> deserializeSignatures(const std::string& serialized);
 
     // Criptografia simétrica
     std::string aesEncrypt(const std::string& data, const std::string& key);
@@ -246,6 +320,8 @@ public:
     std::string pbkdf2(const std::string& password, const std::string& salt, int iterations, int key_length);
     std::string scrypt(const std::string& password, const std::string& salt, int n, int r, int p, int key_length);
     std::string argon2(const std::string& password, const std::string& salt, int iterations, int memory, int parallelism, int key_length);
+    // Modo derive_key do BLAKE3: key_length bytes em hex ("" se key_length <= 0)
+    std::string blake3DeriveKey(const std::string& context, const std::string& material, int key_length);
 
     // Funções de compromisso
     std::string pedersenCommit(const std::string& value, const std::string& blinding);
@@ -267,6 +343,7 @@ const int SECURITY_LEVEL_384 = 384;
 const int SECURITY_LEVEL_512 = 512;
 
 const std::string CURVE_SECP256K1 = "secp256k1";
+const std::string CURVE_SECP256R1 = "secp256r1";
 const std::string CURVE_SECP384R1 = "secp384r1";
 const std::string CURVE_SECP521R1 = "secp521r1";
 const std::string CURVE_BRAINPOOLP512T1 = "brainpoolP512t1";
@@ -275,5 +352,6 @@ const std::string HASH_SHA256 = "sha256";
 const std::string HASH_SHA512 = "sha512";
 const std::string HASH_RIPEMD160 = "ripemd160";
 const std::string HASH_KECCAK256 = "keccak256";
+const std::string HASH_BLAKE3 = "blake3";
 
 #endif // ADILSONCRYPTO_H 
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef ADILSONCRYPTO_ADDRESSSET_H
+#define ADILSONCRYPTO_ADDRESSSET_H
+
+#include "adilsoncrypto_util.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace adilsoncrypto {
+
+struct MappedFile;
+
+// Lista de observação de endereços (a saída de getAddress, ou qualquer texto
+// de até 255 bytes) para varrer fluxos de transações contra milhões de
+// endereços. São duas camadas:
+//   - um filtro binary fuse de 8 bits (3 posições por chave, ~9 bits por
+//     endereço): quase todo endereço de fora é descartado com três leituras
+//     de um byte e nenhuma comparação de texto. Com 20M endereços o filtro
+//     tem ~23MB e fica quente no cache/RAM;
+//   - atrás dele, uma tabela de endereçamento aberto com etiqueta de 32 bits
+//     e os textos num bloco contíguo, consultada só para os ~0,4% de falsos
+//     positivos do filtro e para os acertos. A resposta é exata.
+//
+// O formato em memória é o mesmo do arquivo: open mapeia o arquivo só para
+// leitura e consulta direto no mapeamento, sem copiar nem reconstruir nada.
+// As consultas são const e seguras entre threads; build, open e close exigem
+// acesso exclusivo.
+class AddressSet {
+public:
+    AddressSet();
+    ~AddressSet();
+
+    AddressSet(const AddressSet&) = delete;
+    AddressSet& operator=(const AddressSet&) = delete;
+
+    // Monta o conjunto em memória (repetidos contam uma vez). Falha se algum
+    // endereço for vazio ou maior que 255 bytes.
+    bool build(const std::vector<std::string>& addresses);
+    // Grava num temporário e troca por rename
+    bool save(const std::string& path) const;
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return data != nullptr; }
+    uint64_t size() const;
+    // Bytes do filtro (a parte que precisa ficar em memória)
+    uint64_t filterBytes() const;
+    // Bytes do arquivo inteiro (cabeçalho, filtro, tabela e textos)
+    uint64_t totalBytes() const { return data_bytes; }
+
+    bool contains(const std::string& address) const { return contains(address.data(), address.size()); }
+    bool contains(const char* address, size_t len) const;
+
+    // out[i] = 1 se addresses[i] está na lista, senão 0. Processa em blocos:
+    // calcula os hashes do bloco, adianta (prefetch) as linhas do filtro e só
+    // então as lê, de modo que as faltas de cache se sobrepõem em vez de se
+    // somarem; a tabela exata só é tocada pelos que passam no filtro.
+    void containsBatch(const ByteView* addresses, size_t count, uint8_t* out) const;
+    void containsBatch(const std::string* addresses, size_t count, uint8_t* out) const;
+
+private:
+    bool attach(const uint8_t* bytes, uint64_t len);
+    bool exactMatch(uint64_t key, const char* address, size_t len) const;
+
+    std::vector<uint64_t> owned;        // conjunto montado por build
+    std::unique_ptr<MappedFile> file;   // ou aberto por open
+    const uint8_t* data;
+    uint64_t data_bytes;
+
+    // Copiados do cabeçalho para não o reler a cada consulta
+    uint64_t count;
+    uint64_t hash_seed;
+    uint64_t filter_seed;
+    uint32_t segment_length;
+    uint32_t segment_length_mask;
+    uint32_t segment_count_length;
+    uint32_t array_length;
+    uint64_t slot_mask;
+    uint64_t arena_bytes;
+    const uint8_t* fingerprints;
+    const uint64_t* slots;
+    const uint8_t* arena;
+};
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_ADDRESSSET_H
@@ -0,0 +1,266 @@
+#ifndef ADILSONCRYPTO_ASYNC_H
+#define ADILSONCRYPTO_ASYNC_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#define ADILSONCRYPTO_COROUTINES 1
+#endif
+#endif
+
+namespace adilsoncrypto {
+
+// Conclusões entregues a um laço de eventos. Cada conclusão postada soma no
+// eventfd (Linux); o laço registra fd() no epoll e, quando ele fica legível,
+// chama poll(), que roda as conclusões pendentes na própria thread do laço.
+// Fora do Linux fd() é -1 e o laço chama poll() periodicamente ou usa wait().
+class CompletionQueue {
+public:
+    CompletionQueue();
+    ~CompletionQueue();
+
+    CompletionQueue(const CompletionQueue&) = delete;
+    CompletionQueue& operator=(const CompletionQueue&) = delete;
+
+    int fd() const { return event_fd; }
+    void post(std::function<void()> completion);
+    // Roda o que estiver pendente e retorna quantas rodaram; não bloqueia
+    size_t poll();
+    // Espera até haver alguma conclusão (ou timeout_ms, < 0 sem limite) e roda
+    size_t wait(int timeout_ms = -1);
+
+private:
+    std::mutex mutex;
+    std::condition_variable posted;
+    std::vector<std::function<void()>> pending;
+    int event_fd;
+};
+
+// Estado compartilhado de uma operação assíncrona: o despachante grava o
+// valor e chama complete(); quem espera usa uma das formas de AsyncResult
+class AsyncStateBase {
+public:
+    // Marca como pronto, acorda quem espera e roda (ou posta) a continuação
+    void complete();
+    bool ready() const;
+    void wait() const;
+    // A continuação roda quando a operação terminar: na thread do
+    // despachante, ou na do laço se houver fila. Retorna false se a operação
+    // já tinha terminado e não há fila, caso em que ela não foi guardada.
+    bool setContinuation(std::function<void()> continuation);
+    void setQueue(CompletionQueue* queue);
+
+private:
+    mutable std::mutex mutex;
+    mutable std::condition_variable finished;
+    bool done = false;
+    CompletionQueue* queue = nullptr;
+    std::function<void()> continuation;
+};
+
+template <typename T>
+struct AsyncState : AsyncStateBase {
+    T value{};
+};
+
+// Resultado de uma operação assíncrona da AdilsonCrypto. Consuma uma vez só,
+// de uma destas formas:
+//   - get(): espera e devolve o valor;
+//   - future(): std::future<T> para quem já trabalha com eles;
+//   - then(callback): o callback recebe o valor quando a operação terminar;
+//   - co_await (C++20): a corrotina é retomada quando a operação terminar.
+// Sem via(), callbacks e corrotinas rodam na thread do despachante, que é a
+// mesma para todas as operações: devem ser curtos e nunca esperar (get,
+// future().get()) outra operação assíncrona. Com via(fila) eles rodam em
+// fila.poll(), na thread do laço de eventos.
+template <typename T>
+class AsyncResult {
+public:
+    AsyncResult() = default;
+    explicit AsyncResult(std::shared_ptr<AsyncState<T>> state) : state(std::move(state)) {}
+
+    bool valid() const { return state != nullptr; }
+    bool ready() const { return state->ready(); }
+    void wait() const { state->wait(); }
+
+    T get() {
+        state->wait();
+        return std::move(state->value);
+    }
+
+    AsyncResult& via(CompletionQueue& queue) {
+        state->setQueue(&queue);
+        return *this;
+    }
+
+    void then(std::function<void(T)> callback) {
+        std::shared_ptr<AsyncState<T>> s = state;
+        auto run = [s, callback]() { callback(std::move(s->value)); };
+        if (!state->setContinuation(run)) run();
+    }
+
+    std::future<T> future() {
+        auto promise = std::make_shared<std::promise<T>>();
+        std::future<T> result = promise->get_future();
+        then([promise](T value) { promise->set_value(std::move(value)); });
+        return result;
+    }
+
+#if defined(ADILSONCRYPTO_COROUTINES)
+    bool await_ready() const { return false; }
+    bool await_suspend(std::coroutine_handle<> handle) {
+        return state->setContinuation([handle]() { handle.resume(); });
+    }
+    T await_resume() { return std::move(state->value); }
+#endif
+
+private:
+    std::shared_ptr<AsyncState<T>> state;
+};
+
+// Operações em andamento de um dono (uma instância da AdilsonCrypto): o
+// destrutor do dono chama waitIdle para que nenhuma operação use a instância
+// depois de destruída
+class AsyncScope {
+public:
+    void enter(size_t count = 1);
+    void leave();
+    void waitIdle();
+
+private:
+    std::mutex mutex;
+    std::condition_variable idle;
+    size_t pending = 0;
+};
+
+// Unidade de trabalho do despachante. 'input' (se hash_input) entra no SHA-256
+// em lote de todas as requisições que chegaram juntas; run recebe o digest
+// (ou nullptr) numa thread do pool; complete roda depois, na thread do
+// despachante, na ordem de chegada.
+struct AsyncJob {
+    virtual ~AsyncJob() = default;
+    virtual void run(const uint8_t* digest) = 0;
+    virtual void complete() = 0;
+
+    std::string input;
+    bool hash_input = false;
+};
+
+// Operação de um valor: work(digest) numa thread do pool
+template <typename T>
+class ValueJob : public AsyncJob {
+public:
+    ValueJob(std::shared_ptr<AsyncState<T>> state, AsyncScope* scope, std::function<T(const uint8_t*)> work)
+        : state(std::move(state)), scope(scope), work(std::move(work)) {}
+
+    void run(const uint8_t* digest) override { result = work(digest); }
+    void complete() override {
+        state->value = std::move(result);
+        // Sai do escopo antes: a continuação pode destruir o dono
+        if (scope) scope->leave();
+        state->complete();
+    }
+
+private:
+    std::shared_ptr<AsyncState<T>> state;
+    AsyncScope* scope;
+    std::function<T(const uint8_t*)> work;
+    T result{};
+};
+
+// Item 'index' de um lote: o resultado vai para value[index] em complete()
+// (sempre na thread do despachante, então nem vector<bool> dá corrida) e o
+// lote fica pronto quando o último item termina
+template <typename T>
+class BatchItemJob : public AsyncJob {
+public:
+    struct Shared {
+        std::shared_ptr<AsyncState<std::vector<T>>> state;
+        std::function<T(size_t, const uint8_t*)> work;
+        size_t remaining;
+    };
+
+    BatchItemJob(std::shared_ptr<Shared> shared, AsyncScope* scope, size_t index)
+        : shared(std::move(shared)), scope(scope), index(index) {}
+
+    void run(const uint8_t* digest) override { result = shared->work(index, digest); }
+    void complete() override {
+        shared->state->value[index] = std::move(result);
+        if (scope) scope->leave();
+        if (--shared->remaining == 0) shared->state->complete();
+    }
+
+private:
+    std::shared_ptr<Shared> shared;
+    AsyncScope* scope;
+    size_t index;
+    T result{};
+};
+
+// Despachante da biblioteca: uma thread junta tudo o que chegou enquanto o
+// lote anterior era processado (sem janela de espera: a primeira requisição
+// sai sozinha, as concorrentes se agrupam), calcula os SHA-256 do lote de
+// uma vez com o kernel multi-buffer e reparte o resto no pool compartilhado
+// (defaultThreadPool).
+void submitAsync(std::vector<std::unique_ptr<AsyncJob>> jobs);
+
+template <typename T>
+AsyncResult<T> submitAsyncValue(AsyncScope* scope, std::string input, bool hash_input,
+                                std::function<T(const uint8_t*)> work) {
+    auto state = std::make_shared<AsyncState<T>>();
+    std::vector<std::unique_ptr<AsyncJob>> jobs;
+    jobs.push_back(std::make_unique<ValueJob<T>>(state, scope, std::move(work)));
+    jobs.back()->input = std::move(input);
+    jobs.back()->hash_input = hash_input;
+    if (scope) scope->enter();
+    submitAsync(std::move(jobs));
+    return AsyncResult<T>(state);
+}
+
+// Um job por entrada; work(i, digest) produz o i-ésimo resultado
+template <typename T>
+AsyncResult<std::vector<T>> submitAsyncBatch(AsyncScope* scope, std::vector<std::string> inputs, bool hash_input,
+                                             std::function<T(size_t, const uint8_t*)> work) {
+    auto state = std::make_shared<AsyncState<std::vector<T>>>();
+    state->value.resize(inputs.size());
+    if (inputs.empty()) {
+        state->complete();
+        return AsyncResult<std::vector<T>>(state);
+    }
+    auto shared = std::make_shared<typename BatchItemJob<T>::Shared>();
+    shared->state = state;
+    shared->work = std::move(work);
+    shared->remaining = inputs.size();
+    std::vector<std::unique_ptr<AsyncJob>> jobs;
+    jobs.reserve(inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+        jobs.push_back(std::make_unique<BatchItemJob<T>>(shared, scope, i));
+        jobs.back()->input = std::move(inputs[i]);
+        jobs.back()->hash_input = hash_input;
+    }
+    if (scope) scope->enter(jobs.size());
+    submitAsync(std::move(jobs));
+    return AsyncResult<std::vector<T>>(state);
+}
+
+// Lotes fechados até agora e requisições neles (para medir o agrupamento)
+struct AsyncStats {
+    uint64_t batches = 0;
+    uint64_t jobs = 0;
+};
+AsyncStats asyncStats();
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_ASYNC_H
@@ -0,0 +1,86 @@
+#ifndef ADILSONCRYPTO_BENCH_H
+#define ADILSONCRYPTO_BENCH_H
+
+#include "adilsoncrypto.h"
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace adilsoncrypto {
+
+// Uma operação medida. 'run' é chamada em laço por várias threads ao mesmo
+// tempo, então não pode alterar estado compartilhado; 'bytes' > 0 (tamanho
+// da entrada) acrescenta a vazão em MB/s ao resultado.
+struct BenchCase {
+    std::string name;       // "grupo/operação[/tamanho]", ex.: "hash/sha256/4096"
+    size_t bytes = 0;
+    std::function<void()> run;
+};
+
+struct BenchConfig {
+    std::vector<unsigned> threads;   // vazio: 1, 2, 4, ... até hardware_concurrency
+    unsigned samples = 30;           // amostras por thread
+    double warmup_ms = 100;          // aquecimento (também calibra o lote)
+    double sample_ms = 10;           // duração alvo de uma amostra
+    std::string filter;              // só casos cujo nome contém o texto
+};
+
+// Estatísticas por operação: o tempo de cada amostra é dividido pelo lote,
+// então mean/p50/p99 são latências por chamada; ops_per_sec soma todas as
+// threads sobre o tempo de parede da rodada.
+struct BenchResult {
+    std::string name;
+    unsigned threads = 1;
+    size_t samples = 0;
+    size_t batch = 0;
+    size_t bytes = 0;
+    double mean_ns = 0;
+    double p50_ns = 0;
+    double p99_ns = 0;
+    double ops_per_sec = 0;
+    double mb_per_sec = 0;
+};
+
+// Ambiente da medição, exportado junto com os resultados para que o CI
+// compare execuções de commits diferentes na mesma máquina
+struct BenchMetadata {
+    std::vector<std::pair<std::string, std::string>> fields;
+
+    void set(const std::string& key, const std::string& value);
+    std::string get(const std::string& key) const;
+};
+
+// CPU (modelo e extensões), núcleos, SO, compilador, OpenSSL, backends SIMD
+// escolhidos e data/hora UTC
+BenchMetadata collectBenchMetadata();
+
+class BenchHarness {
+public:
+    void add(const std::string& name, std::function<void()> run, size_t bytes = 0);
+    void add(BenchCase bench_case);
+    const std::vector<BenchCase>& cases() const { return bench_cases; }
+
+    // 'progress' (opcional) recebe cada resultado assim que fica pronto
+    std::vector<BenchResult> run(const BenchConfig& config,
+                                 const std::function<void(const BenchResult&)>& progress = nullptr) const;
+
+private:
+    std::vector<BenchCase> bench_cases;
+};
+
+// Casos padrão: chaves/assinaturas (secp256k1, Ed25519, ML-KEM), todos os
+// hashes (API em hex e digest direto, 64 B e 4 KiB), cifras e KDFs da
+// AdilsonCrypto. 'crypto' precisa viver enquanto o harness for usado.
+void addStandardBenchmarks(BenchHarness& harness, AdilsonCrypto& crypto);
+
+std::string benchToJson(const std::vector<BenchResult>& results, const BenchMetadata& metadata);
+// CSV com cabeçalho; os metadados vão em linhas de comentário "# chave: valor"
+std::string benchToCsv(const std::vector<BenchResult>& results, const BenchMetadata& metadata);
+// Tabela legível para o terminal
+std::string benchToTable(const std::vector<BenchResult>& results);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_BENCH_H
@@ -0,0 +1,107 @@
+#ifndef ADILSONCRYPTO_BITCOIN_H
+#define ADILSONCRYPTO_BITCOIN_H
+
+#include "adilsoncrypto.h"
+#include "adilsoncrypto_miner.h"
+#include "adilsoncrypto_util.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace adilsoncrypto {
+
+struct TxInputView {
+    const uint8_t* outpoint = nullptr;  // txid (32) + vout (4), serializados
+    ByteView script_sig;
+    uint32_t sequence = 0;
+    std::vector<ByteView> witness;
+};
+
+struct TxOutputView {
+    int64_t value = 0;
+    ByteView script_pubkey;
+    ByteView serialized;                // valor + script, como no hashOutputs
+};
+
+// Transação decodificada sem cópia: todas as views apontam para o buffer
+// passado a parseTransaction, que precisa continuar vivo.
+struct TransactionView {
+    int32_t version = 0;
+    uint32_t locktime = 0;
+    bool segwit = false;
+    std::vector<TxInputView> inputs;
+    std::vector<TxOutputView> outputs;
+};
+
+bool parseTransaction(const uint8_t* data, size_t size, TransactionView& tx);
+
+// Saída gasta por uma entrada (necessária para BIP143/BIP341)
+struct SpentOutput {
+    int64_t amount = 0;
+    std::string script_pubkey;
+};
+
+const uint32_t SIGHASH_DEFAULT = 0x00;  // apenas taproot
+const uint32_t SIGHASH_ALL = 0x01;
+const uint32_t SIGHASH_NONE = 0x02;
+const uint32_t SIGHASH_SINGLE = 0x03;
+const uint32_t SIGHASH_ANYONECANPAY = 0x80;
+
+// Cálculo de sighash com pré-computações por transação.
+// hashPrevouts, hashSequence, hashOutputs (e, para BIP341, sha_amounts e
+// sha_scriptpubkeys) são calculados uma única vez, então assinar ou verificar
+// as N entradas custa O(N) no total em vez de O(N^2).
+class SighashCache {
+public:
+    // 'spent' é opcional para legacy/BIP143 e obrigatório para BIP341
+    explicit SighashCache(const TransactionView& tx, const std::vector<SpentOutput>* spent = nullptr);
+
+    // Legacy (pré-segwit). Inerentemente O(tamanho da tx) por entrada, mas
+    // serializado em streaming, sem montar a transação modificada.
+    Hash256 legacy(size_t input, ByteView script_code, uint32_t hash_type) const;
+
+    // BIP143 (segwit v0)
+    Hash256 segwitV0(size_t input, ByteView script_code, int64_t amount, uint32_t hash_type) const;
+
+    // BIP341 (taproot). Key path sem annex por padrão; para script path
+    // informe tapleaf_hash. Retorna false para hash_type inválido ou
+    // SIGHASH_SINGLE sem saída correspondente.
+    bool taproot(size_t input, uint32_t hash_type, Hash256& out,
+                 const Hash256* tapleaf_hash = nullptr, uint32_t codesep_pos = 0xffffffff,
+                 const ByteView* annex = nullptr) const;
+
+private:
+    const TransactionView& tx;
+    const std::vector<SpentOutput>* spent;
+    // SHA256 simples (BIP341); o SHA256d do BIP143 é SHA256 destes valores
+    uint8_t sha_prevouts[32], sha_sequences[32], sha_outputs[32];
+    uint8_t sha_amounts[32], sha_scriptpubkeys[32];
+    uint8_t hash_prevouts[32], hash_sequence[32], hash_outputs[32];
+};
+
+// Tagged hash do BIP340: SHA256(SHA256(tag) || SHA256(tag) || msg)
+Hash256 taggedHash(const std::string& tag, const uint8_t* data, size_t len);
+
+// RIPEMD160(SHA256(data)); muitas de uma vez em adilsoncrypto_ripemd160.h
+void hash160(const uint8_t* data, size_t len, uint8_t out[20]);
+
+// Endereço P2PKH (Base58Check, versão 0x00) da chave pública em bytes (33 ou
+// 65); "" com outro tamanho
+std::string p2pkhAddress(const uint8_t* public_key, size_t len);
+// O mesmo para chaves em hex, em lote (hash160Contiguous e sha256dMany);
+// "" nas posições de chaves inválidas
+std::vector<std::string> p2pkhAddresses(const std::vector<std::string>& public_keys);
+
+// Assinatura ECDSA secp256k1 com S baixo (BIP62/BIP146), codificada em DER.
+// A verificação aceita só chaves SEC1 de 33 ou 65 bytes fora do infinito.
+bool ecdsaSignDigest(const uint8_t digest[32], const uint8_t private_key[32], std::string& der,
+                     std::string* r_hex = nullptr, std::string* s_hex = nullptr);
+bool ecdsaVerifyDigest(const uint8_t digest[32], const std::string& der, const uint8_t* public_key, size_t public_key_len);
+
+} // namespace adilsoncrypto
+
+std::unique_ptr<IBlockchainInterface> createBitcoinChainInterface();
+
+#endif // ADILSONCRYPTO_BITCOIN_H
@@ -0,0 +1,80 @@
+#ifndef ADILSONCRYPTO_BLAKE3_H
+#define ADILSONCRYPTO_BLAKE3_H
+
+#include "adilsoncrypto_sha256.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace adilsoncrypto {
+
+const size_t BLAKE3_OUT_BYTES = 32;
+const size_t BLAKE3_KEY_BYTES = 32;
+const size_t BLAKE3_BLOCK_BYTES = 64;
+const size_t BLAKE3_CHUNK_BYTES = 1024;
+const size_t BLAKE3_MAX_LANES = 16;
+// A partir disto um update() reparte as subárvores no pool de threads
+const size_t BLAKE3_PARALLEL_MIN_BYTES = 512 * 1024;
+
+// Backend multi-lane: comprime 'lanes' entradas independentes de 'blocks'
+// blocos de 64 bytes cada (chunks inteiros ou pares de chaining values) e
+// grava um chaining value de 32 bytes por lane em 'out'.
+struct Blake3LaneBackend {
+    const char* name;
+    size_t lanes;
+    void (*hashMany)(const uint8_t* const* inputs, size_t blocks, const uint32_t key[8], uint64_t counter,
+                     bool increment_counter, uint8_t flags, uint8_t flags_start, uint8_t flags_end, uint8_t* out);
+};
+
+// Mesma escolha do RIPEMD-160: SCALAR, SSE2 (4 lanes), AVX2 (8) e AVX512
+// (16) têm kernel próprio; SHANI e AUTO usam o de mais lanes do CPU.
+const Blake3LaneBackend& blake3LaneBackend(Sha256Kernel kernel = Sha256Kernel::AUTO);
+
+// Hasher incremental nos três modos (hash, keyed_hash e derive_key). Chunks
+// inteiros que chegam juntos num update() vão para o kernel de lanes, em
+// subárvores alinhadas de 64 chunks (64 KiB); com BLAKE3_PARALLEL_MIN_BYTES
+// ou mais, as subárvores são calculadas em paralelo no defaultThreadPool.
+// A pilha de chaining values funde as subárvores completas conforme chegam.
+class Blake3Hasher {
+public:
+    Blake3Hasher();
+    explicit Blake3Hasher(const uint8_t key[BLAKE3_KEY_BYTES]);
+    // Hasher do material de chave, já com a chave derivada de 'context'
+    static Blake3Hasher deriveKey(const std::string& context);
+
+    void reset();
+    Blake3Hasher& update(const uint8_t* data, size_t len);
+    Blake3Hasher& update(const std::string& data) { return update((const uint8_t*)data.data(), data.size()); }
+    // Saída extensível (XOF) de qualquer tamanho; não altera o estado
+    void finalize(uint8_t* out, size_t len = BLAKE3_OUT_BYTES) const;
+
+private:
+    Blake3Hasher(const uint32_t key_words[8], uint8_t mode_flags);
+    void chunkUpdate(const uint8_t* data, size_t len);
+    void pushChunkCv(const uint8_t cv[32], uint64_t total_chunks);
+
+    uint32_t key[8];
+    uint32_t cv[8];                 // chunk em andamento
+    uint64_t chunk_counter;
+    uint8_t block[BLAKE3_BLOCK_BYTES];
+    uint8_t block_len;
+    uint8_t blocks_compressed;
+    uint8_t flags;
+    uint8_t stack_len;
+    uint8_t stack[54][32];          // uma entrada por nível da árvore (2^54 chunks)
+};
+
+// Hash de uma vez nos três modos; out_len > 32 usa a saída extensível
+void blake3Digest(const uint8_t* data, size_t len, uint8_t* out, size_t out_len = BLAKE3_OUT_BYTES);
+void blake3KeyedDigest(const uint8_t key[BLAKE3_KEY_BYTES], const uint8_t* data, size_t len, uint8_t* out,
+                       size_t out_len = BLAKE3_OUT_BYTES);
+void blake3DeriveKey(const std::string& context, const uint8_t* material, size_t len, uint8_t* out,
+                     size_t out_len = BLAKE3_OUT_BYTES);
+
+// Hash do conteúdo de um arquivo mapeado em memória (builder, pacotes).
+// false se o arquivo não puder ser aberto.
+bool blake3File(const std::string& path, uint8_t out[BLAKE3_OUT_BYTES]);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_BLAKE3_H
@@ -0,0 +1,137 @@
+#ifndef ADILSONCRYPTO_BLAKE3_LANES_H
+#define ADILSONCRYPTO_BLAKE3_LANES_H
+
+// Núcleo BLAKE3 genérico sobre um "vetor de lanes", no mesmo esquema de
+// adilsoncrypto_sha256_lanes.h: cada lane é uma entrada independente (um
+// chunk de 1 KiB ou um nó pai), e cada unidade SIMD instancia
+// Blake3Lanes<Ops> com tipos locais.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace adilsoncrypto {
+
+// Flags de domínio da especificação
+enum : uint8_t {
+    BLAKE3_CHUNK_START = 1,
+    BLAKE3_CHUNK_END = 2,
+    BLAKE3_PARENT = 4,
+    BLAKE3_ROOT = 8,
+    BLAKE3_KEYED_HASH = 16,
+    BLAKE3_DERIVE_KEY_CONTEXT = 32,
+    BLAKE3_DERIVE_KEY_MATERIAL = 64,
+};
+
+// IV do BLAKE3 (o mesmo do SHA-256)
+static const uint32_t BLAKE3_IV_WORDS[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+// Ordem das palavras da mensagem em cada uma das 7 rodadas
+static const uint8_t BLAKE3_MSG_SCHEDULE[7][16] = {
+    { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+    { 2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8 },
+    { 3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1 },
+    { 10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6 },
+    { 12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4 },
+    { 9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7 },
+    { 11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13 },
+};
+
+static inline uint32_t blake3LoadLe32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void blake3StoreLe32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+// Ops deve fornecer: tipo vec, LANES, load/store (uint32_t alinhado), set1,
+// add, xor2 e rotr<N>(x) para N = 16, 12, 8 e 7.
+template <class Ops>
+struct Blake3Lanes {
+    typedef typename Ops::vec vec;
+    static const size_t LANES = Ops::LANES;
+
+    static inline void g(vec v[16], int a, int b, int c, int d, vec x, vec y) {
+        v[a] = Ops::add(Ops::add(v[a], v[b]), x);
+        v[d] = Ops::template rotr<16>(Ops::xor2(v[d], v[a]));
+        v[c] = Ops::add(v[c], v[d]);
+        v[b] = Ops::template rotr<12>(Ops::xor2(v[b], v[c]));
+        v[a] = Ops::add(Ops::add(v[a], v[b]), y);
+        v[d] = Ops::template rotr<8>(Ops::xor2(v[d], v[a]));
+        v[c] = Ops::add(v[c], v[d]);
+        v[b] = Ops::template rotr<7>(Ops::xor2(v[b], v[c]));
+    }
+
+    // Colunas e depois diagonais, com a permutação da rodada r
+    static inline void round(vec v[16], const vec m[16], int r) {
+        const uint8_t* s = BLAKE3_MSG_SCHEDULE[r];
+        g(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+        g(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+        g(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+        g(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+        g(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+        g(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+        g(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+        g(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+    }
+
+    // LANES entradas de 'blocks' blocos de 64 bytes cada, todas com a mesma
+    // chave. A lane l usa o contador counter + l quando increment_counter
+    // (chunks consecutivos) ou counter em todas (nós pais). flags_start e
+    // flags_end entram só no primeiro e no último bloco. 'out' recebe os
+    // chaining values em layout [lane][32 bytes].
+    static void hashMany(const uint8_t* const* inputs, size_t blocks, const uint32_t key[8], uint64_t counter,
+                         bool increment_counter, uint8_t flags, uint8_t flags_start, uint8_t flags_end,
+                         uint8_t* out) {
+        alignas(64) uint32_t tmp[LANES];
+        vec h[8], m[16], v[16];
+        for (int i = 0; i < 8; i++) h[i] = Ops::set1(key[i]);
+
+        for (size_t l = 0; l < LANES; l++) tmp[l] = (uint32_t)(counter + (increment_counter ? l : 0));
+        const vec counter_lo = Ops::load(tmp);
+        for (size_t l = 0; l < LANES; l++) tmp[l] = (uint32_t)((counter + (increment_counter ? l : 0)) >> 32);
+        const vec counter_hi = Ops::load(tmp);
+
+        for (size_t b = 0; b < blocks; b++) {
+            uint8_t block_flags = flags;
+            if (b == 0) block_flags |= flags_start;
+            if (b + 1 == blocks) block_flags |= flags_end;
+
+            for (int t = 0; t < 16; t++) {
+                for (size_t l = 0; l < LANES; l++) tmp[l] = blake3LoadLe32(inputs[l] + 64 * b + 4 * t);
+                m[t] = Ops::load(tmp);
+            }
+            for (int i = 0; i < 8; i++) v[i] = h[i];
+            for (int i = 0; i < 4; i++) v[8 + i] = Ops::set1(BLAKE3_IV_WORDS[i]);
+            v[12] = counter_lo;
+            v[13] = counter_hi;
+            v[14] = Ops::set1(64);
+            v[15] = Ops::set1(block_flags);
+#pragma GCC unroll 7
+            for (int r = 0; r < 7; r++) round(v, m, r);
+            for (int i = 0; i < 8; i++) h[i] = Ops::xor2(v[i], v[i + 8]);
+        }
+
+        for (int i = 0; i < 8; i++) {
+            Ops::store(tmp, h[i]);
+            for (size_t l = 0; l < LANES; l++) blake3StoreLe32(out + 32 * l + 4 * i, tmp[l]);
+        }
+    }
+};
+
+// Kernels por conjunto de instruções (definidos nas unidades _avx2/_avx512)
+void blake3HashManyAvx2(const uint8_t* const* inputs, size_t blocks, const uint32_t key[8], uint64_t counter,
+                        bool increment_counter, uint8_t flags, uint8_t flags_start, uint8_t flags_end,
+                        uint8_t* out);
+void blake3HashManyAvx512(const uint8_t* const* inputs, size_t blocks, const uint32_t key[8], uint64_t counter,
+                          bool increment_counter, uint8_t flags, uint8_t flags_start, uint8_t flags_end,
+                          uint8_t* out);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_BLAKE3_LANES_H
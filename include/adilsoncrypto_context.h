@@ -0,0 +1,143 @@
+#ifndef ADILSONCRYPTO_CONTEXT_H
+#define ADILSONCRYPTO_CONTEXT_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+
+namespace adilsoncrypto {
+
+// Estado de rascunho de uma thread: BN_CTX, pontos e EC_KEY por grupo e um
+// EVP_MD_CTX, criados uma vez e reaproveitados a cada chamada. Cada thread
+// tem o seu (threadContext()), então o uso concorrente não compartilha nada
+// mutável nem passa pelo alocador do OpenSSL no caminho quente.
+class ThreadContext {
+public:
+    static const unsigned SCRATCH_POINTS = 2;
+
+    ThreadContext();
+    ~ThreadContext();
+
+    ThreadContext(const ThreadContext&) = delete;
+    ThreadContext& operator=(const ThreadContext&) = delete;
+
+    // Use entre BN_CTX_start/BN_CTX_end
+    BN_CTX* bnCtx() { return bn_ctx; }
+
+    // Rascunho por grupo. group_id identifica a instância da curva (ver
+    // newScratchGroupId): endereços de EC_GROUP liberados podem ser
+    // reaproveitados por outra curva, e o EC_KEY guarda cópia do grupo.
+    EC_POINT* point(uint64_t group_id, const EC_GROUP* group, unsigned slot);
+    EC_KEY* signingKey(uint64_t group_id, const EC_GROUP* group);
+    EC_KEY* verifyingKey(uint64_t group_id, const EC_GROUP* group);
+
+    // Digest de uma vez só com o EVP_MD_CTX da thread; out precisa de
+    // EVP_MD_get_size(md) bytes. Passe um EVP_MD obtido uma vez com
+    // EVP_MD_fetch: EVP_sha512() e afins refazem a busca no provedor (com
+    // trava global) a cada EVP_DigestInit_ex no OpenSSL 3.
+    bool digest(const EVP_MD* md, const void* data, size_t len, uint8_t* out);
+
+private:
+    struct GroupScratch {
+        uint64_t id;
+        EC_POINT* points[SCRATCH_POINTS];
+        EC_KEY* sign_key;
+        EC_KEY* verify_key;
+    };
+
+    GroupScratch& scratchFor(uint64_t group_id, const EC_GROUP* group);
+    static void release(GroupScratch& scratch);
+
+    BN_CTX* bn_ctx;
+    EVP_MD_CTX* md_ctx;
+    std::vector<GroupScratch> groups;   // poucos; o mais antigo sai primeiro
+};
+
+ThreadContext& threadContext();
+uint64_t newScratchGroupId();
+
+// Fatia de contadores de leitura da thread atual (ver RcuCell)
+inline unsigned rcuReaderShard() {
+    static std::atomic<unsigned> next_shard{ 0 };
+    thread_local unsigned shard = next_shard.fetch_add(1, std::memory_order_relaxed);
+    return shard;
+}
+
+// Ponteiro trocado no estilo RCU. Leitores não bloqueiam nem disputam a
+// mesma linha de cache: cada um incrementa o contador da sua fatia na época
+// atual. replace publica o novo valor, vira a época e espera os contadores
+// da época anterior zerarem antes de destruir o valor antigo. Não chame
+// replace segurando um ReadGuard na mesma thread.
+template <typename T>
+class RcuCell {
+public:
+    class ReadGuard {
+    public:
+        ~ReadGuard() { counter->fetch_sub(1, std::memory_order_release); }
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        T* get() const { return value; }
+        T* operator->() const { return value; }
+        T& operator*() const { return *value; }
+
+    private:
+        friend class RcuCell;
+        ReadGuard(std::atomic<long>* counter, T* value) : counter(counter), value(value) {}
+
+        std::atomic<long>* counter;
+        T* value;
+    };
+
+    explicit RcuCell(std::unique_ptr<T> initial) : epoch(0), current(initial.release()) {}
+    ~RcuCell() { delete current.load(); }
+
+    RcuCell(const RcuCell&) = delete;
+    RcuCell& operator=(const RcuCell&) = delete;
+
+    ReadGuard read() const {
+        const unsigned shard = rcuReaderShard() % SHARDS;
+        for (;;) {
+            unsigned e = epoch.load();
+            std::atomic<long>& counter = counters[e & 1][shard].readers;
+            counter.fetch_add(1);
+            // A época pode ter virado entre a leitura e o incremento; nesse
+            // caso o escritor talvez já tenha conferido este contador
+            if (epoch.load() == e) return ReadGuard(&counter, current.load());
+            counter.fetch_sub(1);
+        }
+    }
+
+    void replace(std::unique_ptr<T> next) {
+        std::lock_guard<std::mutex> lock(writer);
+        T* previous = current.exchange(next.release());
+        unsigned e = epoch.fetch_add(1);
+        for (unsigned shard = 0; shard < SHARDS; shard++) {
+            while (counters[e & 1][shard].readers.load() != 0) std::this_thread::yield();
+        }
+        delete previous;
+    }
+
+private:
+    static const unsigned SHARDS = 32;
+
+    struct alignas(64) Counter {
+        std::atomic<long> readers{ 0 };
+    };
+
+    mutable Counter counters[2][SHARDS];
+    std::atomic<unsigned> epoch;
+    std::atomic<T*> current;
+    std::mutex writer;
+};
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_CONTEXT_H
@@ -0,0 +1,30 @@
+#ifndef ADILSONCRYPTO_CPU_H
+#define ADILSONCRYPTO_CPU_H
+
+#include <string>
+
+namespace adilsoncrypto {
+
+// Recursos do processador relevantes para os kernels SIMD.
+// Cada flag só é verdadeira quando o CPU E o sistema operacional suportam
+// o conjunto de instruções (XGETBV confirma que os registradores são salvos).
+struct CpuFeatures {
+    bool sse41 = false;
+    bool ssse3 = false;
+    bool avx2 = false;
+    bool avx512f = false;
+    bool shani = false;
+};
+
+// Detectado uma única vez via CPUID; seguro para chamar de qualquer thread
+const CpuFeatures& cpuFeatures();
+
+// Resumo legível, ex.: "sse4.1 ssse3 avx2 avx512f sha-ni"
+std::string cpuFeatureString();
+
+// Nome do processador (CPUID 0x80000002..4) ou "desconhecido"
+std::string cpuModelName();
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_CPU_H
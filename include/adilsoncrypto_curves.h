@@ -0,0 +1,42 @@
+#ifndef ADILSONCRYPTO_CURVES_H
+#define ADILSONCRYPTO_CURVES_H
+
+#include "adilsoncrypto.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+
+namespace adilsoncrypto {
+
+// Contexto de uma curva nomeada, montado uma vez por processo na primeira
+// vez que a curva é pedida e nunca mais alterado: o grupo já vem com a
+// tabela de múltiplos do gerador, então todas as instâncias e threads o
+// compartilham sem trava. Na P-256 o OpenSSL escolhe sozinho a implementação
+// de primo fixo (nistz256, Montgomery em assembly com tabela do gerador
+// embutida); nas outras curvas a tabela é calculada aqui.
+struct CurveContext {
+    const char* name;         // nome canônico (CURVE_*)
+    int nid;
+    const EC_GROUP* group;
+    uint64_t scratch_id;      // rascunho da curva no contexto da thread
+    const EVP_MD* md;         // hash das mensagens assinadas
+    size_t order_bytes;
+};
+
+// nullptr se a curva não for conhecida. Aceita os nomes CURVE_* e os
+// apelidos usuais (prime256v1, P-256, P-384, P-521). A secp256k1 também tem
+// contexto aqui, usado pela curva padrão da AdilsonCrypto.
+const CurveContext* curveContext(const std::string& name);
+
+// ECDSA sobre o contexto compartilhado; criar uma instância só guarda o
+// ponteiro. nullptr se a curva não for conhecida. Chaves e assinaturas em hex
+// maiúsculo como na secp256k1; o endereço são os 20 primeiros bytes do hash
+// da curva sobre a chave pública, em hex.
+std::unique_ptr<IEllipticCurve> createNamedCurve(const std::string& name);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_CURVES_H
@@ -0,0 +1,173 @@
+#ifndef ADILSONCRYPTO_DAEMON_H
+#define ADILSONCRYPTO_DAEMON_H
+
+#include "adilsoncrypto.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace adilsoncrypto {
+
+// Protocolo binário do daemon de assinatura (inteiros little-endian).
+//
+// Requisição: tamanho (uint32, bytes que seguem) | id (uint32) | op (uint8) | dados
+// Resposta:   tamanho (uint32, bytes que seguem) | id (uint32) | status (uint8) | dados
+//
+// As respostas de uma conexão podem sair fora de ordem; o id casa cada uma
+// com a sua requisição.
+//
+//   SIGN    dados: tipo (0 = endereço no keystore, 1 = chave privada crua)
+//                  | tamanho da chave (uint8) | chave | mensagem
+//           resposta: r || s || v (65 bytes)
+//   VERIFY  dados: chave pública comprimida (33) | r || s (64) | mensagem
+//           resposta: 1 byte (1 = válida)
+//   SHA256  dados: mensagem
+//           resposta: digest (32 bytes)
+//   METRICS dados: nenhum
+//           resposta: métricas do processo do daemon no formato de texto do
+//           Prometheus (adilsoncrypto_metrics.h)
+enum class DaemonOp : uint8_t {
+    SIGN = 1,
+    VERIFY = 2,
+    SHA256 = 3,
+    METRICS = 4
+};
+
+enum class DaemonStatus : uint8_t {
+    OK = 0,
+    BAD_REQUEST = 1,
+    UNKNOWN_KEY = 2,
+    FAILED = 3,
+    DISCONNECTED = 255   // só no cliente: a conexão caiu antes da resposta
+};
+
+const uint8_t DAEMON_KEY_ADDRESS = 0;
+const uint8_t DAEMON_KEY_RAW = 1;
+const size_t DAEMON_FRAME_HEADER_BYTES = 9;   // tamanho + id + op/status
+
+struct DaemonOptions {
+    std::string socket_path;
+    std::string keystore_path;          // vazio: só chaves cruas
+    std::string passphrase;
+    unsigned threads = 0;               // 0: um por núcleo
+    size_t max_batch = 1024;            // requisições por lote
+    unsigned batch_window_us = 100;     // espera por mais requisições antes de fechar um lote pequeno
+    unsigned max_inflight = 256;        // por cliente; acima disso o daemon para de ler o socket
+    size_t max_output_bytes = 4 << 20;  // por cliente; idem para respostas não lidas
+    size_t max_frame_bytes = 1 << 20;
+};
+
+struct DaemonStats {
+    uint64_t requests = 0;
+    uint64_t batches = 0;
+    uint64_t clients = 0;           // conexões abertas agora
+    uint64_t throttled = 0;         // vezes que um cliente teve a leitura suspensa
+};
+
+class Keystore;
+class ThreadPool;
+struct DaemonShared;
+
+// Daemon de assinatura num socket Unix. Uma thread de E/S (epoll) aceita
+// conexões, lê quadros e entrega respostas; uma thread de despacho junta
+// tudo o que chegou de todos os clientes num lote e o processa no pool:
+// hashes das mensagens juntos pelo kernel multi-buffer, depois ECDSA
+// secp256k1 em paralelo. Cada cliente tem limite de requisições pendentes e
+// de bytes de resposta; quando passa, o daemon simplesmente para de ler o
+// socket dele e o kernel devolve a pressão para quem escreve.
+//
+// Só Linux (epoll); nas outras plataformas start() retorna false.
+class SigningDaemon {
+public:
+    explicit SigningDaemon(const DaemonOptions& options);
+    ~SigningDaemon();
+
+    SigningDaemon(const SigningDaemon&) = delete;
+    SigningDaemon& operator=(const SigningDaemon&) = delete;
+
+    // Cria o socket (permissão 0600, só o dono conecta) e as threads
+    bool start();
+    void stop();
+    bool running() const { return io_thread.joinable(); }
+    DaemonStats stats() const;
+
+private:
+    void ioLoop();
+    void dispatchLoop();
+
+    DaemonOptions options;
+    std::unique_ptr<Keystore> keystore;
+    std::unique_ptr<ThreadPool> pool;
+    std::unique_ptr<DaemonShared> shared;
+    std::thread io_thread;
+    std::thread dispatch_thread;
+};
+
+struct DaemonReply {
+    DaemonStatus status = DaemonStatus::DISCONNECTED;
+    std::string data;
+};
+
+// Cliente do daemon. Uma conexão serve várias threads: as requisições são
+// enviadas com o id na frente e uma thread leitora entrega cada resposta ao
+// callback/future correspondente. As chamadas síncronas são as assíncronas
+// seguidas de get().
+class DaemonClient {
+public:
+    using Callback = std::function<void(DaemonReply&&)>;
+
+    DaemonClient();
+    ~DaemonClient();
+
+    DaemonClient(const DaemonClient&) = delete;
+    DaemonClient& operator=(const DaemonClient&) = delete;
+
+    bool connect(const std::string& socket_path);
+    // Pendentes terminam com DaemonStatus::DISCONNECTED
+    void close();
+    bool connected() const { return fd >= 0; }
+
+    // Base das demais: 'done' roda na thread leitora (ou na chamadora, se a
+    // conexão já estiver fechada)
+    void request(DaemonOp op, const std::string& data, Callback done);
+    std::future<DaemonReply> request(DaemonOp op, const std::string& data);
+
+    std::future<Signature> signAsync(const std::string& message, const std::string& address);
+    std::future<Signature> signWithKeyAsync(const std::string& message, const std::string& private_key_hex);
+    std::future<bool> verifyAsync(const std::string& message, const Signature& signature, const std::string& public_key_hex);
+    std::future<std::string> sha256Async(const std::string& data);
+    std::future<std::string> metricsAsync();
+
+    Signature sign(const std::string& message, const std::string& address) { return signAsync(message, address).get(); }
+    Signature signWithKey(const std::string& message, const std::string& private_key_hex) {
+        return signWithKeyAsync(message, private_key_hex).get();
+    }
+    bool verify(const std::string& message, const Signature& signature, const std::string& public_key_hex) {
+        return verifyAsync(message, signature, public_key_hex).get();
+    }
+    std::string sha256(const std::string& data) { return sha256Async(data).get(); }
+    std::string metrics() { return metricsAsync().get(); }
+
+private:
+    void readLoop();
+    void failPending();
+
+    std::atomic<int> fd;
+    std::mutex write_mutex;
+    std::mutex pending_mutex;
+    std::unordered_map<uint32_t, Callback> pending;
+    bool disconnected;   // a leitora saiu (protegido por pending_mutex)
+    uint32_t next_id;
+    std::thread reader;
+};
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_DAEMON_H
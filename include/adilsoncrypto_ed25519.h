@@ -0,0 +1,40 @@
+#ifndef ADILSONCRYPTO_ED25519_H
+#define ADILSONCRYPTO_ED25519_H
+
+#include "adilsoncrypto_pool.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace adilsoncrypto {
+
+const size_t ED25519_SEED_BYTES = 32;
+const size_t ED25519_PUBLIC_KEY_BYTES = 32;
+const size_t ED25519_SIGNATURE_BYTES = 64;
+
+// Ed25519 (RFC 8032). Corpo primo em radix 2^51 (5 limbs de 64 bits),
+// pontos em coordenadas estendidas e tabela pré-computada do ponto base
+// (32 x 8 pontos afins) para a multiplicação escalar fixa.
+void ed25519PublicKey(const uint8_t seed[32], uint8_t public_key[32]);
+void ed25519Sign(const uint8_t* message, size_t len, const uint8_t seed[32],
+                 const uint8_t public_key[32], uint8_t signature[64]);
+
+// Verificação cofatorada: aceita se 8([S]B - R - [k]A) = 0, rejeita S >= L
+// e codificações não canônicas de A ou R. É a mesma equação do lote, então
+// verify e verifyBatch sempre concordam.
+bool ed25519Verify(const uint8_t* message, size_t len, const uint8_t public_key[32], const uint8_t signature[64]);
+
+// Verificação em lote por combinação linear aleatória: com z_i de 128 bits
+// aleatórios, checa 8(-(sum z_i S_i) B + sum z_i R_i + sum (z_i k_i) A_i) = 0
+// com uma única multiplicação multi-escalar (Pippenger).
+// Retorna true se todas as assinaturas forem válidas. Se 'valid' não for
+// nulo recebe o resultado de cada uma (após uma falha do lote, as
+// assinaturas são reverificadas individualmente). Com 'pool' o lote é
+// dividido em sub-lotes verificados em paralelo.
+bool ed25519VerifyBatch(const uint8_t* const* messages, const size_t* lens,
+                        const uint8_t* const* public_keys, const uint8_t* const* signatures,
+                        size_t count, std::vector<bool>* valid = nullptr, ThreadPool* pool = nullptr);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_ED25519_H
@@ -0,0 +1,137 @@
+#ifndef ADILSONCRYPTO_ETHEREUM_H
+#define ADILSONCRYPTO_ETHEREUM_H
+
+#include "adilsoncrypto.h"
+#include "adilsoncrypto_keccak.h"
+#include "adilsoncrypto_miner.h"
+#include "adilsoncrypto_util.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace adilsoncrypto {
+
+// Item RLP decodificado sem cópia: as views apontam para o buffer de entrada
+struct RlpItem {
+    bool list = false;
+    ByteView payload;   // conteúdo sem o prefixo de tamanho
+    ByteView encoded;   // item completo, com prefixo
+};
+
+// Decodifica o item no início de data[0..size). Rejeita prefixos não
+// canônicos e tamanhos além do buffer. item.encoded.size indica quanto foi lido.
+bool rlpDecodeItem(const uint8_t* data, size_t size, RlpItem& item);
+
+// Percorre os itens de uma lista RLP sem alocar
+class RlpListReader {
+public:
+    explicit RlpListReader(const RlpItem& list);
+    bool next(RlpItem& item);     // false no fim da lista ou em erro
+    bool done() const { return p == end; }
+    bool failed() const { return error; }
+
+private:
+    const uint8_t* p;
+    const uint8_t* end;
+    bool error;
+};
+
+// Tamanhos codificados, para pré-alocar o buffer de saída
+size_t rlpStringSize(const uint8_t* data, size_t len);
+size_t rlpIntegerSize(uint64_t value);
+size_t rlpListSize(size_t payload_len);
+
+// Codificador RLP sem alocação. Três destinos:
+// - buffer pré-alocado (ok() fica false se a capacidade acabar)
+// - Keccak256Hasher (o item é hasheado em streaming, sem buffer)
+// - contagem (RlpWriter() só soma o tamanho; usado para os prefixos de lista)
+class RlpWriter {
+public:
+    RlpWriter();
+    RlpWriter(uint8_t* out, size_t capacity);
+    explicit RlpWriter(Keccak256Hasher& hasher);
+
+    RlpWriter& string(const uint8_t* data, size_t len);
+    RlpWriter& string(ByteView view) { return string(view.data, view.size); }
+    RlpWriter& integer(uint64_t value);
+    // Inteiro big-endian (ex.: uint256); zeros à esquerda são removidos
+    RlpWriter& integerBytes(const uint8_t* be, size_t len);
+    RlpWriter& listHeader(size_t payload_len);
+    RlpWriter& raw(const uint8_t* data, size_t len);
+
+    size_t size() const { return written; }
+    bool ok() const { return !overflow; }
+
+private:
+    void put(const uint8_t* data, size_t len);
+    void putLength(uint8_t short_base, size_t len);
+
+    uint8_t* out;
+    size_t capacity;
+    Keccak256Hasher* hasher;
+    size_t written;
+    bool overflow;
+};
+
+enum class EthTxType : uint8_t {
+    LEGACY = 0,
+    ACCESS_LIST = 1,   // EIP-2930
+    DYNAMIC_FEE = 2    // EIP-1559
+};
+
+// Transação Ethereum. Campos de tamanho variável são views (sem cópia) para o
+// buffer decodificado ou para a memória do chamador.
+struct EthTransaction {
+    EthTxType type = EthTxType::LEGACY;
+    uint64_t chain_id = 0;            // legacy: 0 = assinatura pré-EIP-155
+    uint64_t nonce = 0;
+    uint64_t gas_price = 0;           // legacy e EIP-2930
+    uint64_t max_priority_fee_per_gas = 0;
+    uint64_t max_fee_per_gas = 0;
+    uint64_t gas_limit = 0;
+    ByteView to;                      // 20 bytes; vazio = criação de contrato
+    ByteView value;                   // uint256 big-endian
+    ByteView data;
+    ByteView access_list;             // lista RLP já codificada; vazio = lista vazia
+    bool has_signature = false;
+    uint8_t y_parity = 0;             // recovery id (0 ou 1)
+    uint8_t r[32] = {};
+    uint8_t s[32] = {};
+};
+
+// Aceita legacy (6 ou 9 campos; 9 com r = s = 0 é o payload EIP-155 não
+// assinado) e tipadas 0x01/0x02, assinadas ou não.
+bool decodeEthTransaction(const uint8_t* data, size_t size, EthTransaction& tx);
+
+// signing_payload = true: mensagem que é assinada; false: transação assinada
+size_t ethTransactionSize(const EthTransaction& tx, bool signing_payload);
+// Retorna os bytes escritos, ou 0 se capacity < ethTransactionSize()
+size_t encodeEthTransaction(const EthTransaction& tx, bool signing_payload, uint8_t* out, size_t capacity);
+
+// Codifica um lote inteiro em um único buffer: out recebe as transações
+// concatenadas e offsets[i] o início da i-ésima (offsets[count] = total).
+// Reaproveitando out/offsets entre lotes não há alocação em regime.
+void encodeEthTransactionBatch(const EthTransaction* txs, size_t count, bool signing_payload,
+                               std::vector<uint8_t>& out, std::vector<size_t>& offsets);
+
+// Hashes calculados em streaming sobre o RLP, sem buffer intermediário
+Hash256 ethSigningHash(const EthTransaction& tx);
+Hash256 ethTransactionHash(const EthTransaction& tx);
+
+bool ethSignTransaction(EthTransaction& tx, const uint8_t private_key[32]);
+bool ethRecoverSender(const EthTransaction& tx, uint8_t address[20]);
+
+// Recuperação da chave pública secp256k1 (65 bytes, 0x04 || x || y)
+bool ecdsaRecoverPublicKey(const uint8_t digest[32], const uint8_t r[32], const uint8_t s[32],
+                           int recovery_id, uint8_t public_key[65]);
+void ethAddressFromPublicKey(const uint8_t public_key[65], uint8_t address[20]);
+// "0x" + endereço com checksum EIP-55
+std::string ethChecksumAddress(const uint8_t address[20]);
+
+} // namespace adilsoncrypto
+
+std::unique_ptr<IBlockchainInterface> createEthereumChainInterface();
+
+#endif // ADILSONCRYPTO_ETHEREUM_H
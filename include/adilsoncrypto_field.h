@@ -0,0 +1,540 @@
+#ifndef ADILSONCRYPTO_FIELD_H
+#define ADILSONCRYPTO_FIELD_H
+
+#include "adilsoncrypto.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace adilsoncrypto {
+
+// Aritmética de Montgomery em corpos primos de até 576 bits (P-521 cabe).
+// Elementos são limbs de 64 bits little-endian, sempre < p e na forma de
+// Montgomery (x R mod p, R = 2^(64 limbs)).
+//
+// O mesmo código serve às duas formas de módulo:
+// - FixedModulus<Params>: o módulo e as constantes são constexpr e o número
+//   de limbs é parâmetro do template, então os laços desenrolam e as
+//   palavras de p viram imediatos (curvas conhecidas).
+// - RuntimeModulus: módulo lido em tempo de execução, laços até 'limbs'
+//   (curvas customizadas).
+const size_t FIELD_MAX_LIMBS = 9;
+
+template <size_t N>
+struct Modulus {
+    uint64_t p[N];
+    uint64_t p_minus_2[N];   // expoente do inverso (Fermat)
+    uint64_t one[N];         // R mod p
+    uint64_t r2[N];          // R^2 mod p: converte para a forma de Montgomery
+    uint64_t n0;             // -p^-1 mod 2^64
+};
+
+// Limbs a partir do texto hex, em tempo de compilação (até N * 16 dígitos)
+template <size_t N>
+constexpr void limbsFromHex(const char* hex, uint64_t (&out)[N]) {
+    for (size_t i = 0; i < N; i++) out[i] = 0;
+    size_t len = 0;
+    while (hex[len]) len++;
+    for (size_t i = 0; i < len; i++) {
+        char c = hex[len - 1 - i];
+        uint64_t digit = c >= 'a' ? (uint64_t)(c - 'a' + 10) : c >= 'A' ? (uint64_t)(c - 'A' + 10) : (uint64_t)(c - '0');
+        out[i / 16] |= digit << (4 * (i % 16));
+    }
+}
+
+// Constantes de Montgomery de um módulo ímpar p de 'limbs' palavras (limbs
+// <= N). constexpr: para as curvas conhecidas o compilador faz a conta.
+template <size_t N>
+constexpr Modulus<N> makeModulus(const uint64_t* p, size_t limbs) {
+    Modulus<N> m{};
+    for (size_t i = 0; i < limbs; i++) m.p[i] = p[i];
+
+    uint64_t inverse = p[0];   // Newton: cada passo dobra os bits corretos
+    for (int i = 0; i < 5; i++) inverse *= 2 - p[0] * inverse;
+    m.n0 = 0 - inverse;
+
+    uint64_t borrow = 2;
+    for (size_t i = 0; i < limbs; i++) {
+        m.p_minus_2[i] = p[i] - borrow;
+        borrow = p[i] < borrow ? 1 : 0;
+    }
+
+    // R e R^2 por duplicações módulo p a partir de 1
+    uint64_t x[N] = {};
+    x[0] = 1;
+    for (size_t step = 1; step <= 128 * limbs; step++) {
+        uint64_t carry = 0;
+        for (size_t i = 0; i < limbs; i++) {
+            uint64_t next = x[i] >> 63;
+            x[i] = (x[i] << 1) | carry;
+            carry = next;
+        }
+        bool ge = carry != 0;
+        if (!ge) {
+            ge = true;
+            for (size_t i = limbs; i-- > 0;) {
+                if (x[i] != p[i]) {
+                    ge = x[i] > p[i];
+                    break;
+                }
+            }
+        }
+        if (ge) {
+            uint64_t b = 0;
+            for (size_t i = 0; i < limbs; i++) {
+                uint64_t d = x[i] - p[i] - b;
+                b = (x[i] < p[i] || (x[i] == p[i] && b)) ? 1 : 0;
+                x[i] = d;
+            }
+        }
+        if (step == 64 * limbs) {
+            for (size_t i = 0; i < limbs; i++) m.one[i] = x[i];
+        }
+    }
+    for (size_t i = 0; i < limbs; i++) m.r2[i] = x[i];
+    return m;
+}
+
+template <typename Params>
+struct FixedModulus {
+    static constexpr size_t MAX = Params::LIMBS;
+    constexpr size_t limbs() const { return Params::LIMBS; }
+    constexpr const Modulus<Params::LIMBS>& get() const { return Params::MODULUS; }
+};
+
+struct RuntimeModulus {
+    static constexpr size_t MAX = FIELD_MAX_LIMBS;
+    RuntimeModulus() : modulus{}, count(0) {}
+    RuntimeModulus(const uint64_t* p, size_t limbs) : modulus(makeModulus<FIELD_MAX_LIMBS>(p, limbs)), count(limbs) {}
+    size_t limbs() const { return count; }
+    const Modulus<FIELD_MAX_LIMBS>& get() const { return modulus; }
+
+    Modulus<FIELD_MAX_LIMBS> modulus;
+    size_t count;
+};
+
+// Núcleo comum. 'n' é o número de limbs e M o máximo (tamanho dos
+// rascunhos); quando vêm de FixedModulus são o mesmo valor constante após o
+// inline e os laços somem. FIELD_INLINE garante o inline
+// mesmo no produto, que é grande demais para a heurística do GCC.
+#if defined(__GNUC__)
+#define FIELD_INLINE inline __attribute__((always_inline))
+#else
+#define FIELD_INLINE inline
+#endif
+
+// r = a - p se a >= p (a tem n palavras mais 'top'); sem desvio dependente do valor
+template <size_t M>
+FIELD_INLINE void fieldReduceOnce(uint64_t* r, const uint64_t* a, uint64_t top, const uint64_t* p, size_t n) {
+    uint64_t d[M];
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < n; i++) {
+        unsigned __int128 diff = (unsigned __int128)a[i] - p[i] - borrow;
+        d[i] = (uint64_t)diff;
+        borrow = (uint64_t)(diff >> 64) & 1;
+    }
+    // Fica com a diferença se houve vai-um acima de n palavras ou se não faltou nada
+    uint64_t keep_diff = 0 - (uint64_t)((top != 0) | (borrow == 0));
+    for (size_t i = 0; i < n; i++) r[i] = (d[i] & keep_diff) | (a[i] & ~keep_diff);
+}
+
+template <size_t M>
+FIELD_INLINE void fieldAdd(uint64_t* r, const uint64_t* a, const uint64_t* b, const uint64_t* p, size_t n) {
+    uint64_t sum[M];
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        unsigned __int128 s = (unsigned __int128)a[i] + b[i] + carry;
+        sum[i] = (uint64_t)s;
+        carry = (uint64_t)(s >> 64);
+    }
+    fieldReduceOnce<M>(r, sum, carry, p, n);
+}
+
+FIELD_INLINE void fieldSub(uint64_t* r, const uint64_t* a, const uint64_t* b, const uint64_t* p, size_t n) {
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < n; i++) {
+        unsigned __int128 diff = (unsigned __int128)a[i] - b[i] - borrow;
+        r[i] = (uint64_t)diff;
+        borrow = (uint64_t)(diff >> 64) & 1;
+    }
+    // Faltou: soma p de volta
+    uint64_t mask = 0 - borrow;
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        unsigned __int128 s = (unsigned __int128)r[i] + (p[i] & mask) + carry;
+        r[i] = (uint64_t)s;
+        carry = (uint64_t)(s >> 64);
+    }
+}
+
+// Produto de Montgomery (CIOS): r = a b / R mod p. Aceita a < R desde que
+// b < p, o que permite reduzir valores crus com b = R^2.
+template <size_t M>
+FIELD_INLINE void fieldMontMul(uint64_t* r, const uint64_t* a, const uint64_t* b, const uint64_t* p, uint64_t n0, size_t n) {
+    uint64_t t[M + 2] = {};
+    for (size_t i = 0; i < n; i++) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < n; j++) {
+            unsigned __int128 acc = (unsigned __int128)a[j] * b[i] + t[j] + carry;
+            t[j] = (uint64_t)acc;
+            carry = (uint64_t)(acc >> 64);
+        }
+        unsigned __int128 acc = (unsigned __int128)t[n] + carry;
+        t[n] = (uint64_t)acc;
+        t[n + 1] = (uint64_t)(acc >> 64);
+
+        uint64_t m = t[0] * n0;
+        acc = (unsigned __int128)m * p[0] + t[0];
+        carry = (uint64_t)(acc >> 64);
+        for (size_t j = 1; j < n; j++) {
+            acc = (unsigned __int128)m * p[j] + t[j] + carry;
+            t[j - 1] = (uint64_t)acc;
+            carry = (uint64_t)(acc >> 64);
+        }
+        acc = (unsigned __int128)t[n] + carry;
+        t[n - 1] = (uint64_t)acc;
+        t[n] = t[n + 1] + (uint64_t)(acc >> 64);
+    }
+    fieldReduceOnce<M>(r, t, t[n], p, n);
+}
+
+template <typename Mod>
+class MontgomeryField {
+public:
+    static constexpr size_t MAX_LIMBS = Mod::MAX;
+
+    struct Element {
+        uint64_t v[Mod::MAX];
+    };
+
+    MontgomeryField() {}
+    explicit MontgomeryField(const Mod& modulus) : modulus(modulus) {}
+
+    size_t limbs() const { return modulus.limbs(); }
+    size_t bytes() const { return 8 * modulus.limbs(); }
+
+    void add(Element& r, const Element& a, const Element& b) const {
+        fieldAdd<Mod::MAX>(r.v, a.v, b.v, modulus.get().p, modulus.limbs());
+    }
+    void sub(Element& r, const Element& a, const Element& b) const {
+        fieldSub(r.v, a.v, b.v, modulus.get().p, modulus.limbs());
+    }
+    void mul(Element& r, const Element& a, const Element& b) const {
+        fieldMontMul<Mod::MAX>(r.v, a.v, b.v, modulus.get().p, modulus.get().n0, modulus.limbs());
+    }
+    void sqr(Element& r, const Element& a) const { mul(r, a, a); }
+    void neg(Element& r, const Element& a) const { sub(r, zero(), a); }
+
+    Element zero() const { return Element{}; }
+    Element one() const {
+        Element r{};
+        for (size_t i = 0; i < modulus.limbs(); i++) r.v[i] = modulus.get().one[i];
+        return r;
+    }
+
+    bool isZero(const Element& a) const {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < modulus.limbs(); i++) bits |= a.v[i];
+        return bits == 0;
+    }
+    bool equal(const Element& a, const Element& b) const {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < modulus.limbs(); i++) bits |= a.v[i] ^ b.v[i];
+        return bits == 0;
+    }
+
+    // Valor cru (< R) para a forma de Montgomery, já reduzido módulo p
+    Element fromRaw(const uint64_t* raw) const {
+        Element a{}, r;
+        for (size_t i = 0; i < modulus.limbs(); i++) a.v[i] = raw[i];
+        fieldMontMul<Mod::MAX>(r.v, a.v, modulus.get().r2, modulus.get().p, modulus.get().n0, modulus.limbs());
+        return r;
+    }
+    void toRaw(const Element& a, uint64_t* raw) const {
+        uint64_t unit[Mod::MAX] = { 1 };
+        fieldMontMul<Mod::MAX>(raw, a.v, unit, modulus.get().p, modulus.get().n0, modulus.limbs());
+    }
+    Element fromUint(uint64_t value) const {
+        uint64_t raw[Mod::MAX] = { value };
+        return fromRaw(raw);
+    }
+
+    // a^e, e cru com 'limbs' palavras
+    Element pow(const Element& a, const uint64_t* e) const {
+        Element r = one();
+        for (size_t i = modulus.limbs(); i-- > 0;) {
+            for (int bit = 63; bit >= 0; bit--) {
+                sqr(r, r);
+                if ((e[i] >> bit) & 1) mul(r, r, a);
+            }
+        }
+        return r;
+    }
+    // a != 0
+    Element inverse(const Element& a) const { return pow(a, modulus.get().p_minus_2); }
+
+private:
+    Mod modulus;
+};
+
+template <typename Params>
+using FixedField = MontgomeryField<FixedModulus<Params>>;
+using GenericField = MontgomeryField<RuntimeModulus>;
+
+// Curva y^2 = x^3 + a x + b em coordenadas jacobianas (x = X/Z^2,
+// y = Y/Z^3; Z = 0 é o ponto no infinito). a = 0 e a = -3 usam as fórmulas
+// de dobra mais curtas.
+template <typename Field>
+class WeierstrassCurve {
+public:
+    using Element = typename Field::Element;
+
+    struct Point {
+        Element x, y, z;
+    };
+
+    WeierstrassCurve() {}
+    WeierstrassCurve(const Field& field, const Element& a, const Element& b) : field(field), a(a), b(b) {
+        Element minus_three;
+        field.neg(minus_three, field.fromUint(3));
+        a_zero = field.isZero(a);
+        a_minus_three = field.equal(a, minus_three);
+    }
+
+    const Field& baseField() const { return field; }
+
+    Point infinity() const { return Point{ field.one(), field.one(), field.zero() }; }
+    bool isInfinity(const Point& p) const { return field.isZero(p.z); }
+    Point fromAffine(const Element& x, const Element& y) const { return Point{ x, y, field.one() }; }
+
+    bool isOnCurve(const Element& x, const Element& y) const {
+        Element lhs, rhs;
+        field.sqr(lhs, y);
+        field.sqr(rhs, x);
+        field.add(rhs, rhs, a);
+        field.mul(rhs, rhs, x);
+        field.add(rhs, rhs, b);
+        return field.equal(lhs, rhs);
+    }
+
+    // false para o infinito
+    bool toAffine(const Point& p, Element& x, Element& y) const {
+        if (isInfinity(p)) return false;
+        Element z_inv = field.inverse(p.z), z_inv2;
+        field.sqr(z_inv2, z_inv);
+        field.mul(x, p.x, z_inv2);
+        field.mul(z_inv2, z_inv2, z_inv);
+        field.mul(y, p.y, z_inv2);
+        return true;
+    }
+
+    void negate(Point& r, const Point& p) const {
+        r = p;
+        field.neg(r.y, p.y);
+    }
+
+    // dbl-2007-bl (dbl-2001-b com a = -3)
+    void dbl(Point& r, const Point& p) const {
+        if (isInfinity(p) || field.isZero(p.y)) {
+            r = infinity();
+            return;
+        }
+        Element xx, yy, yyyy, zz, s, m, t;
+        field.sqr(xx, p.x);
+        field.sqr(yy, p.y);
+        field.sqr(yyyy, yy);
+        field.sqr(zz, p.z);
+
+        field.add(s, p.x, yy);
+        field.sqr(s, s);
+        field.sub(s, s, xx);
+        field.sub(s, s, yyyy);
+        field.add(s, s, s);
+
+        if (a_minus_three) {
+            Element u, v;
+            field.sub(u, p.x, zz);
+            field.add(v, p.x, zz);
+            field.mul(m, u, v);
+            field.add(t, m, m);
+            field.add(m, t, m);
+        } else {
+            field.add(m, xx, xx);
+            field.add(m, m, xx);
+            if (!a_zero) {
+                field.sqr(t, zz);
+                field.mul(t, t, a);
+                field.add(m, m, t);
+            }
+        }
+
+        Element z3;
+        field.add(z3, p.y, p.z);
+        field.sqr(z3, z3);
+        field.sub(z3, z3, yy);
+        field.sub(r.z, z3, zz);
+
+        field.sqr(t, m);
+        field.sub(t, t, s);
+        field.sub(t, t, s);
+        field.sub(s, s, t);
+        field.mul(s, m, s);
+        field.add(yyyy, yyyy, yyyy);
+        field.add(yyyy, yyyy, yyyy);
+        field.add(yyyy, yyyy, yyyy);
+        field.sub(r.y, s, yyyy);
+        r.x = t;
+    }
+
+    // add-2007-bl; cai na dobra quando p == q
+    void add(Point& r, const Point& p, const Point& q) const {
+        if (isInfinity(p)) {
+            r = q;
+            return;
+        }
+        if (isInfinity(q)) {
+            r = p;
+            return;
+        }
+        Element z1z1, z2z2, u1, u2, s1, s2, h, i, j, rr, v;
+        field.sqr(z1z1, p.z);
+        field.sqr(z2z2, q.z);
+        field.mul(u1, p.x, z2z2);
+        field.mul(u2, q.x, z1z1);
+        field.mul(s1, p.y, q.z);
+        field.mul(s1, s1, z2z2);
+        field.mul(s2, q.y, p.z);
+        field.mul(s2, s2, z1z1);
+        field.sub(h, u2, u1);
+        field.sub(rr, s2, s1);
+        if (field.isZero(h)) {
+            if (field.isZero(rr)) {
+                dbl(r, p);
+            } else {
+                r = infinity();
+            }
+            return;
+        }
+        field.add(rr, rr, rr);
+        field.add(i, h, h);
+        field.sqr(i, i);
+        field.mul(j, h, i);
+        field.mul(v, u1, i);
+
+        Element z3;
+        field.add(z3, p.z, q.z);
+        field.sqr(z3, z3);
+        field.sub(z3, z3, z1z1);
+        field.sub(z3, z3, z2z2);
+        field.mul(r.z, z3, h);
+
+        Element x3;
+        field.sqr(x3, rr);
+        field.sub(x3, x3, j);
+        field.sub(x3, x3, v);
+        field.sub(x3, x3, v);
+
+        field.sub(v, v, x3);
+        field.mul(v, rr, v);
+        field.mul(s1, s1, j);
+        field.add(s1, s1, s1);
+        field.sub(r.y, v, s1);
+        r.x = x3;
+    }
+
+    // k P com janela fixa de 4 bits; escalar big-endian de qualquer tamanho.
+    // Não é tempo constante.
+    void mul(Point& r, const Point& p, const uint8_t* scalar, size_t len) const {
+        Point table[16];
+        table[0] = infinity();
+        table[1] = p;
+        for (int i = 2; i < 16; i++) add(table[i], table[i - 1], p);
+
+        Point acc = infinity();
+        for (size_t i = 0; i < len; i++) {
+            for (int shift = 4; shift >= 0; shift -= 4) {
+                for (int d = 0; d < 4; d++) dbl(acc, acc);
+                unsigned digit = (scalar[i] >> shift) & 15;
+                if (digit) add(acc, acc, table[digit]);
+            }
+        }
+        r = acc;
+    }
+
+private:
+    Field field;
+    Element a, b;
+    bool a_zero = false;
+    bool a_minus_three = false;
+};
+
+// Parâmetros das curvas com aritmética especializada: corpo da curva e corpo
+// dos escalares (ordem do gerador)
+struct Secp256k1FieldParams {
+    static constexpr size_t LIMBS = 4;
+    static constexpr Modulus<LIMBS> MODULUS = [] {
+        uint64_t p[LIMBS]{};
+        limbsFromHex("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F", p);
+        return makeModulus<LIMBS>(p, LIMBS);
+    }();
+};
+
+struct Secp256k1OrderParams {
+    static constexpr size_t LIMBS = 4;
+    static constexpr Modulus<LIMBS> MODULUS = [] {
+        uint64_t n[LIMBS]{};
+        limbsFromHex("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141", n);
+        return makeModulus<LIMBS>(n, LIMBS);
+    }();
+};
+
+struct P256FieldParams {
+    static constexpr size_t LIMBS = 4;
+    static constexpr Modulus<LIMBS> MODULUS = [] {
+        uint64_t p[LIMBS]{};
+        limbsFromHex("FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF", p);
+        return makeModulus<LIMBS>(p, LIMBS);
+    }();
+};
+
+struct P256OrderParams {
+    static constexpr size_t LIMBS = 4;
+    static constexpr Modulus<LIMBS> MODULUS = [] {
+        uint64_t n[LIMBS]{};
+        limbsFromHex("FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551", n);
+        return makeModulus<LIMBS>(n, LIMBS);
+    }();
+};
+
+struct P384FieldParams {
+    static constexpr size_t LIMBS = 6;
+    static constexpr Modulus<LIMBS> MODULUS = [] {
+        uint64_t p[LIMBS]{};
+        limbsFromHex("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF", p);
+        return makeModulus<LIMBS>(p, LIMBS);
+    }();
+};
+
+struct P384OrderParams {
+    static constexpr size_t LIMBS = 6;
+    static constexpr Modulus<LIMBS> MODULUS = [] {
+        uint64_t n[LIMBS]{};
+        limbsFromHex("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52973", n);
+        return makeModulus<LIMBS>(n, LIMBS);
+    }();
+};
+
+// Curva sobre um corpo primo dado por p, a e b em hex. Se os parâmetros
+// forem os de secp256k1, secp256r1 ou secp384r1 a curva usa a aritmética
+// especializada e ECDSA compatível com createCurve. Qualquer outra curva
+// válida cai no corpo genérico: como a ordem do grupo não é conhecida, o
+// gerador sai de um hash dos parâmetros e as assinaturas são Schnorr no
+// esquema GPS (s = k + e x sem redução, com k bem maior que e x), que não
+// precisa da ordem. nullptr se p não for primo ímpar de até 576 bits ou se
+// a curva for singular.
+std::unique_ptr<IEllipticCurve> createPrimeFieldCurve(const std::string& p, const std::string& a, const std::string& b);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_FIELD_H
@@ -0,0 +1,89 @@
+#ifndef ADILSONCRYPTO_GOLDILOCKS_H
+#define ADILSONCRYPTO_GOLDILOCKS_H
+
+#include "adilsoncrypto_pool.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace adilsoncrypto {
+
+// Corpo de Goldilocks: p = 2^64 - 2^32 + 1. Elementos são uint64_t canônicos
+// (< p). Como 2^64 = 2^32 - 1 e 2^96 = -1 (mod p), o produto de 128 bits é
+// reduzido com somas e subtrações, sem divisão. O grupo multiplicativo tem
+// subgrupos de ordem 2^k para todo k <= 32, o que permite NTTs de até 2^32.
+const uint64_t GOLDILOCKS_P = 0xFFFFFFFF00000001ULL;
+const uint64_t GOLDILOCKS_EPSILON = 0xFFFFFFFFULL;       // 2^64 mod p
+const uint64_t GOLDILOCKS_GENERATOR = 7;                  // gera o grupo multiplicativo
+const unsigned GOLDILOCKS_TWO_ADICITY = 32;
+
+// Os ajustes de estouro dependem dos dados e acertam metade das vezes numa
+// NTT, então não podem virar saltos (uma previsão errada custa mais que a
+// borboleta inteira). GL_UNPREDICTABLE leva o GCC/Clang a usar cmov e
+// GL_OPAQUE esconde do otimizador que o valor é 0/1, impedindo que ele
+// funda os ajustes num desvio.
+#if defined(__GNUC__)
+#define GL_UNPREDICTABLE(condition) __builtin_expect_with_probability(!!(condition), 1, 0.5)
+#define GL_OPAQUE(value) __asm__("" : "+r"(value))
+#else
+#define GL_UNPREDICTABLE(condition) (condition)
+#define GL_OPAQUE(value) ((void)0)
+#endif
+
+inline uint64_t glSub(uint64_t a, uint64_t b) {
+    uint64_t d = a - b;
+    uint64_t fixed = d - GOLDILOCKS_EPSILON;   // d + 2^64 - EPSILON = d + p
+    return GL_UNPREDICTABLE(a < b) ? fixed : d;
+}
+
+inline uint64_t glAdd(uint64_t a, uint64_t b) {
+    return glSub(a, GOLDILOCKS_P - b);   // p - b em [1, p]
+}
+
+inline uint64_t glNeg(uint64_t a) {
+    return glSub(0, a);
+}
+
+inline uint64_t glReduce128(unsigned __int128 x) {
+    uint64_t lo = (uint64_t)x;
+    uint64_t hi = (uint64_t)(x >> 64);
+    uint64_t hi_hi = hi >> 32;
+    uint64_t hi_lo = hi & GOLDILOCKS_EPSILON;
+    // x = lo + 2^64 hi_lo + 2^96 hi_hi = lo + EPSILON hi_lo - hi_hi
+    uint64_t t0 = glSub(lo, hi_hi);   // lo < p não é garantido, mas o ajuste é o mesmo
+    unsigned __int128 sum = (unsigned __int128)t0 + hi_lo * GOLDILOCKS_EPSILON;
+    uint64_t carry = (uint64_t)(sum >> 64);
+    GL_OPAQUE(carry);
+    uint64_t r = (uint64_t)sum + carry * GOLDILOCKS_EPSILON;   // sem novo estouro
+    uint64_t reduced = r - GOLDILOCKS_P;
+    return GL_UNPREDICTABLE(r >= GOLDILOCKS_P) ? reduced : r;
+}
+
+inline uint64_t glMul(uint64_t a, uint64_t b) {
+    return glReduce128((unsigned __int128)a * b);
+}
+
+uint64_t glPow(uint64_t a, uint64_t e);
+uint64_t glInverse(uint64_t a);                       // a != 0
+// Inversos de n elementos não nulos com uma única inversão (truque de Montgomery)
+void glBatchInverse(const uint64_t* in, uint64_t* out, size_t n);
+// Raiz primitiva 2^log_n-ésima da unidade (log_n <= 32)
+uint64_t glRootOfUnity(unsigned log_n);
+
+// NTT de tamanho 2^log_n, entrada e saída em ordem natural, no lugar:
+// a[k] = sum_j a[j] w^(jk) com w = glRootOfUnity(log_n).
+// - Até 2^12 elementos (cabem na L1/L2): borboletas radix-4 após a
+//   permutação bit-reversa, com tabelas de fatores por estágio em cache.
+// - Acima disso, algoritmo de quatro passos: a matriz n1 x n2 é transposta
+//   em blocos, as linhas (NTTs pequenas independentes) rodam em paralelo com
+//   'pool' e os fatores de giro são aplicados junto com a primeira passada.
+void glNtt(uint64_t* a, unsigned log_n, ThreadPool* pool = nullptr);
+// Inversa (inclui a divisão por n)
+void glInverseNtt(uint64_t* a, unsigned log_n, ThreadPool* pool = nullptr);
+// Extensão de grau baixo: avalia o polinômio de coeficientes coeffs (2^log_n)
+// na classe lateral shift * <w>, |<w>| = 2^(log_n + log_blowup).
+void glCosetLde(const uint64_t* coeffs, unsigned log_n, unsigned log_blowup, uint64_t shift, uint64_t* out,
+                ThreadPool* pool = nullptr);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_GOLDILOCKS_H
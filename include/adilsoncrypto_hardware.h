@@ -0,0 +1,11 @@
+#ifndef ADILSONCRYPTO_HARDWARE_H
+#define ADILSONCRYPTO_HARDWARE_H
+
+#include "adilsoncrypto.h"
+#include <memory>
+
+// Backend "cpu-simd" de IHardwareAccelerator: kernels SHA-256 escolhidos por
+// CPUID, assinatura em lote no pool de threads e minerador SHA256d
+std::unique_ptr<IHardwareAccelerator> createCpuSimdAccelerator();
+
+#endif // ADILSONCRYPTO_HARDWARE_H
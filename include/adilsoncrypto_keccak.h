@@ -0,0 +1,75 @@
+#ifndef ADILSONCRYPTO_KECCAK_H
+#define ADILSONCRYPTO_KECCAK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace adilsoncrypto {
+
+// Permutação Keccak-f[1600] sobre 25 palavras de 64 bits
+void keccakF1600(uint64_t state[25]);
+
+// Quatro permutações independentes com o estado intercalado: a palavra i da
+// instância l fica em state[4 * i + l]. Usa o kernel AVX2 quando disponível.
+void keccakF1600x4(uint64_t state[100]);
+
+// Esponja Keccak genérica. 'rate' em bytes e byte de domínio do padding:
+// 0x01 = Keccak original (Ethereum), 0x06 = SHA-3, 0x1f = SHAKE.
+class KeccakSponge {
+public:
+    KeccakSponge(size_t rate, uint8_t domain);
+    void reset();
+    KeccakSponge& absorb(const uint8_t* data, size_t len);
+    KeccakSponge& absorb(const std::string& data);
+    // Após a primeira chamada a squeeze não é mais possível absorver
+    void squeeze(uint8_t* out, size_t len);
+
+private:
+    uint64_t state[25];
+    size_t rate;
+    size_t offset;
+    uint8_t domain;
+    bool squeezing;
+};
+
+// Keccak-256 do Ethereum (padding 0x01, não é o SHA3-256 do FIPS 202)
+class Keccak256Hasher : public KeccakSponge {
+public:
+    Keccak256Hasher() : KeccakSponge(136, 0x01) {}
+    void finalize(uint8_t out[32]) { squeeze(out, 32); }
+};
+
+void keccak256Digest(const uint8_t* data, size_t len, uint8_t out[32]);
+std::string keccak256Hex(const std::string& data);
+
+void sha3_256Digest(const uint8_t* data, size_t len, uint8_t out[32]);
+void sha3_512Digest(const uint8_t* data, size_t len, uint8_t out[64]);
+void shake128(const uint8_t* data, size_t len, uint8_t* out, size_t out_len);
+void shake256(const uint8_t* data, size_t len, uint8_t* out, size_t out_len);
+
+// Quatro esponjas SHAKE em paralelo (multi-buffer) sobre entradas do mesmo
+// tamanho, como as sementes da amostragem do ML-KEM. A entrada é absorvida
+// de uma vez e a saída pode ser espremida em várias chamadas.
+class ShakeX4 {
+public:
+    // rate 168 = SHAKE128, 136 = SHAKE256
+    ShakeX4(size_t rate, const uint8_t* const in[4], size_t len);
+    void squeeze(uint8_t* const out[4], size_t len);
+
+private:
+    uint64_t state[100];
+    size_t rate;
+    size_t offset;
+};
+
+void shake128x4(const uint8_t* const in[4], size_t in_len, uint8_t* const out[4], size_t out_len);
+void shake256x4(const uint8_t* const in[4], size_t in_len, uint8_t* const out[4], size_t out_len);
+
+// Interno: constantes de rodada e kernel AVX2 (adilsoncrypto_keccak_avx2.cpp)
+extern const uint64_t KECCAK_RC[24];
+void keccakF1600x4Avx2(uint64_t state[100]);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_KECCAK_H
@@ -0,0 +1,96 @@
+#ifndef ADILSONCRYPTO_KEYSTORE_H
+#define ADILSONCRYPTO_KEYSTORE_H
+
+#include "adilsoncrypto.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace adilsoncrypto {
+
+// Registro de tamanho fixo, gravado como está no arquivo
+struct KeystoreRecord {
+    char address[64];          // terminado em zero (até 63 caracteres)
+    uint8_t public_key[33];    // secp256k1 comprimida
+    uint8_t flags;             // KEYSTORE_HAS_PRIVATE
+    uint8_t reserved[2];
+    uint8_t nonce[12];         // AES-256-GCM; endereço e chave pública são o AAD
+    uint8_t private_key[32];   // cifrada
+    uint8_t tag[16];
+};
+static_assert(sizeof(KeystoreRecord) == 160, "KeystoreRecord precisa de layout fixo");
+
+const uint8_t KEYSTORE_HAS_PRIVATE = 1;
+
+struct MappedFile;   // adilsoncrypto_mmap.h
+
+// Keystore em disco mapeado em memória. O arquivo tem um cabeçalho, dois
+// índices de endereçamento aberto (por endereço e por chave pública) e a
+// tabela de registros, todos pré-alocados para 'capacity' chaves:
+//   - abrir só mapeia o arquivo e confere o cabeçalho (o custo não depende
+//     do número de chaves, fora o PBKDF2 da senha);
+//   - findByAddress/findByPublicKey fazem uma sondagem linear no índice e
+//     devolvem um ponteiro para o registro mapeado, sem alocar;
+//   - add grava o registro, depois as entradas de índice e por último a
+//     contagem, sincronizando cada etapa: uma queda no meio deixa a chave
+//     invisível, nunca um índice apontando para lixo. Quando a capacidade
+//     acaba, o arquivo é reconstruído com o dobro e trocado por rename.
+//
+// Leituras concorrentes são seguras; add e close exigem acesso exclusivo, e
+// um add que cresce o arquivo invalida os ponteiros devolvidos antes.
+class Keystore {
+public:
+    static const uint32_t DEFAULT_KDF_ITERATIONS = 200000;
+
+    Keystore();
+    ~Keystore();
+
+    Keystore(const Keystore&) = delete;
+    Keystore& operator=(const Keystore&) = delete;
+
+    // Cria (ou sobrescreve) o arquivo. Senha vazia: só chaves públicas.
+    bool create(const std::string& path, const std::string& passphrase, uint64_t capacity,
+                uint32_t kdf_iterations = DEFAULT_KDF_ITERATIONS);
+    // Senha vazia abre só para consulta; senha errada falha
+    bool open(const std::string& path, const std::string& passphrase = "");
+    void close();
+
+    bool isOpen() const { return data != nullptr; }
+    bool canDecrypt() const { return has_key; }
+    uint64_t size() const;
+    uint64_t capacity() const;
+
+    // Chave pública em hex (65 bytes "04..." ou 33 comprimida); a privada é
+    // opcional e exige o keystore aberto com senha. Falha em endereço
+    // repetido ou chave pública fora da curva.
+    bool add(const KeyPair& keypair);
+
+    const KeystoreRecord* findByAddress(const std::string& address) const;
+    const KeystoreRecord* findByPublicKey(const uint8_t compressed[33]) const;
+    const KeystoreRecord* findByPublicKey(const std::string& public_key_hex) const;
+    const KeystoreRecord* record(uint64_t index) const;
+
+    // Decifra a chave privada do registro
+    bool privateKey(const KeystoreRecord& record, uint8_t out[32]) const;
+    // Remonta o KeyPair no formato de texto da biblioteca
+    bool load(const KeystoreRecord& record, KeyPair& keypair) const;
+
+private:
+    bool mapFile(const std::string& path, bool create, uint64_t capacity, uint64_t index_slots);
+    bool deriveKey(const std::string& passphrase);
+    bool grow();
+    void repair();
+    void flush(const void* begin, size_t len) const;
+    const KeystoreRecord* find(int index, const uint8_t* key, size_t len) const;
+
+    std::string path;
+    std::unique_ptr<MappedFile> file;
+    uint8_t* data;
+    bool has_key;
+    uint8_t key[32];
+};
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_KEYSTORE_H
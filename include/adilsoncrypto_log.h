@@ -0,0 +1,111 @@
+#ifndef ADILSONCRYPTO_LOG_H
+#define ADILSONCRYPTO_LOG_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace adilsoncrypto {
+
+// Prefixo LOG_ porque ERROR e DEBUG costumam ser macros (windows.h, -DDEBUG)
+enum class LogLevel : uint8_t {
+    LOG_TRACE,
+    LOG_DEBUG,
+    LOG_INFO,
+    LOG_WARN,
+    LOG_ERROR,
+    LOG_OFF
+};
+
+// "trace", "debug", "info", "warn"/"warning", "error", "off" (sem caixa)
+bool parseLogLevel(const std::string& name, LogLevel& level);
+const char* logLevelName(LogLevel level);
+
+struct LogRing;
+
+// Logger assíncrono. Cada thread escreve num anel próprio (um produtor, um
+// consumidor) sem trava nem alocação; uma thread de drenagem, criada no
+// primeiro registro, junta os anéis em ordem de horário, formata as linhas,
+// grava no console (se houver) e guarda as últimas 'history_limit' no
+// histórico. Anel cheio descarta a mensagem e conta o descarte, nunca
+// bloqueia quem registra.
+class Logger {
+public:
+    static const size_t DEFAULT_HISTORY = 1024;
+    static const size_t MAX_MESSAGE = 240;   // bytes por registro; o resto é truncado
+
+    explicit Logger(size_t history_limit = DEFAULT_HISTORY);
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    void setEnabled(bool enable) { enabled_flag.store(enable, std::memory_order_relaxed); }
+    void setLevel(LogLevel level) { min_level.store(level, std::memory_order_relaxed); }
+    LogLevel level() const { return min_level.load(std::memory_order_relaxed); }
+    // Destino das linhas drenadas (padrão stderr); nullptr: só histórico
+    void setConsole(FILE* out);
+
+    // Duas leituras relaxadas: é o custo de um registro filtrado
+    bool enabled(LogLevel level) const {
+        return level != LogLevel::LOG_OFF && enabled_flag.load(std::memory_order_relaxed) &&
+               level >= min_level.load(std::memory_order_relaxed);
+    }
+
+    // Registra texto já formatado (sem conferir o nível)
+    void write(LogLevel level, const char* text, size_t len);
+    void write(LogLevel level, const std::string& text) { write(level, text.data(), text.size()); }
+
+    // Formata só se o nível passar: format() -> std::string
+    template <typename Format>
+    void log(LogLevel level, Format&& format) {
+        if (enabled(level)) write(level, format());
+    }
+
+    // Drena os anéis na thread chamadora
+    void flush();
+    std::vector<std::string> history();
+    void clearHistory();
+    uint64_t dropped() const { return dropped_total.load(std::memory_order_relaxed); }
+
+private:
+    LogRing* ringForThread();
+    void startDrainer();
+    void drainerLoop();
+    void drain();
+
+    const uint64_t id;
+    const size_t history_limit;
+    std::atomic<bool> enabled_flag;
+    std::atomic<LogLevel> min_level;
+    std::atomic<uint64_t> dropped_total;
+
+    std::mutex rings_mutex;                      // registro de anéis (uma vez por thread)
+    std::vector<std::shared_ptr<LogRing>> rings;
+
+    std::mutex drain_mutex;                      // lado consumidor: drenagem e histórico
+    std::deque<std::string> lines;
+    FILE* console;
+
+    std::once_flag drainer_once;
+    std::thread drainer;
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    bool stopping;
+};
+
+// Logger do processo para componentes criados sem uma AdilsonCrypto
+// (aceleradores, interfaces de blockchain); grava em stderr
+Logger& libraryLogger();
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_LOG_H
@@ -0,0 +1,65 @@
+#ifndef ADILSONCRYPTO_MERKLE_H
+#define ADILSONCRYPTO_MERKLE_H
+
+#include "adilsoncrypto_miner.h"
+#include "adilsoncrypto_pool.h"
+#include "adilsoncrypto_sha256.h"
+#include <cstddef>
+#include <vector>
+
+namespace adilsoncrypto {
+
+// Prova de inclusão: irmãos da folha até a raiz. Em níveis de tamanho ímpar
+// o último nó é pareado consigo mesmo (regra do Bitcoin), e o irmão é ele próprio.
+struct MerkleProof {
+    size_t index = 0;
+    std::vector<Hash256> siblings;
+};
+
+// Árvore Merkle SHA256d no estilo Bitcoin que mantém todos os nós internos.
+// build() calcula os níveis com o kernel multi-buffer e subárvores em
+// paralelo; append() e update() recalculam só o caminho até a raiz, O(log n).
+class MerkleTree {
+public:
+    explicit MerkleTree(ThreadPool* pool = nullptr);
+
+    void setKernel(Sha256Kernel kernel);
+
+    void build(const std::vector<Hash256>& leaves);
+    void build(const uint8_t* leaves, size_t count);   // count * 32 bytes
+    void append(const Hash256& leaf);
+    void update(size_t index, const Hash256& leaf);
+    void clear();
+
+    size_t size() const;
+    size_t depth() const;
+    Hash256 root() const;
+    Hash256 leaf(size_t index) const;
+
+    MerkleProof proof(size_t index) const;
+    std::vector<MerkleProof> proofs(const std::vector<size_t>& indices) const;
+
+    static Hash256 computeRoot(const Hash256& leaf, const MerkleProof& proof);
+    static bool verify(const Hash256& leaf, const MerkleProof& proof, const Hash256& root);
+    // Verifica várias provas de uma vez: a cada nível, os pares de todas as
+    // provas são hasheados juntos no kernel multi-buffer.
+    static std::vector<bool> verifyBatch(const std::vector<Hash256>& leaves, const std::vector<MerkleProof>& proofs,
+                                         const Hash256& root, Sha256Kernel kernel = Sha256Kernel::AUTO);
+
+private:
+    void buildUpperLevels(size_t from_level);
+    void buildSubtrees(size_t subtree_levels);
+    void recomputeParent(size_t level, size_t parent);
+
+    // levels[0] = folhas; levels.back() = raiz (1 nó). 32 bytes por nó.
+    std::vector<std::vector<uint8_t>> levels;
+    ThreadPool* pool;
+    Sha256Kernel kernel;
+};
+
+// Raiz de uma lista de folhas sem manter a árvore
+Hash256 merkleRoot(const std::vector<Hash256>& leaves, ThreadPool* pool = nullptr);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_MERKLE_H
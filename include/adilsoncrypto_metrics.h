@@ -0,0 +1,116 @@
+#ifndef ADILSONCRYPTO_METRICS_H
+#define ADILSONCRYPTO_METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace adilsoncrypto {
+
+// Operações públicas medidas. Prefixo OP_ pelo mesmo motivo do LogLevel.
+enum class MetricOp : uint8_t {
+    OP_KEYGEN,
+    OP_SIGN,
+    OP_VERIFY,
+    OP_ADDRESS,
+    OP_SHA256,
+    OP_SHA512,
+    OP_RIPEMD160,
+    OP_KECCAK256,
+    OP_BLAKE3,
+    OP_AES_ENCRYPT,
+    OP_AES_DECRYPT,
+    OP_CHACHA20_ENCRYPT,
+    OP_CHACHA20_DECRYPT,
+    OP_LATTICE_ENCRYPT,
+    OP_LATTICE_DECRYPT,
+    OP_PBKDF2,
+    OP_SCRYPT,
+    OP_ARGON2,
+    OP_COUNT
+};
+
+// "keygen", "sign", "sha256", "aes_encrypt", ... (rótulo op do texto)
+const char* metricOpName(MetricOp op);
+
+// Histograma log-linear no estilo HDR: 16 faixas lineares por potência de 2,
+// ou seja, erro relativo de no máximo 1/16 (~6%) em qualquer percentil, de
+// 1 ns até ~18 minutos (acima disso tudo cai na última faixa).
+const unsigned METRIC_SUB_BUCKET_BITS = 4;
+const unsigned METRIC_MAX_EXPONENT = 40;
+const size_t METRIC_BUCKETS = (METRIC_MAX_EXPONENT - METRIC_SUB_BUCKET_BITS + 1) << METRIC_SUB_BUCKET_BITS;
+
+size_t metricBucket(uint64_t ns);
+// Menor e maior valor (ns) que caem na faixa
+uint64_t metricBucketLow(size_t bucket);
+uint64_t metricBucketHigh(size_t bucket);
+
+struct OperationMetrics {
+    MetricOp op = MetricOp::OP_COUNT;
+    uint64_t count = 0;
+    uint64_t bytes = 0;          // entrada processada, quando a operação tem uma
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+    std::vector<uint64_t> buckets;   // METRIC_BUCKETS contagens
+
+    double meanNs() const { return count ? (double)total_ns / count : 0; }
+    // q em [0, 1]; devolve o limite superior da faixa (0 sem amostras)
+    uint64_t percentileNs(double q) const;
+};
+
+struct MetricsSnapshot {
+    std::vector<OperationMetrics> operations;   // uma por MetricOp, na ordem do enum
+    uint64_t threads = 0;                       // threads que já registraram algo
+
+    const OperationMetrics& operator[](MetricOp op) const { return operations[(size_t)op]; }
+};
+
+// Métricas do processo inteiro, por thread e sem trava: cada thread soma só
+// no próprio bloco (uma leitura e uma escrita relaxadas por campo, sem
+// instrução atômica de leitura-modificação-escrita), e o snapshot soma os
+// blocos de todas. Os contadores só crescem; o bloco de uma thread que saiu
+// é reaproveitado pela próxima. Ligadas por padrão; desligadas, o custo de
+// uma operação é uma leitura relaxada.
+void setMetricsEnabled(bool enable);
+bool metricsEnabled();
+
+void recordMetric(MetricOp op, uint64_t ns, uint64_t bytes = 0);
+MetricsSnapshot metricsSnapshot();
+// Diferença entre dois snapshots (after - before): a janela entre eles
+MetricsSnapshot metricsDelta(const MetricsSnapshot& before, const MetricsSnapshot& after);
+
+// Formato de exposição em texto do Prometheus: contagem, bytes e histograma
+// (faixas em potências de 2, em segundos) de cada operação já usada, mais
+// p50/p90/p99/p999 e máximo prontos para leitura.
+std::string metricsText(const MetricsSnapshot& snapshot);
+std::string metricsText();
+
+// Mede o escopo: relógio monotônico na entrada e na saída
+class MetricTimer {
+public:
+    explicit MetricTimer(MetricOp op, uint64_t bytes = 0) : op(op), bytes(bytes), active(metricsEnabled()) {
+        if (active) start = std::chrono::steady_clock::now();
+    }
+    ~MetricTimer() {
+        if (active) {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            recordMetric(op, (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(), bytes);
+        }
+    }
+
+    MetricTimer(const MetricTimer&) = delete;
+    MetricTimer& operator=(const MetricTimer&) = delete;
+
+private:
+    MetricOp op;
+    uint64_t bytes;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_METRICS_H
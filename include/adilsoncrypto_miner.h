@@ -0,0 +1,85 @@
+#ifndef ADILSONCRYPTO_MINER_H
+#define ADILSONCRYPTO_MINER_H
+
+#include "adilsoncrypto_sha256.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace adilsoncrypto {
+
+typedef std::array<uint8_t, 32> Hash256;
+
+// Trabalho de mineração SHA256d sobre um cabeçalho de 80 bytes.
+// Alvo e hashes usam a ordem interna do Bitcoin (uint256 little-endian).
+struct MiningJob {
+    uint8_t header[80] = {};
+    uint8_t target[32] = {};
+
+    // Rolagem de extranonce (opcional). Com coinbase vazio apenas o nonce
+    // varia; caso contrário cada extranonce gera um novo merkle root a partir
+    // de coinbase_prefix || extranonce (LE) || coinbase_suffix e do ramo.
+    std::string coinbase_prefix;
+    std::string coinbase_suffix;
+    size_t extranonce_size = 4;
+    std::vector<Hash256> merkle_branch;
+    uint64_t extranonce_start = 0;
+    uint64_t extranonce_count = 1;
+};
+
+struct MinerThreadStats {
+    uint64_t hashes = 0;
+    double seconds = 0;
+    double hashes_per_second = 0;
+};
+
+struct MiningResult {
+    bool found = false;
+    uint8_t header[80] = {};
+    uint8_t hash[32] = {};
+    uint32_t nonce = 0;
+    uint64_t extranonce = 0;
+    uint64_t total_hashes = 0;
+    double seconds = 0;
+    double hashes_per_second = 0;
+    std::string kernel;
+    std::vector<MinerThreadStats> threads;
+};
+
+// Minerador multi-thread: pré-calcula o midstate dos primeiros 64 bytes e
+// varre o espaço (extranonce, nonce) em blocos distribuídos entre as threads,
+// usando o kernel SHA256d de várias lanes selecionado por CPUID.
+class CpuMiner {
+public:
+    CpuMiner();
+
+    void setThreadCount(unsigned threads);   // 0 = todos os núcleos
+    void setKernel(Sha256Kernel kernel);
+    void setMaxHashes(uint64_t max_hashes);  // 0 = espaço inteiro (modo benchmark usa limite)
+    unsigned threadCount() const;
+
+    MiningResult mine(const MiningJob& job);
+    void stop();
+
+private:
+    unsigned threads;
+    Sha256Kernel kernel;
+    uint64_t max_hashes;
+    std::atomic<bool> stop_requested;
+};
+
+// nBits compacto -> alvo de 256 bits
+bool compactToTarget(uint32_t bits, uint8_t target[32]);
+// Aceita 64 dígitos hex (alvo na ordem de exibição) ou 8 dígitos (nBits)
+bool parseTarget(const std::string& text, uint8_t target[32]);
+// Verdadeiro se hash <= alvo (ambos little-endian)
+bool hashMeetsTarget(const uint8_t hash[32], const uint8_t target[32]);
+// Hash na ordem de exibição (bytes invertidos), como nos exploradores de blocos
+std::string hashToDisplayHex(const uint8_t hash[32]);
+std::string formatMiningReport(const MiningResult& result);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_MINER_H
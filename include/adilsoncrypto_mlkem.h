@@ -0,0 +1,81 @@
+#ifndef ADILSONCRYPTO_MLKEM_H
+#define ADILSONCRYPTO_MLKEM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace adilsoncrypto {
+
+// ML-KEM (FIPS 203, antigo Kyber): KEM baseado em reticulados modulares,
+// anel Z_q[X]/(X^256 + 1) com q = 3329.
+enum class MlKemLevel {
+    ML_KEM_512,
+    ML_KEM_768,
+    ML_KEM_1024
+};
+
+struct MlKemParams {
+    MlKemLevel level;
+    const char* name;
+    int dimension;            // n * k: 512, 768 ou 1024
+    unsigned k;
+    unsigned eta1;
+    unsigned eta2;
+    unsigned du;
+    unsigned dv;
+    size_t encaps_key_bytes;  // 384k + 32
+    size_t decaps_key_bytes;  // 768k + 96 (contém a chave de encapsulamento)
+    size_t ciphertext_bytes;  // 32(du k + dv)
+};
+
+const size_t MLKEM_SEED_BYTES = 32;
+const size_t MLKEM_SHARED_SECRET_BYTES = 32;
+
+const MlKemParams& mlKemParams(MlKemLevel level);
+// Menor conjunto com n * k >= dimension (acima de 1024 usa ML-KEM-1024)
+MlKemLevel mlKemLevelForDimension(int dimension);
+
+// Geração de chaves com o gerador do OpenSSL; false se o RNG falhar
+bool mlKemKeyGen(MlKemLevel level, uint8_t* encaps_key, uint8_t* decaps_key);
+// Versão determinística (sementes d e z do FIPS 203)
+void mlKemKeyGenDerand(MlKemLevel level, const uint8_t d[32], const uint8_t z[32],
+                       uint8_t* encaps_key, uint8_t* decaps_key);
+
+// Retorna false se a chave falhar na verificação de módulo (coeficiente >= q)
+bool mlKemEncaps(MlKemLevel level, const uint8_t* encaps_key, uint8_t* ciphertext, uint8_t shared_secret[32]);
+bool mlKemEncapsDerand(MlKemLevel level, const uint8_t* encaps_key, const uint8_t m[32],
+                       uint8_t* ciphertext, uint8_t shared_secret[32]);
+
+// Retorna false apenas se a chave privada for inconsistente (hash da chave
+// pública embutida não confere). Um texto cifrado inválido não é erro: a
+// rejeição implícita devolve J(z || c), sem distinção observável.
+bool mlKemDecaps(MlKemLevel level, const uint8_t* decaps_key, const uint8_t* ciphertext, uint8_t shared_secret[32]);
+
+// Criptografia híbrida KEM-DEM: encapsula um segredo para a chave pública e
+// cifra os dados com AES-256-GCM sob esse segredo (nonce fixo: a chave é
+// nova a cada mensagem). Formato: ciphertext ML-KEM || tag (16) || dados.
+bool mlKemSeal(MlKemLevel level, const uint8_t* encaps_key, const uint8_t* data, size_t len, std::string& out);
+bool mlKemOpen(MlKemLevel level, const uint8_t* decaps_key, const uint8_t* sealed, size_t len, std::string& out);
+
+// "avx2" ou "scalar": kernel usado para NTT e multiplicação no domínio NTT
+const char* mlKemBackendName();
+
+// Interno: aritmética mod q compartilhada com o kernel AVX2
+// (adilsoncrypto_mlkem_avx2.cpp). Coeficientes em int16_t, redução de
+// Montgomery com R = 2^16.
+const int16_t MLKEM_Q = 3329;
+const int16_t MLKEM_QINV = -3327;   // q^-1 mod 2^16
+// zetas[i] = 17^bitrev7(i) * R mod q, representante centrado
+const int16_t* mlKemZetas();
+// R^2 / 128 mod q: normalização da NTT inversa (devolve em forma normal)
+const int16_t MLKEM_INVNTT_F = 1441;
+
+void mlKemNttAvx2(int16_t r[256]);
+void mlKemInvNttAvx2(int16_t r[256]);
+void mlKemBasemulAvx2(int16_t r[256], const int16_t a[256], const int16_t b[256]);
+void mlKemReduceAvx2(int16_t r[256]);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_MLKEM_H
@@ -0,0 +1,43 @@
+#ifndef ADILSONCRYPTO_MMAP_H
+#define ADILSONCRYPTO_MMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace adilsoncrypto {
+
+// Arquivo inteiro mapeado em memória (MAP_SHARED no POSIX). Usado pelo
+// keystore e pela lista de observação de endereços.
+struct MappedFile {
+#if defined(_WIN32)
+    void* handle = nullptr;    // HANDLE do arquivo
+    void* mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+    uint8_t* data = nullptr;
+    uint64_t size = 0;
+    bool writable = false;
+
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // create: cria ou trunca o arquivo com 'bytes' (esparso, não escreve nada).
+    // Sem writable o mapeamento é só de leitura e as páginas são as mesmas do
+    // cache do sistema, compartilhadas entre processos.
+    bool open(const std::string& path, bool create, uint64_t bytes, bool writable = true);
+    // Grava no disco a faixa [begin, begin + len) do mapeamento
+    void flush(const void* begin, size_t len);
+    void close();
+};
+
+// Troca 'to' por 'from' de forma atômica e durável (rename + fsync do diretório)
+bool replaceFile(const std::string& from, const std::string& to);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_MMAP_H
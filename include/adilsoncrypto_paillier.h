@@ -0,0 +1,98 @@
+#ifndef ADILSONCRYPTO_PAILLIER_H
+#define ADILSONCRYPTO_PAILLIER_H
+
+#include "adilsoncrypto.h"
+#include "adilsoncrypto_pool.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <openssl/bn.h>
+
+namespace adilsoncrypto {
+
+// Paillier com g = n + 1: Enc(m) = (1 + m n) r^n mod n^2, então g^m custa
+// uma multiplicação e o trabalho da cifragem é só r^n. Textos cifrados são
+// big-endian com tamanho fixo ciphertextBytes(); mensagens são inteiros com
+// sinal (m e n - |m| representam m e -m).
+//
+// - Os fatores r^n ficam numa fila preenchida por uma thread de fundo; com
+//   a chave privada r^n é calculado por CRT módulo p^2 e q^2.
+// - A decifragem usa CRT (exponenciações módulo p^2 e q^2).
+// - add é uma multiplicação de Montgomery módulo n^2; sum multiplica lotes
+//   no domínio de Montgomery, em paralelo com 'pool'.
+// Todos os métodos const podem ser chamados de várias threads.
+class Paillier {
+public:
+    Paillier();
+    ~Paillier();
+
+    Paillier(const Paillier&) = delete;
+    Paillier& operator=(const Paillier&) = delete;
+
+    // Gera p, q primos de modulus_bits / 2 bits; false se o OpenSSL falhar
+    bool generateKey(int modulus_bits = 2048);
+    // Só a chave pública (agregadores): cifra, soma e multiplica por escalar
+    bool setPublicKey(const uint8_t* n, size_t len);
+
+    bool hasPrivateKey() const { return p != nullptr; }
+    int modulusBits() const;
+    size_t ciphertextBytes() const { return cipher_bytes; }
+    std::vector<uint8_t> publicKey() const;   // n, big-endian
+
+    // Tamanho da fila de fatores r^n pré-calculados (0 desliga a thread)
+    void setPrecomputeCapacity(size_t capacity);
+    size_t precomputedAvailable() const;
+
+    bool encrypt(int64_t m, uint8_t* out) const;
+    // false sem chave privada, com texto cifrado inválido ou se o valor
+    // decifrado não couber em int64_t
+    bool decrypt(const uint8_t* c, int64_t& m) const;
+
+    bool add(const uint8_t* a, const uint8_t* b, uint8_t* out) const;
+    bool multiplyScalar(const uint8_t* c, int64_t k, uint8_t* out) const;
+    // Produto de 'count' textos cifrados (soma dos valores); com count = 0
+    // devolve uma cifragem trivial de zero (1)
+    bool sum(const uint8_t* const* cs, size_t count, uint8_t* out, ThreadPool* pool = nullptr) const;
+
+private:
+    void clear();
+    void stopPrecompute();
+    void precomputeLoop();
+    // r^n mod n^2 em forma de Montgomery, com r aleatório
+    bool randomFactor(BIGNUM* out, BN_CTX* ctx) const;
+    bool load(const uint8_t* c, BIGNUM* out) const;
+    void store(const BIGNUM* c, uint8_t* out) const;
+
+    BIGNUM* n;
+    BIGNUM* n2;
+    BN_MONT_CTX* mont_n2;
+    size_t cipher_bytes;
+
+    // Chave privada (nulos para chave só pública)
+    BIGNUM *p, *q, *p2, *q2;
+    BIGNUM *p_minus_1, *q_minus_1;
+    BIGNUM *hp, *hq;              // L_p(g^(p-1) mod p^2)^-1 mod p, idem q
+    BIGNUM *q_inv_p;              // q^-1 mod p
+    BIGNUM *q2_inv_p2;            // q^2^-1 mod p^2 (CRT de r^n)
+    BIGNUM *n_mod_phi_p2, *n_mod_phi_q2;
+    BN_MONT_CTX *mont_p2, *mont_q2;
+
+    mutable std::mutex queue_mutex;
+    mutable std::condition_variable queue_wake;
+    mutable std::deque<std::vector<uint8_t>> factors;
+    size_t capacity;
+    bool stopping;
+    std::thread worker;
+};
+
+} // namespace adilsoncrypto
+
+// IHomomorphicEncryption sobre Paillier com chave nova de modulus_bits
+std::unique_ptr<IHomomorphicEncryption> createPaillierEncryption(int modulus_bits = 2048);
+
+#endif // ADILSONCRYPTO_PAILLIER_H
@@ -0,0 +1,74 @@
+#ifndef ADILSONCRYPTO_POOL_H
+#define ADILSONCRYPTO_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace adilsoncrypto {
+
+// Pool de threads com roubo de trabalho para as APIs em lote. parallelFor
+// divide [0, count) em blocos de 'grain' itens e reparte os blocos em faixas
+// contíguas, uma por thread; cada thread consome a própria faixa pela frente
+// e, quando ela acaba, rouba a metade final da faixa de outra. A thread
+// chamadora também trabalha, então um pool de N threads usa N-1 workers
+// auxiliares. Se o pool já estiver ocupado (outra thread ou uma chamada
+// aninhada de dentro de fn), parallelFor roda o laço inteiro na thread
+// chamadora em vez de esperar.
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const { return thread_count.load(std::memory_order_relaxed); }
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn);
+    // Troca o número de threads (0 = núcleos); espera o trabalho em andamento
+    void resize(unsigned threads);
+
+    static unsigned defaultThreadCount();
+
+private:
+    // Faixa de blocos [início, fim) de uma thread, 32 bits cada, numa linha
+    // de cache própria para que dono e ladrões só disputem ao roubar
+    struct alignas(64) Range {
+        std::atomic<uint64_t> bounds;
+    };
+
+    void startWorkers(unsigned threads);
+    void stopWorkers();
+    void workerLoop(unsigned index);
+    void participate(unsigned index);
+    bool popLocal(unsigned index, uint32_t& chunk);
+    bool steal(unsigned index, uint32_t& chunk);
+
+    std::vector<std::thread> workers;
+    std::unique_ptr<Range[]> ranges;
+    std::atomic<unsigned> thread_count;
+    std::atomic<bool> busy;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(size_t, size_t)>* job;
+    size_t job_count;
+    size_t job_grain;
+    size_t active;
+    unsigned long generation;
+    bool stopping;
+};
+
+// Pool compartilhado pelos componentes da biblioteca (criado sob demanda;
+// AdilsonCrypto::setThreadCount ajusta o tamanho)
+ThreadPool& defaultThreadPool();
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_POOL_H
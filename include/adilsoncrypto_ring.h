@@ -0,0 +1,100 @@
+#ifndef ADILSONCRYPTO_RING_H
+#define ADILSONCRYPTO_RING_H
+
+#include "adilsoncrypto.h"
+#include "adilsoncrypto_pool.h"
+#include "adilsoncrypto_util.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+#include <openssl/ec.h>
+
+namespace adilsoncrypto {
+
+const size_t RING_POINT_BYTES = 33;     // ponto secp256k1 comprimido
+const size_t RING_SCALAR_BYTES = 32;
+
+// Anel de chaves públicas secp256k1 decodificado uma única vez: pontos P_i,
+// H_p(P_i) (hash para a curva) e o hash do anel, reutilizados por todas as
+// assinaturas e verificações sobre o mesmo conjunto de chaves.
+class RingContext {
+public:
+    RingContext() = default;
+    ~RingContext();
+
+    RingContext(const RingContext&) = delete;
+    RingContext& operator=(const RingContext&) = delete;
+
+    // Chaves SEC1 comprimidas (33 bytes) ou não comprimidas (65 bytes);
+    // false se alguma não for um ponto válido da curva
+    bool init(const std::vector<ByteView>& public_keys);
+
+    size_t size() const { return keys.size(); }
+    const uint8_t* ringHash() const { return ring_hash; }
+    // Índice da chave (comprimida) no anel, ou -1
+    long indexOf(const uint8_t public_key[RING_POINT_BYTES]) const;
+
+    const EC_POINT* key(size_t i) const { return keys[i]; }
+    const EC_POINT* hashedKey(size_t i) const { return hashed[i]; }
+    const uint8_t* compressedKey(size_t i) const { return &compressed[i * RING_POINT_BYTES]; }
+
+private:
+    void clear();
+
+    std::vector<EC_POINT*> keys;
+    std::vector<EC_POINT*> hashed;     // H_p(P_i)
+    std::vector<uint8_t> compressed;   // 33 bytes por chave
+    uint8_t ring_hash[32] = {};
+};
+
+// Assinatura em anel linkable (LSAG) sobre secp256k1. A prova é o OR das
+// igualdades de log discreto log_G(P_i) = log_{H_p(P_i)}(I) com desafios
+// independentes que somam o desafio de Fiat-Shamir, então os pares
+// L_i = s_i G + c_i P_i e R_i = s_i H_p(P_i) + c_i I de cada membro são
+// calculados em paralelo (com 'pool'). A imagem de chave I = x H_p(P) é a
+// mesma em toda assinatura da mesma chave privada: duas assinaturas com o
+// mesmo I vêm do mesmo signatário.
+//
+// Formato: I (33) || (c_i || s_i) para cada membro (64 bytes cada).
+size_t lsagSignatureBytes(size_t ring_size);
+bool lsagSign(const RingContext& ring, const uint8_t* message, size_t len, const uint8_t private_key[32],
+              std::vector<uint8_t>& signature, ThreadPool* pool = nullptr);
+bool lsagVerify(const RingContext& ring, const uint8_t* message, size_t len, const uint8_t* signature,
+                size_t signature_len, ThreadPool* pool = nullptr);
+
+// Conjunto de imagens de chave já vistas (detecção de gasto duplo).
+// Dividido em fatias com trava própria; o hash é lido direto dos bytes de x,
+// que já são uniformes.
+class KeyImageSet {
+public:
+    // true se a imagem é nova (e passa a constar no conjunto)
+    bool insert(const uint8_t key_image[RING_POINT_BYTES]);
+    bool contains(const uint8_t key_image[RING_POINT_BYTES]) const;
+    size_t size() const;
+
+private:
+    typedef std::array<uint8_t, RING_POINT_BYTES> Image;
+    struct ImageHash {
+        size_t operator()(const Image& image) const;
+    };
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_set<Image, ImageHash> images;
+    };
+    static const size_t SHARDS = 16;
+    Shard shards[SHARDS];
+};
+
+} // namespace adilsoncrypto
+
+// IMultiSignature com assinaturas em anel LSAG. private_key é hex (como em
+// KeyPair), public_keys são chaves SEC1 em hex. Signature: r = imagem de
+// chave, s = hash do anel, v = "lsag-secp256k1", proof = assinatura em hex.
+// participants > 0 fixa o tamanho do anel aceito.
+std::unique_ptr<IMultiSignature> createLsagRingSignature(int participants = 0);
+
+#endif // ADILSONCRYPTO_RING_H
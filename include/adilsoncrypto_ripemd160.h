@@ -0,0 +1,46 @@
+#ifndef ADILSONCRYPTO_RIPEMD160_H
+#define ADILSONCRYPTO_RIPEMD160_H
+
+#include "adilsoncrypto_sha256.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace adilsoncrypto {
+
+const size_t RIPEMD160_BLOCK_BYTES = 64;
+const size_t RIPEMD160_HASH_BYTES = 20;
+const size_t RIPEMD160_MAX_LANES = 16;
+
+extern const uint32_t RIPEMD160_IV[5];
+
+// Backend multi-lane: comprime 'lanes' blocos independentes por chamada.
+// Estados em layout [lane][5]; blocos são ponteiros para 64 bytes cada.
+struct Ripemd160LaneBackend {
+    const char* name;
+    size_t lanes;
+    void (*compress)(uint32_t* states, const uint8_t* const* blocks);
+};
+
+// O mesmo Sha256Kernel escolhe as duas famílias: SCALAR, SSE2 (4 lanes),
+// AVX2 (8) e AVX512 (16) têm kernel próprio; SHANI e AUTO usam o de mais
+// lanes suportado pelo CPU (o RIPEMD-160 não tem instrução dedicada).
+const Ripemd160LaneBackend& ripemd160LaneBackend(Sha256Kernel kernel = Sha256Kernel::AUTO);
+
+void ripemd160Digest(const uint8_t* data, size_t len, uint8_t out[RIPEMD160_HASH_BYTES]);
+
+// hash160 = RIPEMD-160(SHA-256(m)) de 'count' mensagens de mesmo tamanho
+// 'len' (chaves públicas de 33 ou 65 bytes). Em grupos de até 16: o SHA-256
+// multi-lane escreve os digests direto nos blocos já com padding do
+// RIPEMD-160, que roda em seguida no kernel de lanes. Sem alocação; 'out'
+// recebe count * 20 bytes.
+void hash160Many(const uint8_t* const* messages, size_t len, size_t count, uint8_t* out,
+                 Sha256Kernel kernel = Sha256Kernel::AUTO);
+
+// Mesmo cálculo para 'count' mensagens contíguas de 'len' bytes cada
+// (in[len*i .. len*i+len-1]), o caso de chaves derivadas em sequência
+void hash160Contiguous(const uint8_t* in, size_t len, size_t count, uint8_t* out,
+                       Sha256Kernel kernel = Sha256Kernel::AUTO);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_RIPEMD160_H
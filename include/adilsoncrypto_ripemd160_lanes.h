@@ -0,0 +1,131 @@
+#ifndef ADILSONCRYPTO_RIPEMD160_LANES_H
+#define ADILSONCRYPTO_RIPEMD160_LANES_H
+
+// Núcleo RIPEMD-160 genérico sobre um "vetor de lanes", no mesmo esquema de
+// adilsoncrypto_sha256_lanes.h: cada unidade SIMD instancia
+// Ripemd160Lanes<Ops> com tipos locais, sem conflito de ODR entre objetos
+// compilados com flags -m diferentes.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace adilsoncrypto {
+
+// Palavra da mensagem, deslocamento e constante de cada passo (linha
+// esquerda e direita); as funções booleanas vêm da rodada (passo / 16)
+static const uint8_t RIPEMD160_R_LEFT[80] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    7, 4, 13, 1, 10, 6, 15, 3, 12, 0, 9, 5, 2, 14, 11, 8,
+    3, 10, 14, 4, 9, 15, 8, 1, 2, 7, 0, 6, 13, 11, 5, 12,
+    1, 9, 11, 10, 0, 8, 12, 4, 13, 3, 7, 15, 14, 5, 6, 2,
+    4, 0, 5, 9, 7, 12, 2, 10, 14, 1, 3, 8, 11, 6, 15, 13
+};
+
+static const uint8_t RIPEMD160_R_RIGHT[80] = {
+    5, 14, 7, 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12,
+    6, 11, 3, 7, 0, 13, 5, 10, 14, 15, 8, 12, 4, 9, 1, 2,
+    15, 5, 1, 3, 7, 14, 6, 9, 11, 8, 12, 2, 10, 0, 4, 13,
+    8, 6, 4, 1, 3, 11, 15, 0, 5, 12, 2, 13, 9, 7, 10, 14,
+    12, 15, 10, 4, 1, 5, 8, 7, 6, 2, 13, 14, 0, 3, 9, 11
+};
+
+static const uint8_t RIPEMD160_S_LEFT[80] = {
+    11, 14, 15, 12, 5, 8, 7, 9, 11, 13, 14, 15, 6, 7, 9, 8,
+    7, 6, 8, 13, 11, 9, 7, 15, 7, 12, 15, 9, 11, 7, 13, 12,
+    11, 13, 6, 7, 14, 9, 13, 15, 14, 8, 13, 6, 5, 12, 7, 5,
+    11, 12, 14, 15, 14, 15, 9, 8, 9, 14, 5, 6, 8, 6, 5, 12,
+    9, 15, 5, 11, 6, 8, 13, 12, 5, 12, 13, 14, 11, 8, 5, 6
+};
+
+static const uint8_t RIPEMD160_S_RIGHT[80] = {
+    8, 9, 9, 11, 13, 15, 15, 5, 7, 7, 8, 11, 14, 14, 12, 6,
+    9, 13, 15, 7, 12, 8, 9, 11, 7, 7, 12, 7, 6, 15, 13, 11,
+    9, 7, 15, 11, 8, 6, 6, 14, 12, 13, 5, 14, 13, 13, 7, 5,
+    15, 5, 8, 11, 14, 14, 6, 14, 6, 9, 12, 9, 12, 5, 15, 8,
+    8, 5, 12, 9, 12, 5, 14, 6, 8, 13, 6, 5, 15, 13, 11, 11
+};
+
+static const uint32_t RIPEMD160_K_LEFT[5] = { 0x00000000, 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xa953fd4e };
+static const uint32_t RIPEMD160_K_RIGHT[5] = { 0x50a28be6, 0x5c4dd124, 0x6d703ef3, 0x7a6d76e9, 0x00000000 };
+
+static inline uint32_t ripemd160LoadLe32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void ripemd160StoreLe32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+// Ops deve fornecer: tipo vec, LANES, load/store (uint32_t alinhado), set1,
+// add, xor2, and2, or2, andnot (~a & b), ornot (a | ~b) e rotl(x, n).
+template <class Ops>
+struct Ripemd160Lanes {
+    typedef typename Ops::vec vec;
+    static const size_t LANES = Ops::LANES;
+
+    // f1..f5 da especificação; a linha direita usa a ordem inversa
+    static inline vec f(int round, vec x, vec y, vec z) {
+        switch (round) {
+        case 0: return Ops::xor2(Ops::xor2(x, y), z);
+        case 1: return Ops::or2(Ops::and2(x, y), Ops::andnot(x, z));
+        case 2: return Ops::xor2(Ops::ornot(x, y), z);
+        case 3: return Ops::or2(Ops::and2(x, z), Ops::andnot(z, y));
+        default: return Ops::xor2(x, Ops::ornot(y, z));
+        }
+    }
+
+    // 80 passos das duas linhas sobre s[5] com a mensagem w[16]
+    static inline void transform(vec s[5], const vec w[16]) {
+        vec al = s[0], bl = s[1], cl = s[2], dl = s[3], el = s[4];
+        vec ar = al, br = bl, cr = cl, dr = dl, er = el;
+#pragma GCC unroll 80
+        for (int i = 0; i < 80; i++) {
+            const int round = i >> 4;
+            vec t = Ops::add(Ops::add(al, f(round, bl, cl, dl)),
+                             Ops::add(w[RIPEMD160_R_LEFT[i]], Ops::set1(RIPEMD160_K_LEFT[round])));
+            t = Ops::add(Ops::rotl(t, RIPEMD160_S_LEFT[i]), el);
+            al = el; el = dl; dl = Ops::rotl(cl, 10); cl = bl; bl = t;
+
+            t = Ops::add(Ops::add(ar, f(4 - round, br, cr, dr)),
+                         Ops::add(w[RIPEMD160_R_RIGHT[i]], Ops::set1(RIPEMD160_K_RIGHT[round])));
+            t = Ops::add(Ops::rotl(t, RIPEMD160_S_RIGHT[i]), er);
+            ar = er; er = dr; dr = Ops::rotl(cr, 10); cr = br; br = t;
+        }
+        vec t = Ops::add(Ops::add(s[1], cl), dr);
+        s[1] = Ops::add(Ops::add(s[2], dl), er);
+        s[2] = Ops::add(Ops::add(s[3], el), ar);
+        s[3] = Ops::add(Ops::add(s[4], al), br);
+        s[4] = Ops::add(Ops::add(s[0], bl), cr);
+        s[0] = t;
+    }
+
+    // Estados em layout [lane][5]; blocos são ponteiros para 64 bytes cada
+    static void compressBlocks(uint32_t* states, const uint8_t* const* blocks) {
+        alignas(64) uint32_t tmp[LANES];
+        vec s[5], w[16];
+        for (int j = 0; j < 5; j++) {
+            for (size_t l = 0; l < LANES; l++) tmp[l] = states[l * 5 + j];
+            s[j] = Ops::load(tmp);
+        }
+        for (int t = 0; t < 16; t++) {
+            for (size_t l = 0; l < LANES; l++) tmp[l] = ripemd160LoadLe32(blocks[l] + 4 * t);
+            w[t] = Ops::load(tmp);
+        }
+        transform(s, w);
+        for (int j = 0; j < 5; j++) {
+            Ops::store(tmp, s[j]);
+            for (size_t l = 0; l < LANES; l++) states[l * 5 + j] = tmp[l];
+        }
+    }
+};
+
+// Kernels por conjunto de instruções (definidos nas unidades _avx2/_avx512)
+void ripemd160CompressAvx2(uint32_t* states, const uint8_t* const* blocks);
+void ripemd160CompressAvx512(uint32_t* states, const uint8_t* const* blocks);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_RIPEMD160_LANES_H
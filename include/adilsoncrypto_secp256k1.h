@@ -0,0 +1,68 @@
+#ifndef ADILSONCRYPTO_SECP256K1_H
+#define ADILSONCRYPTO_SECP256K1_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace adilsoncrypto {
+
+// Chaves e ECDSA secp256k1 sem alocação, sobre a aritmética especializada de
+// adilsoncrypto_field.h. Caminho usado por generateKeyPair/sign da curva
+// padrão e pelo daemon.
+//
+// - Tempo constante em relação aos segredos: k G sai de uma tabela fixa do
+//   gerador (64 janelas de 4 bits, 15 pontos afins cada, montada uma vez por
+//   processo) lida inteira a cada janela com máscaras, somada com as fórmulas
+//   completas de Renes-Costello-Batina (sem casos especiais nem desvios), e
+//   os inversos são potências com expoente público.
+// - Nonce determinístico (RFC 6979, HMAC-SHA256): não depende do gerador
+//   aleatório no caminho quente, e a mesma chave e digest dão a mesma
+//   assinatura.
+// - O estado que depende do segredo (chave, nonce, HMAC, acumulador e
+//   escalares) fica num rascunho da arena segura, um por thread, pego na
+//   primeira chamada e zerado ao fim de cada uma; só os temporários das
+//   operações de corpo passam pela pilha. Depois da primeira chamada numa
+//   thread, assinar não toca o heap geral (nem o do OpenSSL).
+//
+// Chaves privadas são 32 bytes big-endian em [1, n); as funções falham fora
+// disso. Guarde-as em memória da arena (SecureBuffer).
+const size_t SECP256K1_SECRET_BYTES = 32;
+const size_t SECP256K1_PUBLIC_KEY_BYTES = 65;   // 0x04 || x || y
+const size_t SECP256K1_SIGNATURE_BYTES = 64;    // r || s
+const size_t SECP256K1_KEY_SLOT_BYTES = 96;     // chave e o que a acompanha
+
+// Chave privada uniforme em [1, n) (RAND_priv_bytes com rejeição)
+bool secp256k1RandomSecret(uint8_t secret[SECP256K1_SECRET_BYTES]);
+bool secp256k1SecretValid(const uint8_t secret[SECP256K1_SECRET_BYTES]);
+
+// Chave pública não comprimida de 'secret'
+bool secp256k1PublicKey(const uint8_t secret[SECP256K1_SECRET_BYTES], uint8_t out[SECP256K1_PUBLIC_KEY_BYTES]);
+
+// Assinatura r || s do digest de 32 bytes (s não é normalizado para a metade
+// baixa, como no ECDSA do OpenSSL). Verificável por qualquer verificador ECDSA.
+bool secp256k1SignDigest(const uint8_t secret[SECP256K1_SECRET_BYTES], const uint8_t digest[32],
+                         uint8_t out[SECP256K1_SIGNATURE_BYTES]);
+
+// Área para a chave privada de quem chama (hex -> bytes, serialização) no
+// mesmo bloco da arena que o rascunho da thread: dispensa um SecureBuffer, e
+// o mutex da arena, por chamada. Um slot por thread de cada vez: valid() é
+// false se ele já estiver em uso ou se a arena não tiver memória. Zerado no
+// destrutor; as funções acima podem receber data() como 'secret'.
+class Secp256k1KeySlot {
+public:
+    Secp256k1KeySlot();
+    ~Secp256k1KeySlot();
+    Secp256k1KeySlot(const Secp256k1KeySlot&) = delete;
+    Secp256k1KeySlot& operator=(const Secp256k1KeySlot&) = delete;
+
+    bool valid() const { return slot != nullptr; }
+    uint8_t* data() { return slot; }
+    size_t size() const { return SECP256K1_KEY_SLOT_BYTES; }
+
+private:
+    uint8_t* slot;
+};
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_SECP256K1_H
@@ -0,0 +1,133 @@
+#ifndef ADILSONCRYPTO_SECURE_H
+#define ADILSONCRYPTO_SECURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace adilsoncrypto {
+
+// Arena para material de chave. A memória vem do sistema em regiões de
+// páginas próprias (mmap/VirtualAlloc), fora do heap geral:
+//   - as páginas úteis ficam travadas na RAM (mlock/VirtualLock), então não
+//     vão para o swap, e fora de core dumps (MADV_DONTDUMP);
+//   - cada região tem uma página de guarda sem acesso antes e depois: um
+//     estouro de buffer para na guarda em vez de ler o vizinho no heap;
+//   - blocos em classes de tamanho potência de 2 (32 a 4096 bytes), cada
+//     página servindo uma classe só, com lista livre por classe;
+//   - todo bloco é zerado (OPENSSL_cleanse) ao ser devolvido.
+// Quando a região enche outra é mapeada; nada volta ao sistema antes do
+// destrutor. Se o limite de mlock do processo (RLIMIT_MEMLOCK) não bastar a
+// arena continua funcionando, só sem a trava (locked() diz).
+//
+// allocate/deallocate passam por uma trava: para o caminho quente, pegue um
+// bloco uma vez (por thread) e reaproveite.
+class SecureArena {
+public:
+    static const size_t MIN_BLOCK = 32;
+    static const size_t MAX_BLOCK = 4096;
+    static const size_t DEFAULT_REGION_BYTES = 64 * 1024;
+
+    explicit SecureArena(size_t region_bytes = DEFAULT_REGION_BYTES);
+    ~SecureArena();
+
+    SecureArena(const SecureArena&) = delete;
+    SecureArena& operator=(const SecureArena&) = delete;
+
+    // Bloco de pelo menos 'size' bytes, alinhado ao tamanho da classe e zerado;
+    // nullptr se size for 0 ou maior que MAX_BLOCK, ou se o sistema negar
+    // memória.
+    void* allocate(size_t size);
+    // Zera o bloco inteiro e devolve à lista; ignora nullptr
+    void deallocate(void* block);
+    bool owns(const void* block) const;
+
+    // Todas as páginas mapeadas até agora estão travadas na RAM
+    bool locked() const;
+
+    struct Stats {
+        size_t regions = 0;
+        size_t mapped_bytes = 0;        // páginas úteis (sem as guardas)
+        size_t locked_bytes = 0;
+        size_t blocks_in_use = 0;
+        size_t bytes_in_use = 0;        // pelas classes, não pelo pedido
+        uint64_t allocations = 0;       // total desde a criação
+    };
+    Stats stats() const;
+
+private:
+    struct Region {
+        uint8_t* base;                  // primeira página útil
+        size_t pages;
+        size_t next_page;               // páginas ainda não entregues a uma classe
+        bool locked;
+        std::vector<uint8_t> page_class;
+    };
+
+    static size_t classOf(size_t size);
+    bool mapRegion(size_t pages);
+    bool refill(size_t size_class);
+    const Region* regionOf(const void* block) const;
+
+    mutable std::mutex mutex;
+    size_t page_size;
+    size_t region_pages;
+    std::vector<Region> regions;
+    void* free_lists[8];                // uma por classe: 32, 64, ..., 4096
+    Stats counters;
+};
+
+// Arena do processo; nunca é destruída (blocos podem sobreviver a estáticos)
+SecureArena& secureArena();
+
+// Bloco da arena com dono único: zerado e devolvido no destrutor
+class SecureBuffer {
+public:
+    SecureBuffer() : arena(nullptr), block(nullptr), length(0) {}
+    explicit SecureBuffer(size_t size, SecureArena& arena = secureArena())
+        : arena(&arena), block((uint8_t*)arena.allocate(size)), length(block ? size : 0) {}
+    ~SecureBuffer() { release(); }
+
+    SecureBuffer(SecureBuffer&& other) noexcept : arena(other.arena), block(other.block), length(other.length) {
+        other.block = nullptr;
+        other.length = 0;
+    }
+    SecureBuffer& operator=(SecureBuffer&& other) noexcept {
+        if (this != &other) {
+            release();
+            arena = other.arena;
+            block = other.block;
+            length = other.length;
+            other.block = nullptr;
+            other.length = 0;
+        }
+        return *this;
+    }
+    SecureBuffer(const SecureBuffer&) = delete;
+    SecureBuffer& operator=(const SecureBuffer&) = delete;
+
+    bool valid() const { return block != nullptr; }
+    uint8_t* data() { return block; }
+    const uint8_t* data() const { return block; }
+    size_t size() const { return length; }
+
+    // Objeto trivial construído no bloco (rascunhos com vários campos)
+    template <typename T>
+    T* as() { return sizeof(T) <= length ? reinterpret_cast<T*>(block) : nullptr; }
+
+private:
+    void release() {
+        if (block) arena->deallocate(block);
+        block = nullptr;
+        length = 0;
+    }
+
+    SecureArena* arena;
+    uint8_t* block;
+    size_t length;
+};
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_SECURE_H
@@ -0,0 +1,93 @@
+#ifndef ADILSONCRYPTO_SERIALIZE_H
+#define ADILSONCRYPTO_SERIALIZE_H
+
+#include "adilsoncrypto_util.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace adilsoncrypto {
+
+// Codificações binárias de assinaturas ECDSA e chaves secp256k1
+const size_t COMPACT_SIGNATURE_BYTES = 64;       // r || s
+const size_t RECOVERABLE_SIGNATURE_BYTES = 65;   // r || s || v
+const size_t DER_SIGNATURE_MAX_BYTES = 72;
+const size_t COMPRESSED_KEY_BYTES = 33;          // 0x02/0x03 || x
+const size_t UNCOMPRESSED_KEY_BYTES = 65;        // 0x04 || x || y
+
+// Escalares no formato de texto da biblioteca (como BN_bn2hex: maiúsculo,
+// sem bytes zero à esquerda). scalarFromHex aceita até 64 dígitos e alinha o
+// valor à direita em 32 bytes.
+std::string scalarToHex(const uint8_t* value, size_t len);
+bool scalarFromHex(const std::string& hex, uint8_t out[32]);
+// O texto é exatamente o que scalarToHex produziria para o valor de até 32
+// bytes que representa (compara sem montar outra string)
+bool scalarHexCanonical(const std::string& hex);
+
+// DER estrito (BIP66): inteiros mínimos e positivos. Retorna o tamanho
+// escrito (até 72 bytes).
+size_t derEncodeSignature(const uint8_t r[32], const uint8_t s[32], uint8_t* out);
+// Rejeita qualquer desvio do DER estrito ou r/s com mais de 32 bytes
+bool derDecodeSignature(const uint8_t* der, size_t len, uint8_t r[32], uint8_t s[32]);
+
+// Só troca o prefixo pela paridade de y (não confere se o ponto está na curva)
+bool compressPublicKey(const uint8_t uncompressed[UNCOMPRESSED_KEY_BYTES], uint8_t compressed[COMPRESSED_KEY_BYTES]);
+// Recupera y com a raiz quadrada mod p; falha se x não estiver na curva
+bool decompressPublicKey(const uint8_t compressed[COMPRESSED_KEY_BYTES], uint8_t uncompressed[UNCOMPRESSED_KEY_BYTES]);
+
+// Contêiner de lote: "ACB" | versão (1) | formato (1) | contagem (uint32 LE)
+// | registros. Formatos de tamanho fixo guardam os registros colados, então
+// o i-ésimo está em cabeçalho + i * tamanho; DER leva 1 byte de tamanho
+// antes de cada registro.
+enum class BatchFormat : uint8_t {
+    COMPACT_SIGNATURE = 1,
+    RECOVERABLE_SIGNATURE = 2,
+    DER_SIGNATURE = 3,
+    COMPRESSED_KEY = 4,
+    UNCOMPRESSED_KEY = 5
+};
+
+const size_t BATCH_HEADER_BYTES = 9;
+const uint32_t BATCH_MAX_RECORDS = 0xFFFFFFFFu;
+
+// Tamanho fixo de um registro (0 para DER)
+size_t batchRecordBytes(BatchFormat format);
+// Tamanho exato para formatos fixos; limite superior para DER
+size_t batchMaxEncodedSize(BatchFormat format, size_t count);
+
+// Escreve o lote direto num buffer já alocado (uma única alocação para o
+// lote inteiro, feita pelo chamador com batchMaxEncodedSize).
+class BatchEncoder {
+public:
+    BatchEncoder(BatchFormat format, size_t count, uint8_t* out, size_t capacity);
+
+    // Copia um registro já codificado
+    bool append(const uint8_t* record, size_t len);
+    // Codifica r/s (e v no formato recuperável) direto no buffer
+    bool appendSignature(const uint8_t r[32], const uint8_t s[32], uint8_t v = 0);
+    // Formatos fixos: espaço do próximo registro, para ser preenchido no lugar
+    uint8_t* reserve();
+
+    // Bytes escritos, ou 0 se houve erro ou faltaram registros
+    size_t finish() const;
+
+private:
+    BatchFormat format;
+    size_t record_bytes;
+    size_t expected;
+    size_t written;
+    uint8_t* out;
+    size_t capacity;
+    size_t used;
+    bool failed;
+};
+
+// Valida o enquadramento e devolve fatias que apontam para 'data' (nenhum
+// registro é copiado). O conteúdo de cada registro não é validado aqui: use
+// derDecodeSignature/decompressPublicKey ao consumir.
+bool batchDecode(const uint8_t* data, size_t len, BatchFormat& format, std::vector<ByteView>& records);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_SERIALIZE_H
@@ -0,0 +1,94 @@
+#ifndef ADILSONCRYPTO_SHA256_H
+#define ADILSONCRYPTO_SHA256_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace adilsoncrypto {
+
+const size_t SHA256_BLOCK_BYTES = 64;
+const size_t SHA256_HASH_BYTES = 32;
+const size_t SHA256_MAX_LANES = 16;
+
+extern const uint32_t SHA256_IV[8];
+
+// Kernels disponíveis. AUTO escolhe o mais rápido suportado pelo CPU;
+// pedir um kernel não suportado cai para o melhor disponível.
+enum class Sha256Kernel {
+    AUTO,
+    SCALAR,
+    SSE2,    // 4 lanes
+    AVX2,    // 8 lanes
+    AVX512,  // 16 lanes
+    SHANI    // 1 lane, instruções SHA dedicadas
+};
+
+// Backend multi-lane: comprime 'lanes' blocos independentes por chamada.
+// Estados em layout [lane][8]; blocos são ponteiros para 64 bytes cada.
+struct Sha256LaneBackend {
+    Sha256Kernel kernel;
+    const char* name;
+    size_t lanes;
+    void (*compress)(uint32_t* states, const uint8_t* const* blocks);
+    // Double-SHA256 de um cabeçalho de 80 bytes para 'lanes' nonces
+    // consecutivos a partir de 'nonce'. 'midstate' é o estado após os
+    // primeiros 64 bytes e 'tail' as palavras big-endian 16..18 do cabeçalho.
+    // Saída: estado final (palavras) em layout [lane][8].
+    void (*sha256dNonces)(const uint32_t* midstate, const uint32_t* tail, uint32_t nonce, uint32_t* out);
+};
+
+const Sha256LaneBackend& sha256LaneBackend(Sha256Kernel kernel = Sha256Kernel::AUTO);
+Sha256Kernel sha256KernelFromName(const std::string& name);
+const char* sha256KernelName(Sha256Kernel kernel);
+bool sha256KernelSupported(Sha256Kernel kernel);
+
+// Compressão de blocos consecutivos com o kernel de uma lane mais rápido
+void sha256Compress(uint32_t state[8], const uint8_t* blocks, size_t nblocks);
+
+void sha256Digest(const uint8_t* data, size_t len, uint8_t out[32]);
+void sha256dDigest(const uint8_t* data, size_t len, uint8_t out[32]);
+std::string sha256Hex(const std::string& data);
+
+// Estado incremental (Init/Update/Final), sem alocação
+class Sha256Hasher {
+public:
+    Sha256Hasher();
+    void reset();
+    Sha256Hasher& update(const uint8_t* data, size_t len);
+    Sha256Hasher& update(const std::string& data);
+    void finalize(uint8_t out[32]);
+    // Estado após um número inteiro de blocos (midstate)
+    const uint32_t* state() const { return h; }
+    uint64_t length() const { return total; }
+
+private:
+    uint32_t h[8];
+    uint8_t buffer[64];
+    size_t buffered;
+    uint64_t total;
+};
+
+// Hash de 'count' mensagens de mesmo tamanho 'len', em lotes do backend
+// escolhido. 'out' recebe count * 32 bytes.
+void sha256Many(const uint8_t* const* messages, size_t len, size_t count, uint8_t* out,
+                Sha256Kernel kernel = Sha256Kernel::AUTO);
+void sha256dMany(const uint8_t* const* messages, size_t len, size_t count, uint8_t* out,
+                 Sha256Kernel kernel = Sha256Kernel::AUTO);
+
+// sha256d(in[64*i .. 64*i+63]) para i < count, com 'in' contíguo.
+// Caso dos nós internos de Merkle: o primeiro bloco é lido sem cópia.
+// 'out' pode coincidir com 'in' (cada lote é lido antes de ser escrito).
+void sha256d64Many(const uint8_t* in, uint8_t* out, size_t count, Sha256Kernel kernel = Sha256Kernel::AUTO);
+
+// Mensagens de tamanhos variados: cada lane que termina sua mensagem é
+// reabastecida com a próxima da fila (agendamento multi-buffer).
+void sha256Batch(const uint8_t* const* messages, const size_t* lens, size_t count, uint8_t* out,
+                 Sha256Kernel kernel = Sha256Kernel::AUTO);
+
+// Serializa o estado como digest big-endian
+void sha256StateToBytes(const uint32_t state[8], uint8_t out[32]);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_SHA256_H
@@ -0,0 +1,141 @@
+#ifndef ADILSONCRYPTO_SHA256_LANES_H
+#define ADILSONCRYPTO_SHA256_LANES_H
+
+// Núcleo SHA-256 genérico sobre um "vetor de lanes".
+// Cada unidade de compilação SIMD instancia Sha256Lanes<Ops> com as operações
+// do seu conjunto de instruções (escalar, SSE2, AVX2, AVX-512); o template é
+// sempre instanciado com tipos locais à unidade, então não há conflito de ODR
+// entre objetos compilados com flags -m diferentes.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace adilsoncrypto {
+
+alignas(64) static const uint32_t SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t sha256LoadBe32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static inline void sha256StoreBe32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static inline uint32_t sha256Bswap32(uint32_t v) {
+    return (v >> 24) | ((v >> 8) & 0xff00) | ((v << 8) & 0xff0000) | (v << 24);
+}
+
+// Ops deve fornecer: tipo vec, LANES, load/store (uint32_t alinhado),
+// set1, add, xor3, ch, maj e rotr<N>.
+template <class Ops>
+struct Sha256Lanes {
+    typedef typename Ops::vec vec;
+    static const size_t LANES = Ops::LANES;
+
+    static inline vec bsig0(vec x) { return Ops::xor3(Ops::template rotr<2>(x), Ops::template rotr<13>(x), Ops::template rotr<22>(x)); }
+    static inline vec bsig1(vec x) { return Ops::xor3(Ops::template rotr<6>(x), Ops::template rotr<11>(x), Ops::template rotr<25>(x)); }
+    static inline vec ssig0(vec x) { return Ops::xor3(Ops::template rotr<7>(x), Ops::template rotr<18>(x), Ops::template shr<3>(x)); }
+    static inline vec ssig1(vec x) { return Ops::xor3(Ops::template rotr<17>(x), Ops::template rotr<19>(x), Ops::template shr<10>(x)); }
+
+    // 64 rodadas sobre s[8] com a mensagem w[16] (w é consumido)
+    static inline void transform(vec s[8], vec w[16]) {
+        vec a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+#pragma GCC unroll 64
+        for (int i = 0; i < 64; i++) {
+            if (i >= 16) {
+                w[i & 15] = Ops::add(Ops::add(ssig1(w[(i - 2) & 15]), w[(i - 7) & 15]),
+                                     Ops::add(ssig0(w[(i - 15) & 15]), w[i & 15]));
+            }
+            vec t1 = Ops::add(Ops::add(h, bsig1(e)), Ops::add(Ops::ch(e, f, g), Ops::add(Ops::set1(SHA256_K[i]), w[i & 15])));
+            vec t2 = Ops::add(bsig0(a), Ops::maj(a, b, c));
+            h = g; g = f; f = e; e = Ops::add(d, t1);
+            d = c; c = b; b = a; a = Ops::add(t1, t2);
+        }
+        s[0] = Ops::add(s[0], a); s[1] = Ops::add(s[1], b);
+        s[2] = Ops::add(s[2], c); s[3] = Ops::add(s[3], d);
+        s[4] = Ops::add(s[4], e); s[5] = Ops::add(s[5], f);
+        s[6] = Ops::add(s[6], g); s[7] = Ops::add(s[7], h);
+    }
+
+    static inline void loadStates(vec s[8], const uint32_t* states) {
+        alignas(64) uint32_t tmp[LANES];
+        for (int j = 0; j < 8; j++) {
+            for (size_t l = 0; l < LANES; l++) tmp[l] = states[l * 8 + j];
+            s[j] = Ops::load(tmp);
+        }
+    }
+
+    static inline void storeStates(uint32_t* states, const vec s[8]) {
+        alignas(64) uint32_t tmp[LANES];
+        for (int j = 0; j < 8; j++) {
+            Ops::store(tmp, s[j]);
+            for (size_t l = 0; l < LANES; l++) states[l * 8 + j] = tmp[l];
+        }
+    }
+
+    static void compressBlocks(uint32_t* states, const uint8_t* const* blocks) {
+        vec s[8], w[16];
+        alignas(64) uint32_t tmp[LANES];
+        loadStates(s, states);
+        for (int t = 0; t < 16; t++) {
+            for (size_t l = 0; l < LANES; l++) tmp[l] = sha256LoadBe32(blocks[l] + 4 * t);
+            w[t] = Ops::load(tmp);
+        }
+        transform(s, w);
+        storeStates(states, s);
+    }
+
+    static void sha256dNonces(const uint32_t* midstate, const uint32_t* tail, uint32_t nonce, uint32_t* out) {
+        alignas(64) uint32_t tmp[LANES];
+        vec s[8], w[16];
+
+        // Segundo bloco do cabeçalho: 16 bytes finais + padding (640 bits)
+        for (int j = 0; j < 8; j++) s[j] = Ops::set1(midstate[j]);
+        w[0] = Ops::set1(tail[0]);
+        w[1] = Ops::set1(tail[1]);
+        w[2] = Ops::set1(tail[2]);
+        for (size_t l = 0; l < LANES; l++) tmp[l] = sha256Bswap32(nonce + (uint32_t)l);
+        w[3] = Ops::load(tmp);
+        w[4] = Ops::set1(0x80000000u);
+        for (int t = 5; t < 15; t++) w[t] = Ops::set1(0);
+        w[15] = Ops::set1(640);
+        transform(s, w);
+
+        // Segundo SHA-256 sobre o digest de 32 bytes (256 bits)
+        for (int j = 0; j < 8; j++) w[j] = s[j];
+        w[8] = Ops::set1(0x80000000u);
+        for (int t = 9; t < 15; t++) w[t] = Ops::set1(0);
+        w[15] = Ops::set1(256);
+        for (int j = 0; j < 8; j++) s[j] = Ops::set1(SHA256_IV_WORDS[j]);
+        transform(s, w);
+        storeStates(out, s);
+    }
+
+    static constexpr uint32_t SHA256_IV_WORDS[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+};
+
+// Kernels por conjunto de instruções (definidos nas unidades _avx2/_avx512/_shani)
+void sha256CompressAvx2(uint32_t* states, const uint8_t* const* blocks);
+void sha256dNoncesAvx2(const uint32_t* midstate, const uint32_t* tail, uint32_t nonce, uint32_t* out);
+void sha256CompressAvx512(uint32_t* states, const uint8_t* const* blocks);
+void sha256dNoncesAvx512(const uint32_t* midstate, const uint32_t* tail, uint32_t nonce, uint32_t* out);
+void sha256CompressShani(uint32_t state[8], const uint8_t* data, size_t nblocks);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_SHA256_LANES_H
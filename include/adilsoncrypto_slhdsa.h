@@ -0,0 +1,55 @@
+#ifndef ADILSONCRYPTO_SLHDSA_H
+#define ADILSONCRYPTO_SLHDSA_H
+
+#include "adilsoncrypto_pool.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace adilsoncrypto {
+
+// SLH-DSA (FIPS 205, antigo SPHINCS+): assinatura pós-quântica sem estado
+// baseada apenas em hash. "s" = assinaturas menores, "f" = assinatura rápida.
+enum class SlhDsaParamSet {
+    SHA2_128S, SHA2_128F, SHA2_192S, SHA2_192F, SHA2_256S, SHA2_256F,
+    SHAKE_128S, SHAKE_128F, SHAKE_192S, SHAKE_192F, SHAKE_256S, SHAKE_256F
+};
+
+struct SlhDsaParams {
+    SlhDsaParamSet set;
+    const char* name;          // ex.: "SLH-DSA-SHA2-128s"
+    bool shake;
+    unsigned n;                // bytes por hash
+    unsigned h;                // altura total da hiperárvore
+    unsigned d;                // camadas XMSS
+    unsigned hp;               // altura de cada árvore XMSS (h / d)
+    unsigned a;                // altura das árvores FORS
+    unsigned k;                // número de árvores FORS
+    unsigned m;                // bytes do digest da mensagem
+    unsigned len;              // cadeias WOTS+ (2n + 3, w = 16)
+    size_t public_key_bytes;   // PK.seed || PK.root
+    size_t secret_key_bytes;   // SK.seed || SK.prf || PK.seed || PK.root
+    size_t signature_bytes;
+};
+
+const SlhDsaParams& slhDsaParams(SlhDsaParamSet set);
+bool slhDsaParamSetFromName(const std::string& name, SlhDsaParamSet& set);
+
+// Com 'pool' as folhas da árvore do topo são calculadas em paralelo
+bool slhDsaKeyGen(SlhDsaParamSet set, uint8_t* public_key, uint8_t* secret_key, ThreadPool* pool = nullptr);
+void slhDsaKeyGenDerand(SlhDsaParamSet set, const uint8_t* sk_seed, const uint8_t* sk_prf, const uint8_t* pk_seed,
+                        uint8_t* public_key, uint8_t* secret_key, ThreadPool* pool = nullptr);
+
+// Assinatura "pura" do FIPS 205 com contexto de até 255 bytes.
+// randomized = false usa a variante determinística (opt_rand = PK.seed).
+// As cadeias WOTS+ e as folhas FORS são hasheadas em lotes multi-lane
+// (SHA-256 com o backend de mais lanes; SHAKE256 em 4 lanes); com 'pool'
+// as k árvores FORS e as d árvores XMSS são construídas em paralelo.
+bool slhDsaSign(SlhDsaParamSet set, const uint8_t* message, size_t len, const uint8_t* context, size_t context_len,
+                const uint8_t* secret_key, uint8_t* signature, bool randomized = true, ThreadPool* pool = nullptr);
+bool slhDsaVerify(SlhDsaParamSet set, const uint8_t* message, size_t len, const uint8_t* context, size_t context_len,
+                  const uint8_t* public_key, const uint8_t* signature);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_SLHDSA_H
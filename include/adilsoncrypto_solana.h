@@ -0,0 +1,36 @@
+#ifndef ADILSONCRYPTO_SOLANA_H
+#define ADILSONCRYPTO_SOLANA_H
+
+#include "adilsoncrypto.h"
+#include "adilsoncrypto_ed25519.h"
+#include "adilsoncrypto_util.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace adilsoncrypto {
+
+// Transação Solana serializada, decodificada sem cópia: assinaturas e chaves
+// apontam para o buffer de origem. message cobre os bytes assinados
+// (legacy ou versionada, prefixo 0x80 | versão).
+struct SolanaTransactionView {
+    std::vector<const uint8_t*> signatures;     // 64 bytes cada
+    std::vector<const uint8_t*> account_keys;   // 32 bytes cada
+    ByteView message;
+    uint8_t num_required_signatures = 0;
+};
+
+bool parseSolanaTransaction(const uint8_t* data, size_t size, SolanaTransactionView& tx);
+
+// Verifica todas as assinaturas de várias transações em um único lote
+// Ed25519 (o i-ésimo signatário é account_keys[i]). valid[t] indica se a
+// transação t é bem formada e todas as suas assinaturas conferem.
+bool solanaVerifyTransactions(const std::vector<ByteView>& transactions, std::vector<bool>* valid = nullptr,
+                              ThreadPool* pool = nullptr);
+
+} // namespace adilsoncrypto
+
+std::unique_ptr<IBlockchainInterface> createSolanaChainInterface();
+
+#endif // ADILSONCRYPTO_SOLANA_H
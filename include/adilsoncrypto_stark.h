@@ -0,0 +1,99 @@
+#ifndef ADILSONCRYPTO_STARK_H
+#define ADILSONCRYPTO_STARK_H
+
+#include "adilsoncrypto.h"
+#include "adilsoncrypto_goldilocks.h"
+#include "adilsoncrypto_merkle.h"
+#include "adilsoncrypto_pool.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace adilsoncrypto {
+
+const unsigned STARK_LOG_BLOWUP = 3;     // domínio de avaliação 8x maior que o traço
+const unsigned STARK_QUERIES = 32;       // ~3 bits de segurança por consulta
+const unsigned STARK_MIN_LOG_TRACE = 3;
+const unsigned STARK_MAX_LOG_TRACE = 20;
+
+// Transcrição de Fiat-Shamir: cada absorb encadeia o estado com SHA-256 e
+// os desafios são SHA-256(estado || contador).
+class StarkTranscript {
+public:
+    StarkTranscript();
+    void absorb(const uint8_t* data, size_t len);
+    uint64_t challengeField();           // uniforme em [0, p)
+    size_t challengeIndex(size_t bound); // bound potência de 2
+
+private:
+    void next(uint8_t out[32]);
+
+    uint8_t state[32];
+    uint64_t counter;
+};
+
+// FRI sobre Goldilocks: prova que as avaliações de f na classe lateral
+// shift * <w> (2^log_size pontos) vêm de um polinômio de grau
+// < 2^(log_size - log_blowup). Cada camada guarda os pares (f(x), f(-x)) como
+// folhas de uma árvore Merkle, então uma consulta abre um caminho por camada;
+// a dobra f'(x^2) = (f(x) + f(-x))/2 + beta (f(x) - f(-x))/(2x) roda em
+// paralelo com 'pool'. As camadas param quando o polinômio é constante.
+class FriProver {
+public:
+    explicit FriProver(ThreadPool* pool = nullptr) : pool(pool) {}
+
+    // Compromete as camadas (absorvendo raízes e o valor final em 'transcript')
+    void commit(std::vector<uint64_t> values, unsigned log_size, unsigned log_blowup, uint64_t shift,
+                StarkTranscript& transcript);
+
+    size_t layerCount() const { return layers.size(); }
+    const Hash256& layerRoot(size_t layer) const { return roots[layer]; }
+    uint64_t finalValue() const { return final_value; }
+
+    // Anexa a 'out' a abertura da consulta 'index' (no domínio original)
+    void open(size_t index, std::vector<uint8_t>& out) const;
+
+private:
+    ThreadPool* pool;
+    std::vector<std::vector<uint64_t>> layers;   // layers[l][2i], [2i+1] = f_l(x_i), f_l(-x_i)
+    std::vector<std::unique_ptr<MerkleTree>> trees;
+    std::vector<Hash256> roots;
+    uint64_t final_value = 0;
+};
+
+// Verificação das consultas do FRI. O chamador lê as raízes e o valor final
+// na mesma ordem de commit() e confere que value0 (abertura de f no índice
+// 'index') é o que ele espera; verifyQuery segue a dobra até a constante.
+struct FriCommitment {
+    unsigned log_size = 0;
+    uint64_t shift = 1;
+    std::vector<Hash256> roots;
+    std::vector<uint64_t> betas;
+    uint64_t final_value = 0;
+};
+bool friVerifyQuery(const FriCommitment& commitment, size_t index, const uint8_t*& cursor, const uint8_t* end,
+                    uint64_t& value0);
+
+// STARK da sequência de Fibonacci em Goldilocks: t[0] = a0, t[1] = a1,
+// t[i+2] = t[i+1] + t[i], com 2^log_trace passos e resultado t[n-1].
+// O traço é interpolado (NTT inversa), estendido 8x numa classe lateral e
+// comprometido por Merkle; a composição das restrições de transição e de
+// contorno é provada de grau baixo com FRI. É uma prova de integridade: o
+// traço não é mascarado, então não há conhecimento zero no sentido estrito.
+bool starkProveFibonacci(uint64_t a0, uint64_t a1, unsigned log_trace, uint64_t& result,
+                         std::vector<uint8_t>& proof, ThreadPool* pool = nullptr);
+bool starkVerifyFibonacci(uint64_t a0, uint64_t a1, unsigned log_trace, uint64_t result, const uint8_t* proof,
+                          size_t len);
+
+} // namespace adilsoncrypto
+
+// IZeroKnowledge com proveSTARK/verifySTARK. A computação é
+// "fibonacci:<passos>[:<a0>:<a1>]" (passos potência de 2 entre 8 e 2^20);
+// qualquer outro texto vira 1024 passos a partir de a0, a1 tirados do
+// SHA-256 do texto. ZKProof: proof_data = prova em hex, public_inputs =
+// "<passos>:<a0>:<a1>:<resultado>", verification_key = "fri-goldilocks".
+// Os métodos SNARK e de intervalo devolvem provas vazias.
+std::unique_ptr<IZeroKnowledge> createStarkZeroKnowledge();
+
+#endif // ADILSONCRYPTO_STARK_H
@@ -0,0 +1,32 @@
+#ifndef ADILSONCRYPTO_UTIL_H
+#define ADILSONCRYPTO_UTIL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace adilsoncrypto {
+
+// Fatia de bytes que aponta para o buffer de origem (não é dona da memória)
+struct ByteView {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+};
+
+// Conversão hexadecimal por tabela (sem stringstream)
+std::string bytesToHex(const uint8_t* data, size_t len);
+std::string bytesToHex(const std::string& data);
+// Retorna false se o texto tiver tamanho ímpar ou dígitos inválidos.
+// Aceita prefixo "0x" opcional.
+bool hexToBytes(const std::string& hex, std::string& out);
+bool hexToBytes(const std::string& hex, uint8_t* out, size_t len);
+
+// Base58 (alfabeto do Bitcoin) e Base58Check (payload + 4 bytes de SHA256d)
+std::string base58Encode(const uint8_t* data, size_t len);
+bool base58Decode(const std::string& text, std::string& out);
+std::string base58CheckEncode(const std::string& payload);
+bool base58CheckDecode(const std::string& text, std::string& payload);
+
+} // namespace adilsoncrypto
+
+#endif // ADILSONCRYPTO_UTIL_H
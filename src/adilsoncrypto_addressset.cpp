@@ -0,0 +1,493 @@
+#include "../include/adilsoncrypto_addressset.h"
+#include "../include/adilsoncrypto_mmap.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <openssl/rand.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const char MAGIC[4] = { 'A', 'C', 'A', 'S' };
+const uint32_t VERSION = 1;
+const size_t MAX_ADDRESS_BYTES = 255;
+const uint64_t MIN_SLOTS = 16;
+const int MAX_FILTER_ATTEMPTS = 100;
+const size_t BATCH = 16;
+
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t count;
+    uint64_t hash_seed;
+    uint64_t filter_seed;
+    uint32_t segment_length;
+    uint32_t segment_length_mask;
+    uint32_t segment_count_length;
+    uint32_t array_length;
+    uint64_t table_slots;
+    uint64_t arena_bytes;
+};
+static_assert(sizeof(FileHeader) == 64, "FileHeader precisa de layout fixo");
+
+uint64_t padded(uint64_t bytes) {
+    return (bytes + 7) & ~(uint64_t)7;
+}
+
+inline uint64_t load64(const char* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint64_t mulhi(uint64_t a, uint64_t b) {
+    return (uint64_t)(((unsigned __int128)a * b) >> 64);
+}
+
+inline uint64_t mix(uint64_t a, uint64_t b) {
+    unsigned __int128 r = (unsigned __int128)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+}
+
+// Hash de 64 bits do endereço com semente do arquivo (no estilo do wyhash:
+// uma multiplicação 64x64->128 a cada 16 bytes). Os 32 bits baixos escolhem a
+// posição na tabela, os altos são a etiqueta, e o filtro o remistura.
+uint64_t addressKey(const char* p, size_t len, uint64_t seed) {
+    const uint64_t K0 = 0xa0761d6478bd642fULL;
+    const uint64_t K1 = 0xe7037ed1a0b428dbULL;
+    const uint64_t K2 = 0x8ebc6af09c88c6e3ULL;
+    uint64_t h = seed ^ K0;
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) h = mix(load64(p + i) ^ K1, load64(p + i + 8) ^ h);
+    uint64_t a = 0, b = 0;
+    const size_t rest = len - i;
+    if (rest > 8) {
+        a = load64(p + i);
+        std::memcpy(&b, p + i + 8, rest - 8);
+    } else {
+        std::memcpy(&a, p + i, rest);
+    }
+    h = mix(a ^ K1, b ^ h);
+    return mix(h ^ (uint64_t)len, K2);
+}
+
+inline uint64_t murmur64(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+inline uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+inline uint8_t fingerprint(uint64_t hash) {
+    return (uint8_t)(hash ^ (hash >> 32));
+}
+
+// Parâmetros do filtro binary fuse de 3 posições (Graf e Lemire, "Binary
+// Fuse Filters: Fast and Smaller Than Xor Filters", 2022)
+struct FuseShape {
+    uint32_t segment_length;
+    uint32_t segment_length_mask;
+    uint32_t segment_count_length;
+    uint32_t array_length;
+
+    inline uint32_t position(int index, uint64_t hash) const {
+        uint64_t h = mulhi(hash, segment_count_length) + (uint64_t)index * segment_length;
+        const uint64_t bits = hash & ((1ULL << 36) - 1);
+        h ^= (bits >> (36 - 18 * index)) & segment_length_mask;
+        return (uint32_t)h;
+    }
+};
+
+FuseShape fuseShape(uint64_t size) {
+    FuseShape shape;
+    const uint32_t length =
+        size == 0 ? 4 : (uint32_t)1 << (int)std::floor(std::log((double)size) / std::log(3.33) + 2.25);
+    shape.segment_length = std::min<uint32_t>(length, 262144);
+    shape.segment_length_mask = shape.segment_length - 1;
+    const double factor =
+        size <= 1 ? 0 : std::max(1.125, 0.875 + 0.25 * std::log(1000000.0) / std::log((double)size));
+    const uint64_t capacity = (uint64_t)std::llround((double)size * factor);
+    int64_t segment_count = (int64_t)((capacity + shape.segment_length - 1) / shape.segment_length) - 2;
+    if (segment_count < 1) segment_count = 1;
+    shape.segment_count_length = (uint32_t)(segment_count * shape.segment_length);
+    shape.array_length = (uint32_t)((segment_count + 2) * shape.segment_length);
+    return shape;
+}
+
+inline uint8_t mod3(uint8_t x) {
+    return x > 2 ? (uint8_t)(x - 3) : x;
+}
+
+// Constrói o filtro por descascamento (peeling): com uma semente boa toda
+// chave acaba sozinha em alguma posição, e as impressões são atribuídas na
+// ordem inversa. As chaves precisam ser distintas.
+bool buildFilter(const std::vector<uint64_t>& keys, const FuseShape& shape, uint64_t& seed, uint8_t* fingerprints) {
+    const size_t size = keys.size();
+    const uint32_t capacity = shape.array_length;
+    std::vector<uint64_t> reverse_order(size + 1);
+    std::vector<uint8_t> reverse_h(size);
+    std::vector<uint32_t> alone(capacity);
+    std::vector<uint8_t> t2count(capacity);
+    std::vector<uint64_t> t2hash(capacity);
+
+    const uint32_t segment_count = shape.array_length / shape.segment_length - 2;
+    uint32_t block_bits = 1;
+    while (((uint32_t)1 << block_bits) < segment_count) block_bits++;
+    const uint32_t block = (uint32_t)1 << block_bits;
+    std::vector<uint32_t> start_pos(block);
+    uint64_t rng = seed;
+
+    for (int attempt = 0; attempt < MAX_FILTER_ATTEMPTS; attempt++) {
+        seed = splitmix64(rng);
+        std::fill(reverse_order.begin(), reverse_order.end(), 0);
+        std::fill(t2count.begin(), t2count.end(), 0);
+        std::fill(t2hash.begin(), t2hash.end(), 0);
+        reverse_order[size] = 1;
+
+        // Agrupa os hashes por segmento para que o preenchimento abaixo
+        // percorra as tabelas quase em ordem
+        for (uint32_t i = 0; i < block; i++) start_pos[i] = (uint32_t)(((uint64_t)i * size) >> block_bits);
+        for (size_t i = 0; i < size; i++) {
+            const uint64_t hash = murmur64(keys[i] + seed);
+            uint64_t segment = hash >> (64 - block_bits);
+            while (reverse_order[start_pos[segment]] != 0) segment = (segment + 1) & (block - 1);
+            reverse_order[start_pos[segment]] = hash;
+            start_pos[segment]++;
+        }
+
+        bool error = false;
+        for (size_t i = 0; i < size; i++) {
+            const uint64_t hash = reverse_order[i];
+            const uint32_t h0 = shape.position(0, hash);
+            const uint32_t h1 = shape.position(1, hash);
+            const uint32_t h2 = shape.position(2, hash);
+            t2count[h0] += 4;
+            t2hash[h0] ^= hash;
+            t2count[h1] += 4;
+            t2count[h1] ^= 1;
+            t2hash[h1] ^= hash;
+            t2count[h2] += 4;
+            t2count[h2] ^= 2;
+            t2hash[h2] ^= hash;
+            error = error || t2count[h0] < 4 || t2count[h1] < 4 || t2count[h2] < 4;   // contador estourou
+        }
+        if (error) continue;
+
+        uint32_t queue = 0;
+        for (uint32_t i = 0; i < capacity; i++) {
+            alone[queue] = i;
+            queue += (t2count[i] >> 2) == 1 ? 1 : 0;
+        }
+        size_t stack = 0;
+        uint32_t h012[5];
+        while (queue > 0) {
+            const uint32_t index = alone[--queue];
+            if ((t2count[index] >> 2) != 1) continue;
+            const uint64_t hash = t2hash[index];
+            h012[0] = shape.position(0, hash);
+            h012[1] = shape.position(1, hash);
+            h012[2] = shape.position(2, hash);
+            h012[3] = h012[0];
+            h012[4] = h012[1];
+            const uint8_t found = t2count[index] & 3;
+            reverse_h[stack] = found;
+            reverse_order[stack] = hash;
+            stack++;
+            for (uint8_t other = 1; other <= 2; other++) {
+                const uint32_t other_index = h012[found + other];
+                alone[queue] = other_index;
+                queue += (t2count[other_index] >> 2) == 2 ? 1 : 0;
+                t2count[other_index] -= 4;
+                t2count[other_index] ^= mod3((uint8_t)(found + other));
+                t2hash[other_index] ^= hash;
+            }
+        }
+        if (stack != size) continue;
+
+        std::memset(fingerprints, 0, capacity);
+        for (size_t i = size; i-- > 0;) {
+            const uint64_t hash = reverse_order[i];
+            h012[0] = shape.position(0, hash);
+            h012[1] = shape.position(1, hash);
+            h012[2] = shape.position(2, hash);
+            h012[3] = h012[0];
+            h012[4] = h012[1];
+            const uint8_t found = reverse_h[i];
+            fingerprints[h012[found]] =
+                (uint8_t)(fingerprint(hash) ^ fingerprints[h012[found + 1]] ^ fingerprints[h012[found + 2]]);
+        }
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+AddressSet::AddressSet() : data(nullptr), data_bytes(0) {
+    close();
+}
+
+AddressSet::~AddressSet() {
+    close();
+}
+
+void AddressSet::close() {
+    if (file) file->close();
+    owned.clear();
+    owned.shrink_to_fit();
+    data = nullptr;
+    data_bytes = 0;
+    count = 0;
+    hash_seed = filter_seed = 0;
+    segment_length = segment_length_mask = segment_count_length = array_length = 0;
+    slot_mask = 0;
+    arena_bytes = 0;
+    fingerprints = nullptr;
+    slots = nullptr;
+    arena = nullptr;
+}
+
+uint64_t AddressSet::size() const {
+    return count;
+}
+
+uint64_t AddressSet::filterBytes() const {
+    return array_length;
+}
+
+bool AddressSet::build(const std::vector<std::string>& addresses) {
+    close();
+    uint64_t seed;
+    if (RAND_bytes((unsigned char*)&seed, sizeof(seed)) != 1) return false;
+
+    // Tabela exata primeiro: ela mesma descarta os repetidos
+    uint64_t table_slots = MIN_SLOTS;
+    while (table_slots < 2 * (uint64_t)addresses.size()) table_slots <<= 1;
+    const uint64_t mask = table_slots - 1;
+    std::vector<uint64_t> table(table_slots);
+    std::string text;
+    std::vector<uint64_t> keys;
+    keys.reserve(addresses.size());
+    uint64_t unique = 0;
+    for (const std::string& address : addresses) {
+        if (address.empty() || address.size() > MAX_ADDRESS_BYTES) return false;
+        const uint64_t key = addressKey(address.data(), address.size(), seed);
+        const uint64_t tag = key >> 32;
+        uint64_t position = key & mask;
+        bool repeated = false;
+        for (; table[position] != 0; position = (position + 1) & mask) {
+            const uint64_t slot = table[position];
+            const uint8_t* stored = (const uint8_t*)text.data() + (uint32_t)slot - 1;
+            if ((slot >> 32) == tag && stored[0] == address.size() &&
+                std::memcmp(stored + 1, address.data(), address.size()) == 0) {
+                repeated = true;
+                break;
+            }
+        }
+        if (repeated) continue;
+        // Deslocamento + 1 cabe nos 32 bits baixos do slot
+        if (text.size() + 1 + address.size() >= 0xFFFFFFFFULL) return false;
+        table[position] = (tag << 32) | (text.size() + 1);
+        text.push_back((char)address.size());
+        text.append(address);
+        keys.push_back(key);
+        unique++;
+    }
+
+    // Endereços diferentes com o mesmo hash de 64 bits são uma chave só no
+    // filtro (a tabela os separa)
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    if (keys.size() > 0xFFFFFFFFULL / 2) return false;
+
+    const FuseShape shape = fuseShape(keys.size());
+    const uint64_t fingerprint_bytes = padded(shape.array_length);
+    const uint64_t total = sizeof(FileHeader) + fingerprint_bytes + table_slots * sizeof(uint64_t) + padded(text.size());
+    std::vector<uint64_t> buffer(total / sizeof(uint64_t));
+    uint8_t* bytes = (uint8_t*)buffer.data();
+
+    uint64_t filter_seed = seed ^ 0x726b2b9d438b9d4dULL;
+    if (!buildFilter(keys, shape, filter_seed, bytes + sizeof(FileHeader))) return false;
+
+    FileHeader* header = (FileHeader*)bytes;
+    std::memcpy(header->magic, MAGIC, sizeof(MAGIC));
+    header->version = VERSION;
+    header->count = unique;
+    header->hash_seed = seed;
+    header->filter_seed = filter_seed;
+    header->segment_length = shape.segment_length;
+    header->segment_length_mask = shape.segment_length_mask;
+    header->segment_count_length = shape.segment_count_length;
+    header->array_length = shape.array_length;
+    header->table_slots = table_slots;
+    header->arena_bytes = text.size();
+    std::memcpy(bytes + sizeof(FileHeader) + fingerprint_bytes, table.data(), table_slots * sizeof(uint64_t));
+    if (!text.empty()) {
+        std::memcpy(bytes + sizeof(FileHeader) + fingerprint_bytes + table_slots * sizeof(uint64_t), text.data(),
+                    text.size());
+    }
+
+    owned.swap(buffer);
+    if (!attach((const uint8_t*)owned.data(), total)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool AddressSet::attach(const uint8_t* bytes, uint64_t len) {
+    if (len < sizeof(FileHeader)) return false;
+    const FileHeader* header = (const FileHeader*)bytes;
+    if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VERSION) return false;
+    const uint64_t slot_count = header->table_slots;
+    if (slot_count < MIN_SLOTS || (slot_count & (slot_count - 1)) != 0 || header->count > slot_count / 2) return false;
+    if (header->segment_length == 0 || (header->segment_length & header->segment_length_mask) != 0 ||
+        header->segment_length_mask != header->segment_length - 1 ||
+        (uint64_t)header->segment_count_length + 2ULL * header->segment_length != header->array_length) {
+        return false;
+    }
+    if (header->arena_bytes >= 0xFFFFFFFFULL || slot_count > (len >> 3)) return false;
+    const uint64_t fingerprint_bytes = padded(header->array_length);
+    if (len != sizeof(FileHeader) + fingerprint_bytes + slot_count * sizeof(uint64_t) + padded(header->arena_bytes)) {
+        return false;
+    }
+
+    data = bytes;
+    data_bytes = len;
+    count = header->count;
+    hash_seed = header->hash_seed;
+    filter_seed = header->filter_seed;
+    segment_length = header->segment_length;
+    segment_length_mask = header->segment_length_mask;
+    segment_count_length = header->segment_count_length;
+    array_length = header->array_length;
+    slot_mask = slot_count - 1;
+    arena_bytes = header->arena_bytes;
+    fingerprints = bytes + sizeof(FileHeader);
+    slots = (const uint64_t*)(fingerprints + fingerprint_bytes);
+    arena = (const uint8_t*)(slots + slot_count);
+    return true;
+}
+
+bool AddressSet::save(const std::string& path) const {
+    if (!data) return false;
+    const std::string temp_path = path + ".tmp";
+    MappedFile temp;
+    if (!temp.open(temp_path, true, data_bytes)) return false;
+    std::memcpy(temp.data, data, data_bytes);
+    temp.flush(temp.data, temp.size);
+    temp.close();
+    return replaceFile(temp_path, path);
+}
+
+bool AddressSet::open(const std::string& path) {
+    close();
+    if (!file) file.reset(new MappedFile());
+    if (!file->open(path, false, 0, false)) {
+        file->close();
+        return false;
+    }
+    if (!attach(file->data, file->size)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool AddressSet::exactMatch(uint64_t key, const char* address, size_t len) const {
+    const uint64_t tag = key >> 32;
+    uint64_t position = key & slot_mask;
+    for (uint64_t probes = 0; probes <= slot_mask; probes++, position = (position + 1) & slot_mask) {
+        const uint64_t slot = slots[position];
+        if (slot == 0) return false;
+        const uint64_t offset = (uint32_t)slot - 1;
+        // Arquivo corrompido não pode levar a leitura fora do mapeamento
+        if ((slot >> 32) == tag && offset + 1 + len <= arena_bytes && arena[offset] == len &&
+            std::memcmp(arena + offset + 1, address, len) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AddressSet::contains(const char* address, size_t len) const {
+    if (count == 0 || len == 0 || len > MAX_ADDRESS_BYTES) return false;
+    const FuseShape shape = { segment_length, segment_length_mask, segment_count_length, array_length };
+    const uint64_t key = addressKey(address, len, hash_seed);
+    const uint64_t hash = murmur64(key + filter_seed);
+    const uint8_t f = fingerprint(hash) ^ fingerprints[shape.position(0, hash)] ^
+                      fingerprints[shape.position(1, hash)] ^ fingerprints[shape.position(2, hash)];
+    return f == 0 && exactMatch(key, address, len);
+}
+
+void AddressSet::containsBatch(const ByteView* addresses, size_t total, uint8_t* out) const {
+    if (count == 0) {
+        std::memset(out, 0, total);
+        return;
+    }
+    const FuseShape shape = { segment_length, segment_length_mask, segment_count_length, array_length };
+    uint64_t keys[BATCH];
+    uint32_t positions[BATCH][3];
+    uint8_t prints[BATCH];
+    size_t candidates[BATCH];
+
+    for (size_t begin = 0; begin < total; begin += BATCH) {
+        const size_t n = std::min(BATCH, total - begin);
+        const ByteView* chunk = addresses + begin;
+        // 1) hashes e prefetch das três posições de cada endereço
+        for (size_t i = 0; i < n; i++) {
+            const char* text = (const char*)chunk[i].data;
+            const size_t len = chunk[i].size;
+            keys[i] = addressKey(text, len, hash_seed);
+            const uint64_t hash = murmur64(keys[i] + filter_seed);
+            prints[i] = len == 0 || len > MAX_ADDRESS_BYTES ? 1 : fingerprint(hash);
+            for (int j = 0; j < 3; j++) {
+                positions[i][j] = shape.position(j, hash);
+                __builtin_prefetch(fingerprints + positions[i][j]);
+            }
+        }
+        // 2) filtro; quem passa tem a posição da tabela adiantada
+        size_t passed = 0;
+        for (size_t i = 0; i < n; i++) {
+            const uint8_t f = prints[i] ^ fingerprints[positions[i][0]] ^ fingerprints[positions[i][1]] ^
+                              fingerprints[positions[i][2]];
+            out[begin + i] = 0;
+            if (f == 0) {
+                __builtin_prefetch(slots + (keys[i] & slot_mask));
+                candidates[passed++] = i;
+            }
+        }
+        // 3) confirmação exata
+        for (size_t c = 0; c < passed; c++) {
+            const size_t i = candidates[c];
+            const ByteView& address = chunk[i];
+            out[begin + i] = address.size != 0 && address.size <= MAX_ADDRESS_BYTES &&
+                             exactMatch(keys[i], (const char*)address.data, address.size);
+        }
+    }
+}
+
+void AddressSet::containsBatch(const std::string* addresses, size_t total, uint8_t* out) const {
+    ByteView views[BATCH * 16];
+    const size_t step = sizeof(views) / sizeof(views[0]);
+    for (size_t begin = 0; begin < total; begin += step) {
+        const size_t n = std::min(step, total - begin);
+        for (size_t i = 0; i < n; i++) {
+            views[i].data = (const uint8_t*)addresses[begin + i].data();
+            views[i].size = addresses[begin + i].size();
+        }
+        containsBatch(views, n, out + begin);
+    }
+}
+
+} // namespace adilsoncrypto
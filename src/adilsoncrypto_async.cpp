@@ -0,0 +1,241 @@
+#include "../include/adilsoncrypto_async.h"
+#include "../include/adilsoncrypto_pool.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include <chrono>
+#include <thread>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace adilsoncrypto {
+
+namespace {
+
+const size_t MAX_BATCH = 1024;   // requisições por lote, como no daemon
+
+class Dispatcher {
+public:
+    Dispatcher() : thread([this]() { loop(); }) {}
+
+    void submit(std::vector<std::unique_ptr<AsyncJob>>& jobs) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto& job : jobs) queue.push_back(std::move(job));
+        }
+        ready.notify_one();
+    }
+
+    AsyncStats stats() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return counters;
+    }
+
+private:
+    void loop() {
+        std::vector<std::unique_ptr<AsyncJob>> batch;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ready.wait(lock, [this]() { return !queue.empty(); });
+                if (queue.size() <= MAX_BATCH) {
+                    batch.swap(queue);
+                } else {
+                    batch.assign(std::make_move_iterator(queue.begin()),
+                                 std::make_move_iterator(queue.begin() + MAX_BATCH));
+                    queue.erase(queue.begin(), queue.begin() + MAX_BATCH);
+                }
+                counters.batches++;
+                counters.jobs += batch.size();
+            }
+            process(batch);
+            batch.clear();
+        }
+    }
+
+    // Hashes do lote juntos, o resto no pool, conclusões na ordem de chegada
+    void process(std::vector<std::unique_ptr<AsyncJob>>& batch) {
+        const size_t count = batch.size();
+        messages.clear();
+        lens.clear();
+        digest_of.assign(count, nullptr);
+        for (size_t i = 0; i < count; i++) {
+            if (!batch[i]->hash_input) continue;
+            messages.push_back((const uint8_t*)batch[i]->input.data());
+            lens.push_back(batch[i]->input.size());
+        }
+        digests.resize(32 * messages.size());
+        if (!messages.empty()) sha256Batch(messages.data(), lens.data(), messages.size(), digests.data());
+        for (size_t i = 0, hashed = 0; i < count; i++) {
+            if (batch[i]->hash_input) digest_of[i] = digests.data() + 32 * hashed++;
+        }
+
+        defaultThreadPool().parallelFor(count, 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                // Uma exceção deixa o valor padrão ("" / vazio / false)
+                try {
+                    batch[i]->run(digest_of[i]);
+                } catch (...) {
+                }
+            }
+        });
+
+        for (auto& job : batch) job->complete();
+    }
+
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::vector<std::unique_ptr<AsyncJob>> queue;
+    AsyncStats counters;
+
+    // Rascunho de process (só a thread do despachante usa)
+    std::vector<const uint8_t*> messages;
+    std::vector<size_t> lens;
+    std::vector<uint8_t> digests;
+    std::vector<const uint8_t*> digest_of;
+
+    std::thread thread;   // por último: começa a rodar com o resto já pronto
+};
+
+// Nunca destruído: a thread vive até o fim do processo
+Dispatcher& dispatcher() {
+    static Dispatcher* instance = new Dispatcher();
+    return *instance;
+}
+
+} // namespace
+
+CompletionQueue::CompletionQueue() {
+#if defined(__linux__)
+    event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#else
+    event_fd = -1;
+#endif
+}
+
+CompletionQueue::~CompletionQueue() {
+#if defined(__linux__)
+    if (event_fd >= 0) ::close(event_fd);
+#endif
+}
+
+void CompletionQueue::post(std::function<void()> completion) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back(std::move(completion));
+    }
+    posted.notify_all();
+#if defined(__linux__)
+    if (event_fd >= 0) {
+        uint64_t one = 1;
+        if (::write(event_fd, &one, sizeof(one)) < 0) {
+            // Contador no máximo: o fd já está legível
+        }
+    }
+#endif
+}
+
+size_t CompletionQueue::poll() {
+    std::vector<std::function<void()>> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.swap(pending);
+#if defined(__linux__)
+        // Zera o contador com a trava: um post depois disto soma de novo
+        uint64_t value;
+        if (event_fd >= 0 && ::read(event_fd, &value, sizeof(value)) < 0) {
+            // Já estava zerado
+        }
+#endif
+    }
+    for (auto& completion : ready) completion();
+    return ready.size();
+}
+
+size_t CompletionQueue::wait(int timeout_ms) {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        auto has_pending = [this]() { return !pending.empty(); };
+        if (timeout_ms < 0) {
+            posted.wait(lock, has_pending);
+        } else if (!posted.wait_for(lock, std::chrono::milliseconds(timeout_ms), has_pending)) {
+            return 0;
+        }
+    }
+    return poll();
+}
+
+void AsyncStateBase::complete() {
+    std::function<void()> next;
+    CompletionQueue* target;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+        next.swap(continuation);
+        target = queue;
+    }
+    finished.notify_all();
+    if (!next) return;
+    if (target) {
+        target->post(std::move(next));
+    } else {
+        next();
+    }
+}
+
+bool AsyncStateBase::ready() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return done;
+}
+
+void AsyncStateBase::wait() const {
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this]() { return done; });
+}
+
+bool AsyncStateBase::setContinuation(std::function<void()> next) {
+    CompletionQueue* target;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!done) {
+            continuation = std::move(next);
+            return true;
+        }
+        target = queue;
+    }
+    if (!target) return false;
+    target->post(std::move(next));
+    return true;
+}
+
+void AsyncStateBase::setQueue(CompletionQueue* target) {
+    std::lock_guard<std::mutex> lock(mutex);
+    queue = target;
+}
+
+void AsyncScope::enter(size_t count) {
+    std::lock_guard<std::mutex> lock(mutex);
+    pending += count;
+}
+
+void AsyncScope::leave() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (--pending == 0) idle.notify_all();
+}
+
+void AsyncScope::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this]() { return pending == 0; });
+}
+
+void submitAsync(std::vector<std::unique_ptr<AsyncJob>> jobs) {
+    if (!jobs.empty()) dispatcher().submit(jobs);
+}
+
+AsyncStats asyncStats() {
+    return dispatcher().stats();
+}
+
+} // namespace adilsoncrypto
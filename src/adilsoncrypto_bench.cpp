@@ -0,0 +1,567 @@
+#include "../include/adilsoncrypto_bench.h"
+#include "../include/adilsoncrypto_addressset.h"
+#include "../include/adilsoncrypto_blake3.h"
+#include "../include/adilsoncrypto_cpu.h"
+#include "../include/adilsoncrypto_ed25519.h"
+#include "../include/adilsoncrypto_field.h"
+#include "../include/adilsoncrypto_keccak.h"
+#include "../include/adilsoncrypto_mlkem.h"
+#include "../include/adilsoncrypto_ripemd160.h"
+#include "../include/adilsoncrypto_secp256k1.h"
+#include "../include/adilsoncrypto_secure.h"
+#include "../include/adilsoncrypto_serialize.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include "../include/adilsoncrypto_util.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+double elapsedNs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+// Percentil pelo posto mais próximo; 'sorted' em ordem crescente
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t rank = (size_t)std::ceil(p * sorted.size());
+    return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+std::vector<unsigned> defaultThreadCounts() {
+    unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts;
+    for (unsigned t = 1; t < max_threads; t *= 2) counts.push_back(t);
+    counts.push_back(max_threads);
+    return counts;
+}
+
+// Aquece e escolhe quantas chamadas cabem em uma amostra de sample_ms
+size_t calibrateBatch(const BenchCase& bench_case, const BenchConfig& config) {
+    size_t calls = 0;
+    Clock::time_point start = Clock::now();
+    double spent = 0;
+    do {
+        bench_case.run();
+        calls++;
+        spent = elapsedNs(start, Clock::now());
+    } while (spent < config.warmup_ms * 1e6);
+    double per_call = spent / calls;
+    return std::max<size_t>(1, (size_t)(config.sample_ms * 1e6 / per_call));
+}
+
+BenchResult measure(const BenchCase& bench_case, unsigned threads, size_t batch, const BenchConfig& config) {
+    std::vector<std::vector<double>> samples(threads);
+    std::atomic<unsigned> ready(0);
+    std::atomic<bool> go(false);
+
+    auto worker = [&](unsigned id) {
+        std::vector<double>& mine = samples[id];
+        mine.reserve(config.samples);
+        ready.fetch_add(1);
+        while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+        for (unsigned s = 0; s < config.samples; s++) {
+            Clock::time_point start = Clock::now();
+            for (size_t i = 0; i < batch; i++) bench_case.run();
+            mine.push_back(elapsedNs(start, Clock::now()) / batch);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; t++) pool.emplace_back(worker, t);
+    while (ready.load() < threads - 1) std::this_thread::yield();
+    Clock::time_point start = Clock::now();
+    go.store(true, std::memory_order_release);
+    ready.fetch_add(1);
+    worker(0);
+    for (std::thread& t : pool) t.join();
+    double wall_ns = elapsedNs(start, Clock::now());
+
+    std::vector<double> all;
+    for (const std::vector<double>& s : samples) all.insert(all.end(), s.begin(), s.end());
+    std::sort(all.begin(), all.end());
+
+    BenchResult result;
+    result.name = bench_case.name;
+    result.threads = threads;
+    result.samples = all.size();
+    result.batch = batch;
+    result.bytes = bench_case.bytes;
+    double total = 0;
+    for (double v : all) total += v;
+    result.mean_ns = all.empty() ? 0 : total / all.size();
+    result.p50_ns = percentile(all, 0.50);
+    result.p99_ns = percentile(all, 0.99);
+    double ops = (double)threads * config.samples * batch;
+    result.ops_per_sec = wall_ns > 0 ? ops * 1e9 / wall_ns : 0;
+    result.mb_per_sec = result.ops_per_sec * bench_case.bytes / 1e6;
+    return result;
+}
+
+std::string jsonEscape(const std::string& text) {
+    std::string out;
+    for (unsigned char c : text) {
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (c < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out += buf;
+            } else {
+                out += (char)c;
+            }
+        }
+    }
+    return out;
+}
+
+std::string csvField(const std::string& text) {
+    if (text.find_first_of(",\"\n") == std::string::npos) return text;
+    std::string out = "\"";
+    for (char c : text) {
+        if (c == '"') out += '"';
+        out += c;
+    }
+    return out + "\"";
+}
+
+std::string number(double value) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.6g", value);
+    return buf;
+}
+
+std::string compilerName() {
+#if defined(__clang__)
+    return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "desconhecido";
+#endif
+}
+
+std::string systemName() {
+#if defined(_WIN32)
+    return "windows";
+#elif defined(__APPLE__)
+    return "macos";
+#elif defined(__linux__)
+    return "linux";
+#else
+    return "desconhecido";
+#endif
+}
+
+std::string architectureName() {
+#if defined(__x86_64__) || defined(_M_X64)
+    return "x86_64";
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    return "aarch64";
+#elif defined(__i386__) || defined(_M_IX86)
+    return "x86";
+#else
+    return "desconhecida";
+#endif
+}
+
+std::string utcTimestamp() {
+    std::time_t now = std::time(nullptr);
+    std::tm utc{};
+#if defined(_WIN32)
+    gmtime_s(&utc, &now);
+#else
+    gmtime_r(&now, &utc);
+#endif
+    char buf[32];
+    std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    return buf;
+}
+
+std::string randomText(size_t len) {
+    std::string text(len, '\0');
+    RAND_bytes((unsigned char*)&text[0], (int)len);
+    return text;
+}
+
+// Adiciona as variantes de 64 B e 4 KiB de um hash sobre bytes brutos
+void addHash(BenchHarness& harness, const std::string& name,
+             std::function<void(const uint8_t*, size_t)> digest) {
+    for (size_t len : { (size_t)64, (size_t)4096 }) {
+        auto data = std::make_shared<std::string>(randomText(len));
+        harness.add(name + "/" + std::to_string(len),
+                    [data, digest]() { digest((const uint8_t*)data->data(), data->size()); }, len);
+    }
+}
+
+// Idem pela API de strings da AdilsonCrypto (inclui a conversão para hex)
+void addApiHash(BenchHarness& harness, const std::string& name, AdilsonCrypto& crypto,
+                std::string (AdilsonCrypto::*method)(const std::string&)) {
+    for (size_t len : { (size_t)64, (size_t)4096 }) {
+        auto data = std::make_shared<std::string>(randomText(len));
+        AdilsonCrypto* c = &crypto;
+        harness.add(name + "/" + std::to_string(len), [c, data, method]() { (c->*method)(*data); }, len);
+    }
+}
+
+// Produto no corpo e k G na secp256k1 com a forma de corpo dada, para
+// comparar a especializada (constexpr) com a genérica
+template <typename Field>
+void addPrimeField(BenchHarness& harness, const std::string& name, const Field& field) {
+    uint64_t raw[FIELD_MAX_LIMBS] = {};
+    RAND_bytes((unsigned char*)raw, 32);
+    auto a = std::make_shared<typename Field::Element>(field.fromRaw(raw));
+    RAND_bytes((unsigned char*)raw, 32);
+    auto b = std::make_shared<typename Field::Element>(field.fromRaw(raw));
+    harness.add(name + "/mul", [field, a, b]() { field.mul(*a, *a, *b); });
+
+    uint64_t gx[4], gy[4];
+    limbsFromHex("79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798", gx);
+    limbsFromHex("483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8", gy);
+    std::copy(gx, gx + 4, raw);
+    typename Field::Element x = field.fromRaw(raw);
+    std::copy(gy, gy + 4, raw);
+    typename Field::Element y = field.fromRaw(raw);
+    auto curve = std::make_shared<WeierstrassCurve<Field>>(field, field.zero(), field.fromUint(7));
+    auto generator = std::make_shared<typename WeierstrassCurve<Field>::Point>(curve->fromAffine(x, y));
+    auto scalar = std::make_shared<std::string>(randomText(32));
+    auto result = std::make_shared<typename WeierstrassCurve<Field>::Point>();
+    harness.add(name + "/scalarmul", [curve, generator, scalar, result]() {
+        curve->mul(*result, *generator, (const uint8_t*)scalar->data(), scalar->size());
+    });
+}
+
+} // namespace
+
+void BenchMetadata::set(const std::string& key, const std::string& value) {
+    for (auto& field : fields) {
+        if (field.first == key) {
+            field.second = value;
+            return;
+        }
+    }
+    fields.emplace_back(key, value);
+}
+
+std::string BenchMetadata::get(const std::string& key) const {
+    for (const auto& field : fields) {
+        if (field.first == key) return field.second;
+    }
+    return "";
+}
+
+BenchMetadata collectBenchMetadata() {
+    BenchMetadata metadata;
+    metadata.set("timestamp", utcTimestamp());
+    metadata.set("cpu", cpuModelName());
+    metadata.set("cpu_features", cpuFeatureString());
+    metadata.set("hardware_threads", std::to_string(std::thread::hardware_concurrency()));
+    metadata.set("os", systemName());
+    metadata.set("arch", architectureName());
+    metadata.set("compiler", compilerName());
+#if defined(__OPTIMIZE__)
+    metadata.set("optimized", "true");
+#else
+    metadata.set("optimized", "false");
+#endif
+    metadata.set("openssl", OpenSSL_version(OPENSSL_VERSION));
+    metadata.set("sha256_lanes", sha256LaneBackend().name);
+    metadata.set("mlkem_backend", mlKemBackendName());
+    return metadata;
+}
+
+void BenchHarness::add(const std::string& name, std::function<void()> run, size_t bytes) {
+    BenchCase bench_case;
+    bench_case.name = name;
+    bench_case.bytes = bytes;
+    bench_case.run = std::move(run);
+    bench_cases.push_back(std::move(bench_case));
+}
+
+void BenchHarness::add(BenchCase bench_case) {
+    bench_cases.push_back(std::move(bench_case));
+}
+
+std::vector<BenchResult> BenchHarness::run(const BenchConfig& config,
+                                           const std::function<void(const BenchResult&)>& progress) const {
+    std::vector<unsigned> thread_counts = config.threads.empty() ? defaultThreadCounts() : config.threads;
+    std::vector<BenchResult> results;
+    for (const BenchCase& bench_case : bench_cases) {
+        if (!config.filter.empty() && bench_case.name.find(config.filter) == std::string::npos) continue;
+        // O lote é calibrado uma vez (1 thread) e mantido em todas as rodadas,
+        // para que as amostras de contagens de threads diferentes sejam comparáveis
+        size_t batch = calibrateBatch(bench_case, config);
+        for (unsigned threads : thread_counts) {
+            if (threads == 0) continue;
+            results.push_back(measure(bench_case, threads, batch, config));
+            if (progress) progress(results.back());
+        }
+    }
+    return results;
+}
+
+void addStandardBenchmarks(BenchHarness& harness, AdilsonCrypto& crypto) {
+    AdilsonCrypto* c = &crypto;
+    auto message = std::make_shared<std::string>(randomText(64));
+
+    // secp256k1 (curva atual da AdilsonCrypto)
+    auto keypair = std::make_shared<KeyPair>(crypto.generateKeyPair());
+    auto signature = std::make_shared<Signature>(crypto.sign(*message, keypair->private_key));
+    harness.add("secp256k1/keygen", [c]() { c->generateKeyPair(); });
+    harness.add("secp256k1/sign", [c, message, keypair]() { c->sign(*message, keypair->private_key); });
+    harness.add("secp256k1/verify",
+                [c, message, keypair, signature]() { c->verify(*message, *signature, keypair->public_key); });
+
+    // Caminho sem alocação por baixo de sign: chave na arena segura, digest pronto
+    auto secret = std::make_shared<SecureBuffer>(SECP256K1_SECRET_BYTES);
+    if (secret->valid() && scalarFromHex(keypair->private_key, secret->data())) {
+        harness.add("secp256k1/sign-digest", [secret]() {
+            static const uint8_t digest[32] = { 1 };
+            uint8_t out[SECP256K1_SIGNATURE_BYTES];
+            secp256k1SignDigest(secret->data(), digest, out);
+        });
+    }
+
+    // Curvas nomeadas: o contexto é do processo, então criar a curva só aloca
+    harness.add("curve/create", [c]() { c->createCurve(CURVE_SECP384R1); });
+    for (const std::string& name : { CURVE_SECP256R1, CURVE_SECP384R1, CURVE_SECP521R1, CURVE_BRAINPOOLP512T1 }) {
+        std::shared_ptr<IEllipticCurve> curve = crypto.createCurve(name);
+        auto curve_keypair = std::make_shared<KeyPair>(curve->generateKeyPair());
+        auto curve_signature = std::make_shared<Signature>(curve->sign(*message, curve_keypair->private_key));
+        harness.add(name + "/sign", [curve, message, curve_keypair]() { curve->sign(*message, curve_keypair->private_key); });
+        harness.add(name + "/verify", [curve, message, curve_keypair, curve_signature]() {
+            curve->verify(*message, *curve_signature, curve_keypair->public_key);
+        });
+    }
+
+    // Corpo primo de createCustomCurve: mesmo código, módulo constexpr x lido
+    // em tempo de execução
+    addPrimeField(harness, "field/secp256k1/specialized", FixedField<Secp256k1FieldParams>());
+    addPrimeField(harness, "field/secp256k1/generic",
+                  GenericField(RuntimeModulus(Secp256k1FieldParams::MODULUS.p, Secp256k1FieldParams::LIMBS)));
+
+    // Ed25519
+    struct Ed25519Keys {
+        uint8_t seed[32];
+        uint8_t public_key[32];
+        uint8_t signature[64];
+    };
+    auto ed = std::make_shared<Ed25519Keys>();
+    RAND_bytes(ed->seed, sizeof(ed->seed));
+    ed25519PublicKey(ed->seed, ed->public_key);
+    ed25519Sign((const uint8_t*)message->data(), message->size(), ed->seed, ed->public_key, ed->signature);
+    harness.add("ed25519/keygen", [ed]() {
+        uint8_t public_key[32];
+        ed25519PublicKey(ed->seed, public_key);
+    });
+    harness.add("ed25519/sign", [ed, message]() {
+        uint8_t sig[64];
+        ed25519Sign((const uint8_t*)message->data(), message->size(), ed->seed, ed->public_key, sig);
+    });
+    harness.add("ed25519/verify", [ed, message]() {
+        ed25519Verify((const uint8_t*)message->data(), message->size(), ed->public_key, ed->signature);
+    });
+
+    // ML-KEM-768
+    const MlKemParams& kem = mlKemParams(MlKemLevel::ML_KEM_768);
+    struct MlKemKeys {
+        std::vector<uint8_t> encaps_key, decaps_key, ciphertext;
+    };
+    auto mk = std::make_shared<MlKemKeys>();
+    mk->encaps_key.resize(kem.encaps_key_bytes);
+    mk->decaps_key.resize(kem.decaps_key_bytes);
+    mk->ciphertext.resize(kem.ciphertext_bytes);
+    uint8_t shared[32];
+    mlKemKeyGen(MlKemLevel::ML_KEM_768, mk->encaps_key.data(), mk->decaps_key.data());
+    mlKemEncaps(MlKemLevel::ML_KEM_768, mk->encaps_key.data(), mk->ciphertext.data(), shared);
+    harness.add("mlkem768/keygen", [kem]() {
+        std::vector<uint8_t> ek(kem.encaps_key_bytes), dk(kem.decaps_key_bytes);
+        mlKemKeyGen(MlKemLevel::ML_KEM_768, ek.data(), dk.data());
+    });
+    harness.add("mlkem768/encaps", [mk, kem]() {
+        std::vector<uint8_t> ct(kem.ciphertext_bytes);
+        uint8_t ss[32];
+        mlKemEncaps(MlKemLevel::ML_KEM_768, mk->encaps_key.data(), ct.data(), ss);
+    });
+    harness.add("mlkem768/decaps", [mk]() {
+        uint8_t ss[32];
+        mlKemDecaps(MlKemLevel::ML_KEM_768, mk->decaps_key.data(), mk->ciphertext.data(), ss);
+    });
+
+    // Hashes: digest direto e API em hex
+    addHash(harness, "hash/sha256", [](const uint8_t* d, size_t n) {
+        uint8_t out[32];
+        sha256Digest(d, n, out);
+    });
+    addHash(harness, "hash/sha256d", [](const uint8_t* d, size_t n) {
+        uint8_t out[32];
+        sha256dDigest(d, n, out);
+    });
+    addHash(harness, "hash/ripemd160", [](const uint8_t* d, size_t n) {
+        uint8_t out[20];
+        ripemd160Digest(d, n, out);
+    });
+    addHash(harness, "hash/keccak256", [](const uint8_t* d, size_t n) {
+        uint8_t out[32];
+        keccak256Digest(d, n, out);
+    });
+    addHash(harness, "hash/blake3", [](const uint8_t* d, size_t n) {
+        uint8_t out[32];
+        blake3Digest(d, n, out);
+    });
+    addHash(harness, "hash/sha3-256", [](const uint8_t* d, size_t n) {
+        uint8_t out[32];
+        sha3_256Digest(d, n, out);
+    });
+    addHash(harness, "hash/sha3-512", [](const uint8_t* d, size_t n) {
+        uint8_t out[64];
+        sha3_512Digest(d, n, out);
+    });
+    addHash(harness, "hash/shake128", [](const uint8_t* d, size_t n) {
+        uint8_t out[32];
+        shake128(d, n, out, sizeof(out));
+    });
+    addHash(harness, "hash/shake256", [](const uint8_t* d, size_t n) {
+        uint8_t out[64];
+        shake256(d, n, out, sizeof(out));
+    });
+    addApiHash(harness, "api/sha256", crypto, &AdilsonCrypto::sha256);
+    addApiHash(harness, "api/sha512", crypto, &AdilsonCrypto::sha512);
+    addApiHash(harness, "api/ripemd160", crypto, &AdilsonCrypto::ripemd160);
+    addApiHash(harness, "api/keccak256", crypto, &AdilsonCrypto::keccak256);
+    addApiHash(harness, "api/blake3", crypto, &AdilsonCrypto::blake3);
+
+    // BLAKE3 de 4 MiB: subárvores de 64 chunks no pool de threads
+    auto blob = std::make_shared<std::string>(randomText(4 << 20));
+    harness.add("hash/blake3/tree-4mib", [blob]() {
+        uint8_t out[32];
+        blake3Digest((const uint8_t*)blob->data(), blob->size(), out);
+    }, blob->size());
+
+    // hash160 de 1024 chaves comprimidas contíguas (varredura de endereços)
+    auto public_keys = std::make_shared<std::string>(randomText(1024 * 33));
+    harness.add("hash160/batch-1024", [public_keys]() {
+        thread_local uint8_t hashes[1024 * 20];
+        hash160Contiguous((const uint8_t*)public_keys->data(), 33, 1024, hashes);
+    }, public_keys->size());
+
+    // Cifras (4 KiB)
+    auto plaintext = std::make_shared<std::string>(randomText(4096));
+    auto key = std::make_shared<std::string>(randomText(32));
+    auto nonce = std::make_shared<std::string>(randomText(12));
+    auto lattice_key = std::make_shared<QuantumKey>(crypto.generateLatticeKey(768));
+    auto sealed = std::make_shared<std::string>(crypto.latticeEncrypt(*plaintext, *lattice_key));
+    auto aes = std::make_shared<std::string>(crypto.aesEncrypt(*plaintext, *key));
+    auto chacha = std::make_shared<std::string>(crypto.chacha20Encrypt(*plaintext, *key, *nonce));
+    size_t len = plaintext->size();
+    harness.add("cipher/mlkem768-aes256gcm/encrypt",
+                [c, plaintext, lattice_key]() { c->latticeEncrypt(*plaintext, *lattice_key); }, len);
+    harness.add("cipher/mlkem768-aes256gcm/decrypt",
+                [c, sealed, lattice_key]() { c->latticeDecrypt(*sealed, *lattice_key); }, len);
+    harness.add("cipher/aes/encrypt", [c, plaintext, key]() { c->aesEncrypt(*plaintext, *key); }, len);
+    harness.add("cipher/aes/decrypt", [c, aes, key]() { c->aesDecrypt(*aes, *key); }, len);
+    harness.add("cipher/chacha20/encrypt",
+                [c, plaintext, key, nonce]() { c->chacha20Encrypt(*plaintext, *key, *nonce); }, len);
+    harness.add("cipher/chacha20/decrypt", [c, chacha, key, nonce]() { c->chacha20Decrypt(*chacha, *key, *nonce); },
+                len);
+
+    // KDFs com parâmetros interativos típicos
+    auto password = std::make_shared<std::string>("correct horse battery staple");
+    auto salt = std::make_shared<std::string>(randomText(16));
+    harness.add("kdf/pbkdf2/10000", [c, password, salt]() { c->pbkdf2(*password, *salt, 10000, 32); });
+    harness.add("kdf/scrypt/16384-8-1", [c, password, salt]() { c->scrypt(*password, *salt, 16384, 8, 1, 32); });
+    harness.add("kdf/argon2/3-65536-1", [c, password, salt]() { c->argon2(*password, *salt, 3, 65536, 1, 32); });
+
+    // Lista de observação com 100k endereços; as consultas alternam entre
+    // endereços da lista e de fora (metade de cada)
+    std::vector<std::string> watched, stream;
+    for (int i = 0; i < 100000; i++) {
+        watched.push_back(bytesToHex((const uint8_t*)randomText(20).data(), 20));
+        stream.push_back(i % 2 ? watched.back() : bytesToHex((const uint8_t*)randomText(20).data(), 20));
+    }
+    // Posição e saída por thread: o mesmo caso roda em várias threads
+    auto address_set = std::make_shared<AddressSet>();
+    auto queries = std::make_shared<std::vector<std::string>>(std::move(stream));
+    if (address_set->build(watched)) {
+        harness.add("addressset/contains", [address_set, queries]() {
+            thread_local size_t next = 0;
+            // O resultado entra no avanço para que a consulta não seja descartada
+            next = (next + 1 + address_set->contains((*queries)[next])) % queries->size();
+        });
+        harness.add("addressset/batch-1024", [address_set, queries]() {
+            thread_local size_t next = 0;
+            thread_local uint8_t hits[1024];
+            next = next % (queries->size() - 1024);
+            address_set->containsBatch(queries->data() + next, 1024, hits);
+            next += 1024;
+        });
+    }
+}
+
+std::string benchToJson(const std::vector<BenchResult>& results, const BenchMetadata& metadata) {
+    std::ostringstream out;
+    out << "{\n  \"metadata\": {";
+    for (size_t i = 0; i < metadata.fields.size(); i++) {
+        out << (i ? "," : "") << "\n    \"" << jsonEscape(metadata.fields[i].first) << "\": \""
+            << jsonEscape(metadata.fields[i].second) << "\"";
+    }
+    out << "\n  },\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        out << (i ? "," : "") << "\n    {\"name\": \"" << jsonEscape(r.name) << "\", \"threads\": " << r.threads
+            << ", \"samples\": " << r.samples << ", \"batch\": " << r.batch << ", \"bytes\": " << r.bytes
+            << ", \"mean_ns\": " << number(r.mean_ns) << ", \"p50_ns\": " << number(r.p50_ns)
+            << ", \"p99_ns\": " << number(r.p99_ns) << ", \"ops_per_sec\": " << number(r.ops_per_sec)
+            << ", \"mb_per_sec\": " << number(r.mb_per_sec) << "}";
+    }
+    out << "\n  ]\n}\n";
+    return out.str();
+}
+
+std::string benchToCsv(const std::vector<BenchResult>& results, const BenchMetadata& metadata) {
+    std::ostringstream out;
+    for (const auto& field : metadata.fields) out << "# " << field.first << ": " << field.second << "\n";
+    out << "name,threads,samples,batch,bytes,mean_ns,p50_ns,p99_ns,ops_per_sec,mb_per_sec\n";
+    for (const BenchResult& r : results) {
+        out << csvField(r.name) << "," << r.threads << "," << r.samples << "," << r.batch << "," << r.bytes << ","
+            << number(r.mean_ns) << "," << number(r.p50_ns) << "," << number(r.p99_ns) << ","
+            << number(r.ops_per_sec) << "," << number(r.mb_per_sec) << "\n";
+    }
+    return out.str();
+}
+
+std::string benchToTable(const std::vector<BenchResult>& results) {
+    std::ostringstream out;
+    char line[160];
+    std::snprintf(line, sizeof(line), "%-36s %7s %12s %12s %12s %14s %10s\n", "operação", "threads", "média ns",
+                  "p50 ns", "p99 ns", "ops/s", "MB/s");
+    out << line;
+    for (const BenchResult& r : results) {
+        std::snprintf(line, sizeof(line), "%-36s %7u %12.0f %12.0f %12.0f %14.0f %10s\n", r.name.c_str(), r.threads,
+                      r.mean_ns, r.p50_ns, r.p99_ns, r.ops_per_sec,
+                      r.bytes ? number(r.mb_per_sec).c_str() : "-");
+        out << line;
+    }
+    return out.str();
+}
+
+} // namespace adilsoncrypto
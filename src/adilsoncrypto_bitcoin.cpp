@@ -0,0 +1,554 @@
+#include "../include/adilsoncrypto_bitcoin.h"
+#include "../include/adilsoncrypto_ethereum.h"
+#include "../include/adilsoncrypto_ripemd160.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include "../include/adilsoncrypto_solana.h"
+#include "../include/adilsoncrypto_util.h"
+#include <cstring>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/ecdsa.h>
+#include <openssl/obj_mac.h>
+#include <openssl/rand.h>
+
+namespace adilsoncrypto {
+
+// Leitura sequencial com verificação de limites
+namespace {
+
+struct Reader {
+    const uint8_t* p;
+    const uint8_t* end;
+
+    bool take(size_t n, const uint8_t*& out) {
+        if ((size_t)(end - p) < n) return false;
+        out = p;
+        p += n;
+        return true;
+    }
+    bool u32(uint32_t& v) {
+        const uint8_t* b;
+        if (!take(4, b)) return false;
+        v = (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+        return true;
+    }
+    bool u64(uint64_t& v) {
+        uint32_t lo, hi;
+        if (!u32(lo) || !u32(hi)) return false;
+        v = ((uint64_t)hi << 32) | lo;
+        return true;
+    }
+    bool compactSize(uint64_t& v) {
+        const uint8_t* b;
+        if (!take(1, b)) return false;
+        if (b[0] < 0xfd) {
+            v = b[0];
+        } else if (b[0] == 0xfd) {
+            if (!take(2, b)) return false;
+            v = (uint64_t)b[0] | ((uint64_t)b[1] << 8);
+        } else if (b[0] == 0xfe) {
+            uint32_t x;
+            if (!u32(x)) return false;
+            v = x;
+        } else {
+            if (!u64(v)) return false;
+        }
+        return true;
+    }
+    bool bytes(ByteView& view) {
+        uint64_t n;
+        if (!compactSize(n) || n > (uint64_t)(end - p)) return false;
+        view.size = (size_t)n;
+        return take(view.size, view.data);
+    }
+};
+
+// Escrita direta no hasher (sem montar a mensagem)
+struct HashWriter {
+    Sha256Hasher& h;
+
+    void raw(const uint8_t* data, size_t len) { h.update(data, len); }
+    void u8(uint8_t v) { h.update(&v, 1); }
+    void u32(uint32_t v) {
+        uint8_t b[4] = { (uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24) };
+        h.update(b, 4);
+    }
+    void u64(uint64_t v) {
+        u32((uint32_t)v);
+        u32((uint32_t)(v >> 32));
+    }
+    void compactSize(uint64_t n) {
+        if (n < 0xfd) {
+            u8((uint8_t)n);
+        } else if (n <= 0xffff) {
+            uint8_t b[3] = { 0xfd, (uint8_t)n, (uint8_t)(n >> 8) };
+            h.update(b, 3);
+        } else if (n <= 0xffffffffu) {
+            u8(0xfe);
+            u32((uint32_t)n);
+        } else {
+            u8(0xff);
+            u64(n);
+        }
+    }
+    void script(const uint8_t* data, size_t len) {
+        compactSize(len);
+        raw(data, len);
+    }
+};
+
+void finishDouble(Sha256Hasher& h, Hash256& out) {
+    uint8_t first[32];
+    h.finalize(first);
+    sha256Digest(first, 32, out.data());
+}
+
+} // namespace
+
+bool parseTransaction(const uint8_t* data, size_t size, TransactionView& tx) {
+    Reader r = { data, data + size };
+    uint32_t version;
+    uint64_t count;
+    if (!r.u32(version)) return false;
+    tx.version = (int32_t)version;
+    tx.inputs.clear();
+    tx.outputs.clear();
+
+    // Marcador segwit: 0x00 0x01 no lugar do número de entradas
+    tx.segwit = size >= 6 && r.p[0] == 0x00 && r.p[1] == 0x01;
+    if (tx.segwit) r.p += 2;
+
+    if (!r.compactSize(count) || count > size) return false;
+    tx.inputs.resize((size_t)count);
+    for (TxInputView& in : tx.inputs) {
+        if (!r.take(36, in.outpoint) || !r.bytes(in.script_sig) || !r.u32(in.sequence)) return false;
+    }
+    if (!r.compactSize(count) || count > size) return false;
+    tx.outputs.resize((size_t)count);
+    for (TxOutputView& out : tx.outputs) {
+        const uint8_t* start = r.p;
+        uint64_t value;
+        if (!r.u64(value) || !r.bytes(out.script_pubkey)) return false;
+        out.value = (int64_t)value;
+        out.serialized.data = start;
+        out.serialized.size = (size_t)(r.p - start);
+    }
+    if (tx.segwit) {
+        for (TxInputView& in : tx.inputs) {
+            if (!r.compactSize(count) || count > size) return false;
+            in.witness.resize((size_t)count);
+            for (ByteView& item : in.witness) {
+                if (!r.bytes(item)) return false;
+            }
+        }
+    }
+    if (!r.u32(tx.locktime)) return false;
+    return r.p == r.end;
+}
+
+SighashCache::SighashCache(const TransactionView& transaction, const std::vector<SpentOutput>* spent_outputs)
+    : tx(transaction), spent(spent_outputs) {
+    Sha256Hasher prevouts, sequences, outputs;
+    for (const TxInputView& in : tx.inputs) {
+        prevouts.update(in.outpoint, 36);
+        uint8_t seq[4] = { (uint8_t)in.sequence, (uint8_t)(in.sequence >> 8), (uint8_t)(in.sequence >> 16), (uint8_t)(in.sequence >> 24) };
+        sequences.update(seq, 4);
+    }
+    for (const TxOutputView& out : tx.outputs) {
+        outputs.update(out.serialized.data, out.serialized.size);
+    }
+    prevouts.finalize(sha_prevouts);
+    sequences.finalize(sha_sequences);
+    outputs.finalize(sha_outputs);
+    sha256Digest(sha_prevouts, 32, hash_prevouts);
+    sha256Digest(sha_sequences, 32, hash_sequence);
+    sha256Digest(sha_outputs, 32, hash_outputs);
+
+    std::memset(sha_amounts, 0, 32);
+    std::memset(sha_scriptpubkeys, 0, 32);
+    if (spent && spent->size() == tx.inputs.size()) {
+        Sha256Hasher amounts, scripts;
+        HashWriter aw = { amounts };
+        HashWriter sw = { scripts };
+        for (const SpentOutput& prev : *spent) {
+            aw.u64((uint64_t)prev.amount);
+            sw.script((const uint8_t*)prev.script_pubkey.data(), prev.script_pubkey.size());
+        }
+        amounts.finalize(sha_amounts);
+        scripts.finalize(sha_scriptpubkeys);
+    }
+}
+
+Hash256 SighashCache::legacy(size_t input, ByteView script_code, uint32_t hash_type) const {
+    Hash256 out = {};
+    const uint32_t base = hash_type & 0x1f;
+    const bool anyone_can_pay = (hash_type & SIGHASH_ANYONECANPAY) != 0;
+    if (input >= tx.inputs.size()) {
+        out[0] = 1;
+        return out;
+    }
+    if (base == SIGHASH_SINGLE && input >= tx.outputs.size()) {
+        // Comportamento histórico do Bitcoin: "hash" = 1
+        out[0] = 1;
+        return out;
+    }
+
+    Sha256Hasher h;
+    HashWriter w = { h };
+    w.u32((uint32_t)tx.version);
+
+    w.compactSize(anyone_can_pay ? 1 : tx.inputs.size());
+    for (size_t i = 0; i < tx.inputs.size(); i++) {
+        if (anyone_can_pay && i != input) continue;
+        const TxInputView& in = tx.inputs[i];
+        w.raw(in.outpoint, 36);
+        if (i == input) {
+            w.script(script_code.data, script_code.size);
+        } else {
+            w.compactSize(0);
+        }
+        bool zero_sequence = i != input && (base == SIGHASH_NONE || base == SIGHASH_SINGLE);
+        w.u32(zero_sequence ? 0 : in.sequence);
+    }
+
+    if (base == SIGHASH_NONE) {
+        w.compactSize(0);
+    } else if (base == SIGHASH_SINGLE) {
+        w.compactSize(input + 1);
+        for (size_t j = 0; j < input; j++) {
+            w.u64(0xffffffffffffffffull);
+            w.compactSize(0);
+        }
+        w.raw(tx.outputs[input].serialized.data, tx.outputs[input].serialized.size);
+    } else {
+        w.compactSize(tx.outputs.size());
+        for (const TxOutputView& o : tx.outputs) w.raw(o.serialized.data, o.serialized.size);
+    }
+
+    w.u32(tx.locktime);
+    w.u32(hash_type);
+    finishDouble(h, out);
+    return out;
+}
+
+Hash256 SighashCache::segwitV0(size_t input, ByteView script_code, int64_t amount, uint32_t hash_type) const {
+    Hash256 out = {};
+    if (input >= tx.inputs.size()) return out;
+    const uint32_t base = hash_type & 0x1f;
+    const bool anyone_can_pay = (hash_type & SIGHASH_ANYONECANPAY) != 0;
+    static const uint8_t ZERO[32] = {};
+
+    uint8_t single_output[32];
+    const uint8_t* outputs_hash = ZERO;
+    if (base != SIGHASH_SINGLE && base != SIGHASH_NONE) {
+        outputs_hash = hash_outputs;
+    } else if (base == SIGHASH_SINGLE && input < tx.outputs.size()) {
+        sha256dDigest(tx.outputs[input].serialized.data, tx.outputs[input].serialized.size, single_output);
+        outputs_hash = single_output;
+    }
+
+    const TxInputView& in = tx.inputs[input];
+    Sha256Hasher h;
+    HashWriter w = { h };
+    w.u32((uint32_t)tx.version);
+    w.raw(anyone_can_pay ? ZERO : hash_prevouts, 32);
+    w.raw(anyone_can_pay || base == SIGHASH_SINGLE || base == SIGHASH_NONE ? ZERO : hash_sequence, 32);
+    w.raw(in.outpoint, 36);
+    w.script(script_code.data, script_code.size);
+    w.u64((uint64_t)amount);
+    w.u32(in.sequence);
+    w.raw(outputs_hash, 32);
+    w.u32(tx.locktime);
+    w.u32(hash_type);
+    finishDouble(h, out);
+    return out;
+}
+
+bool SighashCache::taproot(size_t input, uint32_t hash_type, Hash256& out,
+                           const Hash256* tapleaf_hash, uint32_t codesep_pos, const ByteView* annex) const {
+    if (input >= tx.inputs.size() || !spent || spent->size() != tx.inputs.size()) return false;
+    if (!(hash_type <= 0x03 || (hash_type >= 0x81 && hash_type <= 0x83))) return false;
+    const uint32_t output_type = hash_type == SIGHASH_DEFAULT ? SIGHASH_ALL : (hash_type & 0x03);
+    const bool anyone_can_pay = (hash_type & SIGHASH_ANYONECANPAY) != 0;
+    if (output_type == SIGHASH_SINGLE && input >= tx.outputs.size()) return false;
+
+    // Prefixo do tagged hash "TapSighash" já absorvido no estado
+    static const Hash256 tag = [] {
+        Hash256 t;
+        const char* name = "TapSighash";
+        sha256Digest((const uint8_t*)name, std::strlen(name), t.data());
+        return t;
+    }();
+    Sha256Hasher h;
+    h.update(tag.data(), 32).update(tag.data(), 32);
+    HashWriter w = { h };
+
+    w.u8(0x00);  // epoch
+    w.u8((uint8_t)hash_type);
+    w.u32((uint32_t)tx.version);
+    w.u32(tx.locktime);
+    if (!anyone_can_pay) {
+        w.raw(sha_prevouts, 32);
+        w.raw(sha_amounts, 32);
+        w.raw(sha_scriptpubkeys, 32);
+        w.raw(sha_sequences, 32);
+    }
+    if (output_type == SIGHASH_ALL) {
+        w.raw(sha_outputs, 32);
+    }
+    w.u8((uint8_t)((tapleaf_hash ? 2 : 0) + (annex ? 1 : 0)));
+    if (anyone_can_pay) {
+        const TxInputView& in = tx.inputs[input];
+        const SpentOutput& prev = (*spent)[input];
+        w.raw(in.outpoint, 36);
+        w.u64((uint64_t)prev.amount);
+        w.script((const uint8_t*)prev.script_pubkey.data(), prev.script_pubkey.size());
+        w.u32(in.sequence);
+    } else {
+        w.u32((uint32_t)input);
+    }
+    if (annex) {
+        Sha256Hasher annex_hash;
+        HashWriter aw = { annex_hash };
+        aw.script(annex->data, annex->size);
+        uint8_t digest[32];
+        annex_hash.finalize(digest);
+        w.raw(digest, 32);
+    }
+    if (output_type == SIGHASH_SINGLE) {
+        uint8_t digest[32];
+        sha256Digest(tx.outputs[input].serialized.data, tx.outputs[input].serialized.size, digest);
+        w.raw(digest, 32);
+    }
+    if (tapleaf_hash) {
+        w.raw(tapleaf_hash->data(), 32);
+        w.u8(0x00);  // key_version
+        w.u32(codesep_pos);
+    }
+    h.finalize(out.data());
+    return true;
+}
+
+Hash256 taggedHash(const std::string& tag, const uint8_t* data, size_t len) {
+    uint8_t tag_hash[32];
+    sha256Digest((const uint8_t*)tag.data(), tag.size(), tag_hash);
+    Sha256Hasher h;
+    h.update(tag_hash, 32).update(tag_hash, 32).update(data, len);
+    Hash256 out;
+    h.finalize(out.data());
+    return out;
+}
+
+void hash160(const uint8_t* data, size_t len, uint8_t out[20]) {
+    uint8_t sha[32];
+    sha256Digest(data, len, sha);
+    ripemd160Digest(sha, 32, out);
+}
+
+std::string p2pkhAddress(const uint8_t* public_key, size_t len) {
+    if (len != 33 && len != 65) return "";
+    uint8_t payload[25];
+    payload[0] = 0x00;
+    hash160(public_key, len, payload + 1);
+    uint8_t checksum[32];
+    sha256dDigest(payload, 21, checksum);
+    std::memcpy(payload + 21, checksum, 4);
+    return base58Encode(payload, sizeof(payload));
+}
+
+// As chaves são decodificadas em dois buffers contíguos (comprimidas e não
+// comprimidas) para o hash160 multi-lane; os checksums SHA256d dos payloads
+// de 21 bytes também saem em lote
+std::vector<std::string> p2pkhAddresses(const std::vector<std::string>& public_keys) {
+    const size_t count = public_keys.size();
+    std::vector<std::string> addresses(count);
+    const size_t key_sizes[2] = { 33, 65 };
+    std::vector<uint8_t> keys[2];
+    std::vector<size_t> owners[2];
+    for (size_t i = 0; i < count; i++) {
+        // hexToBytes confere o tamanho: no máximo um dos dois aceita
+        for (int k = 0; k < 2; k++) {
+            keys[k].resize(keys[k].size() + key_sizes[k]);
+            if (hexToBytes(public_keys[i], keys[k].data() + keys[k].size() - key_sizes[k], key_sizes[k])) {
+                owners[k].push_back(i);
+                break;
+            }
+            keys[k].resize(keys[k].size() - key_sizes[k]);
+        }
+    }
+
+    std::vector<uint8_t> hashes, payloads, checksums;
+    std::vector<const uint8_t*> ptrs;
+    for (int k = 0; k < 2; k++) {
+        const size_t total = owners[k].size();
+        if (total == 0) continue;
+        hashes.resize(20 * total);
+        hash160Contiguous(keys[k].data(), key_sizes[k], total, hashes.data());
+        payloads.assign(25 * total, 0);
+        ptrs.resize(total);
+        for (size_t i = 0; i < total; i++) {
+            std::memcpy(payloads.data() + 25 * i + 1, hashes.data() + 20 * i, 20);
+            ptrs[i] = payloads.data() + 25 * i;
+        }
+        checksums.resize(32 * total);
+        sha256dMany(ptrs.data(), 21, total, checksums.data());
+        for (size_t i = 0; i < total; i++) {
+            std::memcpy(payloads.data() + 25 * i + 21, checksums.data() + 32 * i, 4);
+            addresses[owners[k][i]] = base58Encode(payloads.data() + 25 * i, 25);
+        }
+    }
+    return addresses;
+}
+
+// Chave EC secp256k1 compartilhada (o grupo é imutável após criado)
+static const EC_GROUP* secp256k1Group() {
+    static EC_GROUP* group = EC_GROUP_new_by_curve_name(NID_secp256k1);
+    return group;
+}
+
+bool ecdsaSignDigest(const uint8_t digest[32], const uint8_t private_key[32], std::string& der,
+                     std::string* r_hex, std::string* s_hex) {
+    const EC_GROUP* group = secp256k1Group();
+    EC_KEY* key = EC_KEY_new();
+    BIGNUM* priv = BN_bin2bn(private_key, 32, nullptr);
+    EC_KEY_set_group(key, group);
+    EC_KEY_set_private_key(key, priv);
+    ECDSA_SIG* sig = ECDSA_do_sign(digest, 32, key);
+    bool ok = sig != nullptr;
+    if (ok) {
+        // S baixo: s > n/2 -> n - s
+        const BIGNUM* r;
+        const BIGNUM* s;
+        ECDSA_SIG_get0(sig, &r, &s);
+        BIGNUM* half = BN_dup(EC_GROUP_get0_order(group));
+        BN_rshift1(half, half);
+        BIGNUM* new_r = BN_dup(r);
+        BIGNUM* new_s = BN_dup(s);
+        if (BN_cmp(new_s, half) > 0) BN_sub(new_s, EC_GROUP_get0_order(group), new_s);
+        ECDSA_SIG_set0(sig, new_r, new_s);
+        BN_free(half);
+
+        int len = i2d_ECDSA_SIG(sig, nullptr);
+        der.resize(len > 0 ? (size_t)len : 0);
+        unsigned char* p = (unsigned char*)der.data();
+        i2d_ECDSA_SIG(sig, &p);
+        if (r_hex) {
+            char* hex = BN_bn2hex(new_r);
+            *r_hex = hex;
+            OPENSSL_free(hex);
+        }
+        if (s_hex) {
+            char* hex = BN_bn2hex(new_s);
+            *s_hex = hex;
+            OPENSSL_free(hex);
+        }
+        ECDSA_SIG_free(sig);
+    }
+    BN_clear_free(priv);
+    EC_KEY_free(key);
+    return ok;
+}
+
+bool ecdsaVerifyDigest(const uint8_t digest[32], const std::string& der, const uint8_t* public_key, size_t public_key_len) {
+    const EC_GROUP* group = secp256k1Group();
+    EC_POINT* point = EC_POINT_new(group);
+    // Só chaves SEC1 de 33 ou 65 bytes: o byte {0x00} é o infinito, com o qual
+    // r = x(G), s = e verificaria para qualquer digest
+    bool ok = point && (public_key_len == 33 || public_key_len == 65) &&
+              EC_POINT_oct2point(group, point, public_key, public_key_len, nullptr) == 1 &&
+              !EC_POINT_is_at_infinity(group, point);
+    if (ok) {
+        const unsigned char* p = (const unsigned char*)der.data();
+        ECDSA_SIG* sig = d2i_ECDSA_SIG(nullptr, &p, (long)der.size());
+        EC_KEY* key = EC_KEY_new();
+        EC_KEY_set_group(key, group);
+        EC_KEY_set_public_key(key, point);
+        ok = sig && ECDSA_do_verify(digest, 32, sig, key) == 1;
+        ECDSA_SIG_free(sig);
+        EC_KEY_free(key);
+    }
+    EC_POINT_free(point);
+    return ok;
+}
+
+} // namespace adilsoncrypto
+
+using namespace adilsoncrypto;
+
+// Interface Bitcoin: chaves secp256k1 comprimidas, endereços P2PKH
+// Base58Check e assinatura de transações brutas (hex).
+class BitcoinChainInterface : public IBlockchainInterface {
+public:
+    std::unique_ptr<IBlockchainInterface> createBitcoinInterface() override {
+        return createBitcoinChainInterface();
+    }
+
+    KeyPair generateKey() override {
+        KeyPair keypair;
+        EC_KEY* key = EC_KEY_new_by_curve_name(NID_secp256k1);
+        if (EC_KEY_generate_key(key) == 1) {
+            uint8_t priv[32];
+            BN_bn2binpad(EC_KEY_get0_private_key(key), priv, 32);
+            uint8_t pub[33];
+            EC_POINT_point2oct(EC_KEY_get0_group(key), EC_KEY_get0_public_key(key),
+                               POINT_CONVERSION_COMPRESSED, pub, sizeof(pub), nullptr);
+            keypair.private_key = bytesToHex(priv, 32);
+            keypair.public_key = bytesToHex(pub, 33);
+            keypair.address = getAddress(keypair);
+            OPENSSL_cleanse(priv, sizeof(priv));
+        }
+        EC_KEY_free(key);
+        return keypair;
+    }
+
+    std::string getAddress(const KeyPair& keypair) override {
+        std::string pub;
+        if (!hexToBytes(keypair.public_key, pub)) return "";
+        return p2pkhAddress((const uint8_t*)pub.data(), pub.size());
+    }
+
+    // Assina a entrada 0 de uma transação bruta (hex) como P2PKH com
+    // SIGHASH_ALL. Signature.r/s em hex, v = tipo de sighash e proof = DER +
+    // byte de sighash (pronto para o scriptSig). Para várias entradas,
+    // segwit ou taproot use SighashCache (adilsoncrypto_bitcoin.h).
+    // Signature vazia se a transação ou a chave forem inválidas.
+    Signature sign(const std::string& transaction, const KeyPair& keypair) override {
+        Signature signature;
+        std::string raw, pub;
+        uint8_t priv[32];
+        TransactionView tx;
+        if (!hexToBytes(transaction, raw) || !parseTransaction((const uint8_t*)raw.data(), raw.size(), tx) ||
+            tx.inputs.empty() || !hexToBytes(keypair.public_key, pub) || !hexToBytes(keypair.private_key, priv, 32)) {
+            return signature;
+        }
+
+        // scriptCode P2PKH: OP_DUP OP_HASH160 <hash160> OP_EQUALVERIFY OP_CHECKSIG
+        uint8_t script_code[25] = { 0x76, 0xa9, 0x14 };
+        hash160((const uint8_t*)pub.data(), pub.size(), script_code + 3);
+        script_code[23] = 0x88;
+        script_code[24] = 0xac;
+
+        SighashCache cache(tx);
+        Hash256 digest = cache.legacy(0, ByteView{ script_code, sizeof(script_code) }, SIGHASH_ALL);
+        std::string der;
+        if (ecdsaSignDigest(digest.data(), priv, der, &signature.r, &signature.s)) {
+            der.push_back((char)SIGHASH_ALL);
+            signature.v = "01";
+            signature.proof = bytesToHex(der);
+        }
+        OPENSSL_cleanse(priv, sizeof(priv));
+        return signature;
+    }
+
+    std::unique_ptr<IBlockchainInterface> createEthereumInterface() override {
+        return createEthereumChainInterface();
+    }
+
+    std::unique_ptr<IBlockchainInterface> createSolanaInterface() override {
+        return createSolanaChainInterface();
+    }
+};
+
+std::unique_ptr<IBlockchainInterface> createBitcoinChainInterface() {
+    return std::make_unique<BitcoinChainInterface>();
+}
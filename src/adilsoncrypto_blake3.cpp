@@ -0,0 +1,404 @@
+#include "../include/adilsoncrypto_blake3.h"
+#include "../include/adilsoncrypto_blake3_lanes.h"
+#include "../include/adilsoncrypto_cpu.h"
+#include "../include/adilsoncrypto_mmap.h"
+#include "../include/adilsoncrypto_pool.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace adilsoncrypto {
+
+namespace {
+
+// Chunks por subárvore alinhada: a unidade de trabalho do pool (64 KiB)
+const size_t SUBTREE_CHUNKS = 64;
+// Subárvores por rodada paralela; limita o vetor de chaining values
+const size_t SUBTREES_PER_ROUND = 1024;
+
+struct ScalarOps {
+    typedef uint32_t vec;
+    static const size_t LANES = 1;
+    static inline vec load(const uint32_t* p) { return *p; }
+    static inline void store(uint32_t* p, vec v) { *p = v; }
+    static inline vec set1(uint32_t x) { return x; }
+    static inline vec add(vec a, vec b) { return a + b; }
+    static inline vec xor2(vec a, vec b) { return a ^ b; }
+    template <int N> static inline vec rotr(vec x) { return (x >> N) | (x << (32 - N)); }
+};
+
+#if defined(__SSE2__)
+struct Sse2Ops {
+    typedef __m128i vec;
+    static const size_t LANES = 4;
+    static inline vec load(const uint32_t* p) { return _mm_load_si128((const __m128i*)p); }
+    static inline void store(uint32_t* p, vec v) { _mm_store_si128((__m128i*)p, v); }
+    static inline vec set1(uint32_t x) { return _mm_set1_epi32((int)x); }
+    static inline vec add(vec a, vec b) { return _mm_add_epi32(a, b); }
+    static inline vec xor2(vec a, vec b) { return _mm_xor_si128(a, b); }
+    template <int N> static inline vec rotr(vec x) { return _mm_or_si128(_mm_srli_epi32(x, N), _mm_slli_epi32(x, 32 - N)); }
+};
+
+void hashManySse2(const uint8_t* const* inputs, size_t blocks, const uint32_t key[8], uint64_t counter,
+                  bool increment_counter, uint8_t flags, uint8_t flags_start, uint8_t flags_end, uint8_t* out) {
+    Blake3Lanes<Sse2Ops>::hashMany(inputs, blocks, key, counter, increment_counter, flags, flags_start, flags_end,
+                                   out);
+}
+#endif
+
+void hashManyScalar(const uint8_t* const* inputs, size_t blocks, const uint32_t key[8], uint64_t counter,
+                    bool increment_counter, uint8_t flags, uint8_t flags_start, uint8_t flags_end, uint8_t* out) {
+    Blake3Lanes<ScalarOps>::hashMany(inputs, blocks, key, counter, increment_counter, flags, flags_start, flags_end,
+                                     out);
+}
+
+const Blake3LaneBackend BACKEND_SCALAR = { "scalar", 1, hashManyScalar };
+#if defined(__SSE2__)
+const Blake3LaneBackend BACKEND_SSE2 = { "sse2", 4, hashManySse2 };
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+const Blake3LaneBackend BACKEND_AVX2 = { "avx2", 8, blake3HashManyAvx2 };
+const Blake3LaneBackend BACKEND_AVX512 = { "avx512", 16, blake3HashManyAvx512 };
+#endif
+
+const Blake3LaneBackend* backendFor(Sha256Kernel kernel) {
+    switch (kernel) {
+    case Sha256Kernel::SCALAR: return &BACKEND_SCALAR;
+#if defined(__SSE2__)
+    case Sha256Kernel::SSE2: return &BACKEND_SSE2;
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+    case Sha256Kernel::AVX2: return cpuFeatures().avx2 ? &BACKEND_AVX2 : nullptr;
+    case Sha256Kernel::AVX512: return cpuFeatures().avx512f ? &BACKEND_AVX512 : nullptr;
+#endif
+    default: return nullptr;
+    }
+}
+
+const Blake3LaneBackend& bestBackend() {
+    static const Blake3LaneBackend* best = []() {
+        const Sha256Kernel order[] = { Sha256Kernel::AVX512, Sha256Kernel::AVX2, Sha256Kernel::SSE2 };
+        for (Sha256Kernel k : order) {
+            if (const Blake3LaneBackend* b = backendFor(k)) return b;
+        }
+        return &BACKEND_SCALAR;
+    }();
+    return *best;
+}
+
+// Backend mais estreito que ainda cobre 'count' entradas numa chamada:
+// poucos chunks no kernel de 16 lanes pagariam por lanes ociosas. O SSE2
+// fica de fora quando há AVX2: sem vpshufb para as rotações de 16 e 8
+// bits, uma chamada de 4 lanes custa mais que a de 8 do AVX2.
+const Blake3LaneBackend& backendForCount(const Blake3LaneBackend& widest, size_t count) {
+    const Blake3LaneBackend* chosen = &widest;
+    const bool has_avx2 = backendFor(Sha256Kernel::AVX2) != nullptr;
+    const Sha256Kernel narrower[] = { Sha256Kernel::AVX2, Sha256Kernel::SSE2, Sha256Kernel::SCALAR };
+    for (Sha256Kernel k : narrower) {
+        if (k == Sha256Kernel::SSE2 && has_avx2) continue;
+        const Blake3LaneBackend* b = backendFor(k);
+        if (b && b->lanes < chosen->lanes && b->lanes >= count) chosen = b;
+    }
+    return *chosen;
+}
+
+// Compressão completa (16 palavras), usada nos blocos parciais e na saída
+void compressFull(const uint32_t cv[8], const uint8_t block[64], uint8_t block_len, uint64_t counter,
+                  uint8_t flags, uint32_t out[16]) {
+    uint32_t v[16], m[16];
+    for (int t = 0; t < 16; t++) m[t] = blake3LoadLe32(block + 4 * t);
+    for (int i = 0; i < 8; i++) v[i] = cv[i];
+    for (int i = 0; i < 4; i++) v[8 + i] = BLAKE3_IV_WORDS[i];
+    v[12] = (uint32_t)counter;
+    v[13] = (uint32_t)(counter >> 32);
+    v[14] = block_len;
+    v[15] = flags;
+#pragma GCC unroll 7
+    for (int r = 0; r < 7; r++) Blake3Lanes<ScalarOps>::round(v, m, r);
+    for (int i = 0; i < 8; i++) {
+        out[i] = v[i] ^ v[i + 8];
+        out[i + 8] = v[i + 8] ^ cv[i];
+    }
+}
+
+// Último bloco de um nó, guardado para virar chaining value ou raiz (XOF)
+struct Output {
+    uint32_t input_cv[8];
+    uint8_t block[64];
+    uint8_t block_len;
+    uint64_t counter;
+    uint8_t flags;
+
+    void chainingValue(uint8_t out[32]) const {
+        uint32_t words[16];
+        compressFull(input_cv, block, block_len, counter, flags, words);
+        for (int i = 0; i < 8; i++) blake3StoreLe32(out + 4 * i, words[i]);
+    }
+
+    void rootBytes(uint8_t* out, size_t len) const {
+        uint8_t bytes[64];
+        for (uint64_t output_counter = 0; len > 0; output_counter++) {
+            uint32_t words[16];
+            compressFull(input_cv, block, block_len, output_counter, flags | BLAKE3_ROOT, words);
+            for (int i = 0; i < 16; i++) blake3StoreLe32(bytes + 4 * i, words[i]);
+            const size_t take = std::min(len, sizeof(bytes));
+            std::memcpy(out, bytes, take);
+            out += take;
+            len -= take;
+        }
+    }
+};
+
+Output parentOutput(const uint8_t left[32], const uint8_t right[32], const uint32_t key[8], uint8_t flags) {
+    Output o;
+    std::memcpy(o.input_cv, key, sizeof(o.input_cv));
+    std::memcpy(o.block, left, 32);
+    std::memcpy(o.block + 32, right, 32);
+    o.block_len = 64;
+    o.counter = 0;
+    o.flags = flags | BLAKE3_PARENT;
+    return o;
+}
+
+// 'count' chunks inteiros e contíguos a partir do contador 'counter'; lanes
+// ociosas repetem o último chunk e o resultado é descartado
+void hashChunks(const Blake3LaneBackend& widest, const uint32_t key[8], uint8_t flags, const uint8_t* data,
+                size_t count, uint64_t counter, uint8_t* out) {
+    const uint8_t* ptrs[BLAKE3_MAX_LANES];
+    uint8_t cvs[BLAKE3_MAX_LANES * 32];
+    for (size_t base = 0; base < count;) {
+        const Blake3LaneBackend& backend = backendForCount(widest, count - base);
+        const size_t active = std::min(backend.lanes, count - base);
+        for (size_t l = 0; l < backend.lanes; l++) {
+            ptrs[l] = data + BLAKE3_CHUNK_BYTES * (base + std::min(l, active - 1));
+        }
+        backend.hashMany(ptrs, BLAKE3_CHUNK_BYTES / BLAKE3_BLOCK_BYTES, key, counter + base, true, flags,
+                         BLAKE3_CHUNK_START, BLAKE3_CHUNK_END, cvs);
+        std::memcpy(out + 32 * base, cvs, 32 * active);
+        base += active;
+    }
+}
+
+// Um nível acima: cvs[2i] e cvs[2i+1] viram out[i]. Pode ser feito no
+// lugar (out == cvs), pois cada grupo de lanes lê antes de escrever.
+void hashParents(const Blake3LaneBackend& widest, const uint32_t key[8], uint8_t flags, const uint8_t* cvs,
+                 size_t pairs, uint8_t* out) {
+    const uint8_t* ptrs[BLAKE3_MAX_LANES];
+    uint8_t parents[BLAKE3_MAX_LANES * 32];
+    for (size_t base = 0; base < pairs;) {
+        const Blake3LaneBackend& backend = backendForCount(widest, pairs - base);
+        const size_t active = std::min(backend.lanes, pairs - base);
+        for (size_t l = 0; l < backend.lanes; l++) ptrs[l] = cvs + 64 * (base + std::min(l, active - 1));
+        backend.hashMany(ptrs, 1, key, 0, false, flags | BLAKE3_PARENT, 0, 0, parents);
+        std::memcpy(out + 32 * base, parents, 32 * active);
+        base += active;
+    }
+}
+
+// Chaining value de uma subárvore de SUBTREE_CHUNKS chunks inteiros que não
+// é a raiz: folhas em lanes e depois os pais, nível a nível
+void subtreeCv(const Blake3LaneBackend& backend, const uint32_t key[8], uint8_t flags, const uint8_t* data,
+               uint64_t counter, uint8_t out[32]) {
+    uint8_t cvs[SUBTREE_CHUNKS * 32];
+    hashChunks(backend, key, flags, data, SUBTREE_CHUNKS, counter, cvs);
+    for (size_t count = SUBTREE_CHUNKS; count > 1; count /= 2) hashParents(backend, key, flags, cvs, count / 2, cvs);
+    std::memcpy(out, cvs, 32);
+}
+
+} // namespace
+
+const Blake3LaneBackend& blake3LaneBackend(Sha256Kernel kernel) {
+    if (kernel == Sha256Kernel::AUTO) return bestBackend();
+    const Blake3LaneBackend* b = backendFor(kernel);
+    return b ? *b : bestBackend();
+}
+
+Blake3Hasher::Blake3Hasher() : Blake3Hasher(BLAKE3_IV_WORDS, 0) {}
+
+Blake3Hasher::Blake3Hasher(const uint8_t key_bytes[BLAKE3_KEY_BYTES]) {
+    uint32_t words[8];
+    for (int i = 0; i < 8; i++) words[i] = blake3LoadLe32(key_bytes + 4 * i);
+    std::memcpy(key, words, sizeof(key));
+    flags = BLAKE3_KEYED_HASH;
+    reset();
+}
+
+Blake3Hasher::Blake3Hasher(const uint32_t key_words[8], uint8_t mode_flags) : flags(mode_flags) {
+    std::memcpy(key, key_words, sizeof(key));
+    reset();
+}
+
+Blake3Hasher Blake3Hasher::deriveKey(const std::string& context) {
+    uint8_t context_key[BLAKE3_KEY_BYTES];
+    Blake3Hasher(BLAKE3_IV_WORDS, BLAKE3_DERIVE_KEY_CONTEXT).update(context).finalize(context_key);
+    uint32_t words[8];
+    for (int i = 0; i < 8; i++) words[i] = blake3LoadLe32(context_key + 4 * i);
+    return Blake3Hasher(words, BLAKE3_DERIVE_KEY_MATERIAL);
+}
+
+void Blake3Hasher::reset() {
+    std::memcpy(cv, key, sizeof(cv));
+    chunk_counter = 0;
+    std::memset(block, 0, sizeof(block));
+    block_len = 0;
+    blocks_compressed = 0;
+    stack_len = 0;
+}
+
+// Entrada no chunk em andamento; nunca passa do fim do chunk. O bloco cheio
+// só é comprimido quando chega mais entrada, pois o último leva CHUNK_END.
+void Blake3Hasher::chunkUpdate(const uint8_t* data, size_t len) {
+    while (len > 0) {
+        if (block_len == BLAKE3_BLOCK_BYTES) {
+            uint32_t words[16];
+            compressFull(cv, block, (uint8_t)BLAKE3_BLOCK_BYTES, chunk_counter,
+                         flags | (blocks_compressed == 0 ? BLAKE3_CHUNK_START : 0), words);
+            std::memcpy(cv, words, sizeof(cv));
+            blocks_compressed++;
+            block_len = 0;
+            std::memset(block, 0, sizeof(block));
+        }
+        const size_t take = std::min(BLAKE3_BLOCK_BYTES - block_len, len);
+        std::memcpy(block + block_len, data, take);
+        block_len += (uint8_t)take;
+        data += take;
+        len -= take;
+    }
+}
+
+// Empilha o chaining value de uma subárvore que termina em 'total_chunks' e
+// funde o topo enquanto a pilha tiver mais entradas que bits em 1 no total.
+// Só é chamado com mais entrada a seguir, então nenhuma fusão é a raiz.
+void Blake3Hasher::pushChunkCv(const uint8_t new_cv[32], uint64_t total_chunks) {
+    std::memcpy(stack[stack_len++], new_cv, 32);
+    while (stack_len > (size_t)__builtin_popcountll(total_chunks)) {
+        parentOutput(stack[stack_len - 2], stack[stack_len - 1], key, flags).chainingValue(stack[stack_len - 2]);
+        stack_len--;
+    }
+}
+
+Blake3Hasher& Blake3Hasher::update(const uint8_t* data, size_t len) {
+    const Blake3LaneBackend& backend = bestBackend();
+    while (len > 0) {
+        const size_t chunk_len = blocks_compressed * BLAKE3_BLOCK_BYTES + block_len;
+        if (chunk_len == BLAKE3_CHUNK_BYTES) {
+            uint8_t chunk_cv[32];
+            Output o;
+            std::memcpy(o.input_cv, cv, sizeof(cv));
+            std::memcpy(o.block, block, sizeof(block));
+            o.block_len = block_len;
+            o.counter = chunk_counter;
+            o.flags = flags | BLAKE3_CHUNK_END;
+            o.chainingValue(chunk_cv);
+            pushChunkCv(chunk_cv, ++chunk_counter);
+            std::memcpy(cv, key, sizeof(cv));
+            std::memset(block, 0, sizeof(block));
+            block_len = 0;
+            blocks_compressed = 0;
+            continue;
+        }
+        if (chunk_len > 0 || len <= BLAKE3_CHUNK_BYTES) {
+            const size_t take = std::min(BLAKE3_CHUNK_BYTES - chunk_len, len);
+            chunkUpdate(data, take);
+            data += take;
+            len -= take;
+            continue;
+        }
+
+        // Chunks inteiros que não são o último: até o próximo alinhamento de
+        // subárvore um a um em lanes, depois subárvores inteiras (no pool
+        // quando a entrada é grande), e o resto de novo em lanes
+        size_t whole = (len - 1) / BLAKE3_CHUNK_BYTES;
+        const size_t misaligned = (size_t)(chunk_counter % SUBTREE_CHUNKS);
+        size_t single = misaligned ? std::min(whole, SUBTREE_CHUNKS - misaligned) : 0;
+        size_t subtrees = (whole - single) / SUBTREE_CHUNKS;
+        if (subtrees == 0) single = whole;
+
+        uint8_t cvs[SUBTREE_CHUNKS * 32];
+        for (size_t done = 0; done < single;) {
+            const size_t n = std::min(SUBTREE_CHUNKS, single - done);
+            hashChunks(backend, key, flags, data, n, chunk_counter, cvs);
+            for (size_t i = 0; i < n; i++) pushChunkCv(cvs + 32 * i, ++chunk_counter);
+            data += n * BLAKE3_CHUNK_BYTES;
+            len -= n * BLAKE3_CHUNK_BYTES;
+            done += n;
+        }
+
+        while (subtrees > 0) {
+            const size_t round = std::min(subtrees, SUBTREES_PER_ROUND);
+            const size_t subtree_bytes = SUBTREE_CHUNKS * BLAKE3_CHUNK_BYTES;
+            std::vector<uint8_t> subtree_cvs(round * 32);
+            const uint64_t first_counter = chunk_counter;
+            auto work = [&](size_t begin, size_t end) {
+                for (size_t t = begin; t < end; t++) {
+                    subtreeCv(backend, key, flags, data + t * subtree_bytes, first_counter + t * SUBTREE_CHUNKS,
+                              subtree_cvs.data() + 32 * t);
+                }
+            };
+            ThreadPool& pool = defaultThreadPool();
+            if (round > 1 && pool.size() > 1 && len >= BLAKE3_PARALLEL_MIN_BYTES) {
+                pool.parallelFor(round, 1, work);
+            } else {
+                work(0, round);
+            }
+            for (size_t t = 0; t < round; t++) {
+                chunk_counter += SUBTREE_CHUNKS;
+                pushChunkCv(subtree_cvs.data() + 32 * t, chunk_counter);
+            }
+            data += round * subtree_bytes;
+            len -= round * subtree_bytes;
+            subtrees -= round;
+        }
+    }
+    return *this;
+}
+
+// Funde o chunk em andamento com a pilha, do topo para a base; o último
+// nó é a raiz e gera a saída extensível
+void Blake3Hasher::finalize(uint8_t* out, size_t len) const {
+    Output o;
+    std::memcpy(o.input_cv, cv, sizeof(cv));
+    std::memcpy(o.block, block, sizeof(block));
+    o.block_len = block_len;
+    o.counter = chunk_counter;
+    o.flags = flags | (blocks_compressed == 0 ? BLAKE3_CHUNK_START : 0) | BLAKE3_CHUNK_END;
+    for (size_t i = stack_len; i > 0; i--) {
+        uint8_t right[32];
+        o.chainingValue(right);
+        o = parentOutput(stack[i - 1], right, key, flags);
+    }
+    o.rootBytes(out, len);
+}
+
+void blake3Digest(const uint8_t* data, size_t len, uint8_t* out, size_t out_len) {
+    Blake3Hasher().update(data, len).finalize(out, out_len);
+}
+
+void blake3KeyedDigest(const uint8_t key[BLAKE3_KEY_BYTES], const uint8_t* data, size_t len, uint8_t* out,
+                       size_t out_len) {
+    Blake3Hasher(key).update(data, len).finalize(out, out_len);
+}
+
+void blake3DeriveKey(const std::string& context, const uint8_t* material, size_t len, uint8_t* out, size_t out_len) {
+    Blake3Hasher::deriveKey(context).update(material, len).finalize(out, out_len);
+}
+
+bool blake3File(const std::string& path, uint8_t out[BLAKE3_OUT_BYTES]) {
+    MappedFile file;
+    if (file.open(path, false, 0, false)) {
+        blake3Digest(file.data, (size_t)file.size, out);
+        return true;
+    }
+    // O mapeamento recusa arquivos vazios
+    std::ifstream in(path, std::ios::binary);
+    if (!in || in.peek() != std::ifstream::traits_type::eof()) return false;
+    blake3Digest(nullptr, 0, out);
+    return true;
+}
+
+} // namespace adilsoncrypto
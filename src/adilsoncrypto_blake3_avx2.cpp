@@ -0,0 +1,46 @@
+// Kernel BLAKE3 de 8 lanes (AVX2). As rotações de 16 e 8 bits são um
+// vpshufb de bytes; as de 12 e 7, deslocamentos. Chamado apenas quando
+// cpuFeatures().avx2 é verdadeiro.
+#include "../include/adilsoncrypto_blake3_lanes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#ifndef __AVX2__
+#error "adilsoncrypto_blake3_avx2.cpp precisa ser compilado com -mavx2"
+#endif
+#include <immintrin.h>
+
+namespace adilsoncrypto {
+
+namespace {
+struct Avx2Ops {
+    typedef __m256i vec;
+    static const size_t LANES = 8;
+    static inline vec load(const uint32_t* p) { return _mm256_load_si256((const __m256i*)p); }
+    static inline void store(uint32_t* p, vec v) { _mm256_store_si256((__m256i*)p, v); }
+    static inline vec set1(uint32_t x) { return _mm256_set1_epi32((int)x); }
+    static inline vec add(vec a, vec b) { return _mm256_add_epi32(a, b); }
+    static inline vec xor2(vec a, vec b) { return _mm256_xor_si256(a, b); }
+    template <int N> static inline vec rotr(vec x) {
+        if (N == 16) {
+            return _mm256_shuffle_epi8(x, _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+                                                          13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2));
+        }
+        if (N == 8) {
+            return _mm256_shuffle_epi8(x, _mm256_set_epi8(12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1,
+                                                          12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1));
+        }
+        return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+    }
+};
+} // namespace
+
+void blake3HashManyAvx2(const uint8_t* const* inputs, size_t blocks, const uint32_t key[8], uint64_t counter,
+                        bool increment_counter, uint8_t flags, uint8_t flags_start, uint8_t flags_end,
+                        uint8_t* out) {
+    Blake3Lanes<Avx2Ops>::hashMany(inputs, blocks, key, counter, increment_counter, flags, flags_start, flags_end,
+                                   out);
+}
+
+} // namespace adilsoncrypto
+
+#endif
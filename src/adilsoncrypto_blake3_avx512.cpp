@@ -0,0 +1,41 @@
+// Kernel BLAKE3 de 16 lanes (AVX-512F) com a rotação nativa (vprord).
+// Chamado apenas quando cpuFeatures().avx512f.
+#include "../include/adilsoncrypto_blake3_lanes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#ifndef __AVX512F__
+#error "adilsoncrypto_blake3_avx512.cpp precisa ser compilado com -mavx512f"
+#endif
+// O GCC 12 acusa '__Y' não inicializado dentro de avx512fintrin.h
+// (_mm512_undefined_epi32 usado de propósito pelos intrínsecos)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+
+namespace adilsoncrypto {
+
+namespace {
+struct Avx512Ops {
+    typedef __m512i vec;
+    static const size_t LANES = 16;
+    static inline vec load(const uint32_t* p) { return _mm512_load_si512((const void*)p); }
+    static inline void store(uint32_t* p, vec v) { _mm512_store_si512((void*)p, v); }
+    static inline vec set1(uint32_t x) { return _mm512_set1_epi32((int)x); }
+    static inline vec add(vec a, vec b) { return _mm512_add_epi32(a, b); }
+    static inline vec xor2(vec a, vec b) { return _mm512_xor_si512(a, b); }
+    template <int N> static inline vec rotr(vec x) { return _mm512_ror_epi32(x, N); }
+};
+} // namespace
+
+void blake3HashManyAvx512(const uint8_t* const* inputs, size_t blocks, const uint32_t key[8], uint64_t counter,
+                          bool increment_counter, uint8_t flags, uint8_t flags_start, uint8_t flags_end,
+                          uint8_t* out) {
+    Blake3Lanes<Avx512Ops>::hashMany(inputs, blocks, key, counter, increment_counter, flags, flags_start,
+                                     flags_end, out);
+}
+
+} // namespace adilsoncrypto
+
+#endif
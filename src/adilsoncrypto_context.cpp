@@ -0,0 +1,72 @@
+#include "../include/adilsoncrypto_context.h"
+
+namespace adilsoncrypto {
+
+namespace {
+
+// Uma por curva nomeada em uso misto, com folga para curvas avulsas
+const size_t MAX_GROUPS = 8;
+
+} // namespace
+
+ThreadContext::ThreadContext() : bn_ctx(BN_CTX_new()), md_ctx(EVP_MD_CTX_new()) {}
+
+ThreadContext::~ThreadContext() {
+    for (GroupScratch& scratch : groups) release(scratch);
+    EVP_MD_CTX_free(md_ctx);
+    BN_CTX_free(bn_ctx);
+}
+
+void ThreadContext::release(GroupScratch& scratch) {
+    for (EC_POINT* point : scratch.points) EC_POINT_clear_free(point);
+    EC_KEY_free(scratch.sign_key);
+    EC_KEY_free(scratch.verify_key);
+}
+
+ThreadContext::GroupScratch& ThreadContext::scratchFor(uint64_t group_id, const EC_GROUP* group) {
+    for (GroupScratch& scratch : groups) {
+        if (scratch.id == group_id) return scratch;
+    }
+    if (groups.size() == MAX_GROUPS) {
+        release(groups.front());
+        groups.erase(groups.begin());
+    }
+    GroupScratch scratch;
+    scratch.id = group_id;
+    for (EC_POINT*& point : scratch.points) point = EC_POINT_new(group);
+    scratch.sign_key = EC_KEY_new();
+    scratch.verify_key = EC_KEY_new();
+    EC_KEY_set_group(scratch.sign_key, group);
+    EC_KEY_set_group(scratch.verify_key, group);
+    groups.push_back(scratch);
+    return groups.back();
+}
+
+EC_POINT* ThreadContext::point(uint64_t group_id, const EC_GROUP* group, unsigned slot) {
+    return slot < SCRATCH_POINTS ? scratchFor(group_id, group).points[slot] : nullptr;
+}
+
+EC_KEY* ThreadContext::signingKey(uint64_t group_id, const EC_GROUP* group) {
+    return scratchFor(group_id, group).sign_key;
+}
+
+EC_KEY* ThreadContext::verifyingKey(uint64_t group_id, const EC_GROUP* group) {
+    return scratchFor(group_id, group).verify_key;
+}
+
+bool ThreadContext::digest(const EVP_MD* md, const void* data, size_t len, uint8_t* out) {
+    return md && md_ctx && EVP_DigestInit_ex(md_ctx, md, nullptr) == 1 && EVP_DigestUpdate(md_ctx, data, len) == 1 &&
+           EVP_DigestFinal_ex(md_ctx, out, nullptr) == 1;
+}
+
+ThreadContext& threadContext() {
+    thread_local ThreadContext context;
+    return context;
+}
+
+uint64_t newScratchGroupId() {
+    static std::atomic<uint64_t> next_id{ 1 };
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace adilsoncrypto
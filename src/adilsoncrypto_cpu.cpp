@@ -0,0 +1,87 @@
+#include "../include/adilsoncrypto_cpu.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define ADILSON_X86 1
+#include <cpuid.h>
+#endif
+
+namespace adilsoncrypto {
+
+#ifdef ADILSON_X86
+static unsigned long long readXcr0() {
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((unsigned long long)edx << 32) | eax;
+}
+
+static CpuFeatures detectFeatures() {
+    CpuFeatures f;
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return f;
+    }
+    f.ssse3 = (ecx & (1u << 9)) != 0;
+    f.sse41 = (ecx & (1u << 19)) != 0;
+    bool osxsave = (ecx & (1u << 27)) != 0;
+    bool avx = (ecx & (1u << 28)) != 0;
+
+    // Estado YMM (bits 1,2) e ZMM (bits 5,6,7) habilitados pelo SO
+    unsigned long long xcr0 = osxsave ? readXcr0() : 0;
+    bool ymm_ok = avx && (xcr0 & 0x6) == 0x6;
+    bool zmm_ok = ymm_ok && (xcr0 & 0xE0) == 0xE0;
+
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        f.avx2 = ymm_ok && (ebx & (1u << 5)) != 0;
+        f.avx512f = zmm_ok && (ebx & (1u << 16)) != 0;
+        f.shani = f.sse41 && (ebx & (1u << 29)) != 0;
+    }
+    return f;
+}
+#else
+static CpuFeatures detectFeatures() {
+    return CpuFeatures();
+}
+#endif
+
+const CpuFeatures& cpuFeatures() {
+    static const CpuFeatures features = detectFeatures();
+    return features;
+}
+
+std::string cpuFeatureString() {
+    const CpuFeatures& f = cpuFeatures();
+    std::string s;
+    if (f.sse41) s += "sse4.1 ";
+    if (f.ssse3) s += "ssse3 ";
+    if (f.avx2) s += "avx2 ";
+    if (f.avx512f) s += "avx512f ";
+    if (f.shani) s += "sha-ni ";
+    if (s.empty()) return "scalar";
+    s.pop_back();
+    return s;
+}
+
+std::string cpuModelName() {
+#ifdef ADILSON_X86
+    unsigned int regs[12];
+    unsigned int max_ext = __get_cpuid_max(0x80000000, nullptr);
+    if (max_ext >= 0x80000004) {
+        for (unsigned int i = 0; i < 3; i++) {
+            __get_cpuid(0x80000002 + i, &regs[i * 4], &regs[i * 4 + 1], &regs[i * 4 + 2], &regs[i * 4 + 3]);
+        }
+        char name[49];
+        std::memcpy(name, regs, 48);
+        name[48] = '\0';
+        std::string model(name);
+        size_t start = model.find_first_not_of(' ');
+        size_t end = model.find_last_not_of(" ");
+        if (start != std::string::npos) {
+            return model.substr(start, end - start + 1);
+        }
+    }
+#endif
+    return "desconhecido";
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,227 @@
+#include "../include/adilsoncrypto_curves.h"
+#include "../include/adilsoncrypto_context.h"
+#include "../include/adilsoncrypto_util.h"
+#include <cstring>
+#include <mutex>
+#include <openssl/bn.h>
+#include <openssl/crypto.h>
+#include <openssl/ecdsa.h>
+#include <openssl/obj_mac.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+struct CurveSpec {
+    const char* name;
+    int nid;
+    const char* md_name;
+};
+
+// Hash do tamanho da ordem, como no ECDSA do TLS
+const CurveSpec CURVES[] = {
+    { "secp256k1", NID_secp256k1, "SHA256" },
+    { "secp256r1", NID_X9_62_prime256v1, "SHA256" },
+    { "secp384r1", NID_secp384r1, "SHA384" },
+    { "secp521r1", NID_secp521r1, "SHA512" },
+    { "brainpoolP512t1", NID_brainpoolP512t1, "SHA512" },
+};
+const size_t CURVE_COUNT = sizeof(CURVES) / sizeof(CURVES[0]);
+
+struct CurveAlias {
+    const char* alias;
+    const char* name;
+};
+
+const CurveAlias ALIASES[] = {
+    { "prime256v1", "secp256r1" },
+    { "P-256", "secp256r1" },
+    { "P-384", "secp384r1" },
+    { "P-521", "secp521r1" },
+};
+
+const size_t ADDRESS_BYTES = 20;
+
+int curveIndex(const std::string& name) {
+    const char* canonical = name.c_str();
+    for (const CurveAlias& alias : ALIASES) {
+        if (name == alias.alias) canonical = alias.name;
+    }
+    for (size_t i = 0; i < CURVE_COUNT; i++) {
+        if (std::strcmp(canonical, CURVES[i].name) == 0) return (int)i;
+    }
+    return -1;
+}
+
+// Só roda uma vez por curva; o contexto vive até o fim do processo
+CurveContext* buildContext(const CurveSpec& spec) {
+    EC_GROUP* group = EC_GROUP_new_by_curve_name(spec.nid);
+    const EVP_MD* md = EVP_MD_fetch(nullptr, spec.md_name, nullptr);
+    if (!group || !md) {
+        EC_GROUP_free(group);
+        return nullptr;
+    }
+    // A P-256 já traz a tabela do gerador; as demais a calculam agora, antes
+    // de o grupo ser publicado, e daí em diante ele só é lido
+    if (!EC_GROUP_have_precompute_mult(group)) EC_GROUP_precompute_mult(group, nullptr);
+
+    CurveContext* context = new CurveContext();
+    context->name = spec.name;
+    context->nid = spec.nid;
+    context->group = group;
+    context->scratch_id = newScratchGroupId();
+    context->md = md;
+    context->order_bytes = (size_t)BN_num_bytes(EC_GROUP_get0_order(group));
+    return context;
+}
+
+class NamedCurve : public IEllipticCurve {
+public:
+    explicit NamedCurve(const CurveContext* context) : context(context) {}
+
+    std::string getName() const override {
+        return context->name;
+    }
+
+    KeyPair generateKeyPair() override {
+        KeyPair keypair;
+        ThreadContext& thread = threadContext();
+        BN_CTX* ctx = thread.bnCtx();
+        BN_CTX_start(ctx);
+
+        BIGNUM* priv_key = BN_CTX_get(ctx);
+        EC_POINT* pub_point = thread.point(context->scratch_id, context->group, 0);
+        const BIGNUM* order = EC_GROUP_get0_order(context->group);
+        bool ok = priv_key && pub_point;
+        do {
+            ok = ok && BN_priv_rand_range(priv_key, order);
+        } while (ok && BN_is_zero(priv_key));
+
+        if (ok && EC_POINT_mul(context->group, pub_point, priv_key, nullptr, nullptr, ctx)) {
+            char* priv_hex = BN_bn2hex(priv_key);
+            char* pub_hex = EC_POINT_point2hex(context->group, pub_point, POINT_CONVERSION_UNCOMPRESSED, ctx);
+            if (priv_hex && pub_hex) {
+                keypair.private_key = priv_hex;
+                keypair.public_key = pub_hex;
+                keypair.address = getAddress(keypair.public_key);
+            }
+            if (priv_hex) OPENSSL_clear_free(priv_hex, strlen(priv_hex));
+            OPENSSL_free(pub_hex);
+        }
+
+        if (priv_key) BN_clear(priv_key);
+        BN_CTX_end(ctx);
+        return keypair;
+    }
+
+    Signature sign(const std::string& message, const std::string& private_key) override {
+        Signature signature;
+        uint8_t hash[EVP_MAX_MD_SIZE];
+        ThreadContext& thread = threadContext();
+        if (!thread.digest(context->md, message.data(), message.size(), hash)) return signature;
+
+        // O escalar precisa estar em [1, n): o EC_KEY de rascunho não confere
+        BN_CTX* ctx = thread.bnCtx();
+        BN_CTX_start(ctx);
+        BIGNUM* priv_bn = BN_CTX_get(ctx);
+        if (!priv_bn || private_key.empty() || BN_hex2bn(&priv_bn, private_key.c_str()) != (int)private_key.size() ||
+            BN_is_zero(priv_bn) || BN_cmp(priv_bn, EC_GROUP_get0_order(context->group)) >= 0) {
+            if (priv_bn) BN_clear(priv_bn);
+            BN_CTX_end(ctx);
+            return signature;
+        }
+
+        EC_KEY* key = thread.signingKey(context->scratch_id, context->group);
+        ECDSA_SIG* sig = EC_KEY_set_private_key(key, priv_bn)
+                             ? ECDSA_do_sign(hash, EVP_MD_get_size(context->md), key)
+                             : nullptr;
+        EC_KEY_set_private_key(key, nullptr);
+        BN_clear(priv_bn);
+        BN_CTX_end(ctx);
+
+        if (sig) {
+            const BIGNUM* r, *s;
+            ECDSA_SIG_get0(sig, &r, &s);
+            char* r_hex = BN_bn2hex(r);
+            char* s_hex = BN_bn2hex(s);
+            if (r_hex && s_hex) {
+                signature.r = r_hex;
+                signature.s = s_hex;
+                signature.proof = "valid";
+            }
+            OPENSSL_free(r_hex);
+            OPENSSL_free(s_hex);
+            ECDSA_SIG_free(sig);
+        }
+        return signature;
+    }
+
+    bool verify(const std::string& message, const Signature& signature, const std::string& public_key) override {
+        uint8_t hash[EVP_MAX_MD_SIZE];
+        ThreadContext& thread = threadContext();
+        if (signature.r.empty() || signature.s.empty() ||
+            !thread.digest(context->md, message.data(), message.size(), hash)) {
+            return false;
+        }
+
+        // O ponto de rascunho guarda a chave da chamada anterior. O infinito
+        // ("00") aceitaria a assinatura forjada r = x(G), s = e
+        EC_POINT* pub_point = thread.point(context->scratch_id, context->group, 0);
+        if (!pub_point || !EC_POINT_hex2point(context->group, public_key.c_str(), pub_point, thread.bnCtx()) ||
+            EC_POINT_is_at_infinity(context->group, pub_point) ||
+            EC_POINT_is_on_curve(context->group, pub_point, thread.bnCtx()) != 1) {
+            return false;
+        }
+
+        BIGNUM* r = nullptr;
+        BIGNUM* s = nullptr;
+        ECDSA_SIG* sig = ECDSA_SIG_new();
+        bool parsed = BN_hex2bn(&r, signature.r.c_str()) == (int)signature.r.size() &&
+                      BN_hex2bn(&s, signature.s.c_str()) == (int)signature.s.size();
+        if (!sig || !parsed || !ECDSA_SIG_set0(sig, r, s)) {
+            BN_free(r);
+            BN_free(s);
+            ECDSA_SIG_free(sig);
+            return false;
+        }
+
+        EC_KEY* key = thread.verifyingKey(context->scratch_id, context->group);
+        int result = EC_KEY_set_public_key(key, pub_point)
+                         ? ECDSA_do_verify(hash, EVP_MD_get_size(context->md), sig, key)
+                         : 0;
+        ECDSA_SIG_free(sig);
+        return result == 1;
+    }
+
+    std::string getAddress(const std::string& public_key) override {
+        std::string point;
+        uint8_t hash[EVP_MAX_MD_SIZE];
+        if (!hexToBytes(public_key, point) || point.empty() ||
+            !threadContext().digest(context->md, point.data(), point.size(), hash)) {
+            return "";
+        }
+        return bytesToHex(hash, ADDRESS_BYTES);
+    }
+
+private:
+    const CurveContext* context;
+};
+
+} // namespace
+
+const CurveContext* curveContext(const std::string& name) {
+    static std::once_flag built[CURVE_COUNT];
+    static CurveContext* contexts[CURVE_COUNT] = {};
+    int index = curveIndex(name);
+    if (index < 0) return nullptr;
+    std::call_once(built[index], [index] { contexts[index] = buildContext(CURVES[index]); });
+    return contexts[index];
+}
+
+std::unique_ptr<IEllipticCurve> createNamedCurve(const std::string& name) {
+    const CurveContext* context = curveContext(name);
+    if (!context) return nullptr;
+    return std::make_unique<NamedCurve>(context);
+}
+
+} // namespace adilsoncrypto
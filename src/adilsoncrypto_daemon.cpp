@@ -0,0 +1,796 @@
+#include "../include/adilsoncrypto_daemon.h"
+#include "../include/adilsoncrypto_context.h"
+#include "../include/adilsoncrypto_keystore.h"
+#include "../include/adilsoncrypto_metrics.h"
+#include "../include/adilsoncrypto_pool.h"
+#include "../include/adilsoncrypto_secp256k1.h"
+#include "../include/adilsoncrypto_secure.h"
+#include "../include/adilsoncrypto_serialize.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include "../include/adilsoncrypto_util.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <vector>
+#include <openssl/crypto.h>
+#include <openssl/ecdsa.h>
+#include <openssl/obj_mac.h>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace adilsoncrypto {
+
+namespace {
+
+const uint64_t LISTEN_TAG = 0;
+const uint64_t WAKE_TAG = 1;
+const uint8_t SIGNATURE_V = 0x1b;   // o mesmo "v" de AdilsonCrypto::sign
+const size_t READ_CHUNK = 64 * 1024;
+
+struct Job {
+    uint64_t client;
+    uint32_t id;
+    uint8_t op;
+    DaemonStatus status;
+    std::string data;
+    std::string reply;
+};
+
+void putUint32(std::string& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out.push_back((char)(uint8_t)(value >> (8 * i)));
+}
+
+uint32_t getUint32(const char* in) {
+    const uint8_t* p = (const uint8_t*)in;
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void appendFrame(std::string& out, uint32_t id, uint8_t code, const std::string& data) {
+    putUint32(out, (uint32_t)(5 + data.size()));
+    putUint32(out, id);
+    out.push_back((char)code);
+    out += data;
+}
+
+const EC_GROUP* secp256k1Group() {
+    static EC_GROUP* group = EC_GROUP_new_by_curve_name(NID_secp256k1);
+    return group;
+}
+
+uint64_t scratchId() {
+    static const uint64_t id = newScratchGroupId();
+    return id;
+}
+
+bool signDigest(const uint8_t digest[32], const uint8_t secret[32], uint8_t out[RECOVERABLE_SIGNATURE_BYTES]) {
+    if (!secp256k1SignDigest(secret, digest, out)) return false;
+    out[64] = SIGNATURE_V;
+    return true;
+}
+
+bool verifyDigest(const uint8_t digest[32], const uint8_t public_key[COMPRESSED_KEY_BYTES], const uint8_t rs[64]) {
+    ThreadContext& context = threadContext();
+    const EC_GROUP* group = secp256k1Group();
+    EC_POINT* point = context.point(scratchId(), group, 0);
+    if (!point || EC_POINT_oct2point(group, point, public_key, COMPRESSED_KEY_BYTES, context.bnCtx()) != 1) return false;
+    ECDSA_SIG* sig = ECDSA_SIG_new();
+    BIGNUM* r = BN_bin2bn(rs, 32, nullptr);
+    BIGNUM* s = BN_bin2bn(rs + 32, 32, nullptr);
+    if (!sig || !r || !s || !ECDSA_SIG_set0(sig, r, s)) {
+        BN_free(r);
+        BN_free(s);
+        ECDSA_SIG_free(sig);
+        return false;
+    }
+    EC_KEY* key = context.verifyingKey(scratchId(), group);
+    int result = EC_KEY_set_public_key(key, point) ? ECDSA_do_verify(digest, 32, sig, key) : 0;
+    ECDSA_SIG_free(sig);
+    return result == 1;
+}
+
+// Parte da requisição que é hasheada (a mensagem); false se o quadro for
+// malformado para a operação
+bool messageOf(const Job& job, const uint8_t*& message, size_t& len) {
+    const uint8_t* data = (const uint8_t*)job.data.data();
+    const size_t size = job.data.size();
+    size_t offset;
+    switch ((DaemonOp)job.op) {
+    case DaemonOp::SIGN:
+        if (size < 2 || (size_t)2 + data[1] > size) return false;
+        offset = 2 + (size_t)data[1];
+        break;
+    case DaemonOp::VERIFY:
+        offset = COMPRESSED_KEY_BYTES + COMPACT_SIGNATURE_BYTES;
+        if (size < offset) return false;
+        break;
+    case DaemonOp::SHA256:
+    case DaemonOp::METRICS:
+        offset = 0;
+        break;
+    default:
+        return false;
+    }
+    message = data + offset;
+    len = size - offset;
+    return true;
+}
+
+// Executa um trecho do lote: os hashes de todas as mensagens de uma vez e
+// depois a parte de curva elíptica de cada requisição
+void processChunk(Job* jobs, size_t count, const Keystore* keystore) {
+    std::vector<const uint8_t*> messages(count);
+    std::vector<size_t> lens(count);
+    std::vector<uint8_t> digests(32 * count);
+    static const uint8_t empty = 0;
+    for (size_t i = 0; i < count; i++) {
+        jobs[i].status = DaemonStatus::OK;
+        if (!messageOf(jobs[i], messages[i], lens[i])) {
+            jobs[i].status = DaemonStatus::BAD_REQUEST;
+            messages[i] = &empty;
+            lens[i] = 0;
+        }
+    }
+    sha256Batch(messages.data(), lens.data(), count, digests.data());
+
+    // Chave da requisição atual: na arena segura, não na pilha
+    SecureBuffer key_buffer(SECP256K1_SECRET_BYTES);
+    uint8_t* secret = key_buffer.data();
+
+    for (size_t i = 0; i < count; i++) {
+        Job& job = jobs[i];
+        const uint8_t* digest = digests.data() + 32 * i;
+        if (job.status != DaemonStatus::OK) continue;
+        const uint8_t* data = (const uint8_t*)job.data.data();
+
+        if ((DaemonOp)job.op == DaemonOp::SHA256) {
+            job.reply.assign((const char*)digest, 32);
+        } else if ((DaemonOp)job.op == DaemonOp::METRICS) {
+            job.reply = metricsText();
+        } else if ((DaemonOp)job.op == DaemonOp::VERIFY) {
+            MetricTimer metric(MetricOp::OP_VERIFY, lens[i]);
+            bool valid = verifyDigest(digest, data, data + COMPRESSED_KEY_BYTES);
+            job.reply.assign(1, valid ? '\1' : '\0');
+        } else {
+            uint8_t signature[RECOVERABLE_SIGNATURE_BYTES];
+            const uint8_t kind = data[0];
+            const size_t key_len = data[1];
+            bool have_key = false;
+            if (!secret) {
+                job.status = DaemonStatus::FAILED;
+                continue;
+            }
+            if (kind == DAEMON_KEY_RAW && key_len == SECP256K1_SECRET_BYTES) {
+                std::memcpy(secret, data + 2, SECP256K1_SECRET_BYTES);
+                have_key = true;
+            } else if (kind == DAEMON_KEY_ADDRESS && keystore) {
+                const KeystoreRecord* record = keystore->findByAddress(std::string((const char*)data + 2, key_len));
+                have_key = record && keystore->privateKey(*record, secret);
+            } else if (kind != DAEMON_KEY_ADDRESS) {
+                job.status = DaemonStatus::BAD_REQUEST;
+                continue;
+            }
+            if (!have_key) {
+                job.status = DaemonStatus::UNKNOWN_KEY;
+                continue;
+            }
+            MetricTimer metric(MetricOp::OP_SIGN, lens[i]);
+            if (signDigest(digest, secret, signature)) {
+                job.reply.assign((const char*)signature, sizeof(signature));
+            } else {
+                job.status = DaemonStatus::FAILED;
+            }
+            OPENSSL_cleanse(secret, SECP256K1_SECRET_BYTES);
+        }
+    }
+}
+
+} // namespace
+
+// Estado compartilhado entre a thread de E/S e a de despacho
+struct DaemonShared {
+    int listen_fd = -1;
+    int epoll_fd = -1;
+    int wake_fd = -1;
+    std::atomic<bool> stopping{ false };
+
+    std::mutex queue_mutex;
+    std::condition_variable queue_ready;
+    std::vector<Job> queue;
+
+    std::mutex done_mutex;
+    std::vector<Job> done;
+
+    std::atomic<uint64_t> requests{ 0 };
+    std::atomic<uint64_t> batches{ 0 };
+    std::atomic<uint64_t> clients{ 0 };
+    std::atomic<uint64_t> throttled{ 0 };
+
+    void wake() {
+#if defined(__linux__)
+        uint64_t one = 1;
+        ssize_t ignored = write(wake_fd, &one, sizeof(one));
+        (void)ignored;
+#endif
+    }
+};
+
+SigningDaemon::SigningDaemon(const DaemonOptions& options) : options(options), shared(new DaemonShared()) {}
+
+SigningDaemon::~SigningDaemon() {
+    stop();
+}
+
+DaemonStats SigningDaemon::stats() const {
+    DaemonStats stats;
+    stats.requests = shared->requests.load(std::memory_order_relaxed);
+    stats.batches = shared->batches.load(std::memory_order_relaxed);
+    stats.clients = shared->clients.load(std::memory_order_relaxed);
+    stats.throttled = shared->throttled.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SigningDaemon::dispatchLoop() {
+    const size_t max_batch = std::max<size_t>(options.max_batch, 1);
+    std::vector<Job> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(shared->queue_mutex);
+            shared->queue_ready.wait(lock, [&] { return shared->stopping || !shared->queue.empty(); });
+            if (shared->stopping) return;
+            // Lote pequeno: espera um pouco para juntar as requisições que
+            // estão chegando de outros clientes
+            if (shared->queue.size() < max_batch && options.batch_window_us > 0) {
+                shared->queue_ready.wait_for(lock, std::chrono::microseconds(options.batch_window_us),
+                                             [&] { return shared->stopping || shared->queue.size() >= max_batch; });
+            }
+            if (shared->queue.size() <= max_batch) {
+                batch.swap(shared->queue);
+            } else {
+                batch.assign(std::make_move_iterator(shared->queue.begin()),
+                             std::make_move_iterator(shared->queue.begin() + max_batch));
+                shared->queue.erase(shared->queue.begin(), shared->queue.begin() + max_batch);
+            }
+        }
+
+        const Keystore* store = keystore.get();
+        Job* jobs = batch.data();
+        pool->parallelFor(batch.size(), 64, [&](size_t begin, size_t end) { processChunk(jobs + begin, end - begin, store); });
+        shared->batches.fetch_add(1, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lock(shared->done_mutex);
+            for (Job& job : batch) shared->done.push_back(std::move(job));
+        }
+        batch.clear();
+        shared->wake();
+    }
+}
+
+#if defined(__linux__)
+
+namespace {
+
+struct Client {
+    int fd = -1;
+    std::string in;
+    size_t in_offset = 0;
+    std::string out;
+    size_t out_offset = 0;
+    unsigned inflight = 0;
+    bool reading = true;
+    bool closed = false;
+};
+
+} // namespace
+
+bool SigningDaemon::start() {
+    if (running() || options.socket_path.empty()) return false;
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (options.socket_path.size() >= sizeof(address.sun_path)) return false;
+    std::memcpy(address.sun_path, options.socket_path.c_str(), options.socket_path.size());
+
+    if (!options.keystore_path.empty()) {
+        keystore.reset(new Keystore());
+        if (!keystore->open(options.keystore_path, options.passphrase)) {
+            keystore.reset();
+            return false;
+        }
+    }
+
+    DaemonShared& s = *shared;
+    s.stopping = false;
+    s.listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    s.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    s.wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    unlink(options.socket_path.c_str());
+    // umask em vez de chmod depois do bind: o socket nunca existe aberto a outros
+    mode_t old_mask = umask(0177);
+    bool ok = s.listen_fd >= 0 && s.epoll_fd >= 0 && s.wake_fd >= 0 &&
+              bind(s.listen_fd, (const sockaddr*)&address, sizeof(address)) == 0 && listen(s.listen_fd, SOMAXCONN) == 0;
+    umask(old_mask);
+
+    epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u64 = LISTEN_TAG;
+    ok = ok && epoll_ctl(s.epoll_fd, EPOLL_CTL_ADD, s.listen_fd, &event) == 0;
+    event.data.u64 = WAKE_TAG;
+    ok = ok && epoll_ctl(s.epoll_fd, EPOLL_CTL_ADD, s.wake_fd, &event) == 0;
+    if (!ok) {
+        for (int* fd : { &s.listen_fd, &s.epoll_fd, &s.wake_fd }) {
+            if (*fd >= 0) ::close(*fd);
+            *fd = -1;
+        }
+        keystore.reset();
+        return false;
+    }
+
+    pool.reset(new ThreadPool(options.threads));
+    dispatch_thread = std::thread(&SigningDaemon::dispatchLoop, this);
+    io_thread = std::thread(&SigningDaemon::ioLoop, this);
+    return true;
+}
+
+void SigningDaemon::stop() {
+    if (!running()) return;
+    {
+        std::lock_guard<std::mutex> lock(shared->queue_mutex);
+        shared->stopping = true;
+    }
+    shared->queue_ready.notify_all();
+    shared->wake();
+    dispatch_thread.join();
+    io_thread.join();
+    for (int* fd : { &shared->listen_fd, &shared->epoll_fd, &shared->wake_fd }) {
+        ::close(*fd);
+        *fd = -1;
+    }
+    unlink(options.socket_path.c_str());
+    shared->queue.clear();
+    shared->done.clear();
+    pool.reset();
+    keystore.reset();
+}
+
+void SigningDaemon::ioLoop() {
+    DaemonShared& s = *shared;
+    std::unordered_map<uint64_t, Client> clients;
+    uint64_t next_client = WAKE_TAG + 1;
+    std::vector<Job> incoming;
+    std::vector<Job> completed;
+    std::vector<uint64_t> touched;
+    char chunk[READ_CHUNK];
+
+    auto updateEvents = [&](uint64_t id, Client& c) {
+        epoll_event event;
+        event.events = (c.reading ? (uint32_t)EPOLLIN : 0u) | (c.out_offset < c.out.size() ? (uint32_t)EPOLLOUT : 0u);
+        event.data.u64 = id;
+        epoll_ctl(s.epoll_fd, EPOLL_CTL_MOD, c.fd, &event);
+    };
+
+    // Quadros completos do buffer de entrada viram requisições até o limite
+    // de pendentes; o resto espera no buffer
+    auto parseFrames = [&](uint64_t id, Client& c) {
+        while (c.reading && !c.closed) {
+            const size_t available = c.in.size() - c.in_offset;
+            if (available < 4) break;
+            const char* frame = c.in.data() + c.in_offset;
+            const size_t len = getUint32(frame);
+            if (len < DAEMON_FRAME_HEADER_BYTES - 4 || len > options.max_frame_bytes + DAEMON_FRAME_HEADER_BYTES - 4) {
+                c.closed = true;   // fora do protocolo: derruba a conexão
+                break;
+            }
+            if (available < 4 + len) break;
+            Job job;
+            job.client = id;
+            job.id = getUint32(frame + 4);
+            job.op = (uint8_t)frame[8];
+            job.status = DaemonStatus::OK;
+            job.data.assign(frame + DAEMON_FRAME_HEADER_BYTES, len + 4 - DAEMON_FRAME_HEADER_BYTES);
+            incoming.push_back(std::move(job));
+            c.in_offset += 4 + len;
+            if (++c.inflight >= options.max_inflight) {
+                c.reading = false;
+                s.throttled.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if (c.in_offset == c.in.size()) {
+            c.in.clear();
+            c.in_offset = 0;
+        } else if (c.in_offset > READ_CHUNK) {
+            c.in.erase(0, c.in_offset);
+            c.in_offset = 0;
+        }
+    };
+
+    auto readClient = [&](uint64_t id, Client& c) {
+        while (c.reading && !c.closed) {
+            ssize_t n = recv(c.fd, chunk, sizeof(chunk), 0);
+            if (n > 0) {
+                c.in.append(chunk, (size_t)n);
+                parseFrames(id, c);
+            } else if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                c.closed = true;
+            } else if (errno != EINTR) {
+                break;
+            }
+        }
+    };
+
+    auto writeClient = [&](Client& c) {
+        while (c.out_offset < c.out.size() && !c.closed) {
+            ssize_t n = send(c.fd, c.out.data() + c.out_offset, c.out.size() - c.out_offset, MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (n > 0) {
+                c.out_offset += (size_t)n;
+            } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                break;
+            } else if (n < 0 && errno != EINTR) {
+                c.closed = true;
+            }
+        }
+        if (c.out_offset == c.out.size()) {
+            c.out.clear();
+            c.out_offset = 0;
+        }
+    };
+
+    // Depois de entregar respostas ou esvaziar a saída: retoma a leitura de
+    // quem estava suspenso (com folga, para não alternar a cada resposta) ou
+    // suspende quem acumulou respostas demais
+    auto settle = [&](uint64_t id, Client& c) {
+        const size_t pending_out = c.out.size() - c.out_offset;
+        if (c.reading && pending_out > options.max_output_bytes) {
+            c.reading = false;
+            s.throttled.fetch_add(1, std::memory_order_relaxed);
+        } else if (!c.reading && c.inflight <= options.max_inflight / 2 && pending_out <= options.max_output_bytes / 2) {
+            c.reading = true;
+            parseFrames(id, c);
+            readClient(id, c);
+        }
+        if (c.closed) {
+            epoll_ctl(s.epoll_fd, EPOLL_CTL_DEL, c.fd, nullptr);
+            ::close(c.fd);
+            clients.erase(id);
+            s.clients.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+        updateEvents(id, c);
+    };
+
+    epoll_event events[256];
+    while (!s.stopping.load(std::memory_order_acquire)) {
+        int ready = epoll_wait(s.epoll_fd, events, 256, -1);
+        if (ready < 0 && errno != EINTR) break;
+        touched.clear();
+
+        for (int e = 0; e < ready; e++) {
+            const uint64_t tag = events[e].data.u64;
+            if (tag == LISTEN_TAG) {
+                int fd;
+                while ((fd = accept4(s.listen_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+                    const uint64_t id = next_client++;
+                    Client& c = clients[id];
+                    c.fd = fd;
+                    epoll_event event;
+                    event.events = EPOLLIN;
+                    event.data.u64 = id;
+                    epoll_ctl(s.epoll_fd, EPOLL_CTL_ADD, fd, &event);
+                    s.clients.fetch_add(1, std::memory_order_relaxed);
+                }
+            } else if (tag == WAKE_TAG) {
+                uint64_t value;
+                ssize_t ignored = read(s.wake_fd, &value, sizeof(value));
+                (void)ignored;
+                {
+                    std::lock_guard<std::mutex> lock(s.done_mutex);
+                    completed.swap(s.done);
+                }
+                for (Job& job : completed) {
+                    auto it = clients.find(job.client);
+                    if (it == clients.end()) continue;   // o cliente já desconectou
+                    appendFrame(it->second.out, job.id, (uint8_t)job.status, job.reply);
+                    it->second.inflight--;
+                    touched.push_back(job.client);
+                }
+                completed.clear();
+            } else {
+                auto it = clients.find(tag);
+                if (it == clients.end()) continue;
+                Client& c = it->second;
+                // HUP/ERR chegam mesmo com a leitura suspensa; sem isso o
+                // epoll ficaria acordando até as respostas pendentes saírem
+                if (events[e].events & (EPOLLHUP | EPOLLERR)) c.closed = true;
+                if (events[e].events & EPOLLIN) readClient(tag, c);
+                touched.push_back(tag);
+            }
+        }
+
+        std::sort(touched.begin(), touched.end());
+        touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+        for (uint64_t id : touched) {
+            auto it = clients.find(id);
+            if (it == clients.end()) continue;
+            writeClient(it->second);
+            settle(id, it->second);
+        }
+
+        if (!incoming.empty()) {
+            s.requests.fetch_add(incoming.size(), std::memory_order_relaxed);
+            {
+                std::lock_guard<std::mutex> lock(s.queue_mutex);
+                for (Job& job : incoming) s.queue.push_back(std::move(job));
+            }
+            incoming.clear();
+            s.queue_ready.notify_one();
+        }
+    }
+
+    for (auto& entry : clients) ::close(entry.second.fd);
+    s.clients.store(0, std::memory_order_relaxed);
+}
+
+DaemonClient::DaemonClient() : fd(-1), disconnected(true), next_id(1) {}
+
+DaemonClient::~DaemonClient() {
+    close();
+}
+
+bool DaemonClient::connect(const std::string& socket_path) {
+    close();
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) return false;
+    std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size());
+    int socket_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (socket_fd < 0) return false;
+    if (::connect(socket_fd, (const sockaddr*)&address, sizeof(address)) != 0) {
+        ::close(socket_fd);
+        return false;
+    }
+    fd = socket_fd;
+    disconnected = false;
+    reader = std::thread(&DaemonClient::readLoop, this);
+    return true;
+}
+
+void DaemonClient::close() {
+    int socket_fd = fd.exchange(-1);
+    if (socket_fd >= 0) shutdown(socket_fd, SHUT_RDWR);
+    if (reader.joinable()) reader.join();
+    if (socket_fd >= 0) ::close(socket_fd);
+    failPending();
+}
+
+void DaemonClient::failPending() {
+    std::unordered_map<uint32_t, Callback> failed;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        failed.swap(pending);
+    }
+    for (auto& entry : failed) entry.second(DaemonReply());
+}
+
+void DaemonClient::readLoop() {
+    std::string in;
+    size_t offset = 0;
+    char chunk[READ_CHUNK];
+    bool broken = false;
+    while (!broken) {
+        ssize_t n = recv(fd.load(), chunk, sizeof(chunk), 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        in.append(chunk, (size_t)n);
+        while (in.size() - offset >= DAEMON_FRAME_HEADER_BYTES) {
+            const size_t len = getUint32(in.data() + offset);
+            if (len < DAEMON_FRAME_HEADER_BYTES - 4) {
+                broken = true;   // fora do protocolo: trata como desconexão
+                break;
+            }
+            if (in.size() - offset < 4 + len) break;
+            DaemonReply reply;
+            const uint32_t id = getUint32(in.data() + offset + 4);
+            reply.status = (DaemonStatus)(uint8_t)in[offset + 8];
+            reply.data.assign(in.data() + offset + DAEMON_FRAME_HEADER_BYTES, len + 4 - DAEMON_FRAME_HEADER_BYTES);
+            offset += 4 + len;
+
+            Callback done;
+            {
+                std::lock_guard<std::mutex> lock(pending_mutex);
+                auto it = pending.find(id);
+                if (it == pending.end()) continue;
+                done = std::move(it->second);
+                pending.erase(it);
+            }
+            done(std::move(reply));
+        }
+        if (offset == in.size()) {
+            in.clear();
+            offset = 0;
+        } else if (offset > READ_CHUNK) {
+            in.erase(0, offset);
+            offset = 0;
+        }
+    }
+    // Conexão encerrada: o que estava pendente não terá resposta, e o que
+    // vier depois falha na hora
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        disconnected = true;
+    }
+    failPending();
+}
+
+void DaemonClient::request(DaemonOp op, const std::string& data, Callback done) {
+    std::string frame;
+    frame.reserve(DAEMON_FRAME_HEADER_BYTES + data.size());
+    uint32_t id;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        if (fd < 0 || disconnected) {
+            id = 0;
+        } else {
+            id = next_id++;
+            pending.emplace(id, std::move(done));
+        }
+    }
+    if (id == 0) {
+        done(DaemonReply());
+        return;
+    }
+    appendFrame(frame, id, (uint8_t)op, data);
+
+    bool sent = true;
+    {
+        std::lock_guard<std::mutex> lock(write_mutex);
+        size_t offset = 0;
+        while (offset < frame.size()) {
+            ssize_t n = send(fd.load(), frame.data() + offset, frame.size() - offset, MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) {
+                sent = false;
+                break;
+            }
+            offset += (size_t)n;
+        }
+    }
+    if (!sent) {
+        Callback failed;
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex);
+            auto it = pending.find(id);
+            if (it == pending.end()) return;   // a leitora já entregou a falha
+            failed = std::move(it->second);
+            pending.erase(it);
+        }
+        failed(DaemonReply());
+    }
+}
+
+#else
+
+bool SigningDaemon::start() {
+    return false;
+}
+
+void SigningDaemon::stop() {}
+
+void SigningDaemon::ioLoop() {}
+
+DaemonClient::DaemonClient() : fd(-1), disconnected(true), next_id(1) {}
+
+DaemonClient::~DaemonClient() {}
+
+bool DaemonClient::connect(const std::string&) {
+    return false;
+}
+
+void DaemonClient::close() {}
+
+void DaemonClient::failPending() {}
+
+void DaemonClient::readLoop() {}
+
+void DaemonClient::request(DaemonOp, const std::string&, Callback done) {
+    done(DaemonReply());
+}
+
+#endif
+
+std::future<DaemonReply> DaemonClient::request(DaemonOp op, const std::string& data) {
+    auto promise = std::make_shared<std::promise<DaemonReply>>();
+    std::future<DaemonReply> future = promise->get_future();
+    request(op, data, [promise](DaemonReply&& reply) { promise->set_value(std::move(reply)); });
+    return future;
+}
+
+// Assinatura no formato de AdilsonCrypto::sign; vazia se o daemon recusou
+static std::future<Signature> signRequest(DaemonClient& client, const std::string& data) {
+    auto promise = std::make_shared<std::promise<Signature>>();
+    std::future<Signature> future = promise->get_future();
+    client.request(DaemonOp::SIGN, data, [promise](DaemonReply&& reply) {
+        Signature signature;
+        if (reply.status == DaemonStatus::OK && reply.data.size() == RECOVERABLE_SIGNATURE_BYTES) {
+            const uint8_t* bytes = (const uint8_t*)reply.data.data();
+            signature.r = scalarToHex(bytes, 32);
+            signature.s = scalarToHex(bytes + 32, 32);
+            signature.v = bytesToHex(bytes + 64, 1);
+            signature.proof = "valid";
+        }
+        promise->set_value(std::move(signature));
+    });
+    return future;
+}
+
+std::future<Signature> DaemonClient::signAsync(const std::string& message, const std::string& address) {
+    std::string data;
+    data.push_back((char)DAEMON_KEY_ADDRESS);
+    data.push_back((char)std::min<size_t>(address.size(), 255));
+    data.append(address, 0, 255);
+    data += message;
+    return signRequest(*this, data);
+}
+
+std::future<Signature> DaemonClient::signWithKeyAsync(const std::string& message, const std::string& private_key_hex) {
+    std::string data(2 + 32, '\0');
+    data[0] = (char)DAEMON_KEY_RAW;
+    data[1] = 32;
+    if (!scalarFromHex(private_key_hex, (uint8_t*)&data[2])) data[1] = 0;   // o daemon responde BAD_REQUEST
+    data += message;
+    std::future<Signature> future = signRequest(*this, data);
+    OPENSSL_cleanse(&data[0], data.size());
+    return future;
+}
+
+std::future<bool> DaemonClient::verifyAsync(const std::string& message, const Signature& signature,
+                                            const std::string& public_key_hex) {
+    auto promise = std::make_shared<std::promise<bool>>();
+    std::future<bool> future = promise->get_future();
+    std::string data(COMPRESSED_KEY_BYTES + COMPACT_SIGNATURE_BYTES, '\0');
+    uint8_t* bytes = (uint8_t*)&data[0];
+    uint8_t uncompressed[UNCOMPRESSED_KEY_BYTES];
+    bool encoded = scalarFromHex(signature.r, bytes + COMPRESSED_KEY_BYTES) &&
+                   scalarFromHex(signature.s, bytes + COMPRESSED_KEY_BYTES + 32) &&
+                   (hexToBytes(public_key_hex, bytes, COMPRESSED_KEY_BYTES) ||
+                    (hexToBytes(public_key_hex, uncompressed, sizeof(uncompressed)) && compressPublicKey(uncompressed, bytes)));
+    if (!encoded) {
+        promise->set_value(false);
+        return future;
+    }
+    data += message;
+    request(DaemonOp::VERIFY, data, [promise](DaemonReply&& reply) {
+        promise->set_value(reply.status == DaemonStatus::OK && reply.data.size() == 1 && reply.data[0] == 1);
+    });
+    return future;
+}
+
+std::future<std::string> DaemonClient::sha256Async(const std::string& data) {
+    auto promise = std::make_shared<std::promise<std::string>>();
+    std::future<std::string> future = promise->get_future();
+    request(DaemonOp::SHA256, data, [promise](DaemonReply&& reply) {
+        promise->set_value(reply.status == DaemonStatus::OK && reply.data.size() == 32 ? bytesToHex(reply.data) : "");
+    });
+    return future;
+}
+
+std::future<std::string> DaemonClient::metricsAsync() {
+    auto promise = std::make_shared<std::promise<std::string>>();
+    std::future<std::string> future = promise->get_future();
+    request(DaemonOp::METRICS, "", [promise](DaemonReply&& reply) {
+        promise->set_value(reply.status == DaemonStatus::OK ? std::move(reply.data) : "");
+    });
+    return future;
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,877 @@
+#include "../include/adilsoncrypto_ed25519.h"
+#include <algorithm>
+#include <cstring>
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+#include <openssl/sha.h>
+
+namespace adilsoncrypto {
+
+// ---------------------------------------------------------------------------
+// Corpo GF(2^255 - 19), radix 2^51
+// ---------------------------------------------------------------------------
+
+typedef unsigned __int128 u128;
+
+struct Fe {
+    uint64_t v[5];
+};
+
+static const uint64_t MASK51 = (1ull << 51) - 1;
+
+static const Fe FE_ZERO = { { 0, 0, 0, 0, 0 } };
+static const Fe FE_ONE = { { 1, 0, 0, 0, 0 } };
+static const Fe FE_D = { { 0x34dca135978a3, 0x1a8283b156ebd, 0x5e7a26001c029, 0x739c663a03cbb, 0x52036cee2b6ff } };
+static const Fe FE_D2 = { { 0x69b9426b2f159, 0x35050762add7a, 0x3cf44c0038052, 0x6738cc7407977, 0x2406d9dc56dff } };
+static const Fe FE_SQRTM1 = { { 0x61b274a0ea0b0, 0x0d5a5fc8f189d, 0x7ef5e9cbd0c60, 0x78595a6804c9e, 0x2b8324804fc1d } };
+
+static inline void feCarry(Fe& h) {
+    uint64_t c;
+    c = h.v[0] >> 51; h.v[0] &= MASK51; h.v[1] += c;
+    c = h.v[1] >> 51; h.v[1] &= MASK51; h.v[2] += c;
+    c = h.v[2] >> 51; h.v[2] &= MASK51; h.v[3] += c;
+    c = h.v[3] >> 51; h.v[3] &= MASK51; h.v[4] += c;
+    c = h.v[4] >> 51; h.v[4] &= MASK51; h.v[0] += 19 * c;
+}
+
+// Soma sem propagação: limbs < 2^53 ainda são entradas válidas de feMul
+static inline void feAdd(Fe& h, const Fe& f, const Fe& g) {
+    for (int i = 0; i < 5; i++) h.v[i] = f.v[i] + g.v[i];
+}
+
+// f + 4p - g (g com limbs < 2^53), seguido de propagação
+static inline void feSub(Fe& h, const Fe& f, const Fe& g) {
+    h.v[0] = f.v[0] + 0x1FFFFFFFFFFFB4ull - g.v[0];
+    h.v[1] = f.v[1] + 0x1FFFFFFFFFFFFCull - g.v[1];
+    h.v[2] = f.v[2] + 0x1FFFFFFFFFFFFCull - g.v[2];
+    h.v[3] = f.v[3] + 0x1FFFFFFFFFFFFCull - g.v[3];
+    h.v[4] = f.v[4] + 0x1FFFFFFFFFFFFCull - g.v[4];
+    feCarry(h);
+}
+
+static inline void feNeg(Fe& h, const Fe& f) {
+    feSub(h, FE_ZERO, f);
+}
+
+static inline void feReduceWide(Fe& h, u128 r0, u128 r1, u128 r2, u128 r3, u128 r4) {
+    r1 += (uint64_t)(r0 >> 51);
+    r2 += (uint64_t)(r1 >> 51);
+    r3 += (uint64_t)(r2 >> 51);
+    r4 += (uint64_t)(r3 >> 51);
+    u128 t = (u128)((uint64_t)r0 & MASK51) + (r4 >> 51) * 19;
+    h.v[0] = (uint64_t)t & MASK51;
+    h.v[1] = ((uint64_t)r1 & MASK51) + (uint64_t)(t >> 51);
+    h.v[2] = (uint64_t)r2 & MASK51;
+    h.v[3] = (uint64_t)r3 & MASK51;
+    h.v[4] = (uint64_t)r4 & MASK51;
+}
+
+static inline void feMul(Fe& h, const Fe& f, const Fe& g) {
+    const uint64_t f0 = f.v[0], f1 = f.v[1], f2 = f.v[2], f3 = f.v[3], f4 = f.v[4];
+    const uint64_t g0 = g.v[0], g1 = g.v[1], g2 = g.v[2], g3 = g.v[3], g4 = g.v[4];
+    const uint64_t g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3, g4_19 = 19 * g4;
+    u128 r0 = (u128)f0 * g0 + (u128)f1 * g4_19 + (u128)f2 * g3_19 + (u128)f3 * g2_19 + (u128)f4 * g1_19;
+    u128 r1 = (u128)f0 * g1 + (u128)f1 * g0 + (u128)f2 * g4_19 + (u128)f3 * g3_19 + (u128)f4 * g2_19;
+    u128 r2 = (u128)f0 * g2 + (u128)f1 * g1 + (u128)f2 * g0 + (u128)f3 * g4_19 + (u128)f4 * g3_19;
+    u128 r3 = (u128)f0 * g3 + (u128)f1 * g2 + (u128)f2 * g1 + (u128)f3 * g0 + (u128)f4 * g4_19;
+    u128 r4 = (u128)f0 * g4 + (u128)f1 * g3 + (u128)f2 * g2 + (u128)f3 * g1 + (u128)f4 * g0;
+    feReduceWide(h, r0, r1, r2, r3, r4);
+}
+
+static inline void feSq(Fe& h, const Fe& f) {
+    const uint64_t f0 = f.v[0], f1 = f.v[1], f2 = f.v[2], f3 = f.v[3], f4 = f.v[4];
+    const uint64_t f0_2 = 2 * f0, f1_2 = 2 * f1;
+    const uint64_t f1_38 = 38 * f1, f2_38 = 38 * f2, f3_38 = 38 * f3;
+    const uint64_t f3_19 = 19 * f3, f4_19 = 19 * f4;
+    u128 r0 = (u128)f0 * f0 + (u128)f1_38 * f4 + (u128)f2_38 * f3;
+    u128 r1 = (u128)f0_2 * f1 + (u128)f2_38 * f4 + (u128)f3_19 * f3;
+    u128 r2 = (u128)f0_2 * f2 + (u128)f1 * f1 + (u128)f3_38 * f4;
+    u128 r3 = (u128)f0_2 * f3 + (u128)f1_2 * f2 + (u128)f4_19 * f4;
+    u128 r4 = (u128)f0_2 * f4 + (u128)f1_2 * f3 + (u128)f2 * f2;
+    feReduceWide(h, r0, r1, r2, r3, r4);
+}
+
+static inline void feSqN(Fe& h, const Fe& f, int n) {
+    feSq(h, f);
+    while (--n > 0) feSq(h, h);
+}
+
+static void feFromBytes(Fe& h, const uint8_t s[32]) {
+    uint64_t w[4];
+    for (int i = 0; i < 4; i++) {
+        w[i] = 0;
+        for (int j = 7; j >= 0; j--) w[i] = (w[i] << 8) | s[8 * i + j];
+    }
+    h.v[0] = w[0] & MASK51;
+    h.v[1] = ((w[0] >> 51) | (w[1] << 13)) & MASK51;
+    h.v[2] = ((w[1] >> 38) | (w[2] << 26)) & MASK51;
+    h.v[3] = ((w[2] >> 25) | (w[3] << 39)) & MASK51;
+    h.v[4] = (w[3] >> 12) & MASK51;
+}
+
+static void feToBytes(uint8_t s[32], const Fe& f) {
+    Fe h = f;
+    feCarry(h);
+    feCarry(h);
+    // q = 1 se h >= p
+    uint64_t q = (h.v[0] + 19) >> 51;
+    q = (h.v[1] + q) >> 51;
+    q = (h.v[2] + q) >> 51;
+    q = (h.v[3] + q) >> 51;
+    q = (h.v[4] + q) >> 51;
+    h.v[0] += 19 * q;
+    uint64_t c;
+    c = h.v[0] >> 51; h.v[0] &= MASK51; h.v[1] += c;
+    c = h.v[1] >> 51; h.v[1] &= MASK51; h.v[2] += c;
+    c = h.v[2] >> 51; h.v[2] &= MASK51; h.v[3] += c;
+    c = h.v[3] >> 51; h.v[3] &= MASK51; h.v[4] += c;
+    h.v[4] &= MASK51;
+    uint64_t w[4] = {
+        h.v[0] | (h.v[1] << 51),
+        (h.v[1] >> 13) | (h.v[2] << 38),
+        (h.v[2] >> 26) | (h.v[3] << 25),
+        (h.v[3] >> 39) | (h.v[4] << 12)
+    };
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 8; j++) s[8 * i + j] = (uint8_t)(w[i] >> (8 * j));
+    }
+}
+
+static bool feIsZero(const Fe& f) {
+    uint8_t s[32];
+    feToBytes(s, f);
+    uint8_t acc = 0;
+    for (int i = 0; i < 32; i++) acc |= s[i];
+    return acc == 0;
+}
+
+static bool feIsNegative(const Fe& f) {
+    uint8_t s[32];
+    feToBytes(s, f);
+    return s[0] & 1;
+}
+
+// f^(2^250 - 1), base de inversão e raiz quadrada
+static void fePow2250(Fe& out, Fe& z11, const Fe& z) {
+    Fe z2, z9, t0, t1, t2;
+    feSq(z2, z);
+    feSqN(t0, z2, 2);
+    feMul(z9, t0, z);
+    feMul(z11, z9, z2);
+    feSq(t0, z11);
+    feMul(t0, t0, z9);          // 2^5 - 1
+    feSqN(t1, t0, 5);
+    feMul(t0, t1, t0);          // 2^10 - 1
+    feSqN(t1, t0, 10);
+    feMul(t1, t1, t0);          // 2^20 - 1
+    feSqN(t2, t1, 20);
+    feMul(t1, t2, t1);          // 2^40 - 1
+    feSqN(t1, t1, 10);
+    feMul(t0, t1, t0);          // 2^50 - 1
+    feSqN(t1, t0, 50);
+    feMul(t1, t1, t0);          // 2^100 - 1
+    feSqN(t2, t1, 100);
+    feMul(t1, t2, t1);          // 2^200 - 1
+    feSqN(t1, t1, 50);
+    feMul(out, t1, t0);         // 2^250 - 1
+}
+
+static void feInvert(Fe& out, const Fe& z) {
+    Fe t, z11;
+    fePow2250(t, z11, z);
+    feSqN(t, t, 5);
+    feMul(out, t, z11);         // 2^255 - 21 = p - 2
+}
+
+static void fePow22523(Fe& out, const Fe& z) {
+    Fe t, z11;
+    fePow2250(t, z11, z);
+    feSqN(t, t, 2);
+    feMul(out, t, z);           // 2^252 - 3
+}
+
+// Troca condicional em tempo constante (b = 0 ou 1)
+static inline void feCmov(Fe& f, const Fe& g, uint64_t b) {
+    uint64_t mask = 0 - b;
+    for (int i = 0; i < 5; i++) f.v[i] ^= mask & (f.v[i] ^ g.v[i]);
+}
+
+// ---------------------------------------------------------------------------
+// Grupo: coordenadas estendidas (X:Y:Z:T), x = X/Z, y = Y/Z, xy = T/Z
+// ---------------------------------------------------------------------------
+
+struct Ge {
+    Fe X, Y, Z, T;
+};
+
+// Forma pronta para soma: (Y+X, Y-X, Z, 2dT)
+struct GeCached {
+    Fe YplusX, YminusX, Z, T2d;
+};
+
+// Ponto afim pré-computado: (y+x, y-x, 2dxy)
+struct GeNiels {
+    Fe YplusX, YminusX, XY2d;
+};
+
+static void geIdentity(Ge& p) {
+    p.X = FE_ZERO;
+    p.Y = FE_ONE;
+    p.Z = FE_ONE;
+    p.T = FE_ZERO;
+}
+
+static void geToCached(GeCached& c, const Ge& p) {
+    feAdd(c.YplusX, p.Y, p.X);
+    feSub(c.YminusX, p.Y, p.X);
+    c.Z = p.Z;
+    feMul(c.T2d, p.T, FE_D2);
+}
+
+static inline void geFinish(Ge& r, const Fe& A, const Fe& B, const Fe& C, const Fe& D) {
+    Fe E, F, G, H;
+    feSub(E, B, A);
+    feSub(F, D, C);
+    feAdd(G, D, C);
+    feAdd(H, B, A);
+    feMul(r.X, E, F);
+    feMul(r.Y, G, H);
+    feMul(r.T, E, H);
+    feMul(r.Z, F, G);
+}
+
+static void geAdd(Ge& r, const Ge& p, const GeCached& q) {
+    Fe A, B, C, D, t;
+    feSub(t, p.Y, p.X);
+    feMul(A, t, q.YminusX);
+    feAdd(t, p.Y, p.X);
+    feMul(B, t, q.YplusX);
+    feMul(C, p.T, q.T2d);
+    feMul(D, p.Z, q.Z);
+    feAdd(D, D, D);
+    geFinish(r, A, B, C, D);
+}
+
+static void geSub(Ge& r, const Ge& p, const GeCached& q) {
+    Fe A, B, C, D, t;
+    feSub(t, p.Y, p.X);
+    feMul(A, t, q.YplusX);
+    feAdd(t, p.Y, p.X);
+    feMul(B, t, q.YminusX);
+    feMul(C, p.T, q.T2d);
+    feNeg(C, C);
+    feMul(D, p.Z, q.Z);
+    feAdd(D, D, D);
+    geFinish(r, A, B, C, D);
+}
+
+static void geMadd(Ge& r, const Ge& p, const GeNiels& q) {
+    Fe A, B, C, D, t;
+    feSub(t, p.Y, p.X);
+    feMul(A, t, q.YminusX);
+    feAdd(t, p.Y, p.X);
+    feMul(B, t, q.YplusX);
+    feMul(C, p.T, q.XY2d);
+    feAdd(D, p.Z, p.Z);
+    geFinish(r, A, B, C, D);
+}
+
+static void geDouble(Ge& r, const Ge& p) {
+    Fe A, B, C, E, F, G, H, t;
+    feSq(A, p.X);
+    feSq(B, p.Y);
+    feSq(C, p.Z);
+    feAdd(C, C, C);
+    feAdd(H, A, B);
+    feAdd(t, p.X, p.Y);
+    feSq(t, t);
+    feSub(E, H, t);
+    feSub(G, A, B);
+    feAdd(F, C, G);
+    feMul(r.X, E, F);
+    feMul(r.Y, G, H);
+    feMul(r.T, E, H);
+    feMul(r.Z, F, G);
+}
+
+static void geToBytes(uint8_t s[32], const Ge& p) {
+    Fe zi, x, y;
+    feInvert(zi, p.Z);
+    feMul(x, p.X, zi);
+    feMul(y, p.Y, zi);
+    feToBytes(s, y);
+    s[31] ^= (uint8_t)(feIsNegative(x) << 7);
+}
+
+// Decodificação estrita (RFC 8032): rejeita y >= p e x = 0 com bit de sinal
+static bool geFromBytes(Ge& p, const uint8_t s[32]) {
+    Fe u, v, v3, vxx, check;
+    feFromBytes(p.Y, s);
+    uint8_t canonical[32];
+    feToBytes(canonical, p.Y);
+    if (std::memcmp(canonical, s, 31) != 0 || canonical[31] != (s[31] & 0x7f)) return false;
+
+    p.Z = FE_ONE;
+    feSq(u, p.Y);
+    feMul(v, u, FE_D);
+    feSub(u, u, FE_ONE);        // u = y^2 - 1
+    feAdd(v, v, FE_ONE);        // v = d y^2 + 1
+
+    // x = u v^3 (u v^7)^((p-5)/8)
+    feSq(v3, v);
+    feMul(v3, v3, v);
+    feSq(p.X, v3);
+    feMul(p.X, p.X, v);
+    feMul(p.X, p.X, u);
+    fePow22523(p.X, p.X);
+    feMul(p.X, p.X, v3);
+    feMul(p.X, p.X, u);
+
+    feSq(vxx, p.X);
+    feMul(vxx, vxx, v);
+    feSub(check, vxx, u);
+    if (!feIsZero(check)) {
+        feAdd(check, vxx, u);
+        if (!feIsZero(check)) return false;
+        feMul(p.X, p.X, FE_SQRTM1);
+    }
+    bool sign = (s[31] >> 7) != 0;
+    if (feIsZero(p.X) && sign) return false;
+    if (feIsNegative(p.X) != sign) feNeg(p.X, p.X);
+    feMul(p.T, p.X, p.Y);
+    return true;
+}
+
+static bool geIsIdentity(const Ge& p) {
+    Fe t;
+    feSub(t, p.Y, p.Z);
+    return feIsZero(p.X) && feIsZero(t);
+}
+
+// ---------------------------------------------------------------------------
+// Escalares módulo L = 2^252 + 27742317777372353535851937790883648493
+// (Montgomery com R = 2^256, 4 limbs de 64 bits)
+// ---------------------------------------------------------------------------
+
+struct Sc {
+    uint64_t v[4];
+};
+
+static const Sc SC_L = { { 0x5812631a5cf5d3edull, 0x14def9dea2f79cd6ull, 0, 0x1000000000000000ull } };
+
+struct ScConstants {
+    uint64_t l_inv;     // -L^-1 mod 2^64
+    Sc r2;              // R^2 mod L
+};
+
+// Subtrai L se a >= L (sem desvio dependente do valor)
+static inline void scCondSub(Sc& a, uint64_t high = 0) {
+    Sc t;
+    u128 borrow = 0;
+    for (int i = 0; i < 4; i++) {
+        u128 d = (u128)a.v[i] - SC_L.v[i] - (uint64_t)borrow;
+        t.v[i] = (uint64_t)d;
+        borrow = (d >> 64) & 1;
+    }
+    uint64_t keep = 0 - (uint64_t)(borrow > high);   // a < L: mantém a
+    for (int i = 0; i < 4; i++) a.v[i] = (a.v[i] & keep) | (t.v[i] & ~keep);
+}
+
+static const ScConstants& scConstants() {
+    static const ScConstants c = [] {
+        ScConstants k;
+        uint64_t inv = 1;
+        for (int i = 0; i < 6; i++) inv *= 2 - SC_L.v[0] * inv;
+        k.l_inv = 0 - inv;
+        Sc x = { { 1, 0, 0, 0 } };
+        for (int i = 0; i < 512; i++) {
+            uint64_t carry = 0;
+            for (int j = 0; j < 4; j++) {
+                uint64_t next = x.v[j] >> 63;
+                x.v[j] = (x.v[j] << 1) | carry;
+                carry = next;
+            }
+            scCondSub(x);
+        }
+        k.r2 = x;
+        return k;
+    }();
+    return c;
+}
+
+// a * b * R^-1 mod L, para a * b < L * R
+static Sc scMont(const Sc& a, const Sc& b) {
+    const uint64_t l_inv = scConstants().l_inv;
+    uint64_t t[6] = { 0, 0, 0, 0, 0, 0 };
+    for (int i = 0; i < 4; i++) {
+        u128 c = 0;
+        for (int j = 0; j < 4; j++) {
+            c += (u128)a.v[j] * b.v[i] + t[j];
+            t[j] = (uint64_t)c;
+            c >>= 64;
+        }
+        c += t[4];
+        t[4] = (uint64_t)c;
+        t[5] = (uint64_t)(c >> 64);
+
+        uint64_t m = t[0] * l_inv;
+        c = ((u128)m * SC_L.v[0] + t[0]) >> 64;
+        for (int j = 1; j < 4; j++) {
+            c += (u128)m * SC_L.v[j] + t[j];
+            t[j - 1] = (uint64_t)c;
+            c >>= 64;
+        }
+        c += t[4];
+        t[3] = (uint64_t)c;
+        t[4] = t[5] + (uint64_t)(c >> 64);
+    }
+    Sc r = { { t[0], t[1], t[2], t[3] } };
+    scCondSub(r, t[4]);
+    return r;
+}
+
+static Sc scFromBytes(const uint8_t s[32]) {
+    Sc r;
+    for (int i = 0; i < 4; i++) {
+        r.v[i] = 0;
+        for (int j = 7; j >= 0; j--) r.v[i] = (r.v[i] << 8) | s[8 * i + j];
+    }
+    return r;
+}
+
+static void scToBytes(uint8_t s[32], const Sc& a) {
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 8; j++) s[8 * i + j] = (uint8_t)(a.v[i] >> (8 * j));
+    }
+}
+
+static bool scIsCanonical(const uint8_t s[32]) {
+    Sc a = scFromBytes(s);
+    for (int i = 3; i >= 0; i--) {
+        if (a.v[i] != SC_L.v[i]) return a.v[i] < SC_L.v[i];
+    }
+    return false;
+}
+
+static Sc scAdd(const Sc& a, const Sc& b) {
+    Sc r;
+    u128 c = 0;
+    for (int i = 0; i < 4; i++) {
+        c += (u128)a.v[i] + b.v[i];
+        r.v[i] = (uint64_t)c;
+        c >>= 64;
+    }
+    scCondSub(r);
+    return r;
+}
+
+static Sc scNeg(const Sc& a) {
+    Sc r;
+    u128 borrow = 0;
+    for (int i = 0; i < 4; i++) {
+        u128 d = (u128)SC_L.v[i] - a.v[i] - (uint64_t)borrow;
+        r.v[i] = (uint64_t)d;
+        borrow = (d >> 64) & 1;
+    }
+    scCondSub(r);   // a = 0 -> L -> 0
+    return r;
+}
+
+static Sc scMul(const Sc& a, const Sc& b) {
+    return scMont(scMont(a, b), scConstants().r2);
+}
+
+// Redução de 512 bits (saída do SHA-512): lo + hi * 2^256 mod L
+static Sc scReduce512(const uint8_t h[64]) {
+    const Sc& r2 = scConstants().r2;
+    static const Sc ONE = { { 1, 0, 0, 0 } };
+    Sc lo = scMont(scMont(scFromBytes(h), r2), ONE);
+    Sc hi = scMont(scFromBytes(h + 32), r2);
+    return scAdd(lo, hi);
+}
+
+// ---------------------------------------------------------------------------
+// Multiplicação escalar
+// ---------------------------------------------------------------------------
+
+// Dígitos com sinal em radix 16: a = sum e[i] 16^i, e[i] em [-8, 8)
+static void scalarRadix16(int8_t e[64], const uint8_t a[32]) {
+    for (int i = 0; i < 32; i++) {
+        e[2 * i] = a[i] & 15;
+        e[2 * i + 1] = (a[i] >> 4) & 15;
+    }
+    int8_t carry = 0;
+    for (int i = 0; i < 63; i++) {
+        e[i] += carry;
+        carry = (int8_t)((e[i] + 8) >> 4);
+        e[i] -= (int8_t)(carry << 4);
+    }
+    e[63] += carry;
+}
+
+// BASE_TABLE[i][j] = (j + 1) * 16^(2i) * B
+struct BaseTable {
+    GeNiels points[32][8];
+};
+
+static const Ge& basePoint() {
+    static const Ge B = [] {
+        static const uint8_t encoded[32] = {
+            0x58, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+            0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66
+        };
+        Ge p;
+        geFromBytes(p, encoded);
+        return p;
+    }();
+    return B;
+}
+
+static const BaseTable& baseTable() {
+    static const BaseTable* table = [] {
+        BaseTable* t = new BaseTable;
+        Ge row = basePoint();
+        for (int i = 0; i < 32; i++) {
+            GeCached row_cached;
+            geToCached(row_cached, row);
+            Ge p = row;
+            for (int j = 0; j < 8; j++) {
+                Fe zi, x, y;
+                feInvert(zi, p.Z);
+                feMul(x, p.X, zi);
+                feMul(y, p.Y, zi);
+                GeNiels& n = t->points[i][j];
+                feAdd(n.YplusX, y, x);
+                feCarry(n.YplusX);
+                feSub(n.YminusX, y, x);
+                feMul(n.XY2d, x, y);
+                feMul(n.XY2d, n.XY2d, FE_D2);
+                geAdd(p, p, row_cached);
+            }
+            // próxima linha: 256 * row
+            for (int k = 0; k < 8; k++) geDouble(row, row);
+        }
+        return t;
+    }();
+    return *table;
+}
+
+// Seleção em tempo constante de b * BASE_TABLE[pos] (b em [-8, 8])
+static void selectBase(GeNiels& t, int pos, int8_t b) {
+    const BaseTable& table = baseTable();
+    uint8_t negative = (uint8_t)b >> 7;
+    uint8_t babs = (uint8_t)(b - ((-negative & b) << 1));
+    t.YplusX = FE_ONE;
+    t.YminusX = FE_ONE;
+    t.XY2d = FE_ZERO;
+    for (int j = 0; j < 8; j++) {
+        uint64_t eq = (uint64_t)(((uint32_t)(babs ^ (j + 1)) - 1) >> 31);
+        feCmov(t.YplusX, table.points[pos][j].YplusX, eq);
+        feCmov(t.YminusX, table.points[pos][j].YminusX, eq);
+        feCmov(t.XY2d, table.points[pos][j].XY2d, eq);
+    }
+    GeNiels minus;
+    minus.YplusX = t.YminusX;
+    minus.YminusX = t.YplusX;
+    feNeg(minus.XY2d, t.XY2d);
+    feCmov(t.YplusX, minus.YplusX, negative);
+    feCmov(t.YminusX, minus.YminusX, negative);
+    feCmov(t.XY2d, minus.XY2d, negative);
+}
+
+// [a]B com a[31] <= 127, em tempo constante
+static void geScalarMultBase(Ge& h, const uint8_t a[32]) {
+    int8_t e[64];
+    scalarRadix16(e, a);
+    GeNiels t;
+    geIdentity(h);
+    for (int i = 1; i < 64; i += 2) {
+        selectBase(t, i / 2, e[i]);
+        geMadd(h, h, t);
+    }
+    geDouble(h, h);
+    geDouble(h, h);
+    geDouble(h, h);
+    geDouble(h, h);
+    for (int i = 0; i < 64; i += 2) {
+        selectBase(t, i / 2, e[i]);
+        geMadd(h, h, t);
+    }
+}
+
+// [a]P em tempo variável (apenas dados públicos)
+static void geScalarMultVartime(Ge& h, const uint8_t a[32], const Ge& p) {
+    GeCached multiples[8];
+    Ge acc = p;
+    geToCached(multiples[0], p);
+    for (int j = 1; j < 8; j++) {
+        geAdd(acc, acc, multiples[0]);
+        geToCached(multiples[j], acc);
+    }
+    int8_t e[64];
+    scalarRadix16(e, a);
+    geIdentity(h);
+    for (int i = 63; i >= 0; i--) {
+        if (i != 63) {
+            for (int k = 0; k < 4; k++) geDouble(h, h);
+        }
+        if (e[i] > 0) {
+            geAdd(h, h, multiples[e[i] - 1]);
+        } else if (e[i] < 0) {
+            geSub(h, h, multiples[-e[i] - 1]);
+        }
+    }
+}
+
+// Pippenger com dígitos com sinal: sum scalars[i] * points[i].
+// Escalares em 32 bytes little-endian, < 2^255.
+static void geMultiScalarMult(Ge& result, const std::vector<Sc>& scalars, const std::vector<Ge>& points) {
+    const size_t n = points.size();
+    int c;
+    if (n < 32) c = 4;
+    else if (n < 128) c = 5;
+    else if (n < 512) c = 7;
+    else if (n < 2048) c = 8;
+    else if (n < 8192) c = 10;
+    else c = 11;
+
+    const int windows = (256 + c - 1) / c;
+    const int half = 1 << (c - 1);
+    // Recodificação de todos os escalares: digits[i * windows + w]
+    std::vector<int32_t> digits(n * windows);
+    for (size_t i = 0; i < n; i++) {
+        int32_t carry = 0;
+        for (int w = 0; w < windows; w++) {
+            int bit = w * c;
+            int limb = bit / 64, shift = bit % 64;
+            uint64_t bits = scalars[i].v[limb] >> shift;
+            if (shift + c > 64 && limb + 1 < 4) bits |= scalars[i].v[limb + 1] << (64 - shift);
+            int32_t d = (int32_t)(bits & ((1u << c) - 1)) + carry;
+            carry = d >= half ? 1 : 0;
+            digits[i * windows + w] = d - (carry << c);
+        }
+    }
+
+    std::vector<GeCached> cached(n);
+    for (size_t i = 0; i < n; i++) geToCached(cached[i], points[i]);
+
+    std::vector<Ge> buckets(half);
+    std::vector<char> used(half);
+    geIdentity(result);
+    for (int w = windows - 1; w >= 0; w--) {
+        for (int k = 0; k < c; k++) geDouble(result, result);
+
+        std::fill(used.begin(), used.end(), 0);
+        for (size_t i = 0; i < n; i++) {
+            int32_t d = digits[i * windows + w];
+            if (d == 0) continue;
+            int b = (d > 0 ? d : -d) - 1;
+            if (!used[b]) {
+                geIdentity(buckets[b]);
+                used[b] = 1;
+            }
+            if (d > 0) {
+                geAdd(buckets[b], buckets[b], cached[i]);
+            } else {
+                geSub(buckets[b], buckets[b], cached[i]);
+            }
+        }
+
+        // sum_b (b + 1) * bucket[b] por somas acumuladas
+        Ge running, sum;
+        geIdentity(running);
+        geIdentity(sum);
+        bool started = false;
+        for (int b = half - 1; b >= 0; b--) {
+            GeCached tmp;
+            if (used[b]) {
+                geToCached(tmp, buckets[b]);
+                geAdd(running, running, tmp);
+                started = true;
+            }
+            if (started) {
+                geToCached(tmp, running);
+                geAdd(sum, sum, tmp);
+            }
+        }
+        GeCached sum_cached;
+        geToCached(sum_cached, sum);
+        geAdd(result, result, sum_cached);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Assinatura e verificação
+// ---------------------------------------------------------------------------
+
+static void expandSeed(const uint8_t seed[32], uint8_t az[64]) {
+    SHA512(seed, 32, az);
+    az[0] &= 248;
+    az[31] &= 127;
+    az[31] |= 64;
+}
+
+// k = SHA-512(R || A || M) mod L
+static Sc challenge(const uint8_t R[32], const uint8_t A[32], const uint8_t* message, size_t len) {
+    uint8_t h[64];
+    SHA512_CTX ctx;
+    SHA512_Init(&ctx);
+    SHA512_Update(&ctx, R, 32);
+    SHA512_Update(&ctx, A, 32);
+    SHA512_Update(&ctx, message, len);
+    SHA512_Final(h, &ctx);
+    return scReduce512(h);
+}
+
+void ed25519PublicKey(const uint8_t seed[32], uint8_t public_key[32]) {
+    uint8_t az[64];
+    expandSeed(seed, az);
+    Ge A;
+    geScalarMultBase(A, az);
+    geToBytes(public_key, A);
+    OPENSSL_cleanse(az, sizeof(az));
+}
+
+void ed25519Sign(const uint8_t* message, size_t len, const uint8_t seed[32],
+                 const uint8_t public_key[32], uint8_t signature[64]) {
+    uint8_t az[64];
+    uint8_t nonce[64];
+    expandSeed(seed, az);
+
+    SHA512_CTX ctx;
+    SHA512_Init(&ctx);
+    SHA512_Update(&ctx, az + 32, 32);
+    SHA512_Update(&ctx, message, len);
+    SHA512_Final(nonce, &ctx);
+    Sc r = scReduce512(nonce);
+    uint8_t r_bytes[32];
+    scToBytes(r_bytes, r);
+
+    Ge R;
+    geScalarMultBase(R, r_bytes);
+    geToBytes(signature, R);
+
+    Sc k = challenge(signature, public_key, message, len);
+    // a < 2^255 < R: scMul reduz sem pré-redução
+    Sc a = scFromBytes(az);
+    Sc s = scAdd(scMul(k, a), r);
+    scToBytes(signature + 32, s);
+
+    OPENSSL_cleanse(az, sizeof(az));
+    OPENSSL_cleanse(nonce, sizeof(nonce));
+    OPENSSL_cleanse(r_bytes, sizeof(r_bytes));
+    OPENSSL_cleanse(&a, sizeof(a));
+    OPENSSL_cleanse(&r, sizeof(r));
+}
+
+static bool isSmallMultipleIdentity(Ge p) {
+    geDouble(p, p);
+    geDouble(p, p);
+    geDouble(p, p);
+    return geIsIdentity(p);
+}
+
+bool ed25519Verify(const uint8_t* message, size_t len, const uint8_t public_key[32], const uint8_t signature[64]) {
+    Ge A, R;
+    if (!scIsCanonical(signature + 32) || !geFromBytes(A, public_key) || !geFromBytes(R, signature)) return false;
+    Sc k = challenge(signature, public_key, message, len);
+    uint8_t k_bytes[32];
+    scToBytes(k_bytes, k);
+
+    Ge sB, kA;
+    geScalarMultBase(sB, signature + 32);
+    geScalarMultVartime(kA, k_bytes, A);
+    GeCached c;
+    geToCached(c, kA);
+    geSub(sB, sB, c);
+    geToCached(c, R);
+    geSub(sB, sB, c);
+    return isSmallMultipleIdentity(sB);
+}
+
+// Um sub-lote: as assinaturas bem formadas são combinadas em uma única MSM.
+// results[i] recebe 1/0; com 'detailed', uma falha do lote é resolvida
+// reverificando cada assinatura, senão todo o sub-lote é marcado inválido.
+static bool verifyChunk(const uint8_t* const* messages, const size_t* lens,
+                        const uint8_t* const* public_keys, const uint8_t* const* signatures,
+                        size_t begin, size_t end, char* results, bool detailed) {
+    const size_t n = end - begin;
+    std::vector<Sc> scalars;
+    std::vector<Ge> points;
+    std::vector<size_t> members;
+    scalars.reserve(2 * n + 1);
+    points.reserve(2 * n + 1);
+    members.reserve(n);
+
+    std::vector<uint8_t> z_bytes(16 * n);
+    RAND_bytes(z_bytes.data(), (int)z_bytes.size());
+
+    bool all_valid = true;
+    Sc b_scalar = { { 0, 0, 0, 0 } };
+    scalars.push_back(b_scalar);
+    points.push_back(basePoint());
+    for (size_t i = begin; i < end; i++) {
+        Ge A, R;
+        const uint8_t* sig = signatures[i];
+        if (!scIsCanonical(sig + 32) || !geFromBytes(A, public_keys[i]) || !geFromBytes(R, sig)) {
+            results[i] = 0;
+            all_valid = false;
+            continue;
+        }
+        // z_i de 128 bits
+        const uint8_t* zb = z_bytes.data() + 16 * (i - begin);
+        Sc z = { { 0, 0, 0, 0 } };
+        for (int j = 7; j >= 0; j--) {
+            z.v[0] = (z.v[0] << 8) | zb[j];
+            z.v[1] = (z.v[1] << 8) | zb[8 + j];
+        }
+        Sc k = challenge(sig, public_keys[i], messages[i], lens[i]);
+        b_scalar = scAdd(b_scalar, scMul(z, scFromBytes(sig + 32)));
+        scalars.push_back(z);
+        points.push_back(R);
+        scalars.push_back(scMul(z, k));
+        points.push_back(A);
+        members.push_back(i);
+    }
+    if (members.empty()) return all_valid;
+    scalars[0] = scNeg(b_scalar);
+
+    Ge sum;
+    geMultiScalarMult(sum, scalars, points);
+    const bool batch_ok = isSmallMultipleIdentity(sum);
+    for (size_t i : members) {
+        results[i] = batch_ok || (detailed && ed25519Verify(messages[i], lens[i], public_keys[i], signatures[i]));
+    }
+    return all_valid && batch_ok;
+}
+
+bool ed25519VerifyBatch(const uint8_t* const* messages, const size_t* lens,
+                        const uint8_t* const* public_keys, const uint8_t* const* signatures,
+                        size_t count, std::vector<bool>* valid, ThreadPool* pool) {
+    if (valid) valid->assign(count, false);
+    if (count == 0) return true;
+    baseTable();
+
+    // Um byte por item: std::vector<bool> não pode ser escrito em paralelo
+    std::vector<char> results(count, 0);
+    const size_t threads = pool ? pool->size() : 1;
+    const size_t grain = std::max<size_t>(64, (count + threads - 1) / threads);
+    bool ok = true;
+    if (threads > 1 && count > grain) {
+        std::vector<char> chunk_ok((count + grain - 1) / grain, 0);
+        pool->parallelFor(count, grain, [&](size_t begin, size_t end) {
+            chunk_ok[begin / grain] = verifyChunk(messages, lens, public_keys, signatures, begin, end,
+                                                  results.data(), valid != nullptr);
+        });
+        for (char c : chunk_ok) ok = ok && c;
+    } else {
+        ok = verifyChunk(messages, lens, public_keys, signatures, 0, count, results.data(), valid != nullptr);
+    }
+
+    if (valid) {
+        for (size_t i = 0; i < count; i++) (*valid)[i] = results[i] != 0;
+    }
+    return ok;
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,558 @@
+#include "../include/adilsoncrypto_ethereum.h"
+#include "../include/adilsoncrypto_bitcoin.h"
+#include "../include/adilsoncrypto_solana.h"
+#include <algorithm>
+#include <cstring>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/ecdsa.h>
+#include <openssl/obj_mac.h>
+
+namespace adilsoncrypto {
+
+// ---------------------------------------------------------------------------
+// RLP
+// ---------------------------------------------------------------------------
+
+static bool readBigEndianLength(const uint8_t* p, size_t n, size_t& len) {
+    if (n == 0 || n > sizeof(size_t) || p[0] == 0) return false;
+    len = 0;
+    for (size_t i = 0; i < n; i++) len = (len << 8) | p[i];
+    return true;
+}
+
+bool rlpDecodeItem(const uint8_t* data, size_t size, RlpItem& item) {
+    if (size == 0) return false;
+    const uint8_t b0 = data[0];
+    size_t header = 1;
+    size_t len;
+
+    if (b0 < 0x80) {
+        item.list = false;
+        header = 0;
+        len = 1;
+    } else if (b0 <= 0xb7 || (b0 >= 0xc0 && b0 <= 0xf7)) {
+        item.list = b0 >= 0xc0;
+        len = b0 - (item.list ? 0xc0 : 0x80);
+        // Um byte < 0x80 deve ser codificado como ele próprio
+        if (!item.list && len == 1 && (size < 2 || data[1] < 0x80)) return false;
+    } else {
+        item.list = b0 >= 0xf8;
+        size_t len_of_len = b0 - (item.list ? 0xf7 : 0xb7);
+        if (size < 1 + len_of_len || !readBigEndianLength(data + 1, len_of_len, len) || len < 56) return false;
+        header += len_of_len;
+    }
+    if (len > size - header) return false;
+    item.payload.data = data + header;
+    item.payload.size = len;
+    item.encoded.data = data;
+    item.encoded.size = header + len;
+    return true;
+}
+
+RlpListReader::RlpListReader(const RlpItem& list)
+    : p(list.payload.data), end(list.payload.data + list.payload.size), error(!list.list) {
+    if (error) end = p;
+}
+
+bool RlpListReader::next(RlpItem& item) {
+    if (error || p == end) return false;
+    if (!rlpDecodeItem(p, (size_t)(end - p), item)) {
+        error = true;
+        return false;
+    }
+    p += item.encoded.size;
+    return true;
+}
+
+static size_t lengthOfLength(size_t len) {
+    size_t n = 0;
+    while (len) {
+        n++;
+        len >>= 8;
+    }
+    return n;
+}
+
+size_t rlpStringSize(const uint8_t* data, size_t len) {
+    if (len == 1 && data[0] < 0x80) return 1;
+    return len < 56 ? 1 + len : 1 + lengthOfLength(len) + len;
+}
+
+size_t rlpIntegerSize(uint64_t value) {
+    if (value < 0x80) return 1;   // 0 vira 0x80
+    return 1 + lengthOfLength((size_t)value);
+}
+
+size_t rlpListSize(size_t payload_len) {
+    return payload_len < 56 ? 1 + payload_len : 1 + lengthOfLength(payload_len) + payload_len;
+}
+
+RlpWriter::RlpWriter() : out(nullptr), capacity(0), hasher(nullptr), written(0), overflow(false) {
+}
+
+RlpWriter::RlpWriter(uint8_t* o, size_t cap) : out(o), capacity(cap), hasher(nullptr), written(0), overflow(false) {
+}
+
+RlpWriter::RlpWriter(Keccak256Hasher& h) : out(nullptr), capacity(0), hasher(&h), written(0), overflow(false) {
+}
+
+void RlpWriter::put(const uint8_t* data, size_t len) {
+    // Campos vazios chegam com data == nullptr, que memcpy não aceita
+    if (len == 0) return;
+    if (hasher) {
+        hasher->absorb(data, len);
+    } else if (out) {
+        if (len > capacity - std::min(capacity, written)) {
+            overflow = true;
+        } else {
+            std::memcpy(out + written, data, len);
+        }
+    }
+    written += len;
+}
+
+void RlpWriter::putLength(uint8_t short_base, size_t len) {
+    uint8_t header[1 + sizeof(size_t)];
+    if (len < 56) {
+        header[0] = (uint8_t)(short_base + len);
+        put(header, 1);
+        return;
+    }
+    size_t n = lengthOfLength(len);
+    header[0] = (uint8_t)(short_base + 55 + n);
+    for (size_t i = 0; i < n; i++) header[n - i] = (uint8_t)(len >> (8 * i));
+    put(header, 1 + n);
+}
+
+RlpWriter& RlpWriter::string(const uint8_t* data, size_t len) {
+    if (len != 1 || data[0] >= 0x80) putLength(0x80, len);
+    put(data, len);
+    return *this;
+}
+
+RlpWriter& RlpWriter::integer(uint64_t value) {
+    uint8_t be[8];
+    for (int i = 0; i < 8; i++) be[i] = (uint8_t)(value >> (56 - 8 * i));
+    return integerBytes(be, 8);
+}
+
+RlpWriter& RlpWriter::integerBytes(const uint8_t* be, size_t len) {
+    while (len > 0 && be[0] == 0) {
+        be++;
+        len--;
+    }
+    return string(be, len);
+}
+
+RlpWriter& RlpWriter::listHeader(size_t payload_len) {
+    putLength(0xc0, payload_len);
+    return *this;
+}
+
+RlpWriter& RlpWriter::raw(const uint8_t* data, size_t len) {
+    put(data, len);
+    return *this;
+}
+
+// ---------------------------------------------------------------------------
+// Transações
+// ---------------------------------------------------------------------------
+
+static bool readInteger(const RlpItem& item, uint64_t& value) {
+    if (item.list || item.payload.size > 8 || (item.payload.size > 0 && item.payload.data[0] == 0)) return false;
+    value = 0;
+    for (size_t i = 0; i < item.payload.size; i++) value = (value << 8) | item.payload.data[i];
+    return true;
+}
+
+static bool readScalar(const RlpItem& item, size_t max_len, ByteView& view) {
+    if (item.list || item.payload.size > max_len || (item.payload.size > 0 && item.payload.data[0] == 0)) return false;
+    view = item.payload;
+    return true;
+}
+
+static bool readScalar32(const RlpItem& item, uint8_t out[32]) {
+    ByteView view;
+    if (!readScalar(item, 32, view)) return false;
+    std::memset(out, 0, 32);
+    if (view.size) std::memcpy(out + 32 - view.size, view.data, view.size);
+    return true;
+}
+
+static bool isZero32(const uint8_t v[32]) {
+    for (int i = 0; i < 32; i++) {
+        if (v[i]) return false;
+    }
+    return true;
+}
+
+bool decodeEthTransaction(const uint8_t* data, size_t size, EthTransaction& tx) {
+    tx = EthTransaction();
+    if (size == 0) return false;
+    if (data[0] < 0xc0) {
+        if (data[0] != 0x01 && data[0] != 0x02) return false;
+        tx.type = (EthTxType)data[0];
+        data++;
+        size--;
+    }
+
+    RlpItem list;
+    if (!rlpDecodeItem(data, size, list) || !list.list || list.encoded.size != size) return false;
+
+    RlpItem f[12];
+    size_t count = 0;
+    RlpListReader reader(list);
+    while (count < 12 && reader.next(f[count])) count++;
+    if (reader.failed() || !reader.done()) return false;
+
+    const bool typed = tx.type != EthTxType::LEGACY;
+    const size_t unsigned_count = tx.type == EthTxType::DYNAMIC_FEE ? 9 : (typed ? 8 : 6);
+    if (count != unsigned_count && count != unsigned_count + 3) return false;
+    size_t i = 0;
+    if (typed && !readInteger(f[i++], tx.chain_id)) return false;
+    if (!readInteger(f[i++], tx.nonce)) return false;
+    if (tx.type == EthTxType::DYNAMIC_FEE) {
+        if (!readInteger(f[i++], tx.max_priority_fee_per_gas) || !readInteger(f[i++], tx.max_fee_per_gas)) return false;
+    } else if (!readInteger(f[i++], tx.gas_price)) {
+        return false;
+    }
+    if (!readInteger(f[i++], tx.gas_limit)) return false;
+    if (f[i].list || (f[i].payload.size != 0 && f[i].payload.size != 20)) return false;
+    tx.to = f[i++].payload;
+    if (!readScalar(f[i++], 32, tx.value)) return false;
+    if (f[i].list) return false;
+    tx.data = f[i++].payload;
+    if (typed) {
+        if (!f[i].list) return false;
+        tx.access_list = f[i++].encoded;
+    }
+    if (count == unsigned_count) return true;
+
+    uint64_t v;
+    if (!readInteger(f[i++], v) || !readScalar32(f[i++], tx.r) || !readScalar32(f[i++], tx.s)) return false;
+    if (typed) {
+        if (v > 1) return false;
+        tx.y_parity = (uint8_t)v;
+        tx.has_signature = true;
+    } else if (isZero32(tx.r) && isZero32(tx.s)) {
+        // Payload EIP-155 ainda não assinado: v = chain_id
+        tx.chain_id = v;
+    } else if (v == 27 || v == 28) {
+        tx.y_parity = (uint8_t)(v - 27);
+        tx.has_signature = true;
+    } else if (v >= 35) {
+        tx.chain_id = (v - 35) / 2;
+        tx.y_parity = (uint8_t)((v - 35) & 1);
+        tx.has_signature = true;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static void writeFields(const EthTransaction& tx, bool signing_payload, RlpWriter& w) {
+    const bool typed = tx.type != EthTxType::LEGACY;
+    if (typed) w.integer(tx.chain_id);
+    w.integer(tx.nonce);
+    if (tx.type == EthTxType::DYNAMIC_FEE) {
+        w.integer(tx.max_priority_fee_per_gas).integer(tx.max_fee_per_gas);
+    } else {
+        w.integer(tx.gas_price);
+    }
+    w.integer(tx.gas_limit).string(tx.to).integerBytes(tx.value.data, tx.value.size).string(tx.data);
+    if (typed) {
+        if (tx.access_list.size) {
+            w.raw(tx.access_list.data, tx.access_list.size);
+        } else {
+            w.listHeader(0);
+        }
+    }
+    if (signing_payload) {
+        // EIP-155: (chain_id, 0, 0) no lugar de (v, r, s)
+        if (!typed && tx.chain_id) w.integer(tx.chain_id).integer(0).integer(0);
+        return;
+    }
+    uint64_t v = typed ? tx.y_parity : (tx.chain_id ? tx.chain_id * 2 + 35 + tx.y_parity : 27u + tx.y_parity);
+    w.integer(v).integerBytes(tx.r, 32).integerBytes(tx.s, 32);
+}
+
+static void writeTransaction(const EthTransaction& tx, bool signing_payload, RlpWriter& w) {
+    RlpWriter counter;
+    writeFields(tx, signing_payload, counter);
+    if (tx.type != EthTxType::LEGACY) {
+        uint8_t type = (uint8_t)tx.type;
+        w.raw(&type, 1);
+    }
+    w.listHeader(counter.size());
+    writeFields(tx, signing_payload, w);
+}
+
+size_t ethTransactionSize(const EthTransaction& tx, bool signing_payload) {
+    RlpWriter counter;
+    writeTransaction(tx, signing_payload, counter);
+    return counter.size();
+}
+
+size_t encodeEthTransaction(const EthTransaction& tx, bool signing_payload, uint8_t* out, size_t capacity) {
+    RlpWriter writer(out, capacity);
+    writeTransaction(tx, signing_payload, writer);
+    return writer.ok() ? writer.size() : 0;
+}
+
+void encodeEthTransactionBatch(const EthTransaction* txs, size_t count, bool signing_payload,
+                               std::vector<uint8_t>& out, std::vector<size_t>& offsets) {
+    offsets.resize(count + 1);
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        offsets[i] = total;
+        total += ethTransactionSize(txs[i], signing_payload);
+    }
+    offsets[count] = total;
+    out.resize(total);
+    for (size_t i = 0; i < count; i++) {
+        RlpWriter writer(out.data() + offsets[i], offsets[i + 1] - offsets[i]);
+        writeTransaction(txs[i], signing_payload, writer);
+    }
+}
+
+Hash256 ethSigningHash(const EthTransaction& tx) {
+    Keccak256Hasher hasher;
+    RlpWriter writer(hasher);
+    writeTransaction(tx, true, writer);
+    Hash256 out;
+    hasher.finalize(out.data());
+    return out;
+}
+
+Hash256 ethTransactionHash(const EthTransaction& tx) {
+    Keccak256Hasher hasher;
+    RlpWriter writer(hasher);
+    writeTransaction(tx, false, writer);
+    Hash256 out;
+    hasher.finalize(out.data());
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+// secp256k1: assinatura com recovery id e recuperação da chave pública
+// ---------------------------------------------------------------------------
+
+static const EC_GROUP* secp256k1Group() {
+    static EC_GROUP* group = EC_GROUP_new_by_curve_name(NID_secp256k1);
+    return group;
+}
+
+bool ecdsaRecoverPublicKey(const uint8_t digest[32], const uint8_t r[32], const uint8_t s[32],
+                           int recovery_id, uint8_t public_key[65]) {
+    if (recovery_id < 0 || recovery_id > 3) return false;
+    const EC_GROUP* group = secp256k1Group();
+    const BIGNUM* n = EC_GROUP_get0_order(group);
+    BN_CTX* ctx = BN_CTX_new();
+    BN_CTX_start(ctx);
+    BIGNUM* rb = BN_CTX_get(ctx);
+    BIGNUM* sb = BN_CTX_get(ctx);
+    BIGNUM* e = BN_CTX_get(ctx);
+    BIGNUM* x = BN_CTX_get(ctx);
+    BIGNUM* p = BN_CTX_get(ctx);
+    BIGNUM* r_inv = BN_CTX_get(ctx);
+    BIGNUM* u1 = BN_CTX_get(ctx);
+    BIGNUM* u2 = BN_CTX_get(ctx);
+    EC_POINT* R = EC_POINT_new(group);
+    EC_POINT* Q = EC_POINT_new(group);
+    bool ok = false;
+
+    BN_bin2bn(r, 32, rb);
+    BN_bin2bn(s, 32, sb);
+    BN_bin2bn(digest, 32, e);
+    if (!BN_is_zero(rb) && !BN_is_zero(sb) && BN_cmp(rb, n) < 0 && BN_cmp(sb, n) < 0 &&
+        EC_GROUP_get_curve(group, p, nullptr, nullptr, ctx) == 1) {
+        // R = ponto com x = r (+ n) e paridade de y = recovery_id & 1
+        BN_copy(x, rb);
+        if (recovery_id & 2) BN_add(x, x, n);
+        if (BN_cmp(x, p) < 0 && EC_POINT_set_compressed_coordinates(group, R, x, recovery_id & 1, ctx) == 1 &&
+            BN_mod_inverse(r_inv, rb, n, ctx)) {
+            // Q = r^-1 (s R - e G)
+            BN_mod_mul(u1, e, r_inv, n, ctx);
+            BN_sub(u1, n, u1);
+            BN_nnmod(u1, u1, n, ctx);
+            BN_mod_mul(u2, sb, r_inv, n, ctx);
+            ok = EC_POINT_mul(group, Q, u1, R, u2, ctx) == 1 && !EC_POINT_is_at_infinity(group, Q) &&
+                 EC_POINT_point2oct(group, Q, POINT_CONVERSION_UNCOMPRESSED, public_key, 65, ctx) == 65;
+        }
+    }
+
+    EC_POINT_free(R);
+    EC_POINT_free(Q);
+    BN_CTX_end(ctx);
+    BN_CTX_free(ctx);
+    return ok;
+}
+
+void ethAddressFromPublicKey(const uint8_t public_key[65], uint8_t address[20]) {
+    uint8_t digest[32];
+    keccak256Digest(public_key + 1, 64, digest);
+    std::memcpy(address, digest + 12, 20);
+}
+
+std::string ethChecksumAddress(const uint8_t address[20]) {
+    std::string hex = bytesToHex(address, 20);
+    uint8_t digest[32];
+    keccak256Digest((const uint8_t*)hex.data(), hex.size(), digest);
+    for (size_t i = 0; i < hex.size(); i++) {
+        uint8_t nibble = (digest[i / 2] >> (i % 2 ? 0 : 4)) & 0x0f;
+        if (hex[i] >= 'a' && nibble >= 8) hex[i] = (char)(hex[i] - 'a' + 'A');
+    }
+    return "0x" + hex;
+}
+
+static bool publicKeyFromPrivate(const uint8_t private_key[32], uint8_t public_key[65]) {
+    const EC_GROUP* group = secp256k1Group();
+    BIGNUM* priv = BN_bin2bn(private_key, 32, nullptr);
+    EC_POINT* point = EC_POINT_new(group);
+    bool ok = !BN_is_zero(priv) && BN_cmp(priv, EC_GROUP_get0_order(group)) < 0 &&
+              EC_POINT_mul(group, point, priv, nullptr, nullptr, nullptr) == 1 &&
+              EC_POINT_point2oct(group, point, POINT_CONVERSION_UNCOMPRESSED, public_key, 65, nullptr) == 65;
+    EC_POINT_free(point);
+    BN_clear_free(priv);
+    return ok;
+}
+
+bool ethSignTransaction(EthTransaction& tx, const uint8_t private_key[32]) {
+    uint8_t public_key[65];
+    if (!publicKeyFromPrivate(private_key, public_key)) return false;
+
+    Hash256 digest = ethSigningHash(tx);
+    std::string der;
+    if (!ecdsaSignDigest(digest.data(), private_key, der)) return false;
+    const unsigned char* p = (const unsigned char*)der.data();
+    ECDSA_SIG* sig = d2i_ECDSA_SIG(nullptr, &p, (long)der.size());
+    if (!sig) return false;
+    const BIGNUM* r;
+    const BIGNUM* s;
+    ECDSA_SIG_get0(sig, &r, &s);
+    BN_bn2binpad(r, tx.r, 32);
+    BN_bn2binpad(s, tx.s, 32);
+    ECDSA_SIG_free(sig);
+
+    // O OpenSSL não expõe a paridade de R: descobre o recovery id testando
+    for (int id = 0; id < 2; id++) {
+        uint8_t recovered[65];
+        if (ecdsaRecoverPublicKey(digest.data(), tx.r, tx.s, id, recovered) &&
+            std::memcmp(recovered, public_key, 65) == 0) {
+            tx.y_parity = (uint8_t)id;
+            tx.has_signature = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ethRecoverSender(const EthTransaction& tx, uint8_t address[20]) {
+    // secp256k1n / 2: assinaturas com S alto são inválidas desde o Homestead
+    static const uint8_t HALF_N[32] = {
+        0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x5d, 0x57, 0x6e, 0x73, 0x57, 0xa4, 0x50, 0x1d, 0xdf, 0xe9, 0x2f, 0x46, 0x68, 0x1b, 0x20, 0xa0
+    };
+    if (!tx.has_signature || std::memcmp(tx.s, HALF_N, 32) > 0) return false;
+    Hash256 digest = ethSigningHash(tx);
+    uint8_t public_key[65];
+    if (!ecdsaRecoverPublicKey(digest.data(), tx.r, tx.s, tx.y_parity, public_key)) return false;
+    ethAddressFromPublicKey(public_key, address);
+    return true;
+}
+
+} // namespace adilsoncrypto
+
+using namespace adilsoncrypto;
+
+// Interface Ethereum: chaves secp256k1, endereços EIP-55 e assinatura de
+// transações legacy, EIP-155, EIP-2930 e EIP-1559 codificadas em RLP (hex).
+class EthereumChainInterface : public IBlockchainInterface {
+public:
+    std::unique_ptr<IBlockchainInterface> createBitcoinInterface() override {
+        return createBitcoinChainInterface();
+    }
+
+    KeyPair generateKey() override {
+        KeyPair keypair;
+        EC_KEY* key = EC_KEY_new_by_curve_name(NID_secp256k1);
+        if (EC_KEY_generate_key(key) == 1) {
+            uint8_t priv[32];
+            uint8_t pub[65];
+            uint8_t address[20];
+            BN_bn2binpad(EC_KEY_get0_private_key(key), priv, 32);
+            EC_POINT_point2oct(EC_KEY_get0_group(key), EC_KEY_get0_public_key(key),
+                               POINT_CONVERSION_UNCOMPRESSED, pub, sizeof(pub), nullptr);
+            ethAddressFromPublicKey(pub, address);
+            keypair.private_key = bytesToHex(priv, 32);
+            keypair.public_key = bytesToHex(pub, 65);
+            keypair.address = ethChecksumAddress(address);
+            OPENSSL_cleanse(priv, sizeof(priv));
+        }
+        EC_KEY_free(key);
+        return keypair;
+    }
+
+    // Aceita chave pública comprimida (33), não comprimida (65) ou x || y (64)
+    std::string getAddress(const KeyPair& keypair) override {
+        std::string pub;
+        if (!hexToBytes(keypair.public_key, pub)) return "";
+        if (pub.size() == 64) pub.insert(pub.begin(), '\x04');
+        const EC_GROUP* group = secp256k1Group();
+        EC_POINT* point = EC_POINT_new(group);
+        uint8_t uncompressed[65];
+        bool ok = EC_POINT_oct2point(group, point, (const uint8_t*)pub.data(), pub.size(), nullptr) == 1 &&
+                  EC_POINT_point2oct(group, point, POINT_CONVERSION_UNCOMPRESSED, uncompressed, 65, nullptr) == 65;
+        EC_POINT_free(point);
+        if (!ok) return "";
+        uint8_t address[20];
+        ethAddressFromPublicKey(uncompressed, address);
+        return ethChecksumAddress(address);
+    }
+
+    // transaction: transação RLP em hex (não assinada ou assinada; a
+    // assinatura anterior é substituída). Signature.r/s em hex (32 bytes),
+    // v = valor gravado na transação (hex) e proof = transação assinada.
+    // Signature vazia se a transação ou a chave forem inválidas.
+    Signature sign(const std::string& transaction, const KeyPair& keypair) override {
+        Signature signature;
+        std::string raw;
+        uint8_t priv[32];
+        EthTransaction tx;
+        if (!hexToBytes(transaction, raw) || !decodeEthTransaction((const uint8_t*)raw.data(), raw.size(), tx) ||
+            !hexToBytes(keypair.private_key, priv, 32)) {
+            return signature;
+        }
+        bool ok = ethSignTransaction(tx, priv);
+        OPENSSL_cleanse(priv, sizeof(priv));
+        if (!ok) return signature;
+
+        std::string encoded(ethTransactionSize(tx, false), '\0');
+        encodeEthTransaction(tx, false, (uint8_t*)&encoded[0], encoded.size());
+        uint64_t v = tx.type != EthTxType::LEGACY ? tx.y_parity
+                     : (tx.chain_id ? tx.chain_id * 2 + 35 + tx.y_parity : 27u + tx.y_parity);
+        uint8_t v_bytes[8];
+        for (int i = 0; i < 8; i++) v_bytes[i] = (uint8_t)(v >> (56 - 8 * i));
+        size_t skip = 0;
+        while (skip < 7 && v_bytes[skip] == 0) skip++;
+
+        signature.r = bytesToHex(tx.r, 32);
+        signature.s = bytesToHex(tx.s, 32);
+        signature.v = bytesToHex(v_bytes + skip, 8 - skip);
+        signature.proof = bytesToHex(encoded);
+        return signature;
+    }
+
+    std::unique_ptr<IBlockchainInterface> createEthereumInterface() override {
+        return createEthereumChainInterface();
+    }
+
+    std::unique_ptr<IBlockchainInterface> createSolanaInterface() override {
+        return createSolanaChainInterface();
+    }
+};
+
+std::unique_ptr<IBlockchainInterface> createEthereumChainInterface() {
+    return std::make_unique<EthereumChainInterface>();
+}
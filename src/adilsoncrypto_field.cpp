@@ -0,0 +1,567 @@
+#include "../include/adilsoncrypto_field.h"
+#include "../include/adilsoncrypto_context.h"
+#include "../include/adilsoncrypto_serialize.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include "../include/adilsoncrypto_util.h"
+#include <cstring>
+#include <utility>
+#include <openssl/bn.h>
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/rand.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const size_t ADDRESS_BYTES = 20;
+const size_t GPS_CHALLENGE_BYTES = 16;   // desafio de 128 bits
+const size_t GPS_MASK_BYTES = 16;        // folga estatística de k sobre e x
+
+// Big-endian (até 8 * limbs bytes) <-> limbs little-endian
+void bytesToLimbs(const uint8_t* in, size_t len, uint64_t* out, size_t limbs) {
+    std::memset(out, 0, limbs * sizeof(uint64_t));
+    for (size_t i = 0; i < len; i++) out[i / 8] |= (uint64_t)in[len - 1 - i] << (8 * (i % 8));
+}
+
+void limbsToBytes(const uint64_t* in, uint8_t* out, size_t len) {
+    for (size_t i = 0; i < len; i++) out[len - 1 - i] = (uint8_t)(in[i / 8] >> (8 * (i % 8)));
+}
+
+bool lessThan(const uint64_t* a, const uint64_t* b, size_t limbs) {
+    for (size_t i = limbs; i-- > 0;) {
+        if (a[i] != b[i]) return a[i] < b[i];
+    }
+    return false;
+}
+
+bool isZeroLimbs(const uint64_t* a, size_t limbs) {
+    uint64_t bits = 0;
+    for (size_t i = 0; i < limbs; i++) bits |= a[i];
+    return bits == 0;
+}
+
+// Hex como o de BN_hex2bn (tamanho ímpar vale) para no máximo 'max_len'
+// bytes, alinhado à direita em 'out'
+bool hexToFixed(const std::string& hex, uint8_t* out, size_t max_len) {
+    if (hex.empty() || hex.size() > 2 * max_len) return false;
+    std::string padded = hex.size() % 2 ? "0" + hex : hex;
+    size_t len = padded.size() / 2;
+    std::memset(out, 0, max_len - len);
+    return hexToBytes(padded, out + max_len - len, len);
+}
+
+std::string upperHex(const uint8_t* data, size_t len) {
+    std::string hex = bytesToHex(data, len);
+    for (char& c : hex) {
+        if (c >= 'a' && c <= 'f') c = (char)(c - 'a' + 'A');
+    }
+    return hex;
+}
+
+// Chave pública no formato de EC_POINT_point2hex (não comprimida)
+template <typename Curve>
+std::string publicKeyHex(const Curve& curve, const typename Curve::Point& point, size_t field_bytes) {
+    typename Curve::Element x, y;
+    if (!curve.toAffine(point, x, y)) return "";
+    uint64_t raw[FIELD_MAX_LIMBS];
+    uint8_t bytes[1 + 2 * 8 * FIELD_MAX_LIMBS];
+    bytes[0] = 0x04;
+    curve.baseField().toRaw(x, raw);
+    limbsToBytes(raw, bytes + 1, field_bytes);
+    curve.baseField().toRaw(y, raw);
+    limbsToBytes(raw, bytes + 1 + field_bytes, field_bytes);
+    return upperHex(bytes, 1 + 2 * field_bytes);
+}
+
+// Coordenada big-endian; false se não for < p (a volta da forma de
+// Montgomery não reproduziria o valor)
+template <typename Curve>
+bool parseCoordinate(const Curve& curve, const uint8_t* bytes, size_t field_bytes, typename Curve::Element& out) {
+    uint64_t raw[FIELD_MAX_LIMBS];
+    uint64_t back[FIELD_MAX_LIMBS];
+    const size_t limbs = curve.baseField().limbs();
+    bytesToLimbs(bytes, field_bytes, raw, limbs);
+    out = curve.baseField().fromRaw(raw);
+    curve.baseField().toRaw(out, back);
+    return std::memcmp(raw, back, limbs * sizeof(uint64_t)) == 0;
+}
+
+template <typename Curve>
+bool parsePublicKey(const Curve& curve, const std::string& hex, size_t field_bytes, typename Curve::Point& point) {
+    uint8_t bytes[1 + 2 * 8 * FIELD_MAX_LIMBS];
+    const size_t len = 1 + 2 * field_bytes;
+    typename Curve::Element x, y;
+    if (hex.size() != 2 * len || !hexToBytes(hex, bytes, len) || bytes[0] != 0x04 ||
+        !parseCoordinate(curve, bytes + 1, field_bytes, x) ||
+        !parseCoordinate(curve, bytes + 1 + field_bytes, field_bytes, y) || !curve.isOnCurve(x, y)) {
+        return false;
+    }
+    point = curve.fromAffine(x, y);
+    return true;
+}
+
+// Endereço: primeiros 20 bytes do hash da chave pública, como em NamedCurve
+std::string digestAddress(const EVP_MD* md, const std::string& public_key) {
+    std::string point;
+    uint8_t hash[EVP_MAX_MD_SIZE];
+    if (!hexToBytes(public_key, point) || point.empty() || !threadContext().digest(md, point.data(), point.size(), hash)) {
+        return "";
+    }
+    return bytesToHex(hash, ADDRESS_BYTES);
+}
+
+struct KnownCurve {
+    const char* name;
+    const char* p;
+    const char* a;
+    const char* b;
+    const char* gx;
+    const char* gy;
+    const char* md_name;
+    std::unique_ptr<IEllipticCurve> (*create)(const KnownCurve&);
+};
+
+// ECDSA com corpo e escalares especializados. Mesmo formato de chaves e
+// assinaturas de createCurve, então as duas implementações se verificam.
+template <typename FieldParams, typename OrderParams>
+class SpecializedCurve : public IEllipticCurve {
+public:
+    using Field = FixedField<FieldParams>;
+    using Scalars = FixedField<OrderParams>;
+    using Curve = WeierstrassCurve<Field>;
+    using Point = typename Curve::Point;
+    static constexpr size_t FIELD_BYTES = 8 * FieldParams::LIMBS;
+    static constexpr size_t ORDER_LIMBS = OrderParams::LIMBS;
+    static constexpr size_t ORDER_BYTES = 8 * ORDER_LIMBS;
+
+    explicit SpecializedCurve(const KnownCurve& known) : name(known.name) {
+        static const EVP_MD* digests[] = { EVP_MD_fetch(nullptr, "SHA256", nullptr),
+                                           EVP_MD_fetch(nullptr, "SHA384", nullptr) };
+        md = std::strcmp(known.md_name, "SHA384") == 0 ? digests[1] : digests[0];
+
+        Field field;
+        uint64_t raw[FieldParams::LIMBS];
+        uint8_t bytes[FIELD_BYTES];
+        auto element = [&](const char* hex) {
+            hexToFixed(hex, bytes, FIELD_BYTES);
+            bytesToLimbs(bytes, FIELD_BYTES, raw, FieldParams::LIMBS);
+            return field.fromRaw(raw);
+        };
+        curve = Curve(field, element(known.a), element(known.b));
+        generator = curve.fromAffine(element(known.gx), element(known.gy));
+    }
+
+    std::string getName() const override {
+        return name;
+    }
+
+    KeyPair generateKeyPair() override {
+        KeyPair keypair;
+        uint8_t secret[ORDER_BYTES];
+        uint64_t d[ORDER_LIMBS];
+        if (!randomScalar(secret, d)) return keypair;
+
+        Point public_point;
+        curve.mul(public_point, generator, secret, ORDER_BYTES);
+        keypair.private_key = scalarToHex(secret, ORDER_BYTES);
+        keypair.public_key = publicKeyHex(curve, public_point, FIELD_BYTES);
+        keypair.address = getAddress(keypair.public_key);
+        OPENSSL_cleanse(secret, sizeof(secret));
+        OPENSSL_cleanse(d, sizeof(d));
+        return keypair;
+    }
+
+    Signature sign(const std::string& message, const std::string& private_key) override {
+        Signature signature;
+        uint64_t d_raw[ORDER_LIMBS];
+        uint8_t bytes[ORDER_BYTES];
+        if (!parseScalar(private_key, bytes, d_raw)) return signature;
+
+        const typename Scalars::Element e = messageScalar(message);
+        const typename Scalars::Element d = scalars.fromRaw(d_raw);
+        uint8_t k_bytes[ORDER_BYTES];
+        uint64_t k_raw[ORDER_LIMBS];
+        for (;;) {
+            if (!randomScalar(k_bytes, k_raw)) break;
+            Point r_point;
+            typename Curve::Element x, y;
+            curve.mul(r_point, generator, k_bytes, ORDER_BYTES);
+            if (!curve.toAffine(r_point, x, y)) continue;
+
+            // r = x mod n (x < p < R, então fromRaw reduz)
+            uint64_t x_raw[FieldParams::LIMBS];
+            curve.baseField().toRaw(x, x_raw);
+            const typename Scalars::Element r = scalars.fromRaw(x_raw);
+            if (scalars.isZero(r)) continue;
+
+            typename Scalars::Element s;
+            scalars.mul(s, r, d);
+            scalars.add(s, s, e);
+            scalars.mul(s, s, scalars.inverse(scalars.fromRaw(k_raw)));
+            if (scalars.isZero(s)) continue;
+
+            uint64_t out[ORDER_LIMBS];
+            scalars.toRaw(r, out);
+            limbsToBytes(out, bytes, ORDER_BYTES);
+            signature.r = scalarToHex(bytes, ORDER_BYTES);
+            scalars.toRaw(s, out);
+            limbsToBytes(out, bytes, ORDER_BYTES);
+            signature.s = scalarToHex(bytes, ORDER_BYTES);
+            signature.proof = "valid";
+            break;
+        }
+        OPENSSL_cleanse(k_bytes, sizeof(k_bytes));
+        OPENSSL_cleanse(k_raw, sizeof(k_raw));
+        OPENSSL_cleanse(d_raw, sizeof(d_raw));
+        return signature;
+    }
+
+    bool verify(const std::string& message, const Signature& signature, const std::string& public_key) override {
+        uint8_t bytes[ORDER_BYTES];
+        uint64_t r_raw[ORDER_LIMBS], s_raw[ORDER_LIMBS];
+        Point q;
+        if (!parseScalar(signature.r, bytes, r_raw) || !parseScalar(signature.s, bytes, s_raw) ||
+            !parsePublicKey(curve, public_key, FIELD_BYTES, q)) {
+            return false;
+        }
+
+        const typename Scalars::Element r = scalars.fromRaw(r_raw);
+        const typename Scalars::Element w = scalars.inverse(scalars.fromRaw(s_raw));
+        typename Scalars::Element u1, u2;
+        scalars.mul(u1, messageScalar(message), w);
+        scalars.mul(u2, r, w);
+
+        uint64_t raw[ORDER_LIMBS];
+        uint8_t u_bytes[ORDER_BYTES];
+        Point sum, term;
+        scalars.toRaw(u1, raw);
+        limbsToBytes(raw, u_bytes, ORDER_BYTES);
+        curve.mul(sum, generator, u_bytes, ORDER_BYTES);
+        scalars.toRaw(u2, raw);
+        limbsToBytes(raw, u_bytes, ORDER_BYTES);
+        curve.mul(term, q, u_bytes, ORDER_BYTES);
+        curve.add(sum, sum, term);
+
+        typename Curve::Element x, y;
+        if (!curve.toAffine(sum, x, y)) return false;
+        uint64_t x_raw[FieldParams::LIMBS];
+        curve.baseField().toRaw(x, x_raw);
+        return scalars.equal(scalars.fromRaw(x_raw), r);
+    }
+
+    std::string getAddress(const std::string& public_key) override {
+        return digestAddress(md, public_key);
+    }
+
+private:
+    // Escalar em [1, n) do texto hex; 'bytes' é só rascunho
+    bool parseScalar(const std::string& hex, uint8_t* bytes, uint64_t* raw) const {
+        if (!hexToFixed(hex, bytes, ORDER_BYTES)) return false;
+        bytesToLimbs(bytes, ORDER_BYTES, raw, ORDER_LIMBS);
+        return !isZeroLimbs(raw, ORDER_LIMBS) && lessThan(raw, OrderParams::MODULUS.p, ORDER_LIMBS);
+    }
+
+    // Rejeição: uniforme em [1, n)
+    bool randomScalar(uint8_t* bytes, uint64_t* raw) const {
+        do {
+            if (RAND_priv_bytes(bytes, (int)ORDER_BYTES) != 1) return false;
+            bytesToLimbs(bytes, ORDER_BYTES, raw, ORDER_LIMBS);
+        } while (isZeroLimbs(raw, ORDER_LIMBS) || !lessThan(raw, OrderParams::MODULUS.p, ORDER_LIMBS));
+        return true;
+    }
+
+    // O hash tem o tamanho da ordem, então não há bits a descartar
+    typename Scalars::Element messageScalar(const std::string& message) const {
+        uint8_t hash[EVP_MAX_MD_SIZE];
+        uint64_t raw[ORDER_LIMBS];
+        if (!threadContext().digest(md, message.data(), message.size(), hash)) std::memset(hash, 0, sizeof(hash));
+        bytesToLimbs(hash, ORDER_BYTES, raw, ORDER_LIMBS);
+        return scalars.fromRaw(raw);
+    }
+
+    std::string name;
+    const EVP_MD* md;
+    Scalars scalars;
+    Curve curve;
+    Point generator;
+};
+
+template <typename FieldParams, typename OrderParams>
+std::unique_ptr<IEllipticCurve> createSpecialized(const KnownCurve& known) {
+    return std::make_unique<SpecializedCurve<FieldParams, OrderParams>>(known);
+}
+
+const KnownCurve KNOWN_CURVES[] = {
+    { "secp256k1", "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F", "0", "7",
+      "79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798",
+      "483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8", "SHA256",
+      createSpecialized<Secp256k1FieldParams, Secp256k1OrderParams> },
+    { "secp256r1", "FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF",
+      "FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFC",
+      "5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B",
+      "6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296",
+      "4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5", "SHA256",
+      createSpecialized<P256FieldParams, P256OrderParams> },
+    { "secp384r1",
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF",
+      "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFC",
+      "B3312FA7E23EE7E4988E056BE3F82D19181D9C6EFE8141120314088F5013875AC656398D8A2ED19D2A85C8EDD3EC2AEF",
+      "AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7",
+      "3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F", "SHA384",
+      createSpecialized<P384FieldParams, P384OrderParams> },
+};
+
+// Curva sem ordem conhecida sobre o corpo genérico. Assinatura GPS
+// (Girault-Poupard-Stern): R = k G, e = H(R, Q, m) truncado em 128 bits,
+// s = k + e x nos inteiros. Com k 128 bits maior que e x, s não revela x, e
+// a verificação confere H(s G - e Q, Q, m) == e sem nunca reduzir módulo a
+// ordem.
+class GenericCurve : public IEllipticCurve {
+public:
+    using Curve = WeierstrassCurve<GenericField>;
+    using Point = Curve::Point;
+
+    GenericCurve(const Curve& curve, const Point& generator, size_t field_bytes)
+        : curve(curve), generator(generator), field_bytes(field_bytes) {}
+
+    std::string getName() const override {
+        return "custom";
+    }
+
+    KeyPair generateKeyPair() override {
+        KeyPair keypair;
+        uint8_t secret[8 * FIELD_MAX_LIMBS];
+        do {
+            if (RAND_priv_bytes(secret, (int)field_bytes) != 1) return keypair;
+        } while (isZeroBytes(secret, field_bytes));
+
+        Point public_point;
+        curve.mul(public_point, generator, secret, field_bytes);
+        keypair.public_key = publicKeyHex(curve, public_point, field_bytes);
+        if (!keypair.public_key.empty()) {
+            keypair.private_key = scalarToHex(secret, field_bytes);
+            keypair.address = getAddress(keypair.public_key);
+        }
+        OPENSSL_cleanse(secret, sizeof(secret));
+        return keypair;
+    }
+
+    Signature sign(const std::string& message, const std::string& private_key) override {
+        Signature signature;
+        uint8_t secret[8 * FIELD_MAX_LIMBS];
+        if (!hexToFixed(private_key, secret, field_bytes) || isZeroBytes(secret, field_bytes)) return signature;
+        Point public_point;
+        curve.mul(public_point, generator, secret, field_bytes);
+        const std::string public_key = publicKeyHex(curve, public_point, field_bytes);
+
+        const size_t nonce_bytes = field_bytes + GPS_CHALLENGE_BYTES + GPS_MASK_BYTES;
+        uint8_t nonce[8 * FIELD_MAX_LIMBS + GPS_CHALLENGE_BYTES + GPS_MASK_BYTES];
+        uint8_t challenge[GPS_CHALLENGE_BYTES];
+        Point commitment;
+        if (public_key.empty() || RAND_priv_bytes(nonce, (int)nonce_bytes) != 1) {
+            OPENSSL_cleanse(secret, sizeof(secret));
+            return signature;
+        }
+        curve.mul(commitment, generator, nonce, nonce_bytes);
+        bool ok = challengeFor(commitment, public_key, message, challenge);
+
+        // s = k + e x com BIGNUM: só uma multiplicação por assinatura
+        BN_CTX* ctx = threadContext().bnCtx();
+        BN_CTX_start(ctx);
+        BIGNUM* k = BN_CTX_get(ctx);
+        BIGNUM* e = BN_CTX_get(ctx);
+        BIGNUM* x = BN_CTX_get(ctx);
+        ok = ok && x && BN_bin2bn(nonce, (int)nonce_bytes, k) && BN_bin2bn(challenge, sizeof(challenge), e) &&
+             BN_bin2bn(secret, (int)field_bytes, x) && BN_mul(x, e, x, ctx) && BN_add(k, k, x);
+        if (ok) {
+            uint8_t s[8 * FIELD_MAX_LIMBS + GPS_CHALLENGE_BYTES + GPS_MASK_BYTES + 1];
+            const int s_len = BN_bn2binpad(k, s, (int)nonce_bytes + 1);
+            if (s_len > 0) {
+                signature.r = scalarToHex(challenge, sizeof(challenge));
+                signature.s = scalarToHex(s, (size_t)s_len);
+                signature.proof = "valid";
+            }
+        }
+        if (k) BN_clear(k);
+        if (x) BN_clear(x);
+        BN_CTX_end(ctx);
+        OPENSSL_cleanse(nonce, sizeof(nonce));
+        OPENSSL_cleanse(secret, sizeof(secret));
+        return signature;
+    }
+
+    bool verify(const std::string& message, const Signature& signature, const std::string& public_key) override {
+        uint8_t challenge[GPS_CHALLENGE_BYTES];
+        uint8_t s[8 * FIELD_MAX_LIMBS + GPS_CHALLENGE_BYTES + GPS_MASK_BYTES + 1];
+        const size_t s_bytes = field_bytes + GPS_CHALLENGE_BYTES + GPS_MASK_BYTES + 1;
+        Point q;
+        if (!hexToFixed(signature.r, challenge, sizeof(challenge)) || !hexToFixed(signature.s, s, s_bytes) ||
+            !parsePublicKey(curve, public_key, field_bytes, q)) {
+            return false;
+        }
+
+        // R = s G - e Q
+        Point commitment, term;
+        curve.mul(commitment, generator, s, s_bytes);
+        curve.mul(term, q, challenge, sizeof(challenge));
+        curve.negate(term, term);
+        curve.add(commitment, commitment, term);
+
+        uint8_t expected[GPS_CHALLENGE_BYTES];
+        return challengeFor(commitment, public_key, message, expected) &&
+               CRYPTO_memcmp(expected, challenge, sizeof(challenge)) == 0;
+    }
+
+    std::string getAddress(const std::string& public_key) override {
+        static const EVP_MD* sha256_md = EVP_MD_fetch(nullptr, "SHA256", nullptr);
+        return digestAddress(sha256_md, public_key);
+    }
+
+private:
+    static bool isZeroBytes(const uint8_t* bytes, size_t len) {
+        uint8_t bits = 0;
+        for (size_t i = 0; i < len; i++) bits |= bytes[i];
+        return bits == 0;
+    }
+
+    // e = SHA-256(R || Q || m) nos 16 primeiros bytes; false se R for o infinito
+    bool challengeFor(const Point& commitment, const std::string& public_key, const std::string& message,
+                      uint8_t out[GPS_CHALLENGE_BYTES]) const {
+        std::string input = publicKeyHex(curve, commitment, field_bytes);
+        if (input.empty()) return false;
+        input += public_key;
+        input += message;
+        uint8_t hash[32];
+        sha256Digest((const uint8_t*)input.data(), input.size(), hash);
+        std::memcpy(out, hash, GPS_CHALLENGE_BYTES);
+        return true;
+    }
+
+    Curve curve;
+    Point generator;
+    size_t field_bytes;
+};
+
+// Aceita "0x" e sinal de menos (a = -3); o valor é reduzido módulo p depois
+bool parseBignum(const std::string& text, BIGNUM*& out) {
+    size_t start = 0;
+    bool negative = !text.empty() && text[0] == '-';
+    if (negative) start = 1;
+    if (text.size() >= start + 2 && text[start] == '0' && (text[start + 1] == 'x' || text[start + 1] == 'X')) start += 2;
+    const std::string digits = text.substr(start);
+    if (digits.empty() || BN_hex2bn(&out, digits.c_str()) != (int)digits.size()) return false;
+    BN_set_negative(out, negative);
+    return true;
+}
+
+// Gerador determinístico a partir dos parâmetros: x = H(parâmetros, contador)
+// mod p até x^3 + a x + b ser um quadrado; y é a raiz par
+bool deriveGenerator(const BIGNUM* p, const BIGNUM* a, const BIGNUM* b, BIGNUM* gx, BIGNUM* gy, BN_CTX* ctx) {
+    const size_t field_bytes = (size_t)BN_num_bytes(p);
+    std::string seed = "AdilsonCrypto/gerador";
+    for (const BIGNUM* value : { p, a, b }) {
+        std::string bytes(field_bytes, '\0');
+        BN_bn2binpad(value, (uint8_t*)&bytes[0], (int)field_bytes);
+        seed += bytes;
+    }
+
+    BIGNUM* rhs = BN_CTX_get(ctx);
+    BIGNUM* t = BN_CTX_get(ctx);
+    if (!t) return false;
+    for (uint32_t counter = 0; counter < 1000; counter++) {
+        // field_bytes + 16 bytes de hash para o viés de mod p ser desprezível
+        std::string stream;
+        for (uint32_t block = 0; stream.size() < field_bytes + 16; block++) {
+            std::string input = seed;
+            for (uint32_t value : { counter, block }) {
+                for (int shift = 24; shift >= 0; shift -= 8) input.push_back((char)(value >> shift));
+            }
+            uint8_t hash[32];
+            sha256Digest((const uint8_t*)input.data(), input.size(), hash);
+            stream.append((const char*)hash, sizeof(hash));
+        }
+        if (!BN_bin2bn((const uint8_t*)stream.data(), (int)(field_bytes + 16), t) || !BN_nnmod(gx, t, p, ctx)) return false;
+
+        // rhs = x^3 + a x + b
+        if (!BN_mod_sqr(rhs, gx, p, ctx) || !BN_mod_add(rhs, rhs, a, p, ctx) || !BN_mod_mul(rhs, rhs, gx, p, ctx) ||
+            !BN_mod_add(rhs, rhs, b, p, ctx)) {
+            return false;
+        }
+        if (BN_is_zero(rhs)) continue;
+        if (BN_mod_sqrt(gy, rhs, p, ctx)) {
+            if (BN_is_odd(gy) && !BN_sub(gy, p, gy)) return false;
+            return true;
+        }
+        ERR_clear_error();
+    }
+    return false;
+}
+
+template <typename Field>
+typename Field::Element bignumElement(const Field& field, const BIGNUM* value) {
+    uint8_t bytes[8 * FIELD_MAX_LIMBS];
+    uint64_t raw[FIELD_MAX_LIMBS];
+    const size_t len = 8 * field.limbs();
+    BN_bn2binpad(value, bytes, (int)len);
+    bytesToLimbs(bytes, len, raw, field.limbs());
+    return field.fromRaw(raw);
+}
+
+} // namespace
+
+std::unique_ptr<IEllipticCurve> createPrimeFieldCurve(const std::string& p_hex, const std::string& a_hex,
+                                                      const std::string& b_hex) {
+    BN_CTX* ctx = threadContext().bnCtx();
+    BN_CTX_start(ctx);
+    BIGNUM* p = BN_CTX_get(ctx);
+    BIGNUM* a = BN_CTX_get(ctx);
+    BIGNUM* b = BN_CTX_get(ctx);
+    BIGNUM* t = BN_CTX_get(ctx);
+    BIGNUM* u = BN_CTX_get(ctx);
+    std::unique_ptr<IEllipticCurve> curve;
+
+    // p primo ímpar de até 576 bits; a e b reduzidos; 4a^3 + 27b^2 != 0
+    bool valid = u && parseBignum(p_hex, p) && parseBignum(a_hex, a) && parseBignum(b_hex, b) &&
+                 !BN_is_negative(p) && BN_num_bits(p) > 2 && BN_num_bits(p) <= (int)(64 * FIELD_MAX_LIMBS) &&
+                 BN_is_odd(p) && BN_check_prime(p, ctx, nullptr) == 1 && BN_nnmod(a, a, p, ctx) && BN_nnmod(b, b, p, ctx);
+    valid = valid && BN_mod_sqr(t, a, p, ctx) && BN_mod_mul(t, t, a, p, ctx) && BN_mul_word(t, 4) &&
+            BN_mod_sqr(u, b, p, ctx) && BN_mul_word(u, 27) && BN_mod_add(t, t, u, p, ctx) && !BN_is_zero(t);
+
+    if (valid) {
+        for (const KnownCurve& known : KNOWN_CURVES) {
+            bool same = true;
+            for (auto pair : { std::make_pair(known.p, p), std::make_pair(known.a, a), std::make_pair(known.b, b) }) {
+                same = same && BN_hex2bn(&t, pair.first) && BN_cmp(t, pair.second) == 0;
+            }
+            if (same) {
+                curve = known.create(known);
+                break;
+            }
+        }
+    }
+
+    if (valid && !curve) {
+        BIGNUM* gx = BN_CTX_get(ctx);
+        BIGNUM* gy = BN_CTX_get(ctx);
+        if (gy && deriveGenerator(p, a, b, gx, gy, ctx)) {
+            const size_t limbs = ((size_t)BN_num_bits(p) + 63) / 64;
+            uint8_t bytes[8 * FIELD_MAX_LIMBS];
+            uint64_t raw[FIELD_MAX_LIMBS];
+            BN_bn2binpad(p, bytes, (int)(8 * limbs));
+            bytesToLimbs(bytes, 8 * limbs, raw, limbs);
+
+            GenericField field(RuntimeModulus(raw, limbs));
+            WeierstrassCurve<GenericField> generic(field, bignumElement(field, a), bignumElement(field, b));
+            curve = std::make_unique<GenericCurve>(
+                generic, generic.fromAffine(bignumElement(field, gx), bignumElement(field, gy)),
+                (size_t)BN_num_bytes(p));
+        }
+    }
+
+    BN_CTX_end(ctx);
+    ERR_clear_error();
+    return curve;
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,264 @@
+#include "../include/adilsoncrypto_goldilocks.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace adilsoncrypto {
+
+namespace {
+
+// NTTs até 2^SMALL_LOG ficam num único bloco de cache; acima disso, quatro passos
+const unsigned SMALL_LOG = 12;
+const size_t TRANSPOSE_TILE = 32;
+const size_t ROW_GRAIN_ELEMENTS = 1 << 14;   // elementos por tarefa do pool
+
+// Tabelas de uma NTT pequena: permutação bit-reversa e, para cada estágio
+// radix-4 com quartos de tamanho q, os fatores (w^k, w^2k, w^3k), k < q,
+// intercalados para leitura sequencial.
+struct SmallPlan {
+    std::vector<uint32_t> bitrev;
+    std::vector<uint64_t> twiddles;
+    uint64_t quarter_root = 0;   // w_4 (ou w_4^-1 na inversa)
+};
+
+const SmallPlan& smallPlan(unsigned log_n, bool inverse) {
+    static std::once_flag flags[2][SMALL_LOG + 1];
+    static SmallPlan plans[2][SMALL_LOG + 1];
+    SmallPlan& plan = plans[inverse][log_n];
+    std::call_once(flags[inverse][log_n], [&]() {
+        size_t n = (size_t)1 << log_n;
+        plan.bitrev.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            uint32_t r = 0;
+            for (unsigned b = 0; b < log_n; b++) r |= (uint32_t)((i >> b) & 1) << (log_n - 1 - b);
+            plan.bitrev[i] = r;
+        }
+        size_t q = (log_n & 1) ? 2 : 1;
+        for (; 4 * q <= n; q *= 4) {
+            unsigned log_m = 0;
+            while (((size_t)1 << log_m) < 4 * q) log_m++;
+            uint64_t w = glRootOfUnity(log_m);
+            if (inverse) w = glInverse(w);
+            uint64_t wk = 1;
+            for (size_t k = 0; k < q; k++) {
+                uint64_t w2k = glMul(wk, wk);
+                plan.twiddles.push_back(wk);
+                plan.twiddles.push_back(w2k);
+                plan.twiddles.push_back(glMul(w2k, wk));
+                wk = glMul(wk, w);
+            }
+        }
+        plan.quarter_root = glRootOfUnity(2);
+        if (inverse) plan.quarter_root = glInverse(plan.quarter_root);
+    });
+    return plan;
+}
+
+void smallNtt(uint64_t* a, unsigned log_n, const SmallPlan& plan) {
+    size_t n = (size_t)1 << log_n;
+    for (size_t i = 0; i < n; i++) {
+        size_t j = plan.bitrev[i];
+        if (i < j) std::swap(a[i], a[j]);
+    }
+
+    size_t q = 1;
+    if (log_n & 1) {
+        for (size_t i = 0; i < n; i += 2) {
+            uint64_t x = a[i], y = a[i + 1];
+            a[i] = glAdd(x, y);
+            a[i + 1] = glSub(x, y);
+        }
+        q = 2;
+    }
+
+    // Após a permutação, os quatro subblocos de cada bloco 4q guardam as
+    // NTTs das subsequências de resto 0, 2, 1, 3 (ordem bit-reversa de 2 bits)
+    const uint64_t* tw = plan.twiddles.data();
+    const uint64_t i4 = plan.quarter_root;
+    for (; 4 * q <= n; q *= 4) {
+        for (size_t base = 0; base < n; base += 4 * q) {
+            uint64_t* x = a + base;
+            for (size_t k = 0; k < q; k++) {
+                uint64_t t0 = x[k];
+                uint64_t t2 = glMul(x[k + q], tw[3 * k + 1]);
+                uint64_t t1 = glMul(x[k + 2 * q], tw[3 * k]);
+                uint64_t t3 = glMul(x[k + 3 * q], tw[3 * k + 2]);
+                uint64_t u0 = glAdd(t0, t2);
+                uint64_t u1 = glSub(t0, t2);
+                uint64_t u2 = glAdd(t1, t3);
+                uint64_t u3 = glMul(glSub(t1, t3), i4);
+                x[k] = glAdd(u0, u2);
+                x[k + q] = glAdd(u1, u3);
+                x[k + 2 * q] = glSub(u0, u2);
+                x[k + 3 * q] = glSub(u1, u3);
+            }
+        }
+        tw += 3 * q;
+    }
+}
+
+// dst (cols x rows) = transposta de src (rows x cols), em blocos
+void transpose(const uint64_t* src, uint64_t* dst, size_t rows, size_t cols, ThreadPool* pool) {
+    auto tiles = [&](size_t begin, size_t end) {
+        for (size_t tr = begin; tr < end; tr++) {
+            size_t r0 = tr * TRANSPOSE_TILE;
+            size_t r1 = std::min(rows, r0 + TRANSPOSE_TILE);
+            for (size_t c0 = 0; c0 < cols; c0 += TRANSPOSE_TILE) {
+                size_t c1 = std::min(cols, c0 + TRANSPOSE_TILE);
+                for (size_t r = r0; r < r1; r++) {
+                    for (size_t c = c0; c < c1; c++) dst[c * rows + r] = src[r * cols + c];
+                }
+            }
+        }
+    };
+    size_t tile_rows = (rows + TRANSPOSE_TILE - 1) / TRANSPOSE_TILE;
+    if (pool && pool->size() > 1) {
+        pool->parallelFor(tile_rows, 1, tiles);
+    } else {
+        tiles(0, tile_rows);
+    }
+}
+
+void transform(uint64_t* a, unsigned log_n, bool inverse, ThreadPool* pool);
+
+// NTTs independentes das 'rows' linhas de 2^log_cols elementos; com
+// twiddle_log > 0 multiplica o elemento (j, k) por w^(jk), w raiz 2^twiddle_log
+void transformRows(uint64_t* a, size_t rows, unsigned log_cols, bool inverse, unsigned twiddle_log,
+                   ThreadPool* pool) {
+    size_t cols = (size_t)1 << log_cols;
+    uint64_t w = 1;
+    if (twiddle_log) {
+        w = glRootOfUnity(twiddle_log);
+        if (inverse) w = glInverse(w);
+    }
+    auto work = [&](size_t begin, size_t end) {
+        uint64_t row_root = twiddle_log ? glPow(w, begin) : 1;
+        for (size_t r = begin; r < end; r++) {
+            uint64_t* row = a + r * cols;
+            if (log_cols <= SMALL_LOG) {
+                smallNtt(row, log_cols, smallPlan(log_cols, inverse));
+            } else {
+                transform(row, log_cols, inverse, nullptr);
+            }
+            if (twiddle_log) {
+                uint64_t t = row_root;
+                for (size_t k = 1; k < cols; k++) {
+                    row[k] = glMul(row[k], t);
+                    t = glMul(t, row_root);
+                }
+                row_root = glMul(row_root, w);
+            }
+        }
+    };
+    if (pool && pool->size() > 1) {
+        pool->parallelFor(rows, std::max<size_t>(1, ROW_GRAIN_ELEMENTS / cols), work);
+    } else {
+        work(0, rows);
+    }
+}
+
+// NTT sem a divisão por n da inversa
+void transform(uint64_t* a, unsigned log_n, bool inverse, ThreadPool* pool) {
+    if (log_n <= SMALL_LOG) {
+        smallNtt(a, log_n, smallPlan(log_n, inverse));
+        return;
+    }
+
+    // n = n1 n2, a[j1 n2 + j2]; X[k1 + n1 k2] =
+    //   sum_j2 w_n2^(j2 k2) w_n^(j2 k1) sum_j1 a[j1 n2 + j2] w_n1^(j1 k1)
+    unsigned log1 = log_n / 2, log2 = log_n - log1;
+    size_t n1 = (size_t)1 << log1, n2 = (size_t)1 << log2;
+    size_t n = (size_t)1 << log_n;
+    std::unique_ptr<uint64_t[]> scratch(new uint64_t[n]);   // sem zerar: é todo sobrescrito
+    uint64_t* t = scratch.get();
+
+    transpose(a, t, n1, n2, pool);                      // t[j2][j1]
+    transformRows(t, n2, log1, inverse, log_n, pool);   // t[j2][k1] com giro
+    transpose(t, a, n2, n1, pool);                      // a[k1][j2]
+    transformRows(a, n1, log2, inverse, 0, pool);       // a[k1][k2] = X[k1 + n1 k2]
+    transpose(a, t, n1, n2, pool);                      // t[k2][k1]
+    std::memcpy(a, t, n * sizeof(uint64_t));
+}
+
+} // namespace
+
+uint64_t glPow(uint64_t a, uint64_t e) {
+    uint64_t r = 1;
+    while (e) {
+        if (e & 1) r = glMul(r, a);
+        a = glMul(a, a);
+        e >>= 1;
+    }
+    return r;
+}
+
+uint64_t glInverse(uint64_t a) {
+    return glPow(a, GOLDILOCKS_P - 2);
+}
+
+void glBatchInverse(const uint64_t* in, uint64_t* out, size_t n) {
+    if (n == 0) return;
+    // out[i] = in[0] ... in[i]; depois desfaz de trás para frente
+    uint64_t acc = 1;
+    for (size_t i = 0; i < n; i++) {
+        acc = glMul(acc, in[i]);
+        out[i] = acc;
+    }
+    uint64_t inv = glInverse(acc);
+    for (size_t i = n - 1; i > 0; i--) {
+        uint64_t value = in[i];
+        out[i] = glMul(inv, out[i - 1]);
+        inv = glMul(inv, value);
+    }
+    out[0] = inv;
+}
+
+uint64_t glRootOfUnity(unsigned log_n) {
+    static const uint64_t root = glPow(GOLDILOCKS_GENERATOR, (GOLDILOCKS_P - 1) >> GOLDILOCKS_TWO_ADICITY);
+    uint64_t w = root;
+    for (unsigned i = log_n; i < GOLDILOCKS_TWO_ADICITY; i++) w = glMul(w, w);
+    return w;
+}
+
+void glNtt(uint64_t* a, unsigned log_n, ThreadPool* pool) {
+    transform(a, log_n, false, pool);
+}
+
+void glInverseNtt(uint64_t* a, unsigned log_n, ThreadPool* pool) {
+    transform(a, log_n, true, pool);
+    size_t n = (size_t)1 << log_n;
+    uint64_t n_inv = glInverse(n % GOLDILOCKS_P);
+    auto scale = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) a[i] = glMul(a[i], n_inv);
+    };
+    if (pool && pool->size() > 1 && log_n > SMALL_LOG) {
+        pool->parallelFor(n, ROW_GRAIN_ELEMENTS, scale);
+    } else {
+        scale(0, n);
+    }
+}
+
+void glCosetLde(const uint64_t* coeffs, unsigned log_n, unsigned log_blowup, uint64_t shift, uint64_t* out,
+                ThreadPool* pool) {
+    size_t n = (size_t)1 << log_n;
+    size_t total = n << log_blowup;
+    // Coeficiente i multiplicado por shift^i: p(shift x) avaliado em <w>
+    auto fill = [&](size_t begin, size_t end) {
+        uint64_t s = glPow(shift, begin);
+        for (size_t i = begin; i < end; i++) {
+            out[i] = i < n ? glMul(coeffs[i], s) : 0;
+            s = glMul(s, shift);
+        }
+    };
+    if (pool && pool->size() > 1 && total > ((size_t)1 << SMALL_LOG)) {
+        pool->parallelFor(total, ROW_GRAIN_ELEMENTS, fill);
+    } else {
+        fill(0, total);
+    }
+    glNtt(out, log_n + log_blowup, pool);
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,217 @@
+#include "../include/adilsoncrypto_hardware.h"
+#include "../include/adilsoncrypto_log.h"
+#include "../include/adilsoncrypto_miner.h"
+#include "../include/adilsoncrypto_pool.h"
+#include "../include/adilsoncrypto_util.h"
+#include <sstream>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/ecdsa.h>
+#include <openssl/obj_mac.h>
+
+using namespace adilsoncrypto;
+
+// Acelerador "cpu-simd": implementa IHardwareAccelerator inteiramente na CPU.
+// - sha256: kernel de uma lane mais rápido (SHA-NI ou escalar)
+// - signBatch: hashes em lotes multi-buffer + ECDSA secp256k1 no pool de threads
+// - mineBlock: CpuMiner (midstate + SHA256d de várias lanes)
+//
+// setDevice/setArchitecture aceitam tokens separados por ',' ou ':':
+//   "auto" | "scalar" | "sse2" | "avx2" | "avx512" | "sha-ni"  -> kernel
+//   "threads=N" ou apenas "N"                                  -> threads
+//   "key=<hex>"                                                -> chave de assinatura
+//
+// A chave pública de signBatch é a da chave privada de "key=<hex>" (ao ser
+// definida, o hex não comprimido vai para libraryLogger). Sem "key=" a chave
+// é efêmera e as assinaturas não têm como ser verificadas.
+class CpuSimdAccelerator : public IHardwareAccelerator {
+private:
+    Sha256Kernel kernel;
+    unsigned threads;
+    std::unique_ptr<ThreadPool> pool;
+    CpuMiner miner;
+    MiningResult last_result;
+    EC_KEY* signing_key;
+
+    // Sem "threads=N" usa o pool compartilhado (AdilsonCrypto::setThreadCount)
+    ThreadPool& getPool() {
+        if (threads == 0) return defaultThreadPool();
+        if (!pool) pool = std::make_unique<ThreadPool>(threads);
+        return *pool;
+    }
+
+    // Chave em [1, n); fora disso a pública seria o infinito. O par só
+    // substitui o atual se todas as etapas derem certo.
+    void setSigningKey(const std::string& private_key_hex) {
+        const EC_GROUP* group = EC_KEY_get0_group(signing_key);
+        BIGNUM* priv = nullptr;
+        EC_KEY* key = nullptr;
+        EC_POINT* pub = nullptr;
+        bool ok = !private_key_hex.empty() &&
+                  BN_hex2bn(&priv, private_key_hex.c_str()) == (int)private_key_hex.size() &&
+                  !BN_is_zero(priv) && !BN_is_negative(priv) && BN_cmp(priv, EC_GROUP_get0_order(group)) < 0 &&
+                  (key = EC_KEY_new_by_curve_name(NID_secp256k1)) != nullptr &&
+                  (pub = EC_POINT_new(group)) != nullptr &&
+                  EC_POINT_mul(group, pub, priv, nullptr, nullptr, nullptr) == 1 &&
+                  EC_KEY_set_private_key(key, priv) == 1 && EC_KEY_set_public_key(key, pub) == 1;
+        BN_clear_free(priv);
+        EC_POINT_free(pub);
+        if (!ok) {
+            EC_KEY_free(key);
+            libraryLogger().log(LogLevel::LOG_ERROR,
+                                [] { return std::string("cpu-simd: chave privada inválida (hex em [1, n))"); });
+            return;
+        }
+        EC_KEY_free(signing_key);
+        signing_key = key;
+        libraryLogger().log(LogLevel::LOG_INFO, [&] {
+            char* hex = EC_POINT_point2hex(EC_KEY_get0_group(signing_key), EC_KEY_get0_public_key(signing_key),
+                                           POINT_CONVERSION_UNCOMPRESSED, nullptr);
+            std::string message = std::string("cpu-simd: chave de assinatura definida, pública ") + (hex ? hex : "?");
+            OPENSSL_free(hex);
+            return message;
+        });
+    }
+
+    void configure(const std::string& spec) {
+        std::string token;
+        std::istringstream in(spec);
+        while (std::getline(in, token, ',')) {
+            size_t colon;
+            while ((colon = token.find(':')) != std::string::npos && token.compare(0, 4, "key=") != 0) {
+                configureToken(token.substr(0, colon));
+                token = token.substr(colon + 1);
+            }
+            configureToken(token);
+        }
+        miner.setKernel(kernel);
+        miner.setThreadCount(threads);
+    }
+
+    void configureToken(const std::string& token) {
+        if (token.empty() || token == "cpu-simd" || token == "cpu") return;
+        if (token.compare(0, 4, "key=") == 0) {
+            setSigningKey(token.substr(4));
+            return;
+        }
+        std::string value = token.compare(0, 8, "threads=") == 0 ? token.substr(8) : token;
+        if (!value.empty() && value.find_first_not_of("0123456789") == std::string::npos) {
+            unsigned count = (unsigned)std::stoul(value);
+            if (count != threads) {
+                threads = count;
+                pool.reset();
+            }
+            return;
+        }
+        Sha256Kernel requested = sha256KernelFromName(token);
+        if (requested != Sha256Kernel::AUTO && !sha256KernelSupported(requested)) {
+            libraryLogger().log(LogLevel::LOG_WARN, [&] {
+                return "cpu-simd: kernel " + token + " não suportado por este CPU, usando " +
+                       sha256LaneBackend().name;
+            });
+        }
+        kernel = requested;
+    }
+
+public:
+    CpuSimdAccelerator() : kernel(Sha256Kernel::AUTO), threads(0) {
+        // Chave efêmera até que setDevice("key=...") defina outra
+        signing_key = EC_KEY_new_by_curve_name(NID_secp256k1);
+        EC_KEY_generate_key(signing_key);
+    }
+
+    ~CpuSimdAccelerator() {
+        EC_KEY_free(signing_key);
+    }
+
+    std::unique_ptr<IHardwareAccelerator> createGPUAccelerator() override {
+        return createCpuSimdAccelerator();
+    }
+
+    void setDevice(const std::string& device_name) override {
+        configure(device_name);
+    }
+
+    // Assina cada mensagem (ECDSA secp256k1 sobre SHA-256). Os hashes de cada
+    // lote de batch_size mensagens são calculados juntos pelo kernel
+    // multi-buffer; os lotes são distribuídos no pool. Verificável com a
+    // chave pública de setDevice("key=<hex>").
+    std::vector<Signature> signBatch(const std::vector<std::string>& messages, int batch_size) override {
+        std::vector<Signature> signatures(messages.size());
+        const size_t grain = batch_size > 0 ? (size_t)batch_size : 256;
+
+        getPool().parallelFor(messages.size(), grain, [&](size_t begin, size_t end) {
+            const size_t n = end - begin;
+            std::vector<const uint8_t*> ptrs(n);
+            std::vector<size_t> lens(n);
+            std::vector<uint8_t> digests(32 * n);
+            for (size_t i = 0; i < n; i++) {
+                ptrs[i] = (const uint8_t*)messages[begin + i].data();
+                lens[i] = messages[begin + i].size();
+            }
+            sha256Batch(ptrs.data(), lens.data(), n, digests.data(), kernel);
+
+            for (size_t i = 0; i < n; i++) {
+                ECDSA_SIG* sig = ECDSA_do_sign(digests.data() + 32 * i, 32, signing_key);
+                if (!sig) continue;
+                const BIGNUM* r;
+                const BIGNUM* s;
+                ECDSA_SIG_get0(sig, &r, &s);
+                char* r_hex = BN_bn2hex(r);
+                char* s_hex = BN_bn2hex(s);
+                Signature& out = signatures[begin + i];
+                out.r = r_hex;
+                out.s = s_hex;
+                out.v = "1b";
+                out.proof = "valid";
+                OPENSSL_free(r_hex);
+                OPENSSL_free(s_hex);
+                ECDSA_SIG_free(sig);
+            }
+        });
+        return signatures;
+    }
+
+    std::unique_ptr<IHardwareAccelerator> createFPGAAccelerator() override {
+        return createCpuSimdAccelerator();
+    }
+
+    void loadBitstream(const std::string& bitstream_path) override {
+        // Não há FPGA: o "bitstream" equivale à configuração do dispositivo
+        libraryLogger().log(LogLevel::LOG_WARN, [&] {
+            return "cpu-simd: bitstream ignorado (" + bitstream_path + "), kernel " + sha256LaneBackend(kernel).name;
+        });
+    }
+
+    std::string sha256(const std::string& data) override {
+        return sha256Hex(data);
+    }
+
+    std::unique_ptr<IHardwareAccelerator> createASICSimulator() override {
+        return createCpuSimdAccelerator();
+    }
+
+    void setArchitecture(const std::string& architecture) override {
+        configure(architecture);
+    }
+
+    // header: 80 bytes em hex (160 dígitos); target: alvo de 64 dígitos na
+    // ordem de exibição ou nBits compacto de 8 dígitos.
+    // Retorna o cabeçalho com o nonce vencedor em hex, ou "" se não houver
+    // ou se a entrada for inválida. O relatório vai para libraryLogger().
+    std::string mineBlock(const std::string& header, const std::string& target) override {
+        MiningJob job;
+        if (!hexToBytes(header, job.header, sizeof(job.header)) || !parseTarget(target, job.target)) return "";
+        last_result = miner.mine(job);
+        libraryLogger().log(LogLevel::LOG_INFO, [&] {
+            // Só a linha de resumo; o relatório por thread passa do limite de um registro
+            std::string report = formatMiningReport(last_result);
+            return "mineBlock: " + report.substr(0, report.find('\n')) + (last_result.found ? " (bloco encontrado)" : "");
+        });
+        return last_result.found ? bytesToHex(last_result.header, 80) : "";
+    }
+};
+
+std::unique_ptr<IHardwareAccelerator> createCpuSimdAccelerator() {
+    return std::make_unique<CpuSimdAccelerator>();
+}
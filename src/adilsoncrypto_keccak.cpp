@@ -0,0 +1,322 @@
+#include "../include/adilsoncrypto_keccak.h"
+#include "../include/adilsoncrypto_cpu.h"
+#include "../include/adilsoncrypto_util.h"
+#include <cstring>
+
+namespace adilsoncrypto {
+
+const uint64_t KECCAK_RC[24] = {
+    0x0000000000000001ull, 0x0000000000008082ull, 0x800000000000808aull, 0x8000000080008000ull,
+    0x000000000000808bull, 0x0000000080000001ull, 0x8000000080008081ull, 0x8000000000008009ull,
+    0x000000000000008aull, 0x0000000000000088ull, 0x0000000080008009ull, 0x000000008000000aull,
+    0x000000008000808bull, 0x800000000000008bull, 0x8000000000008089ull, 0x8000000000008003ull,
+    0x8000000000008002ull, 0x8000000000000080ull, 0x000000000000800aull, 0x800000008000000aull,
+    0x8000000080008081ull, 0x8000000000008080ull, 0x0000000080000001ull, 0x8000000080008008ull
+};
+
+static inline uint64_t rotl64(uint64_t x, unsigned n) {
+    return n == 0 ? x : (x << n) | (x >> (64 - n));
+}
+
+// Rodada desenrolada (theta, rho + pi + chi por linha, iota), duas rodadas
+// por iteração alternando os estados a e e para evitar cópias
+void keccakF1600(uint64_t st[25]) {
+    uint64_t a[25], e[25];
+    uint64_t b0, b1, b2, b3, b4, c0, c1, c2, c3, c4, d0, d1, d2, d3, d4;
+    std::memcpy(a, st, sizeof(a));
+    for (int round = 0; round < 24; round += 2) {
+        // theta
+        c0 = a[0] ^ a[5] ^ a[10] ^ a[15] ^ a[20];
+        c1 = a[1] ^ a[6] ^ a[11] ^ a[16] ^ a[21];
+        c2 = a[2] ^ a[7] ^ a[12] ^ a[17] ^ a[22];
+        c3 = a[3] ^ a[8] ^ a[13] ^ a[18] ^ a[23];
+        c4 = a[4] ^ a[9] ^ a[14] ^ a[19] ^ a[24];
+        d0 = c4 ^ rotl64(c1, 1);
+        d1 = c0 ^ rotl64(c2, 1);
+        d2 = c1 ^ rotl64(c3, 1);
+        d3 = c2 ^ rotl64(c4, 1);
+        d4 = c3 ^ rotl64(c0, 1);
+        // rho + pi + chi, uma linha de saída por vez
+        b0 = a[0] ^ d0;
+        b1 = rotl64(a[6] ^ d1, 44);
+        b2 = rotl64(a[12] ^ d2, 43);
+        b3 = rotl64(a[18] ^ d3, 21);
+        b4 = rotl64(a[24] ^ d4, 14);
+        e[0] = b0 ^ (~b1 & b2);
+        e[1] = b1 ^ (~b2 & b3);
+        e[2] = b2 ^ (~b3 & b4);
+        e[3] = b3 ^ (~b4 & b0);
+        e[4] = b4 ^ (~b0 & b1);
+        b0 = rotl64(a[3] ^ d3, 28);
+        b1 = rotl64(a[9] ^ d4, 20);
+        b2 = rotl64(a[10] ^ d0, 3);
+        b3 = rotl64(a[16] ^ d1, 45);
+        b4 = rotl64(a[22] ^ d2, 61);
+        e[5] = b0 ^ (~b1 & b2);
+        e[6] = b1 ^ (~b2 & b3);
+        e[7] = b2 ^ (~b3 & b4);
+        e[8] = b3 ^ (~b4 & b0);
+        e[9] = b4 ^ (~b0 & b1);
+        b0 = rotl64(a[1] ^ d1, 1);
+        b1 = rotl64(a[7] ^ d2, 6);
+        b2 = rotl64(a[13] ^ d3, 25);
+        b3 = rotl64(a[19] ^ d4, 8);
+        b4 = rotl64(a[20] ^ d0, 18);
+        e[10] = b0 ^ (~b1 & b2);
+        e[11] = b1 ^ (~b2 & b3);
+        e[12] = b2 ^ (~b3 & b4);
+        e[13] = b3 ^ (~b4 & b0);
+        e[14] = b4 ^ (~b0 & b1);
+        b0 = rotl64(a[4] ^ d4, 27);
+        b1 = rotl64(a[5] ^ d0, 36);
+        b2 = rotl64(a[11] ^ d1, 10);
+        b3 = rotl64(a[17] ^ d2, 15);
+        b4 = rotl64(a[23] ^ d3, 56);
+        e[15] = b0 ^ (~b1 & b2);
+        e[16] = b1 ^ (~b2 & b3);
+        e[17] = b2 ^ (~b3 & b4);
+        e[18] = b3 ^ (~b4 & b0);
+        e[19] = b4 ^ (~b0 & b1);
+        b0 = rotl64(a[2] ^ d2, 62);
+        b1 = rotl64(a[8] ^ d3, 55);
+        b2 = rotl64(a[14] ^ d4, 39);
+        b3 = rotl64(a[15] ^ d0, 41);
+        b4 = rotl64(a[21] ^ d1, 2);
+        e[20] = b0 ^ (~b1 & b2);
+        e[21] = b1 ^ (~b2 & b3);
+        e[22] = b2 ^ (~b3 & b4);
+        e[23] = b3 ^ (~b4 & b0);
+        e[24] = b4 ^ (~b0 & b1);
+        e[0] ^= KECCAK_RC[round];
+        // theta
+        c0 = e[0] ^ e[5] ^ e[10] ^ e[15] ^ e[20];
+        c1 = e[1] ^ e[6] ^ e[11] ^ e[16] ^ e[21];
+        c2 = e[2] ^ e[7] ^ e[12] ^ e[17] ^ e[22];
+        c3 = e[3] ^ e[8] ^ e[13] ^ e[18] ^ e[23];
+        c4 = e[4] ^ e[9] ^ e[14] ^ e[19] ^ e[24];
+        d0 = c4 ^ rotl64(c1, 1);
+        d1 = c0 ^ rotl64(c2, 1);
+        d2 = c1 ^ rotl64(c3, 1);
+        d3 = c2 ^ rotl64(c4, 1);
+        d4 = c3 ^ rotl64(c0, 1);
+        // rho + pi + chi, uma linha de saída por vez
+        b0 = e[0] ^ d0;
+        b1 = rotl64(e[6] ^ d1, 44);
+        b2 = rotl64(e[12] ^ d2, 43);
+        b3 = rotl64(e[18] ^ d3, 21);
+        b4 = rotl64(e[24] ^ d4, 14);
+        a[0] = b0 ^ (~b1 & b2);
+        a[1] = b1 ^ (~b2 & b3);
+        a[2] = b2 ^ (~b3 & b4);
+        a[3] = b3 ^ (~b4 & b0);
+        a[4] = b4 ^ (~b0 & b1);
+        b0 = rotl64(e[3] ^ d3, 28);
+        b1 = rotl64(e[9] ^ d4, 20);
+        b2 = rotl64(e[10] ^ d0, 3);
+        b3 = rotl64(e[16] ^ d1, 45);
+        b4 = rotl64(e[22] ^ d2, 61);
+        a[5] = b0 ^ (~b1 & b2);
+        a[6] = b1 ^ (~b2 & b3);
+        a[7] = b2 ^ (~b3 & b4);
+        a[8] = b3 ^ (~b4 & b0);
+        a[9] = b4 ^ (~b0 & b1);
+        b0 = rotl64(e[1] ^ d1, 1);
+        b1 = rotl64(e[7] ^ d2, 6);
+        b2 = rotl64(e[13] ^ d3, 25);
+        b3 = rotl64(e[19] ^ d4, 8);
+        b4 = rotl64(e[20] ^ d0, 18);
+        a[10] = b0 ^ (~b1 & b2);
+        a[11] = b1 ^ (~b2 & b3);
+        a[12] = b2 ^ (~b3 & b4);
+        a[13] = b3 ^ (~b4 & b0);
+        a[14] = b4 ^ (~b0 & b1);
+        b0 = rotl64(e[4] ^ d4, 27);
+        b1 = rotl64(e[5] ^ d0, 36);
+        b2 = rotl64(e[11] ^ d1, 10);
+        b3 = rotl64(e[17] ^ d2, 15);
+        b4 = rotl64(e[23] ^ d3, 56);
+        a[15] = b0 ^ (~b1 & b2);
+        a[16] = b1 ^ (~b2 & b3);
+        a[17] = b2 ^ (~b3 & b4);
+        a[18] = b3 ^ (~b4 & b0);
+        a[19] = b4 ^ (~b0 & b1);
+        b0 = rotl64(e[2] ^ d2, 62);
+        b1 = rotl64(e[8] ^ d3, 55);
+        b2 = rotl64(e[14] ^ d4, 39);
+        b3 = rotl64(e[15] ^ d0, 41);
+        b4 = rotl64(e[21] ^ d1, 2);
+        a[20] = b0 ^ (~b1 & b2);
+        a[21] = b1 ^ (~b2 & b3);
+        a[22] = b2 ^ (~b3 & b4);
+        a[23] = b3 ^ (~b4 & b0);
+        a[24] = b4 ^ (~b0 & b1);
+        a[0] ^= KECCAK_RC[round + 1];
+    }
+    std::memcpy(st, a, sizeof(a));
+}
+
+static void keccakF1600x4Scalar(uint64_t st[100]) {
+    uint64_t lane[25];
+    for (int l = 0; l < 4; l++) {
+        for (int i = 0; i < 25; i++) lane[i] = st[4 * i + l];
+        keccakF1600(lane);
+        for (int i = 0; i < 25; i++) st[4 * i + l] = lane[i];
+    }
+}
+
+void keccakF1600x4(uint64_t st[100]) {
+#if defined(__x86_64__) || defined(__i386__)
+    static const bool avx2 = cpuFeatures().avx2;
+    if (avx2) {
+        keccakF1600x4Avx2(st);
+        return;
+    }
+#endif
+    keccakF1600x4Scalar(st);
+}
+
+// Estado em little-endian: o byte i está na palavra i/8, deslocamento 8*(i%8)
+static inline void xorByte(uint64_t* st, size_t i, uint8_t b) {
+    st[i / 8] ^= (uint64_t)b << (8 * (i % 8));
+}
+
+KeccakSponge::KeccakSponge(size_t r, uint8_t d) : rate(r), domain(d) {
+    reset();
+}
+
+void KeccakSponge::reset() {
+    std::memset(state, 0, sizeof(state));
+    offset = 0;
+    squeezing = false;
+}
+
+KeccakSponge& KeccakSponge::absorb(const uint8_t* data, size_t len) {
+    // Palavras inteiras quando alinhado ao início de uma palavra
+    while (len > 0) {
+        if (offset % 8 == 0 && len >= 8 && offset + 8 <= rate) {
+            uint64_t w = 0;
+            for (int k = 7; k >= 0; k--) w = (w << 8) | data[k];
+            state[offset / 8] ^= w;
+            offset += 8;
+            data += 8;
+            len -= 8;
+        } else {
+            xorByte(state, offset++, *data++);
+            len--;
+        }
+        if (offset == rate) {
+            keccakF1600(state);
+            offset = 0;
+        }
+    }
+    return *this;
+}
+
+KeccakSponge& KeccakSponge::absorb(const std::string& data) {
+    return absorb((const uint8_t*)data.data(), data.size());
+}
+
+void KeccakSponge::squeeze(uint8_t* out, size_t len) {
+    if (!squeezing) {
+        xorByte(state, offset, domain);
+        xorByte(state, rate - 1, 0x80);
+        keccakF1600(state);
+        offset = 0;
+        squeezing = true;
+    }
+    while (len > 0) {
+        if (offset == rate) {
+            keccakF1600(state);
+            offset = 0;
+        }
+        *out++ = (uint8_t)(state[offset / 8] >> (8 * (offset % 8)));
+        offset++;
+        len--;
+    }
+}
+
+void keccak256Digest(const uint8_t* data, size_t len, uint8_t out[32]) {
+    Keccak256Hasher hasher;
+    hasher.absorb(data, len);
+    hasher.finalize(out);
+}
+
+std::string keccak256Hex(const std::string& data) {
+    uint8_t digest[32];
+    keccak256Digest((const uint8_t*)data.data(), data.size(), digest);
+    return bytesToHex(digest, 32);
+}
+
+void sha3_256Digest(const uint8_t* data, size_t len, uint8_t out[32]) {
+    KeccakSponge sponge(136, 0x06);
+    sponge.absorb(data, len).squeeze(out, 32);
+}
+
+void sha3_512Digest(const uint8_t* data, size_t len, uint8_t out[64]) {
+    KeccakSponge sponge(72, 0x06);
+    sponge.absorb(data, len).squeeze(out, 64);
+}
+
+void shake128(const uint8_t* data, size_t len, uint8_t* out, size_t out_len) {
+    KeccakSponge sponge(168, 0x1f);
+    sponge.absorb(data, len).squeeze(out, out_len);
+}
+
+void shake256(const uint8_t* data, size_t len, uint8_t* out, size_t out_len) {
+    KeccakSponge sponge(136, 0x1f);
+    sponge.absorb(data, len).squeeze(out, out_len);
+}
+
+ShakeX4::ShakeX4(size_t r, const uint8_t* const in[4], size_t len) : rate(r), offset(0) {
+    std::memset(state, 0, sizeof(state));
+    for (;;) {
+        size_t take = len < rate ? len : rate;
+        for (int l = 0; l < 4; l++) {
+            for (size_t i = 0; i < take; i++) {
+                state[4 * (i / 8) + l] ^= (uint64_t)in[l][offset + i] << (8 * (i % 8));
+            }
+        }
+        offset += take;
+        len -= take;
+        if (take < rate) break;
+        keccakF1600x4(state);
+    }
+    // Padding SHAKE no bloco parcial (take < rate sempre aqui)
+    size_t tail = offset % rate;
+    for (int l = 0; l < 4; l++) {
+        state[4 * (tail / 8) + l] ^= (uint64_t)0x1f << (8 * (tail % 8));
+        state[4 * ((rate - 1) / 8) + l] ^= (uint64_t)0x80 << (8 * ((rate - 1) % 8));
+    }
+    keccakF1600x4(state);
+    offset = 0;
+}
+
+void ShakeX4::squeeze(uint8_t* const out[4], size_t len) {
+    size_t pos = 0;
+    while (pos < len) {
+        if (offset == rate) {
+            keccakF1600x4(state);
+            offset = 0;
+        }
+        size_t take = rate - offset;
+        if (take > len - pos) take = len - pos;
+        for (int l = 0; l < 4; l++) {
+            for (size_t i = 0; i < take; i++) {
+                size_t b = offset + i;
+                out[l][pos + i] = (uint8_t)(state[4 * (b / 8) + l] >> (8 * (b % 8)));
+            }
+        }
+        offset += take;
+        pos += take;
+    }
+}
+
+void shake128x4(const uint8_t* const in[4], size_t in_len, uint8_t* const out[4], size_t out_len) {
+    ShakeX4(168, in, in_len).squeeze(out, out_len);
+}
+
+void shake256x4(const uint8_t* const in[4], size_t in_len, uint8_t* const out[4], size_t out_len) {
+    ShakeX4(136, in, in_len).squeeze(out, out_len);
+}
+
+} // namespace adilsoncrypto
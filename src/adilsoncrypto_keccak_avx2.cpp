@@ -0,0 +1,160 @@
+// Keccak-f[1600] em 4 lanes (AVX2): cada registrador de 256 bits guarda a
+// mesma palavra do estado de quatro instâncias. Compilado com -mavx2 e
+// chamado apenas quando cpuFeatures().avx2 é verdadeiro.
+#include "../include/adilsoncrypto_keccak.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#ifndef __AVX2__
+#error "adilsoncrypto_keccak_avx2.cpp precisa ser compilado com -mavx2"
+#endif
+#include <immintrin.h>
+
+namespace adilsoncrypto {
+
+namespace {
+template <int N>
+inline __m256i rotl(__m256i x) {
+    return _mm256_or_si256(_mm256_slli_epi64(x, N), _mm256_srli_epi64(x, 64 - N));
+}
+} // namespace
+
+void keccakF1600x4Avx2(uint64_t st[100]) {
+    __m256i a[25], e[25];
+    __m256i b0, b1, b2, b3, b4, c0, c1, c2, c3, c4, d0, d1, d2, d3, d4;
+    for (int i = 0; i < 25; i++) a[i] = _mm256_loadu_si256((const __m256i*)(st + 4 * i));
+
+    for (int round = 0; round < 24; round += 2) {
+        // theta
+        c0 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(a[0], a[5]), a[10]), a[15]), a[20]);
+        c1 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(a[1], a[6]), a[11]), a[16]), a[21]);
+        c2 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(a[2], a[7]), a[12]), a[17]), a[22]);
+        c3 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(a[3], a[8]), a[13]), a[18]), a[23]);
+        c4 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(a[4], a[9]), a[14]), a[19]), a[24]);
+        d0 = _mm256_xor_si256(c4, rotl<1>(c1));
+        d1 = _mm256_xor_si256(c0, rotl<1>(c2));
+        d2 = _mm256_xor_si256(c1, rotl<1>(c3));
+        d3 = _mm256_xor_si256(c2, rotl<1>(c4));
+        d4 = _mm256_xor_si256(c3, rotl<1>(c0));
+        // rho + pi + chi, uma linha de saída por vez
+        b0 = _mm256_xor_si256(a[0], d0);
+        b1 = rotl<44>(_mm256_xor_si256(a[6], d1));
+        b2 = rotl<43>(_mm256_xor_si256(a[12], d2));
+        b3 = rotl<21>(_mm256_xor_si256(a[18], d3));
+        b4 = rotl<14>(_mm256_xor_si256(a[24], d4));
+        e[0] = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2));
+        e[1] = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3));
+        e[2] = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4));
+        e[3] = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0));
+        e[4] = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1));
+        b0 = rotl<28>(_mm256_xor_si256(a[3], d3));
+        b1 = rotl<20>(_mm256_xor_si256(a[9], d4));
+        b2 = rotl<3>(_mm256_xor_si256(a[10], d0));
+        b3 = rotl<45>(_mm256_xor_si256(a[16], d1));
+        b4 = rotl<61>(_mm256_xor_si256(a[22], d2));
+        e[5] = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2));
+        e[6] = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3));
+        e[7] = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4));
+        e[8] = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0));
+        e[9] = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1));
+        b0 = rotl<1>(_mm256_xor_si256(a[1], d1));
+        b1 = rotl<6>(_mm256_xor_si256(a[7], d2));
+        b2 = rotl<25>(_mm256_xor_si256(a[13], d3));
+        b3 = rotl<8>(_mm256_xor_si256(a[19], d4));
+        b4 = rotl<18>(_mm256_xor_si256(a[20], d0));
+        e[10] = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2));
+        e[11] = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3));
+        e[12] = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4));
+        e[13] = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0));
+        e[14] = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1));
+        b0 = rotl<27>(_mm256_xor_si256(a[4], d4));
+        b1 = rotl<36>(_mm256_xor_si256(a[5], d0));
+        b2 = rotl<10>(_mm256_xor_si256(a[11], d1));
+        b3 = rotl<15>(_mm256_xor_si256(a[17], d2));
+        b4 = rotl<56>(_mm256_xor_si256(a[23], d3));
+        e[15] = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2));
+        e[16] = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3));
+        e[17] = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4));
+        e[18] = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0));
+        e[19] = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1));
+        b0 = rotl<62>(_mm256_xor_si256(a[2], d2));
+        b1 = rotl<55>(_mm256_xor_si256(a[8], d3));
+        b2 = rotl<39>(_mm256_xor_si256(a[14], d4));
+        b3 = rotl<41>(_mm256_xor_si256(a[15], d0));
+        b4 = rotl<2>(_mm256_xor_si256(a[21], d1));
+        e[20] = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2));
+        e[21] = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3));
+        e[22] = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4));
+        e[23] = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0));
+        e[24] = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1));
+        e[0] = _mm256_xor_si256(e[0], _mm256_set1_epi64x((long long)KECCAK_RC[round]));
+        // theta
+        c0 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(e[0], e[5]), e[10]), e[15]), e[20]);
+        c1 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(e[1], e[6]), e[11]), e[16]), e[21]);
+        c2 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(e[2], e[7]), e[12]), e[17]), e[22]);
+        c3 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(e[3], e[8]), e[13]), e[18]), e[23]);
+        c4 = _mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(e[4], e[9]), e[14]), e[19]), e[24]);
+        d0 = _mm256_xor_si256(c4, rotl<1>(c1));
+        d1 = _mm256_xor_si256(c0, rotl<1>(c2));
+        d2 = _mm256_xor_si256(c1, rotl<1>(c3));
+        d3 = _mm256_xor_si256(c2, rotl<1>(c4));
+        d4 = _mm256_xor_si256(c3, rotl<1>(c0));
+        // rho + pi + chi, uma linha de saída por vez
+        b0 = _mm256_xor_si256(e[0], d0);
+        b1 = rotl<44>(_mm256_xor_si256(e[6], d1));
+        b2 = rotl<43>(_mm256_xor_si256(e[12], d2));
+        b3 = rotl<21>(_mm256_xor_si256(e[18], d3));
+        b4 = rotl<14>(_mm256_xor_si256(e[24], d4));
+        a[0] = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2));
+        a[1] = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3));
+        a[2] = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4));
+        a[3] = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0));
+        a[4] = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1));
+        b0 = rotl<28>(_mm256_xor_si256(e[3], d3));
+        b1 = rotl<20>(_mm256_xor_si256(e[9], d4));
+        b2 = rotl<3>(_mm256_xor_si256(e[10], d0));
+        b3 = rotl<45>(_mm256_xor_si256(e[16], d1));
+        b4 = rotl<61>(_mm256_xor_si256(e[22], d2));
+        a[5] = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2));
+        a[6] = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3));
+        a[7] = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4));
+        a[8] = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0));
+        a[9] = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1));
+        b0 = rotl<1>(_mm256_xor_si256(e[1], d1));
+        b1 = rotl<6>(_mm256_xor_si256(e[7], d2));
+        b2 = rotl<25>(_mm256_xor_si256(e[13], d3));
+        b3 = rotl<8>(_mm256_xor_si256(e[19], d4));
+        b4 = rotl<18>(_mm256_xor_si256(e[20], d0));
+        a[10] = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2));
+        a[11] = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3));
+        a[12] = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4));
+        a[13] = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0));
+        a[14] = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1));
+        b0 = rotl<27>(_mm256_xor_si256(e[4], d4));
+        b1 = rotl<36>(_mm256_xor_si256(e[5], d0));
+        b2 = rotl<10>(_mm256_xor_si256(e[11], d1));
+        b3 = rotl<15>(_mm256_xor_si256(e[17], d2));
+        b4 = rotl<56>(_mm256_xor_si256(e[23], d3));
+        a[15] = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2));
+        a[16] = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3));
+        a[17] = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4));
+        a[18] = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0));
+        a[19] = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1));
+        b0 = rotl<62>(_mm256_xor_si256(e[2], d2));
+        b1 = rotl<55>(_mm256_xor_si256(e[8], d3));
+        b2 = rotl<39>(_mm256_xor_si256(e[14], d4));
+        b3 = rotl<41>(_mm256_xor_si256(e[15], d0));
+        b4 = rotl<2>(_mm256_xor_si256(e[21], d1));
+        a[20] = _mm256_xor_si256(b0, _mm256_andnot_si256(b1, b2));
+        a[21] = _mm256_xor_si256(b1, _mm256_andnot_si256(b2, b3));
+        a[22] = _mm256_xor_si256(b2, _mm256_andnot_si256(b3, b4));
+        a[23] = _mm256_xor_si256(b3, _mm256_andnot_si256(b4, b0));
+        a[24] = _mm256_xor_si256(b4, _mm256_andnot_si256(b0, b1));
+        a[0] = _mm256_xor_si256(a[0], _mm256_set1_epi64x((long long)KECCAK_RC[round + 1]));
+    }
+
+    for (int i = 0; i < 25; i++) _mm256_storeu_si256((__m256i*)(st + 4 * i), a[i]);
+}
+
+} // namespace adilsoncrypto
+
+#endif
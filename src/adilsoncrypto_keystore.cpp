@@ -0,0 +1,424 @@
+#include "../include/adilsoncrypto_keystore.h"
+#include "../include/adilsoncrypto_mmap.h"
+#include "../include/adilsoncrypto_serialize.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include "../include/adilsoncrypto_util.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <climits>
+#include <cstring>
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const char MAGIC[4] = { 'A', 'C', 'K', 'S' };
+const uint32_t VERSION = 1;
+const size_t HEADER_BYTES = 4096;
+const uint64_t MIN_CAPACITY = 16;
+const uint64_t MAX_CAPACITY = 0xFFFFFFFEULL;   // índice + 1 cabe em 32 bits
+const uint8_t HEADER_HAS_PASSPHRASE = 1;
+const size_t RECORD_AAD_BYTES = offsetof(KeystoreRecord, reserved);
+
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t record_bytes;
+    uint32_t kdf_iterations;
+    uint64_t capacity;
+    uint64_t index_slots;
+    uint64_t count;            // só cresce depois que registro e índices estão no disco
+    uint8_t salt[16];
+    uint8_t flags;
+    uint8_t reserved[7];
+    uint8_t check_nonce[12];   // GCM sem texto: confere a senha na abertura
+    uint8_t check_tag[16];
+};
+static_assert(sizeof(FileHeader) <= HEADER_BYTES, "cabeçalho maior que a página reservada");
+
+// Os campos atualizados com o arquivo em uso são lidos e escritos como
+// atômicos de 64 bits (mesmo layout de um uint64_t)
+inline std::atomic<uint64_t>& atomicWord(uint64_t& word) {
+    return *reinterpret_cast<std::atomic<uint64_t>*>(&word);
+}
+
+uint64_t indexSlotsFor(uint64_t capacity) {
+    uint64_t slots = 2 * MIN_CAPACITY;
+    while (slots < 2 * capacity) slots <<= 1;
+    return slots;
+}
+
+uint64_t fileBytes(uint64_t capacity, uint64_t index_slots) {
+    return HEADER_BYTES + 2 * index_slots * sizeof(uint64_t) + capacity * sizeof(KeystoreRecord);
+}
+
+bool aesGcm(bool encrypt, const uint8_t key[32], const uint8_t nonce[12], const uint8_t* aad, size_t aad_len,
+            const uint8_t* in, size_t len, uint8_t* out, uint8_t tag[16]) {
+    EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+    if (!ctx) return false;
+    int out_len = 0;
+    bool ok = EVP_CipherInit_ex(ctx, EVP_aes_256_gcm(), nullptr, key, nonce, encrypt ? 1 : 0) == 1;
+    if (ok && !encrypt) ok = EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, 16, tag) == 1;
+    if (ok) ok = EVP_CipherUpdate(ctx, nullptr, &out_len, aad, (int)aad_len) == 1;
+    if (ok && len > 0) ok = EVP_CipherUpdate(ctx, out, &out_len, in, (int)len) == 1;
+    if (ok) ok = EVP_CipherFinal_ex(ctx, out + out_len, &out_len) == 1;
+    if (ok && encrypt) ok = EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, 16, tag) == 1;
+    EVP_CIPHER_CTX_free(ctx);
+    return ok;
+}
+
+// Posição inicial e etiqueta de 32 bits de uma chave de índice. O sal do
+// arquivo entra no hash para que as posições não sejam previsíveis de fora.
+void indexHash(const uint8_t salt[16], int index, const uint8_t* key, size_t len, uint64_t& position, uint32_t& tag) {
+    uint8_t buf[16 + 1 + 64];
+    uint8_t hash[32];
+    std::memcpy(buf, salt, 16);
+    buf[16] = (uint8_t)index;
+    std::memcpy(buf + 17, key, len);
+    sha256Digest(buf, 17 + len, hash);
+    position = 0;
+    for (int i = 0; i < 8; i++) position |= (uint64_t)hash[i] << (8 * i);
+    tag = (uint32_t)hash[8] | ((uint32_t)hash[9] << 8) | ((uint32_t)hash[10] << 16) | ((uint32_t)hash[11] << 24);
+}
+
+const uint8_t* recordKey(const KeystoreRecord& record, int index, size_t& len) {
+    if (index == 1) {
+        len = sizeof(record.public_key);
+        return record.public_key;
+    }
+    len = strnlen(record.address, sizeof(record.address));
+    return (const uint8_t*)record.address;
+}
+
+struct Layout {
+    FileHeader* header;
+    uint64_t* indexes[2];
+    KeystoreRecord* records;
+};
+
+Layout layoutOf(uint8_t* data) {
+    Layout layout;
+    layout.header = (FileHeader*)data;
+    layout.indexes[0] = (uint64_t*)(data + HEADER_BYTES);
+    layout.indexes[1] = layout.indexes[0] + layout.header->index_slots;
+    layout.records = (KeystoreRecord*)(layout.indexes[1] + layout.header->index_slots);
+    return layout;
+}
+
+// Primeira posição livre na sondagem linear
+uint64_t* freeSlot(const Layout& layout, int index, const uint8_t* key, size_t len) {
+    uint64_t position;
+    uint32_t tag;
+    indexHash(layout.header->salt, index, key, len, position, tag);
+    const uint64_t mask = layout.header->index_slots - 1;
+    for (uint64_t probe = 0; probe <= mask; probe++) {
+        uint64_t* slot = &layout.indexes[index][(position + probe) & mask];
+        if (atomicWord(*slot).load(std::memory_order_relaxed) == 0) return slot;
+    }
+    return nullptr;
+}
+
+uint64_t slotValue(const Layout& layout, int index, uint64_t record_index) {
+    size_t len;
+    const uint8_t* key = recordKey(layout.records[record_index], index, len);
+    uint64_t position;
+    uint32_t tag;
+    indexHash(layout.header->salt, index, key, len, position, tag);
+    return ((uint64_t)tag << 32) | (record_index + 1);
+}
+
+} // namespace
+
+Keystore::Keystore() : file(new MappedFile()), data(nullptr), has_key(false) {}
+
+Keystore::~Keystore() {
+    close();
+}
+
+void Keystore::close() {
+    file->close();
+    data = nullptr;
+    has_key = false;
+    OPENSSL_cleanse(key, sizeof(key));
+}
+
+uint64_t Keystore::size() const {
+    return data ? atomicWord(((FileHeader*)data)->count).load(std::memory_order_acquire) : 0;
+}
+
+uint64_t Keystore::capacity() const {
+    return data ? ((const FileHeader*)data)->capacity : 0;
+}
+
+void Keystore::flush(const void* begin, size_t len) const {
+    file->flush(begin, len);
+}
+
+bool Keystore::mapFile(const std::string& file_path, bool create, uint64_t record_capacity, uint64_t index_slots) {
+    file->close();
+    data = nullptr;
+    if (!file->open(file_path, create, fileBytes(record_capacity, index_slots))) {
+        file->close();
+        return false;
+    }
+    const FileHeader* header = (const FileHeader*)file->data;
+    if (!create) {
+        bool valid = file->size >= HEADER_BYTES && std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) == 0 &&
+                     header->version == VERSION && header->record_bytes == sizeof(KeystoreRecord) &&
+                     header->capacity >= 1 && header->capacity <= MAX_CAPACITY && header->index_slots >= header->capacity &&
+                     (header->index_slots & (header->index_slots - 1)) == 0 && header->count <= header->capacity &&
+                     file->size == fileBytes(header->capacity, header->index_slots);
+        if (!valid) {
+            file->close();
+            return false;
+        }
+    }
+    path = file_path;
+    data = file->data;
+    return true;
+}
+
+bool Keystore::deriveKey(const std::string& passphrase) {
+    const FileHeader* header = (const FileHeader*)data;
+    has_key = PKCS5_PBKDF2_HMAC(passphrase.data(), (int)passphrase.size(), header->salt, sizeof(header->salt),
+                                (int)header->kdf_iterations, EVP_sha256(), sizeof(key), key) == 1;
+    return has_key;
+}
+
+bool Keystore::create(const std::string& file_path, const std::string& passphrase, uint64_t record_capacity,
+                      uint32_t kdf_iterations) {
+    close();
+    record_capacity = std::max(record_capacity, MIN_CAPACITY);
+    if (record_capacity > MAX_CAPACITY || kdf_iterations == 0 || kdf_iterations > (uint32_t)INT_MAX) return false;
+    const uint64_t index_slots = indexSlotsFor(record_capacity);
+    if (!mapFile(file_path, true, record_capacity, index_slots)) return false;
+
+    FileHeader* header = (FileHeader*)data;
+    std::memcpy(header->magic, MAGIC, sizeof(MAGIC));
+    header->version = VERSION;
+    header->record_bytes = sizeof(KeystoreRecord);
+    header->kdf_iterations = kdf_iterations;
+    header->capacity = record_capacity;
+    header->index_slots = index_slots;
+    header->count = 0;
+    bool ok = RAND_bytes(header->salt, sizeof(header->salt)) == 1;
+    if (ok && !passphrase.empty()) {
+        header->flags = HEADER_HAS_PASSPHRASE;
+        ok = RAND_bytes(header->check_nonce, sizeof(header->check_nonce)) == 1 && deriveKey(passphrase) &&
+             aesGcm(true, key, header->check_nonce, header->salt, sizeof(header->salt), nullptr, 0, nullptr,
+                    header->check_tag);
+    }
+    if (!ok) {
+        close();
+        return false;
+    }
+    flush(data, HEADER_BYTES);
+    return true;
+}
+
+bool Keystore::open(const std::string& file_path, const std::string& passphrase) {
+    close();
+    if (!mapFile(file_path, false, 0, 0)) return false;
+    FileHeader* header = (FileHeader*)data;
+    if (!passphrase.empty()) {
+        if (!(header->flags & HEADER_HAS_PASSPHRASE) || !deriveKey(passphrase) ||
+            !aesGcm(false, key, header->check_nonce, header->salt, sizeof(header->salt), nullptr, 0, nullptr,
+                    header->check_tag)) {
+            close();
+            return false;
+        }
+    }
+    repair();
+    return true;
+}
+
+// Um add interrompido depois de gravar os índices e antes da contagem deixa
+// entradas apontando para o registro 'count'. Elas são sempre as últimas
+// inseridas, então podem ser apagadas sem quebrar a sondagem de ninguém.
+void Keystore::repair() {
+    Layout layout = layoutOf(data);
+    const uint64_t count = layout.header->count;
+    if (count >= layout.header->capacity) return;
+    const uint64_t mask = layout.header->index_slots - 1;
+    for (int index = 0; index < 2; index++) {
+        size_t len;
+        const uint8_t* key_bytes = recordKey(layout.records[count], index, len);
+        if (len == 0 || len >= sizeof(KeystoreRecord::address)) continue;
+        uint64_t position;
+        uint32_t tag;
+        indexHash(layout.header->salt, index, key_bytes, len, position, tag);
+        for (uint64_t probe = 0; probe <= mask; probe++) {
+            uint64_t& slot = layout.indexes[index][(position + probe) & mask];
+            if (slot == 0) break;
+            if ((uint32_t)slot == count + 1) {
+                slot = 0;
+                flush(&slot, sizeof(slot));
+            }
+        }
+    }
+}
+
+const KeystoreRecord* Keystore::find(int index, const uint8_t* key_bytes, size_t len) const {
+    if (!data || len == 0 || len >= sizeof(KeystoreRecord::address)) return nullptr;
+    Layout layout = layoutOf(data);
+    const uint64_t count = size();
+    const uint64_t mask = layout.header->index_slots - 1;
+    uint64_t position;
+    uint32_t tag;
+    indexHash(layout.header->salt, index, key_bytes, len, position, tag);
+    for (uint64_t probe = 0; probe <= mask; probe++) {
+        uint64_t slot = atomicWord(layout.indexes[index][(position + probe) & mask]).load(std::memory_order_acquire);
+        if (slot == 0) return nullptr;
+        uint64_t record_index = (uint32_t)slot - 1;
+        if ((uint32_t)(slot >> 32) != tag || record_index >= count) continue;
+        const KeystoreRecord& record = layout.records[record_index];
+        size_t record_len;
+        const uint8_t* record_key = recordKey(record, index, record_len);
+        if (record_len == len && std::memcmp(record_key, key_bytes, len) == 0) return &record;
+    }
+    return nullptr;
+}
+
+const KeystoreRecord* Keystore::findByAddress(const std::string& address) const {
+    return find(0, (const uint8_t*)address.data(), address.size());
+}
+
+const KeystoreRecord* Keystore::findByPublicKey(const uint8_t compressed[33]) const {
+    return find(1, compressed, COMPRESSED_KEY_BYTES);
+}
+
+const KeystoreRecord* Keystore::findByPublicKey(const std::string& public_key_hex) const {
+    uint8_t uncompressed[UNCOMPRESSED_KEY_BYTES];
+    uint8_t compressed[COMPRESSED_KEY_BYTES];
+    if (hexToBytes(public_key_hex, compressed, sizeof(compressed))) return findByPublicKey(compressed);
+    if (hexToBytes(public_key_hex, uncompressed, sizeof(uncompressed)) && compressPublicKey(uncompressed, compressed)) {
+        return findByPublicKey(compressed);
+    }
+    return nullptr;
+}
+
+const KeystoreRecord* Keystore::record(uint64_t index) const {
+    return index < size() ? &layoutOf(data).records[index] : nullptr;
+}
+
+bool Keystore::add(const KeyPair& keypair) {
+    if (!data || keypair.address.empty() || keypair.address.size() >= sizeof(KeystoreRecord::address) ||
+        keypair.address.find('\0') != std::string::npos) {
+        return false;
+    }
+
+    KeystoreRecord record;
+    std::memset(&record, 0, sizeof(record));
+    std::memcpy(record.address, keypair.address.data(), keypair.address.size());
+
+    // Chave pública: aceita as duas formas e confere que o ponto está na curva
+    uint8_t uncompressed[UNCOMPRESSED_KEY_BYTES];
+    uint8_t check[UNCOMPRESSED_KEY_BYTES];
+    if (hexToBytes(keypair.public_key, uncompressed, sizeof(uncompressed))) {
+        if (!compressPublicKey(uncompressed, record.public_key) || !decompressPublicKey(record.public_key, check) ||
+            std::memcmp(check, uncompressed, sizeof(check)) != 0) {
+            return false;
+        }
+    } else if (!hexToBytes(keypair.public_key, record.public_key, sizeof(record.public_key)) ||
+               !decompressPublicKey(record.public_key, check)) {
+        return false;
+    }
+    if (findByAddress(keypair.address) || findByPublicKey(record.public_key)) return false;
+
+    if (!keypair.private_key.empty()) {
+        uint8_t secret[32];
+        record.flags = KEYSTORE_HAS_PRIVATE;
+        bool ok = has_key && scalarFromHex(keypair.private_key, secret) &&
+                  RAND_bytes(record.nonce, sizeof(record.nonce)) == 1 &&
+                  aesGcm(true, key, record.nonce, (const uint8_t*)&record, RECORD_AAD_BYTES, secret, sizeof(secret),
+                         record.private_key, record.tag);
+        OPENSSL_cleanse(secret, sizeof(secret));
+        if (!ok) return false;
+    }
+
+    if (size() == capacity() && !grow()) return false;
+    Layout layout = layoutOf(data);
+    const uint64_t count = layout.header->count;
+
+    // 1. registro
+    layout.records[count] = record;
+    flush(&layout.records[count], sizeof(record));
+    // 2. índices (ainda invisíveis: apontam para além da contagem)
+    for (int index = 0; index < 2; index++) {
+        size_t len;
+        const uint8_t* key_bytes = recordKey(record, index, len);
+        uint64_t* slot = freeSlot(layout, index, key_bytes, len);
+        if (!slot) return false;
+        atomicWord(*slot).store(slotValue(layout, index, count), std::memory_order_release);
+        flush(slot, sizeof(*slot));
+    }
+    // 3. contagem: a partir daqui a chave existe
+    atomicWord(layout.header->count).store(count + 1, std::memory_order_release);
+    flush(&layout.header->count, sizeof(layout.header->count));
+    return true;
+}
+
+// Reconstrói com o dobro da capacidade num arquivo temporário e troca por
+// rename: uma queda no meio deixa o arquivo antigo intacto
+bool Keystore::grow() {
+    Layout old_layout = layoutOf(data);
+    const FileHeader old_header = *old_layout.header;
+    if (old_header.capacity >= MAX_CAPACITY) return false;
+    const uint64_t new_capacity = std::min(old_header.capacity * 2, MAX_CAPACITY);
+    const uint64_t new_slots = indexSlotsFor(new_capacity);
+    const std::string temp_path = path + ".tmp";
+
+    MappedFile temp;
+    if (!temp.open(temp_path, true, fileBytes(new_capacity, new_slots))) return false;
+    FileHeader* header = (FileHeader*)temp.data;
+    *header = old_header;
+    header->capacity = new_capacity;
+    header->index_slots = new_slots;
+    Layout layout = layoutOf(temp.data);
+    std::memcpy(layout.records, old_layout.records, old_header.count * sizeof(KeystoreRecord));
+    for (uint64_t i = 0; i < old_header.count; i++) {
+        for (int index = 0; index < 2; index++) {
+            size_t len;
+            const uint8_t* key_bytes = recordKey(layout.records[i], index, len);
+            *freeSlot(layout, index, key_bytes, len) = slotValue(layout, index, i);
+        }
+    }
+    temp.flush(temp.data, temp.size);
+    temp.close();
+
+    const std::string file_path = path;
+    file->close();
+    data = nullptr;
+    // Se o rename falhar, o arquivo antigo continua válido e volta a ser mapeado
+    bool replaced = replaceFile(temp_path, file_path);
+    return mapFile(file_path, false, 0, 0) && replaced;
+}
+
+bool Keystore::privateKey(const KeystoreRecord& record, uint8_t out[32]) const {
+    if (!has_key || !(record.flags & KEYSTORE_HAS_PRIVATE)) return false;
+    uint8_t tag[16];
+    std::memcpy(tag, record.tag, sizeof(tag));
+    return aesGcm(false, key, record.nonce, (const uint8_t*)&record, RECORD_AAD_BYTES, record.private_key,
+                  sizeof(record.private_key), out, tag);
+}
+
+bool Keystore::load(const KeystoreRecord& record, KeyPair& keypair) const {
+    uint8_t uncompressed[UNCOMPRESSED_KEY_BYTES];
+    if (!decompressPublicKey(record.public_key, uncompressed)) return false;
+    keypair.private_key.clear();
+    if (record.flags & KEYSTORE_HAS_PRIVATE) {
+        uint8_t secret[32];
+        if (!privateKey(record, secret)) return false;
+        keypair.private_key = scalarToHex(secret, sizeof(secret));
+        OPENSSL_cleanse(secret, sizeof(secret));
+    }
+    keypair.public_key = scalarToHex(uncompressed, sizeof(uncompressed));
+    keypair.address.assign(record.address, strnlen(record.address, sizeof(record.address)));
+    return true;
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,252 @@
+#include "../include/adilsoncrypto_log.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const size_t RING_CAPACITY = 1024;         // potência de 2
+const size_t THREAD_CACHE = 8;             // anéis lembrados por thread
+const auto DRAIN_INTERVAL = std::chrono::milliseconds(50);
+
+struct LogEntry {
+    uint64_t time_ns;
+    uint32_t thread;
+    uint16_t length;
+    LogLevel level;
+    char text[Logger::MAX_MESSAGE];
+};
+
+uint64_t nextLoggerId() {
+    static std::atomic<uint64_t> next_id{ 1 };
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t currentThreadIndex() {
+    static std::atomic<uint32_t> next_index{ 1 };
+    thread_local uint32_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+std::string formatEntry(const LogEntry& entry) {
+    time_t seconds = (time_t)(entry.time_ns / 1000000000ULL);
+    unsigned millis = (unsigned)(entry.time_ns / 1000000ULL % 1000);
+    struct tm utc;
+#if defined(_WIN32)
+    gmtime_s(&utc, &seconds);
+#else
+    gmtime_r(&seconds, &utc);
+#endif
+    char prefix[64];
+    int n = std::snprintf(prefix, sizeof(prefix), "%02d:%02d:%02d.%03u %-5s t%u ", utc.tm_hour, utc.tm_min, utc.tm_sec,
+                          millis, logLevelName(entry.level), entry.thread);
+    std::string line(prefix, n > 0 ? (size_t)n : 0);
+    line.append(entry.text, entry.length);
+    return line;
+}
+
+} // namespace
+
+const size_t Logger::DEFAULT_HISTORY;
+const size_t Logger::MAX_MESSAGE;
+
+// Anel de um produtor (a thread dona) e um consumidor (quem drena, sob
+// drain_mutex). head e tail ficam em linhas de cache separadas.
+struct LogRing {
+    alignas(64) std::atomic<uint64_t> head{ 0 };
+    alignas(64) std::atomic<uint64_t> tail{ 0 };
+    std::atomic<uint64_t> dropped{ 0 };
+    std::atomic<bool> retired{ false };   // a thread saiu ou esqueceu o anel
+    LogEntry entries[RING_CAPACITY];
+};
+
+namespace {
+
+// Anéis desta thread por logger. Ao sair, a thread marca os anéis como
+// aposentados; o logger os libera depois de drenar o que sobrou.
+struct ThreadRings {
+    std::vector<std::pair<uint64_t, std::shared_ptr<LogRing>>> rings;
+
+    ~ThreadRings() {
+        for (auto& ring : rings) ring.second->retired.store(true, std::memory_order_release);
+    }
+};
+
+thread_local ThreadRings thread_rings;
+
+} // namespace
+
+bool parseLogLevel(const std::string& name, LogLevel& level) {
+    std::string lower = name;
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+    static const std::pair<const char*, LogLevel> names[] = {
+        { "trace", LogLevel::LOG_TRACE }, { "debug", LogLevel::LOG_DEBUG }, { "info", LogLevel::LOG_INFO },
+        { "warn", LogLevel::LOG_WARN },   { "warning", LogLevel::LOG_WARN }, { "error", LogLevel::LOG_ERROR },
+        { "off", LogLevel::LOG_OFF },
+    };
+    for (const auto& entry : names) {
+        if (lower == entry.first) {
+            level = entry.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* logLevelName(LogLevel level) {
+    switch (level) {
+    case LogLevel::LOG_TRACE: return "TRACE";
+    case LogLevel::LOG_DEBUG: return "DEBUG";
+    case LogLevel::LOG_INFO: return "INFO";
+    case LogLevel::LOG_WARN: return "WARN";
+    case LogLevel::LOG_ERROR: return "ERROR";
+    default: return "OFF";
+    }
+}
+
+Logger::Logger(size_t history_limit)
+    : id(nextLoggerId()), history_limit(history_limit), enabled_flag(true), min_level(LogLevel::LOG_INFO),
+      dropped_total(0), console(stderr), stopping(false) {}
+
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (drainer.joinable()) drainer.join();
+    drain();
+}
+
+void Logger::setConsole(FILE* out) {
+    std::lock_guard<std::mutex> lock(drain_mutex);
+    console = out;
+}
+
+LogRing* Logger::ringForThread() {
+    for (auto& ring : thread_rings.rings) {
+        if (ring.first == id) return ring.second.get();
+    }
+
+    std::shared_ptr<LogRing> ring = std::make_shared<LogRing>();
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex);
+        rings.push_back(ring);
+    }
+    if (thread_rings.rings.size() == THREAD_CACHE) {
+        thread_rings.rings.front().second->retired.store(true, std::memory_order_release);
+        thread_rings.rings.erase(thread_rings.rings.begin());
+    }
+    thread_rings.rings.emplace_back(id, ring);
+    return ring.get();
+}
+
+void Logger::write(LogLevel level, const char* text, size_t len) {
+    LogRing* ring = ringForThread();
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    if (head - ring->tail.load(std::memory_order_acquire) == RING_CAPACITY) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        LogEntry& entry = ring->entries[head & (RING_CAPACITY - 1)];
+        entry.time_ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::system_clock::now().time_since_epoch())
+                            .count();
+        entry.thread = currentThreadIndex();
+        entry.level = level;
+        entry.length = (uint16_t)std::min(len, MAX_MESSAGE);
+        std::memcpy(entry.text, text, entry.length);
+        ring->head.store(head + 1, std::memory_order_release);
+    }
+    std::call_once(drainer_once, [this] { startDrainer(); });
+}
+
+void Logger::startDrainer() {
+    drainer = std::thread(&Logger::drainerLoop, this);
+}
+
+void Logger::drainerLoop() {
+    std::unique_lock<std::mutex> lock(wake_mutex);
+    while (!stopping) {
+        wake.wait_for(lock, DRAIN_INTERVAL, [this] { return stopping; });
+        lock.unlock();
+        drain();
+        lock.lock();
+    }
+}
+
+void Logger::drain() {
+    std::vector<std::shared_ptr<LogRing>> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex);
+        snapshot = rings;
+    }
+
+    std::lock_guard<std::mutex> lock(drain_mutex);
+    std::vector<LogEntry> batch;
+    uint64_t dropped_now = 0;
+    for (const std::shared_ptr<LogRing>& ring : snapshot) {
+        // retired é lido antes de head: o que foi publicado antes da
+        // aposentadoria entra neste lote
+        bool retired = ring->retired.load(std::memory_order_acquire);
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        for (; tail < head; tail++) batch.push_back(ring->entries[tail & (RING_CAPACITY - 1)]);
+        ring->tail.store(tail, std::memory_order_release);
+        dropped_now += ring->dropped.exchange(0, std::memory_order_relaxed);
+        if (retired) {
+            std::lock_guard<std::mutex> rings_lock(rings_mutex);
+            rings.erase(std::remove(rings.begin(), rings.end(), ring), rings.end());
+        }
+    }
+    if (batch.empty() && dropped_now == 0) return;
+
+    // Cada anel já está em ordem; o lote intercala as threads pelo horário
+    std::stable_sort(batch.begin(), batch.end(),
+                     [](const LogEntry& a, const LogEntry& b) { return a.time_ns < b.time_ns; });
+    std::string output;
+    auto append = [&](std::string line) {
+        if (console) {
+            output += "[AdilsonCrypto] ";
+            output += line;
+            output += '\n';
+        }
+        lines.push_back(std::move(line));
+        if (lines.size() > history_limit) lines.pop_front();
+    };
+    for (const LogEntry& entry : batch) append(formatEntry(entry));
+    if (dropped_now) {
+        dropped_total.fetch_add(dropped_now, std::memory_order_relaxed);
+        append(std::to_string(dropped_now) + " mensagens descartadas (anel cheio)");
+    }
+    if (console && !output.empty()) {
+        std::fwrite(output.data(), 1, output.size(), console);
+        std::fflush(console);
+    }
+}
+
+void Logger::flush() {
+    drain();
+}
+
+std::vector<std::string> Logger::history() {
+    drain();
+    std::lock_guard<std::mutex> lock(drain_mutex);
+    return std::vector<std::string>(lines.begin(), lines.end());
+}
+
+void Logger::clearHistory() {
+    drain();
+    std::lock_guard<std::mutex> lock(drain_mutex);
+    lines.clear();
+}
+
+Logger& libraryLogger() {
+    static Logger logger;
+    return logger;
+}
+
+} // namespace adilsoncrypto
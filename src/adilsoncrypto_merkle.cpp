@@ -0,0 +1,241 @@
+#include "../include/adilsoncrypto_merkle.h"
+#include <algorithm>
+#include <cstring>
+
+namespace adilsoncrypto {
+
+// Abaixo deste número de folhas a construção é feita em uma thread
+static const size_t PARALLEL_MIN_LEAVES = 2048;
+static const size_t SUBTREE_MIN_LEAVES = 256;
+
+static size_t parentCount(size_t n) {
+    return (n + 1) / 2;
+}
+
+// Pais [begin, end) de um nível: pares completos vão direto do buffer
+// contíguo para o kernel; o último nó de um nível ímpar é duplicado.
+static void hashPairs(const uint8_t* nodes, size_t node_count, uint8_t* parents,
+                      size_t begin, size_t end, Sha256Kernel kernel) {
+    size_t full_end = std::min(end, node_count / 2);
+    if (full_end > begin) {
+        sha256d64Many(nodes + 64 * begin, parents + 32 * begin, full_end - begin, kernel);
+    }
+    if (end > full_end && full_end == node_count / 2 && (node_count & 1)) {
+        uint8_t pair[64];
+        std::memcpy(pair, nodes + 32 * (node_count - 1), 32);
+        std::memcpy(pair + 32, nodes + 32 * (node_count - 1), 32);
+        sha256dDigest(pair, 64, parents + 32 * full_end);
+    }
+}
+
+MerkleTree::MerkleTree(ThreadPool* p) : pool(p), kernel(Sha256Kernel::AUTO) {
+}
+
+void MerkleTree::setKernel(Sha256Kernel k) {
+    kernel = k;
+}
+
+void MerkleTree::clear() {
+    levels.clear();
+}
+
+void MerkleTree::build(const std::vector<Hash256>& leaves) {
+    build(leaves.empty() ? nullptr : leaves[0].data(), leaves.size());
+}
+
+void MerkleTree::build(const uint8_t* leaves, size_t count) {
+    levels.clear();
+    if (count == 0) return;
+
+    // Reserva todos os níveis de uma vez
+    size_t n = count;
+    levels.emplace_back(leaves, leaves + 32 * count);
+    while (n > 1) {
+        n = parentCount(n);
+        levels.emplace_back(32 * n);
+    }
+
+    size_t threads = pool ? pool->size() : 1;
+    if (threads > 1 && count >= PARALLEL_MIN_LEAVES) {
+        // Subárvores alinhadas em potências de 2 são independentes até o
+        // nível log2(S); ~4 subárvores por thread equilibram a carga.
+        size_t subtree_levels = 0;
+        while (((size_t)2 << subtree_levels) <= count / (4 * threads) || ((size_t)1 << subtree_levels) < SUBTREE_MIN_LEAVES) {
+            subtree_levels++;
+        }
+        subtree_levels = std::min(subtree_levels, levels.size() - 1);
+        buildSubtrees(subtree_levels);
+        buildUpperLevels(subtree_levels);
+    } else {
+        buildUpperLevels(0);
+    }
+}
+
+void MerkleTree::buildSubtrees(size_t subtree_levels) {
+    const size_t width = (size_t)1 << subtree_levels;
+    const size_t count = levels[0].size() / 32;
+    const size_t subtrees = (count + width - 1) / width;
+
+    pool->parallelFor(subtrees, 1, [&](size_t first, size_t last) {
+        for (size_t t = first; t < last; t++) {
+            for (size_t j = 0; j < subtree_levels; j++) {
+                size_t node_count = levels[j].size() / 32;
+                size_t parents = levels[j + 1].size() / 32;
+                size_t begin = (t * width) >> (j + 1);
+                size_t end = std::min(((t + 1) * width) >> (j + 1), parents);
+                hashPairs(levels[j].data(), node_count, levels[j + 1].data(), begin, end, kernel);
+            }
+        }
+    });
+}
+
+void MerkleTree::buildUpperLevels(size_t from_level) {
+    for (size_t j = from_level; j + 1 < levels.size(); j++) {
+        size_t node_count = levels[j].size() / 32;
+        hashPairs(levels[j].data(), node_count, levels[j + 1].data(), 0, parentCount(node_count), kernel);
+    }
+}
+
+void MerkleTree::recomputeParent(size_t level, size_t parent) {
+    const std::vector<uint8_t>& nodes = levels[level];
+    size_t node_count = nodes.size() / 32;
+    size_t left = 2 * parent;
+    size_t right = left + 1 < node_count ? left + 1 : left;
+    uint8_t pair[64];
+    std::memcpy(pair, nodes.data() + 32 * left, 32);
+    std::memcpy(pair + 32, nodes.data() + 32 * right, 32);
+    sha256dDigest(pair, 64, levels[level + 1].data() + 32 * parent);
+}
+
+void MerkleTree::append(const Hash256& leaf) {
+    if (levels.empty()) levels.emplace_back();
+    levels[0].insert(levels[0].end(), leaf.begin(), leaf.end());
+
+    // Só o último nó de cada nível muda (ou é criado)
+    for (size_t j = 0; levels[j].size() > 32; j++) {
+        size_t node_count = levels[j].size() / 32;
+        if (levels.size() <= j + 1) levels.emplace_back();
+        levels[j + 1].resize(32 * parentCount(node_count));
+        recomputeParent(j, (node_count - 1) / 2);
+    }
+}
+
+void MerkleTree::update(size_t index, const Hash256& leaf) {
+    if (index >= size()) return;
+    std::memcpy(levels[0].data() + 32 * index, leaf.data(), 32);
+    for (size_t j = 0; j + 1 < levels.size(); j++) {
+        index >>= 1;
+        recomputeParent(j, index);
+    }
+}
+
+size_t MerkleTree::size() const {
+    return levels.empty() ? 0 : levels[0].size() / 32;
+}
+
+size_t MerkleTree::depth() const {
+    return levels.empty() ? 0 : levels.size() - 1;
+}
+
+Hash256 MerkleTree::root() const {
+    Hash256 out = {};
+    if (!levels.empty()) std::memcpy(out.data(), levels.back().data(), 32);
+    return out;
+}
+
+Hash256 MerkleTree::leaf(size_t index) const {
+    Hash256 out = {};
+    if (index < size()) std::memcpy(out.data(), levels[0].data() + 32 * index, 32);
+    return out;
+}
+
+MerkleProof MerkleTree::proof(size_t index) const {
+    MerkleProof result;
+    result.index = index;
+    if (index >= size()) return result;
+    result.siblings.resize(depth());
+    for (size_t j = 0; j + 1 < levels.size(); j++) {
+        size_t node_count = levels[j].size() / 32;
+        size_t sibling = index ^ 1;
+        if (sibling >= node_count) sibling = index;
+        std::memcpy(result.siblings[j].data(), levels[j].data() + 32 * sibling, 32);
+        index >>= 1;
+    }
+    return result;
+}
+
+std::vector<MerkleProof> MerkleTree::proofs(const std::vector<size_t>& indices) const {
+    std::vector<MerkleProof> result(indices.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+        result[i] = proof(indices[i]);
+    }
+    return result;
+}
+
+Hash256 MerkleTree::computeRoot(const Hash256& leaf, const MerkleProof& proof) {
+    Hash256 node = leaf;
+    size_t index = proof.index;
+    uint8_t pair[64];
+    for (const Hash256& sibling : proof.siblings) {
+        if (index & 1) {
+            std::memcpy(pair, sibling.data(), 32);
+            std::memcpy(pair + 32, node.data(), 32);
+        } else {
+            std::memcpy(pair, node.data(), 32);
+            std::memcpy(pair + 32, sibling.data(), 32);
+        }
+        sha256dDigest(pair, 64, node.data());
+        index >>= 1;
+    }
+    return node;
+}
+
+bool MerkleTree::verify(const Hash256& leaf, const MerkleProof& proof, const Hash256& root) {
+    return computeRoot(leaf, proof) == root;
+}
+
+std::vector<bool> MerkleTree::verifyBatch(const std::vector<Hash256>& leaves, const std::vector<MerkleProof>& proofs,
+                                          const Hash256& root, Sha256Kernel kernel) {
+    const size_t count = std::min(leaves.size(), proofs.size());
+    std::vector<bool> valid(proofs.size(), false);
+    std::vector<uint8_t> nodes(32 * count);
+    std::vector<size_t> indices(count);
+    size_t max_depth = 0;
+    for (size_t i = 0; i < count; i++) {
+        std::memcpy(nodes.data() + 32 * i, leaves[i].data(), 32);
+        indices[i] = proofs[i].index;
+        max_depth = std::max(max_depth, proofs[i].siblings.size());
+    }
+
+    std::vector<uint8_t> pairs(64 * count);
+    std::vector<size_t> active(count);
+    for (size_t level = 0; level < max_depth; level++) {
+        size_t n = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (level >= proofs[i].siblings.size()) continue;
+            const uint8_t* sibling = proofs[i].siblings[level].data();
+            uint8_t* pair = pairs.data() + 64 * n;
+            bool right = (indices[i] >> level) & 1;
+            std::memcpy(pair + (right ? 32 : 0), nodes.data() + 32 * i, 32);
+            std::memcpy(pair + (right ? 0 : 32), sibling, 32);
+            active[n++] = i;
+        }
+        sha256d64Many(pairs.data(), pairs.data(), n, kernel);
+        for (size_t k = 0; k < n; k++) {
+            std::memcpy(nodes.data() + 32 * active[k], pairs.data() + 32 * k, 32);
+        }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        valid[i] = std::memcmp(nodes.data() + 32 * i, root.data(), 32) == 0;
+    }
+    return valid;
+}
+
+Hash256 merkleRoot(const std::vector<Hash256>& leaves, ThreadPool* pool) {
+    MerkleTree tree(pool);
+    tree.build(leaves);
+    return tree.root();
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,260 @@
+#include "../include/adilsoncrypto_metrics.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const char* const OP_NAMES[(size_t)MetricOp::OP_COUNT] = {
+    "keygen",           "sign",          "verify",           "address",         "sha256",         "sha512",
+    "ripemd160",        "keccak256",     "blake3",           "aes_encrypt",     "aes_decrypt",
+    "chacha20_encrypt", "chacha20_decrypt", "lattice_encrypt", "lattice_decrypt", "pbkdf2",       "scrypt",
+    "argon2",
+};
+static_assert(sizeof(OP_NAMES) / sizeof(OP_NAMES[0]) == (size_t)MetricOp::OP_COUNT, "um nome por MetricOp");
+
+// Faixas do texto: potências de 2 de 256 ns a ~69 s
+const unsigned TEXT_MIN_EXPONENT = 8;
+const unsigned TEXT_MAX_EXPONENT = 36;
+const double QUANTILES[] = { 0.5, 0.9, 0.99, 0.999 };
+
+std::atomic<bool> metrics_enabled{ true };
+
+struct OpCounters {
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> bytes;
+    std::atomic<uint64_t> total_ns;
+    std::atomic<uint64_t> max_ns;
+    std::atomic<uint64_t> buckets[METRIC_BUCKETS];
+};
+
+// Bloco de uma thread: só ela escreve, o snapshot só lê
+struct ThreadMetrics {
+    std::atomic<bool> in_use;
+    OpCounters ops[(size_t)MetricOp::OP_COUNT];
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadMetrics*> blocks;   // nunca liberados: os totais continuam valendo
+};
+
+Registry& registry() {
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+ThreadMetrics* acquireBlock() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (ThreadMetrics* block : r.blocks) {
+        if (!block->in_use.load(std::memory_order_acquire)) {
+            block->in_use.store(true, std::memory_order_relaxed);
+            return block;
+        }
+    }
+    ThreadMetrics* block = new ThreadMetrics();   // inicialização por valor: tudo zerado
+    block->in_use.store(true, std::memory_order_relaxed);
+    r.blocks.push_back(block);
+    return block;
+}
+
+struct ThreadSlot {
+    ThreadMetrics* block = nullptr;
+
+    ~ThreadSlot() {
+        if (block) block->in_use.store(false, std::memory_order_release);
+    }
+};
+
+thread_local ThreadSlot thread_slot;
+
+// Escritor único: dispensa o fetch_add
+inline void bump(std::atomic<uint64_t>& counter, uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void appendLine(std::string& out, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+void appendLine(std::string& out, const char* format, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, format);
+    int n = std::vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (n > 0) out.append(line, std::min((size_t)n, sizeof(line) - 1));
+}
+
+} // namespace
+
+const char* metricOpName(MetricOp op) {
+    return op < MetricOp::OP_COUNT ? OP_NAMES[(size_t)op] : "unknown";
+}
+
+size_t metricBucket(uint64_t ns) {
+    if (ns < (1ULL << METRIC_SUB_BUCKET_BITS)) return (size_t)ns;
+    const unsigned exponent = 63 - (unsigned)__builtin_clzll(ns);
+    if (exponent >= METRIC_MAX_EXPONENT) return METRIC_BUCKETS - 1;
+    const size_t sub = (size_t)(ns >> (exponent - METRIC_SUB_BUCKET_BITS)) & ((1u << METRIC_SUB_BUCKET_BITS) - 1);
+    return ((size_t)(exponent - METRIC_SUB_BUCKET_BITS + 1) << METRIC_SUB_BUCKET_BITS) + sub;
+}
+
+uint64_t metricBucketLow(size_t bucket) {
+    if (bucket < (1u << METRIC_SUB_BUCKET_BITS)) return bucket;
+    const unsigned exponent = (unsigned)(bucket >> METRIC_SUB_BUCKET_BITS) + METRIC_SUB_BUCKET_BITS - 1;
+    const uint64_t sub = bucket & ((1u << METRIC_SUB_BUCKET_BITS) - 1);
+    return ((1ULL << METRIC_SUB_BUCKET_BITS) + sub) << (exponent - METRIC_SUB_BUCKET_BITS);
+}
+
+uint64_t metricBucketHigh(size_t bucket) {
+    if (bucket < (1u << METRIC_SUB_BUCKET_BITS)) return bucket;
+    if (bucket >= METRIC_BUCKETS - 1) return UINT64_MAX;
+    return metricBucketLow(bucket + 1) - 1;
+}
+
+uint64_t OperationMetrics::percentileNs(double q) const {
+    uint64_t total = 0;
+    for (uint64_t n : buckets) total += n;
+    if (total == 0) return 0;
+    q = std::min(1.0, std::max(0.0, q));
+    const uint64_t target = std::max<uint64_t>(1, (uint64_t)std::ceil(q * (double)total));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        seen += buckets[i];
+        if (seen >= target) return max_ns ? std::min(metricBucketHigh(i), max_ns) : metricBucketHigh(i);
+    }
+    return max_ns;
+}
+
+void setMetricsEnabled(bool enable) {
+    metrics_enabled.store(enable, std::memory_order_relaxed);
+}
+
+bool metricsEnabled() {
+    return metrics_enabled.load(std::memory_order_relaxed);
+}
+
+void recordMetric(MetricOp op, uint64_t ns, uint64_t bytes) {
+    if (op >= MetricOp::OP_COUNT) return;
+    ThreadSlot& slot = thread_slot;
+    if (!slot.block) slot.block = acquireBlock();
+    OpCounters& counters = slot.block->ops[(size_t)op];
+    bump(counters.count, 1);
+    bump(counters.bytes, bytes);
+    bump(counters.total_ns, ns);
+    if (ns > counters.max_ns.load(std::memory_order_relaxed)) counters.max_ns.store(ns, std::memory_order_relaxed);
+    bump(counters.buckets[metricBucket(ns)], 1);
+}
+
+MetricsSnapshot metricsSnapshot() {
+    MetricsSnapshot snapshot;
+    snapshot.operations.resize((size_t)MetricOp::OP_COUNT);
+    for (size_t i = 0; i < snapshot.operations.size(); i++) {
+        snapshot.operations[i].op = (MetricOp)i;
+        snapshot.operations[i].buckets.assign(METRIC_BUCKETS, 0);
+    }
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    snapshot.threads = r.blocks.size();
+    for (const ThreadMetrics* block : r.blocks) {
+        for (size_t i = 0; i < snapshot.operations.size(); i++) {
+            const OpCounters& counters = block->ops[i];
+            OperationMetrics& op = snapshot.operations[i];
+            const uint64_t count = counters.count.load(std::memory_order_relaxed);
+            if (count == 0) continue;
+            op.count += count;
+            op.bytes += counters.bytes.load(std::memory_order_relaxed);
+            op.total_ns += counters.total_ns.load(std::memory_order_relaxed);
+            op.max_ns = std::max(op.max_ns, counters.max_ns.load(std::memory_order_relaxed));
+            for (size_t b = 0; b < METRIC_BUCKETS; b++) op.buckets[b] += counters.buckets[b].load(std::memory_order_relaxed);
+        }
+    }
+    return snapshot;
+}
+
+MetricsSnapshot metricsDelta(const MetricsSnapshot& before, const MetricsSnapshot& after) {
+    MetricsSnapshot delta = after;
+    for (size_t i = 0; i < delta.operations.size() && i < before.operations.size(); i++) {
+        OperationMetrics& op = delta.operations[i];
+        const OperationMetrics& old = before.operations[i];
+        op.count -= std::min(op.count, old.count);
+        op.bytes -= std::min(op.bytes, old.bytes);
+        op.total_ns -= std::min(op.total_ns, old.total_ns);
+        for (size_t b = 0; b < op.buckets.size() && b < old.buckets.size(); b++) {
+            op.buckets[b] -= std::min(op.buckets[b], old.buckets[b]);
+        }
+        // O máximo não se subtrai; só vale se a janela o alterou
+        if (op.max_ns == old.max_ns) op.max_ns = 0;
+    }
+    return delta;
+}
+
+std::string metricsText(const MetricsSnapshot& snapshot) {
+    std::string out;
+    out.reserve(4096);
+    appendLine(out, "# HELP adilsoncrypto_operations_total Chamadas concluídas por operação.\n");
+    appendLine(out, "# TYPE adilsoncrypto_operations_total counter\n");
+    for (const OperationMetrics& op : snapshot.operations) {
+        if (op.count) appendLine(out, "adilsoncrypto_operations_total{op=\"%s\"} %llu\n", metricOpName(op.op),
+                                 (unsigned long long)op.count);
+    }
+    appendLine(out, "# HELP adilsoncrypto_operation_bytes_total Bytes de entrada processados por operação.\n");
+    appendLine(out, "# TYPE adilsoncrypto_operation_bytes_total counter\n");
+    for (const OperationMetrics& op : snapshot.operations) {
+        if (op.count) appendLine(out, "adilsoncrypto_operation_bytes_total{op=\"%s\"} %llu\n", metricOpName(op.op),
+                                 (unsigned long long)op.bytes);
+    }
+
+    appendLine(out, "# HELP adilsoncrypto_operation_duration_seconds Latência por operação.\n");
+    appendLine(out, "# TYPE adilsoncrypto_operation_duration_seconds histogram\n");
+    for (const OperationMetrics& op : snapshot.operations) {
+        if (!op.count) continue;
+        const char* name = metricOpName(op.op);
+        uint64_t cumulative = 0, total = 0;
+        size_t bucket = 0;
+        for (uint64_t n : op.buckets) total += n;
+        // As faixas do histograma começam em potências de 2, então a soma das
+        // faixas abaixo de 2^k é exatamente a contagem de valores < 2^k ns
+        for (unsigned k = TEXT_MIN_EXPONENT; k <= TEXT_MAX_EXPONENT; k++) {
+            const size_t limit = metricBucket(1ULL << k);
+            for (; bucket < limit; bucket++) cumulative += op.buckets[bucket];
+            appendLine(out, "adilsoncrypto_operation_duration_seconds_bucket{op=\"%s\",le=\"%.9g\"} %llu\n", name,
+                       (double)(1ULL << k) * 1e-9, (unsigned long long)cumulative);
+        }
+        appendLine(out, "adilsoncrypto_operation_duration_seconds_bucket{op=\"%s\",le=\"+Inf\"} %llu\n", name,
+                   (unsigned long long)total);
+        appendLine(out, "adilsoncrypto_operation_duration_seconds_sum{op=\"%s\"} %.9g\n", name, op.total_ns * 1e-9);
+        appendLine(out, "adilsoncrypto_operation_duration_seconds_count{op=\"%s\"} %llu\n", name,
+                   (unsigned long long)total);
+    }
+
+    appendLine(out, "# HELP adilsoncrypto_operation_latency_seconds Percentis de latência (erro <= 6,25%%).\n");
+    appendLine(out, "# TYPE adilsoncrypto_operation_latency_seconds gauge\n");
+    for (const OperationMetrics& op : snapshot.operations) {
+        if (!op.count) continue;
+        for (double q : QUANTILES) {
+            appendLine(out, "adilsoncrypto_operation_latency_seconds{op=\"%s\",quantile=\"%g\"} %.9g\n",
+                       metricOpName(op.op), q, op.percentileNs(q) * 1e-9);
+        }
+    }
+    appendLine(out, "# HELP adilsoncrypto_operation_max_seconds Maior latência observada.\n");
+    appendLine(out, "# TYPE adilsoncrypto_operation_max_seconds gauge\n");
+    for (const OperationMetrics& op : snapshot.operations) {
+        if (op.count) appendLine(out, "adilsoncrypto_operation_max_seconds{op=\"%s\"} %.9g\n", metricOpName(op.op),
+                                 op.max_ns * 1e-9);
+    }
+    appendLine(out, "# HELP adilsoncrypto_metrics_threads Threads que registraram métricas.\n");
+    appendLine(out, "# TYPE adilsoncrypto_metrics_threads gauge\n");
+    appendLine(out, "adilsoncrypto_metrics_threads %llu\n", (unsigned long long)snapshot.threads);
+    return out;
+}
+
+std::string metricsText() {
+    return metricsText(metricsSnapshot());
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,232 @@
+#include "../include/adilsoncrypto_miner.h"
+#include "../include/adilsoncrypto_sha256_lanes.h"
+#include "../include/adilsoncrypto_util.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace adilsoncrypto {
+
+// Cada unidade de trabalho cobre 2^20 nonces de um extranonce
+static const uint64_t NONCE_CHUNK_BITS = 20;
+static const uint64_t CHUNKS_PER_EXTRANONCE = 1ull << (32 - NONCE_CHUNK_BITS);
+
+CpuMiner::CpuMiner() : threads(0), kernel(Sha256Kernel::AUTO), max_hashes(0), stop_requested(false) {
+}
+
+void CpuMiner::setThreadCount(unsigned count) {
+    threads = count;
+}
+
+void CpuMiner::setKernel(Sha256Kernel k) {
+    kernel = k;
+}
+
+void CpuMiner::setMaxHashes(uint64_t limit) {
+    max_hashes = limit;
+}
+
+unsigned CpuMiner::threadCount() const {
+    if (threads > 0) return threads;
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw > 0 ? hw : 1;
+}
+
+void CpuMiner::stop() {
+    stop_requested.store(true, std::memory_order_relaxed);
+}
+
+// Merkle root para um extranonce: sha256d(coinbase) dobrado com o ramo
+static void merkleRootFor(const MiningJob& job, uint64_t extranonce, uint8_t root[32]) {
+    std::string coinbase = job.coinbase_prefix;
+    for (size_t i = 0; i < job.extranonce_size; i++) {
+        coinbase.push_back((char)(i < 8 ? (extranonce >> (8 * i)) & 0xff : 0));
+    }
+    coinbase += job.coinbase_suffix;
+    sha256dDigest((const uint8_t*)coinbase.data(), coinbase.size(), root);
+
+    uint8_t pair[64];
+    for (const Hash256& sibling : job.merkle_branch) {
+        std::memcpy(pair, root, 32);
+        std::memcpy(pair + 32, sibling.data(), 32);
+        sha256dDigest(pair, 64, root);
+    }
+}
+
+namespace {
+
+struct ThreadContext {
+    uint8_t header[80];
+    uint32_t midstate[8];
+    uint32_t tail[3];
+    uint64_t extranonce;
+    bool prepared;
+};
+
+void prepareHeader(ThreadContext& ctx, const MiningJob& job, uint64_t extranonce) {
+    std::memcpy(ctx.header, job.header, 80);
+    if (!job.coinbase_prefix.empty() || !job.coinbase_suffix.empty()) {
+        merkleRootFor(job, extranonce, ctx.header + 36);
+    }
+    std::memcpy(ctx.midstate, SHA256_IV, sizeof(ctx.midstate));
+    sha256Compress(ctx.midstate, ctx.header, 1);
+    for (int i = 0; i < 3; i++) ctx.tail[i] = sha256LoadBe32(ctx.header + 64 + 4 * i);
+    ctx.extranonce = extranonce;
+    ctx.prepared = true;
+}
+
+uint32_t loadLe32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+} // namespace
+
+MiningResult CpuMiner::mine(const MiningJob& job) {
+    MiningResult result;
+    const Sha256LaneBackend& backend = sha256LaneBackend(kernel);
+    const unsigned nthreads = threadCount();
+    const uint64_t extranonces = std::max<uint64_t>(job.extranonce_count, 1);
+    const uint64_t total_units = extranonces * CHUNKS_PER_EXTRANONCE;
+    const uint64_t unit_limit = max_hashes == 0
+        ? total_units
+        : std::min<uint64_t>(total_units, (max_hashes + (1ull << NONCE_CHUNK_BITS) - 1) >> NONCE_CHUNK_BITS);
+
+    // Palavra mais significativa do alvo para rejeição rápida
+    const uint32_t target_top = loadLe32(job.target + 28);
+
+    std::atomic<uint64_t> next_unit(0);
+    std::atomic<bool> found(false);
+    std::mutex result_mutex;
+    stop_requested.store(false, std::memory_order_relaxed);
+
+    result.kernel = backend.name;
+    result.threads.resize(nthreads);
+    auto start = std::chrono::steady_clock::now();
+
+    auto worker = [&](unsigned index) {
+        ThreadContext ctx;
+        ctx.prepared = false;
+        uint32_t out[SHA256_MAX_LANES * 8];
+        uint64_t hashes = 0;
+        auto thread_start = std::chrono::steady_clock::now();
+
+        while (!found.load(std::memory_order_relaxed) && !stop_requested.load(std::memory_order_relaxed)) {
+            uint64_t unit = next_unit.fetch_add(1, std::memory_order_relaxed);
+            if (unit >= unit_limit) break;
+
+            uint64_t extranonce = job.extranonce_start + unit / CHUNKS_PER_EXTRANONCE;
+            if (!ctx.prepared || ctx.extranonce != extranonce) {
+                prepareHeader(ctx, job, extranonce);
+            }
+            uint32_t nonce = (uint32_t)((unit % CHUNKS_PER_EXTRANONCE) << NONCE_CHUNK_BITS);
+            const uint32_t chunk_end = nonce + (uint32_t)((1ull << NONCE_CHUNK_BITS) - backend.lanes);
+
+            for (;;) {
+                backend.sha256dNonces(ctx.midstate, ctx.tail, nonce, out);
+                hashes += backend.lanes;
+                for (size_t l = 0; l < backend.lanes; l++) {
+                    // Bytes 28..31 do digest = palavra mais significativa do uint256
+                    if (sha256Bswap32(out[8 * l + 7]) > target_top) continue;
+                    uint8_t hash[32];
+                    sha256StateToBytes(out + 8 * l, hash);
+                    if (!hashMeetsTarget(hash, job.target)) continue;
+
+                    std::lock_guard<std::mutex> lock(result_mutex);
+                    if (!found.exchange(true)) {
+                        uint32_t winner = nonce + (uint32_t)l;
+                        result.found = true;
+                        result.nonce = winner;
+                        result.extranonce = extranonce;
+                        std::memcpy(result.header, ctx.header, 80);
+                        std::memcpy(result.header + 76, &winner, 4);
+                        std::memcpy(result.hash, hash, 32);
+                    }
+                    break;
+                }
+                if (nonce == chunk_end || found.load(std::memory_order_relaxed)) break;
+                nonce += (uint32_t)backend.lanes;
+            }
+        }
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - thread_start).count();
+        MinerThreadStats& stats = result.threads[index];
+        stats.hashes = hashes;
+        stats.seconds = seconds;
+        stats.hashes_per_second = seconds > 0 ? hashes / seconds : 0;
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned i = 1; i < nthreads; i++) pool.emplace_back(worker, i);
+    worker(0);
+    for (std::thread& t : pool) t.join();
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (const MinerThreadStats& stats : result.threads) result.total_hashes += stats.hashes;
+    result.hashes_per_second = result.seconds > 0 ? result.total_hashes / result.seconds : 0;
+    return result;
+}
+
+bool compactToTarget(uint32_t bits, uint8_t target[32]) {
+    std::memset(target, 0, 32);
+    uint32_t mantissa = bits & 0x007fffff;
+    int exponent = (int)(bits >> 24);
+    if ((bits & 0x00800000) || mantissa == 0) return false; // negativo ou zero
+    for (int i = 0; i < 3; i++) {
+        int pos = exponent - 3 + i;
+        uint8_t byte = (uint8_t)(mantissa >> (8 * i));
+        if (pos < 0 || byte == 0) continue;
+        if (pos >= 32) return false; // overflow
+        target[pos] = byte;
+    }
+    return true;
+}
+
+bool parseTarget(const std::string& text, uint8_t target[32]) {
+    std::string bytes;
+    if (!hexToBytes(text, bytes)) return false;
+    if (bytes.size() == 4) {
+        uint32_t bits = ((uint32_t)(uint8_t)bytes[0] << 24) | ((uint32_t)(uint8_t)bytes[1] << 16) |
+                        ((uint32_t)(uint8_t)bytes[2] << 8) | (uint32_t)(uint8_t)bytes[3];
+        return compactToTarget(bits, target);
+    }
+    if (bytes.size() != 32) return false;
+    // Ordem de exibição (big-endian) -> little-endian interno
+    for (int i = 0; i < 32; i++) target[i] = (uint8_t)bytes[31 - i];
+    return true;
+}
+
+bool hashMeetsTarget(const uint8_t hash[32], const uint8_t target[32]) {
+    for (int i = 31; i >= 0; i--) {
+        if (hash[i] != target[i]) return hash[i] < target[i];
+    }
+    return true;
+}
+
+std::string hashToDisplayHex(const uint8_t hash[32]) {
+    uint8_t reversed[32];
+    for (int i = 0; i < 32; i++) reversed[i] = hash[31 - i];
+    return bytesToHex(reversed, 32);
+}
+
+std::string formatMiningReport(const MiningResult& result) {
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(2);
+    ss << "kernel=" << result.kernel << " threads=" << result.threads.size()
+       << " hashes=" << result.total_hashes << " tempo=" << result.seconds << "s"
+       << " taxa=" << result.hashes_per_second / 1e6 << " MH/s\n";
+    for (size_t i = 0; i < result.threads.size(); i++) {
+        ss << "  thread " << i << ": " << result.threads[i].hashes << " hashes, "
+           << result.threads[i].hashes_per_second / 1e6 << " MH/s\n";
+    }
+    if (result.found) {
+        ss << "  bloco encontrado: nonce=" << result.nonce << " extranonce=" << result.extranonce
+           << " hash=" << hashToDisplayHex(result.hash) << "\n";
+    }
+    return ss.str();
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,590 @@
+#include "../include/adilsoncrypto_mlkem.h"
+#include "../include/adilsoncrypto_cpu.h"
+#include "../include/adilsoncrypto_keccak.h"
+#include <climits>
+#include <cstring>
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const unsigned N = 256;
+const unsigned MAX_K = 4;
+const size_t POLY_BYTES = 384;
+const size_t MAX_CIPHERTEXT_BYTES = 1568;
+const int16_t MONT_R2 = 1353;        // 2^32 mod q (converte para Montgomery)
+const size_t XOF_BLOCK = 168;         // rate do SHAKE128
+const size_t XOF_FIRST_BLOCKS = 3;    // suficiente para 256 coeficientes quase sempre
+
+const MlKemParams PARAMS[3] = {
+    { MlKemLevel::ML_KEM_512, "ML-KEM-512", 512, 2, 3, 2, 10, 4, 800, 1632, 768 },
+    { MlKemLevel::ML_KEM_768, "ML-KEM-768", 768, 3, 2, 2, 10, 4, 1184, 2400, 1088 },
+    { MlKemLevel::ML_KEM_1024, "ML-KEM-1024", 1024, 4, 2, 2, 11, 5, 1568, 3168, 1568 },
+};
+
+struct alignas(32) Poly {
+    int16_t c[N];
+};
+
+struct ZetaTable {
+    int16_t z[128];
+
+    ZetaTable() {
+        for (unsigned i = 0; i < 128; i++) {
+            unsigned e = 0;
+            for (unsigned b = 0; b < 7; b++) e |= ((i >> b) & 1) << (6 - b);
+            int32_t v = 1;
+            for (unsigned j = 0; j < e; j++) v = (v * 17) % MLKEM_Q;
+            v = (int32_t)(((int64_t)v << 16) % MLKEM_Q);
+            if (v > MLKEM_Q / 2) v -= MLKEM_Q;
+            z[i] = (int16_t)v;
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Aritmética mod q (escalar)
+// ---------------------------------------------------------------------------
+
+inline int16_t montgomeryReduce(int32_t a) {
+    int16_t t = (int16_t)((int16_t)a * MLKEM_QINV);
+    return (int16_t)((a - (int32_t)t * MLKEM_Q) >> 16);
+}
+
+inline int16_t fqmul(int16_t a, int16_t b) {
+    return montgomeryReduce((int32_t)a * b);
+}
+
+// Representante centrado de a mod q
+inline int16_t barrettReduce(int16_t a) {
+    const int32_t v = ((1 << 26) + MLKEM_Q / 2) / MLKEM_Q;
+    int16_t t = (int16_t)((v * a + (1 << 25)) >> 26);
+    return (int16_t)(a - t * MLKEM_Q);
+}
+
+// Leva [-q, 2q) para [0, q) sem desvios
+inline uint16_t canonical(int16_t a) {
+    a = (int16_t)(a + ((a >> 15) & MLKEM_Q));
+    a = (int16_t)(a - MLKEM_Q);
+    a = (int16_t)(a + ((a >> 15) & MLKEM_Q));
+    return (uint16_t)a;
+}
+
+void nttScalar(int16_t r[N]) {
+    const int16_t* zetas = mlKemZetas();
+    unsigned k = 1;
+    for (unsigned len = 128; len >= 2; len >>= 1) {
+        for (unsigned start = 0; start < N; start += 2 * len) {
+            int16_t zeta = zetas[k++];
+            for (unsigned j = start; j < start + len; j++) {
+                int16_t t = fqmul(zeta, r[j + len]);
+                r[j + len] = (int16_t)(r[j] - t);
+                r[j] = (int16_t)(r[j] + t);
+            }
+        }
+    }
+    for (unsigned j = 0; j < N; j++) r[j] = barrettReduce(r[j]);
+}
+
+// Inclui o fator R^2/128: desfaz o R^-1 da multiplicação no domínio NTT
+void invNttScalar(int16_t r[N]) {
+    const int16_t* zetas = mlKemZetas();
+    unsigned k = 127;
+    for (unsigned len = 2; len <= 128; len <<= 1) {
+        for (unsigned start = 0; start < N; start += 2 * len) {
+            int16_t zeta = zetas[k--];
+            for (unsigned j = start; j < start + len; j++) {
+                int16_t t = r[j];
+                r[j] = barrettReduce((int16_t)(t + r[j + len]));
+                r[j + len] = fqmul(zeta, (int16_t)(r[j + len] - t));
+            }
+        }
+    }
+    for (unsigned j = 0; j < N; j++) r[j] = fqmul(r[j], MLKEM_INVNTT_F);
+}
+
+// Produto de polinômios de grau 1 mod (X^2 - zeta), resultado vezes R^-1
+inline void basemulPair(int16_t r[2], const int16_t a[2], const int16_t b[2], int16_t zeta) {
+    r[0] = (int16_t)(fqmul(fqmul(a[1], b[1]), zeta) + fqmul(a[0], b[0]));
+    r[1] = (int16_t)(fqmul(a[0], b[1]) + fqmul(a[1], b[0]));
+}
+
+void basemulScalar(int16_t r[N], const int16_t a[N], const int16_t b[N]) {
+    const int16_t* zetas = mlKemZetas();
+    for (unsigned i = 0; i < N / 4; i++) {
+        basemulPair(r + 4 * i, a + 4 * i, b + 4 * i, zetas[64 + i]);
+        basemulPair(r + 4 * i + 2, a + 4 * i + 2, b + 4 * i + 2, (int16_t)-zetas[64 + i]);
+    }
+}
+
+void reduceScalar(int16_t r[N]) {
+    for (unsigned j = 0; j < N; j++) r[j] = barrettReduce(r[j]);
+}
+
+struct PolyKernel {
+    const char* name;
+    void (*ntt)(int16_t*);
+    void (*invntt)(int16_t*);
+    void (*basemul)(int16_t*, const int16_t*, const int16_t*);
+    void (*reduce)(int16_t*);
+};
+
+const PolyKernel KERNEL_SCALAR = { "scalar", nttScalar, invNttScalar, basemulScalar, reduceScalar };
+#if defined(__x86_64__) || defined(__i386__)
+const PolyKernel KERNEL_AVX2 = { "avx2", mlKemNttAvx2, mlKemInvNttAvx2, mlKemBasemulAvx2, mlKemReduceAvx2 };
+#endif
+
+const PolyKernel& kernel() {
+#if defined(__x86_64__) || defined(__i386__)
+    static const PolyKernel& selected = cpuFeatures().avx2 ? KERNEL_AVX2 : KERNEL_SCALAR;
+    return selected;
+#else
+    return KERNEL_SCALAR;
+#endif
+}
+
+void polyAdd(Poly& r, const Poly& b) {
+    for (unsigned j = 0; j < N; j++) r.c[j] = (int16_t)(r.c[j] + b.c[j]);
+}
+
+void polyToMont(Poly& r) {
+    for (unsigned j = 0; j < N; j++) r.c[j] = fqmul(r.c[j], MONT_R2);
+}
+
+// r = sum a[i] o b[i] no domínio NTT, reduzido
+void basemulAcc(Poly& r, const Poly* a, const Poly* b, unsigned k) {
+    const PolyKernel& kern = kernel();
+    Poly t;
+    kern.basemul(r.c, a[0].c, b[0].c);
+    for (unsigned i = 1; i < k; i++) {
+        kern.basemul(t.c, a[i].c, b[i].c);
+        polyAdd(r, t);
+    }
+    kern.reduce(r.c);
+}
+
+// ---------------------------------------------------------------------------
+// Codificação (ByteEncode/ByteDecode com Compress/Decompress do FIPS 203)
+// ---------------------------------------------------------------------------
+
+// d < 12 comprime cada coeficiente para d bits; d = 12 grava o valor em [0, q)
+void packPoly(uint8_t* out, const Poly& a, unsigned d) {
+    uint32_t acc = 0;
+    unsigned bits = 0;
+    for (unsigned i = 0; i < N; i++) {
+        uint32_t x = canonical(a.c[i]);
+        if (d < 12) x = (((x << d) + MLKEM_Q / 2) / MLKEM_Q) & ((1u << d) - 1);
+        acc |= x << bits;
+        bits += d;
+        while (bits >= 8) {
+            *out++ = (uint8_t)acc;
+            acc >>= 8;
+            bits -= 8;
+        }
+    }
+}
+
+// Inverso de packPoly. Com d = 12 retorna false se algum valor for >= q
+bool unpackPoly(Poly& a, const uint8_t* in, unsigned d) {
+    uint32_t acc = 0;
+    unsigned bits = 0;
+    uint32_t mask = (1u << d) - 1;
+    uint32_t out_of_range = 0;
+    for (unsigned i = 0; i < N; i++) {
+        while (bits < d) {
+            acc |= (uint32_t)*in++ << bits;
+            bits += 8;
+        }
+        uint32_t x = acc & mask;
+        acc >>= d;
+        bits -= d;
+        if (d == 12) {
+            out_of_range |= (uint32_t)(MLKEM_Q - 1 - (int32_t)x) >> 31;
+            a.c[i] = (int16_t)x;
+        } else {
+            a.c[i] = (int16_t)((x * MLKEM_Q + (1u << (d - 1))) >> d);
+        }
+    }
+    return out_of_range == 0;
+}
+
+void messageToPoly(Poly& r, const uint8_t m[32]) {
+    for (unsigned i = 0; i < N; i++) {
+        int16_t bit = (int16_t)((m[i / 8] >> (i % 8)) & 1);
+        r.c[i] = (int16_t)(-bit & ((MLKEM_Q + 1) / 2));
+    }
+}
+
+void polyToMessage(uint8_t m[32], const Poly& a) {
+    std::memset(m, 0, 32);
+    for (unsigned i = 0; i < N; i++) {
+        uint32_t x = canonical(a.c[i]);
+        x = (((x << 1) + MLKEM_Q / 2) / MLKEM_Q) & 1;
+        m[i / 8] |= (uint8_t)(x << (i % 8));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Amostragem
+// ---------------------------------------------------------------------------
+
+// SampleNTT: aceita valores de 12 bits < q; devolve quantos foram escritos
+unsigned rejectionSample(int16_t* r, unsigned len, const uint8_t* buf, size_t buflen) {
+    unsigned ctr = 0;
+    for (size_t pos = 0; ctr < len && pos + 3 <= buflen; pos += 3) {
+        uint16_t d1 = (uint16_t)((buf[pos] | ((uint16_t)buf[pos + 1] << 8)) & 0xfff);
+        uint16_t d2 = (uint16_t)((buf[pos + 1] >> 4) | ((uint16_t)buf[pos + 2] << 4));
+        if (d1 < MLKEM_Q) r[ctr++] = (int16_t)d1;
+        if (ctr < len && d2 < MLKEM_Q) r[ctr++] = (int16_t)d2;
+    }
+    return ctr;
+}
+
+// Matriz A (ou A^T) já no domínio NTT, quatro entradas por vez com SHAKE128 x4.
+// A[i][j] = SampleNTT(rho || j || i), guardada em a[i * k + j].
+void generateMatrix(Poly* a, const uint8_t rho[32], unsigned k, bool transposed) {
+    const unsigned count = k * k;
+    uint8_t seeds[4][34];
+    uint8_t buf[4][XOF_FIRST_BLOCKS * XOF_BLOCK];
+    for (unsigned base = 0; base < count; base += 4) {
+        const uint8_t* in[4];
+        uint8_t* out[4];
+        unsigned idx[4];
+        unsigned ctr[4];
+        for (unsigned l = 0; l < 4; l++) {
+            idx[l] = base + l < count ? base + l : base;   // lanes sobrando repetem a primeira
+            unsigned i = idx[l] / k;
+            unsigned j = idx[l] % k;
+            std::memcpy(seeds[l], rho, 32);
+            seeds[l][32] = (uint8_t)(transposed ? i : j);
+            seeds[l][33] = (uint8_t)(transposed ? j : i);
+            in[l] = seeds[l];
+            out[l] = buf[l];
+        }
+        ShakeX4 xof(XOF_BLOCK, in, 34);
+        xof.squeeze(out, sizeof(buf[0]));
+        bool done = true;
+        for (unsigned l = 0; l < 4; l++) {
+            ctr[l] = rejectionSample(a[idx[l]].c, N, buf[l], sizeof(buf[0]));
+            done = done && ctr[l] == N;
+        }
+        while (!done) {
+            xof.squeeze(out, XOF_BLOCK);
+            done = true;
+            for (unsigned l = 0; l < 4; l++) {
+                ctr[l] += rejectionSample(a[idx[l]].c + ctr[l], N - ctr[l], buf[l], XOF_BLOCK);
+                done = done && ctr[l] == N;
+            }
+        }
+    }
+}
+
+// Distribuição binomial centrada: cada coeficiente é a soma de eta bits
+// menos a soma dos eta bits seguintes
+void cbd(Poly& r, const uint8_t* buf, unsigned eta) {
+    if (eta == 2) {
+        for (unsigned i = 0; i < N / 8; i++) {
+            uint32_t t = (uint32_t)buf[4 * i] | ((uint32_t)buf[4 * i + 1] << 8) |
+                         ((uint32_t)buf[4 * i + 2] << 16) | ((uint32_t)buf[4 * i + 3] << 24);
+            uint32_t d = (t & 0x55555555) + ((t >> 1) & 0x55555555);
+            for (unsigned j = 0; j < 8; j++) {
+                int16_t x = (int16_t)((d >> (4 * j)) & 3);
+                int16_t y = (int16_t)((d >> (4 * j + 2)) & 3);
+                r.c[8 * i + j] = (int16_t)(x - y);
+            }
+        }
+    } else {
+        for (unsigned i = 0; i < N / 4; i++) {
+            uint32_t t = (uint32_t)buf[3 * i] | ((uint32_t)buf[3 * i + 1] << 8) | ((uint32_t)buf[3 * i + 2] << 16);
+            uint32_t d = (t & 0x249249) + ((t >> 1) & 0x249249) + ((t >> 2) & 0x249249);
+            for (unsigned j = 0; j < 4; j++) {
+                int16_t x = (int16_t)((d >> (6 * j)) & 7);
+                int16_t y = (int16_t)((d >> (6 * j + 3)) & 7);
+                r.c[4 * i + j] = (int16_t)(x - y);
+            }
+        }
+    }
+}
+
+// polys[i] = CBD_eta[i](PRF(seed, nonce0 + i)), com SHAKE256 x4
+void sampleNoise(Poly* const* polys, const unsigned* etas, unsigned count, const uint8_t seed[32], uint8_t nonce0) {
+    uint8_t inputs[4][33];
+    uint8_t buf[4][64 * 3];
+    for (unsigned base = 0; base < count; base += 4) {
+        const uint8_t* in[4];
+        uint8_t* out[4];
+        unsigned max_eta = 0;
+        for (unsigned l = 0; l < 4; l++) {
+            std::memcpy(inputs[l], seed, 32);
+            inputs[l][32] = (uint8_t)(nonce0 + base + l);
+            in[l] = inputs[l];
+            out[l] = buf[l];
+            if (base + l < count && etas[base + l] > max_eta) max_eta = etas[base + l];
+        }
+        shake256x4(in, 33, out, 64 * max_eta);
+        for (unsigned l = 0; l < 4 && base + l < count; l++) cbd(*polys[base + l], buf[l], etas[base + l]);
+    }
+    OPENSSL_cleanse(buf, sizeof(buf));
+}
+
+// ---------------------------------------------------------------------------
+// K-PKE
+// ---------------------------------------------------------------------------
+
+void pkeKeyGen(const MlKemParams& p, const uint8_t d[32], uint8_t* pk, uint8_t* sk) {
+    const unsigned k = p.k;
+    const PolyKernel& kern = kernel();
+    uint8_t seed[33];
+    uint8_t rho_sigma[64];
+    std::memcpy(seed, d, 32);
+    seed[32] = (uint8_t)k;
+    sha3_512Digest(seed, sizeof(seed), rho_sigma);
+    const uint8_t* rho = rho_sigma;
+    const uint8_t* sigma = rho_sigma + 32;
+
+    Poly a[MAX_K * MAX_K], s[MAX_K], e[MAX_K], t;
+    generateMatrix(a, rho, k, false);
+
+    Poly* noise[2 * MAX_K] = {};
+    unsigned etas[2 * MAX_K] = {};
+    for (unsigned i = 0; i < k; i++) {
+        noise[i] = &s[i];
+        noise[k + i] = &e[i];
+        etas[i] = etas[k + i] = p.eta1;
+    }
+    sampleNoise(noise, etas, 2 * k, sigma, 0);
+    for (unsigned i = 0; i < k; i++) {
+        kern.ntt(s[i].c);
+        kern.ntt(e[i].c);
+    }
+
+    for (unsigned i = 0; i < k; i++) {
+        basemulAcc(t, &a[i * k], s, k);
+        polyToMont(t);
+        polyAdd(t, e[i]);
+        kern.reduce(t.c);
+        packPoly(pk + i * POLY_BYTES, t, 12);
+        packPoly(sk + i * POLY_BYTES, s[i], 12);
+    }
+    std::memcpy(pk + k * POLY_BYTES, rho, 32);
+
+    OPENSSL_cleanse(rho_sigma, sizeof(rho_sigma));
+    OPENSSL_cleanse(s, sizeof(s));
+    OPENSSL_cleanse(e, sizeof(e));
+}
+
+void pkeEncrypt(const MlKemParams& p, uint8_t* ct, const uint8_t m[32], const uint8_t* pk, const uint8_t coins[32]) {
+    const unsigned k = p.k;
+    const PolyKernel& kern = kernel();
+    Poly at[MAX_K * MAX_K], t[MAX_K], y[MAX_K], e1[MAX_K], e2, u, v, mu;
+
+    for (unsigned i = 0; i < k; i++) unpackPoly(t[i], pk + i * POLY_BYTES, 12);
+    generateMatrix(at, pk + k * POLY_BYTES, k, true);
+
+    Poly* noise[2 * MAX_K + 1] = {};
+    unsigned etas[2 * MAX_K + 1] = {};
+    for (unsigned i = 0; i < k; i++) {
+        noise[i] = &y[i];
+        etas[i] = p.eta1;
+        noise[k + i] = &e1[i];
+        etas[k + i] = p.eta2;
+    }
+    noise[2 * k] = &e2;
+    etas[2 * k] = p.eta2;
+    sampleNoise(noise, etas, 2 * k + 1, coins, 0);
+    for (unsigned i = 0; i < k; i++) kern.ntt(y[i].c);
+
+    for (unsigned i = 0; i < k; i++) {
+        basemulAcc(u, &at[i * k], y, k);
+        kern.invntt(u.c);
+        polyAdd(u, e1[i]);
+        kern.reduce(u.c);
+        packPoly(ct + i * 32 * p.du, u, p.du);
+    }
+
+    messageToPoly(mu, m);
+    basemulAcc(v, t, y, k);
+    kern.invntt(v.c);
+    polyAdd(v, e2);
+    polyAdd(v, mu);
+    kern.reduce(v.c);
+    packPoly(ct + k * 32 * p.du, v, p.dv);
+
+    OPENSSL_cleanse(y, sizeof(y));
+    OPENSSL_cleanse(e1, sizeof(e1));
+    OPENSSL_cleanse(&e2, sizeof(e2));
+    OPENSSL_cleanse(&mu, sizeof(mu));
+}
+
+void pkeDecrypt(const MlKemParams& p, uint8_t m[32], const uint8_t* ct, const uint8_t* sk) {
+    const unsigned k = p.k;
+    const PolyKernel& kern = kernel();
+    Poly u[MAX_K], s[MAX_K], v, w;
+    for (unsigned i = 0; i < k; i++) {
+        unpackPoly(u[i], ct + i * 32 * p.du, p.du);
+        kern.ntt(u[i].c);
+        unpackPoly(s[i], sk + i * POLY_BYTES, 12);
+    }
+    unpackPoly(v, ct + k * 32 * p.du, p.dv);
+
+    basemulAcc(w, s, u, k);
+    kern.invntt(w.c);
+    for (unsigned j = 0; j < N; j++) w.c[j] = (int16_t)(v.c[j] - w.c[j]);
+    kern.reduce(w.c);
+    polyToMessage(m, w);
+
+    OPENSSL_cleanse(s, sizeof(s));
+    OPENSSL_cleanse(&w, sizeof(w));
+}
+
+bool aesGcm(bool encrypt, const uint8_t key[32], const uint8_t* in, size_t len, uint8_t* out, uint8_t tag[16]) {
+    if (len > (size_t)INT_MAX) return false;
+    static const uint8_t nonce[12] = {};
+    EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+    if (!ctx) return false;
+    int out_len = 0;
+    bool ok = EVP_CipherInit_ex(ctx, EVP_aes_256_gcm(), nullptr, key, nonce, encrypt ? 1 : 0) == 1;
+    if (ok && !encrypt) ok = EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, 16, tag) == 1;
+    if (ok && len > 0) ok = EVP_CipherUpdate(ctx, out, &out_len, in, (int)len) == 1;
+    if (ok) ok = EVP_CipherFinal_ex(ctx, out + out_len, &out_len) == 1;
+    if (ok && encrypt) ok = EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, 16, tag) == 1;
+    EVP_CIPHER_CTX_free(ctx);
+    return ok;
+}
+
+} // namespace
+
+const int16_t* mlKemZetas() {
+    static const ZetaTable table;
+    return table.z;
+}
+
+const MlKemParams& mlKemParams(MlKemLevel level) {
+    return PARAMS[(int)level];
+}
+
+MlKemLevel mlKemLevelForDimension(int dimension) {
+    if (dimension <= 512) return MlKemLevel::ML_KEM_512;
+    if (dimension <= 768) return MlKemLevel::ML_KEM_768;
+    return MlKemLevel::ML_KEM_1024;
+}
+
+const char* mlKemBackendName() {
+    return kernel().name;
+}
+
+void mlKemKeyGenDerand(MlKemLevel level, const uint8_t d[32], const uint8_t z[32],
+                       uint8_t* encaps_key, uint8_t* decaps_key) {
+    const MlKemParams& p = mlKemParams(level);
+    // dk = dk_pke || ek || H(ek) || z
+    pkeKeyGen(p, d, encaps_key, decaps_key);
+    uint8_t* tail = decaps_key + p.k * POLY_BYTES;
+    std::memcpy(tail, encaps_key, p.encaps_key_bytes);
+    sha3_256Digest(encaps_key, p.encaps_key_bytes, tail + p.encaps_key_bytes);
+    std::memcpy(tail + p.encaps_key_bytes + 32, z, 32);
+}
+
+bool mlKemKeyGen(MlKemLevel level, uint8_t* encaps_key, uint8_t* decaps_key) {
+    uint8_t seeds[64];
+    if (RAND_bytes(seeds, sizeof(seeds)) != 1) return false;
+    mlKemKeyGenDerand(level, seeds, seeds + 32, encaps_key, decaps_key);
+    OPENSSL_cleanse(seeds, sizeof(seeds));
+    return true;
+}
+
+bool mlKemEncapsDerand(MlKemLevel level, const uint8_t* encaps_key, const uint8_t m[32],
+                       uint8_t* ciphertext, uint8_t shared_secret[32]) {
+    const MlKemParams& p = mlKemParams(level);
+    // Verificação de módulo: ek deve ser a codificação canônica de t
+    Poly t;
+    for (unsigned i = 0; i < p.k; i++) {
+        if (!unpackPoly(t, encaps_key + i * POLY_BYTES, 12)) return false;
+    }
+
+    uint8_t buf[64], kr[64];
+    std::memcpy(buf, m, 32);
+    sha3_256Digest(encaps_key, p.encaps_key_bytes, buf + 32);
+    sha3_512Digest(buf, sizeof(buf), kr);
+    pkeEncrypt(p, ciphertext, m, encaps_key, kr + 32);
+    std::memcpy(shared_secret, kr, 32);
+
+    OPENSSL_cleanse(buf, sizeof(buf));
+    OPENSSL_cleanse(kr, sizeof(kr));
+    return true;
+}
+
+bool mlKemEncaps(MlKemLevel level, const uint8_t* encaps_key, uint8_t* ciphertext, uint8_t shared_secret[32]) {
+    uint8_t m[32];
+    if (RAND_bytes(m, sizeof(m)) != 1) return false;
+    bool ok = mlKemEncapsDerand(level, encaps_key, m, ciphertext, shared_secret);
+    OPENSSL_cleanse(m, sizeof(m));
+    return ok;
+}
+
+bool mlKemDecaps(MlKemLevel level, const uint8_t* decaps_key, const uint8_t* ciphertext, uint8_t shared_secret[32]) {
+    const MlKemParams& p = mlKemParams(level);
+    const uint8_t* ek = decaps_key + p.k * POLY_BYTES;
+    const uint8_t* h = ek + p.encaps_key_bytes;
+    const uint8_t* z = h + 32;
+
+    uint8_t check[32];
+    sha3_256Digest(ek, p.encaps_key_bytes, check);
+    if (CRYPTO_memcmp(check, h, 32) != 0) return false;
+
+    uint8_t buf[64], kr[64], rejected[32];
+    uint8_t reencrypted[MAX_CIPHERTEXT_BYTES];
+    pkeDecrypt(p, buf, ciphertext, decaps_key);
+    std::memcpy(buf + 32, h, 32);
+    sha3_512Digest(buf, sizeof(buf), kr);
+    pkeEncrypt(p, reencrypted, buf, ek, kr + 32);
+
+    // Rejeição implícita: K_bar = J(z || c), escolhido sem desvio
+    KeccakSponge j(136, 0x1f);
+    j.absorb(z, 32).absorb(ciphertext, p.ciphertext_bytes);
+    j.squeeze(rejected, 32);
+
+    uint8_t diff = 0;
+    for (size_t i = 0; i < p.ciphertext_bytes; i++) diff |= (uint8_t)(ciphertext[i] ^ reencrypted[i]);
+    uint8_t mask = (uint8_t)(0u - (((uint32_t)diff | (0u - (uint32_t)diff)) >> 31));
+    for (unsigned i = 0; i < 32; i++) shared_secret[i] = (uint8_t)(kr[i] ^ (mask & (kr[i] ^ rejected[i])));
+
+    OPENSSL_cleanse(buf, sizeof(buf));
+    OPENSSL_cleanse(kr, sizeof(kr));
+    OPENSSL_cleanse(rejected, sizeof(rejected));
+    return true;
+}
+
+bool mlKemSeal(MlKemLevel level, const uint8_t* encaps_key, const uint8_t* data, size_t len, std::string& out) {
+    const MlKemParams& p = mlKemParams(level);
+    out.assign(p.ciphertext_bytes + 16 + len, '\0');
+    uint8_t* o = (uint8_t*)&out[0];
+    uint8_t key[32];
+    bool ok = mlKemEncaps(level, encaps_key, o, key) &&
+              aesGcm(true, key, data, len, o + p.ciphertext_bytes + 16, o + p.ciphertext_bytes);
+    OPENSSL_cleanse(key, sizeof(key));
+    if (!ok) out.clear();
+    return ok;
+}
+
+bool mlKemOpen(MlKemLevel level, const uint8_t* decaps_key, const uint8_t* sealed, size_t len, std::string& out) {
+    const MlKemParams& p = mlKemParams(level);
+    out.clear();
+    if (len < p.ciphertext_bytes + 16) return false;
+    uint8_t key[32], tag[16];
+    if (!mlKemDecaps(level, decaps_key, sealed, key)) return false;
+    std::memcpy(tag, sealed + p.ciphertext_bytes, 16);
+    size_t data_len = len - p.ciphertext_bytes - 16;
+    out.assign(data_len, '\0');
+    bool ok = aesGcm(false, key, sealed + p.ciphertext_bytes + 16, data_len, (uint8_t*)&out[0], tag);
+    OPENSSL_cleanse(key, sizeof(key));
+    if (!ok) {
+        OPENSSL_cleanse(&out[0], out.size());
+        out.clear();
+    }
+    return ok;
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,239 @@
+// NTT do ML-KEM em AVX2: 16 coeficientes int16 por registrador, redução de
+// Montgomery com mullo/mulhi e Barrett com mulhi/mulhrs. As três últimas
+// camadas (len 8, 4, 2) cruzam elementos do mesmo registrador e são feitas
+// com permutações entre pares de registradores. Compilado com -mavx2 e
+// chamado apenas quando cpuFeatures().avx2 é verdadeiro.
+#include "../include/adilsoncrypto_mlkem.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#ifndef __AVX2__
+#error "adilsoncrypto_mlkem_avx2.cpp precisa ser compilado com -mavx2"
+#endif
+#include <immintrin.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+inline __m256i load(const int16_t* p) { return _mm256_loadu_si256((const __m256i*)p); }
+inline void store(int16_t* p, __m256i v) { _mm256_storeu_si256((__m256i*)p, v); }
+
+// a * b * R^-1 mod q, com b_qinv = b * q^-1 mod 2^16 pré-calculado
+inline __m256i fqmul(__m256i a, __m256i b, __m256i b_qinv) {
+    __m256i hi = _mm256_mulhi_epi16(a, b);
+    __m256i t = _mm256_mullo_epi16(a, b_qinv);
+    t = _mm256_mulhi_epi16(t, _mm256_set1_epi16(MLKEM_Q));
+    return _mm256_sub_epi16(hi, t);
+}
+
+inline __m256i fqmul(__m256i a, __m256i b) {
+    return fqmul(a, b, _mm256_mullo_epi16(b, _mm256_set1_epi16(MLKEM_QINV)));
+}
+
+// Representante centrado: t = round(a * v / 2^26), v = round(2^26 / q)
+inline __m256i barrett(__m256i a) {
+    __m256i t = _mm256_mulhi_epi16(a, _mm256_set1_epi16(20159));
+    t = _mm256_mulhrs_epi16(t, _mm256_set1_epi16(1 << 5));
+    t = _mm256_mullo_epi16(t, _mm256_set1_epi16(MLKEM_Q));
+    return _mm256_sub_epi16(a, t);
+}
+
+// Separa 32 coeficientes (a = 0..15, b = 16..31) em x = elementos inferiores
+// e y = superiores das borboletas de distância LEN; merge desfaz.
+template <int LEN> void split(__m256i a, __m256i b, __m256i& x, __m256i& y);
+template <int LEN> void merge(__m256i x, __m256i y, __m256i& a, __m256i& b);
+
+template <> inline void split<8>(__m256i a, __m256i b, __m256i& x, __m256i& y) {
+    x = _mm256_permute2x128_si256(a, b, 0x20);
+    y = _mm256_permute2x128_si256(a, b, 0x31);
+}
+template <> inline void merge<8>(__m256i x, __m256i y, __m256i& a, __m256i& b) {
+    split<8>(x, y, a, b);
+}
+
+template <> inline void split<4>(__m256i a, __m256i b, __m256i& x, __m256i& y) {
+    x = _mm256_unpacklo_epi64(a, b);
+    y = _mm256_unpackhi_epi64(a, b);
+}
+template <> inline void merge<4>(__m256i x, __m256i y, __m256i& a, __m256i& b) {
+    split<4>(x, y, a, b);
+}
+
+// Pares de int16 (palavras de 32 bits) d0 d2 | d1 d3 em cada metade
+template <> inline void split<2>(__m256i a, __m256i b, __m256i& x, __m256i& y) {
+    a = _mm256_shuffle_epi32(a, 0xD8);
+    b = _mm256_shuffle_epi32(b, 0xD8);
+    x = _mm256_unpacklo_epi64(a, b);
+    y = _mm256_unpackhi_epi64(a, b);
+}
+template <> inline void merge<2>(__m256i x, __m256i y, __m256i& a, __m256i& b) {
+    a = _mm256_shuffle_epi32(_mm256_unpacklo_epi64(x, y), 0xD8);
+    b = _mm256_shuffle_epi32(_mm256_unpackhi_epi64(x, y), 0xD8);
+}
+
+// Zetas expandidos na ordem das lanes de x, um vetor por par de registradores
+struct alignas(32) ExpandedZetas {
+    int16_t fwd[3][8][16], fwd_qinv[3][8][16];     // camadas len 8, 4, 2
+    int16_t inv[3][8][16], inv_qinv[3][8][16];     // camadas len 2, 4, 8
+    int16_t mul[16][16], mul_qinv[16][16];         // basemul: +zeta e -zeta nas lanes pares
+
+    // Índice do coeficiente inferior de cada lane de x, obtido aplicando a
+    // própria permutação a um vetor de índices
+    template <int LEN>
+    static void lowerIndices(unsigned pair, int16_t out[16]) {
+        alignas(32) int16_t ia[16], ib[16];
+        for (int i = 0; i < 16; i++) {
+            ia[i] = (int16_t)(32 * pair + i);
+            ib[i] = (int16_t)(32 * pair + 16 + i);
+        }
+        __m256i x, y;
+        split<LEN>(load(ia), load(ib), x, y);
+        store(out, x);
+    }
+
+    template <int LEN>
+    void fill(int layer_fwd, int layer_inv, const int16_t* zetas) {
+        for (unsigned pair = 0; pair < 8; pair++) {
+            int16_t idx[16];
+            lowerIndices<LEN>(pair, idx);
+            for (int l = 0; l < 16; l++) {
+                unsigned block = (unsigned)idx[l] / (2 * LEN);
+                int16_t zf = zetas[128 / LEN + block];
+                int16_t zi = zetas[256 / LEN - 1 - block];
+                fwd[layer_fwd][pair][l] = zf;
+                fwd_qinv[layer_fwd][pair][l] = (int16_t)(zf * MLKEM_QINV);
+                inv[layer_inv][pair][l] = zi;
+                inv_qinv[layer_inv][pair][l] = (int16_t)(zi * MLKEM_QINV);
+            }
+        }
+    }
+
+    ExpandedZetas() {
+        const int16_t* zetas = mlKemZetas();
+        fill<8>(0, 2, zetas);
+        fill<4>(1, 1, zetas);
+        fill<2>(2, 0, zetas);
+        for (unsigned v = 0; v < 16; v++) {
+            for (unsigned g = 0; g < 4; g++) {
+                int16_t z = zetas[64 + 4 * v + g];
+                int16_t lanes[4] = { z, 0, (int16_t)-z, 0 };
+                for (unsigned l = 0; l < 4; l++) {
+                    mul[v][4 * g + l] = lanes[l];
+                    mul_qinv[v][4 * g + l] = (int16_t)(lanes[l] * MLKEM_QINV);
+                }
+            }
+        }
+    }
+};
+
+const ExpandedZetas& expandedZetas() {
+    static const ExpandedZetas table;
+    return table;
+}
+
+template <int LEN>
+inline void forwardShuffled(__m256i& a, __m256i& b, const int16_t* z, const int16_t* zq) {
+    __m256i x, y;
+    split<LEN>(a, b, x, y);
+    __m256i t = fqmul(y, load(z), load(zq));
+    merge<LEN>(_mm256_add_epi16(x, t), _mm256_sub_epi16(x, t), a, b);
+}
+
+template <int LEN>
+inline void inverseShuffled(__m256i& a, __m256i& b, const int16_t* z, const int16_t* zq) {
+    __m256i x, y;
+    split<LEN>(a, b, x, y);
+    __m256i sum = barrett(_mm256_add_epi16(x, y));
+    __m256i diff = fqmul(_mm256_sub_epi16(y, x), load(z), load(zq));
+    merge<LEN>(sum, diff, a, b);
+}
+
+} // namespace
+
+void mlKemNttAvx2(int16_t r[256]) {
+    const int16_t* zetas = mlKemZetas();
+    const ExpandedZetas& ez = expandedZetas();
+
+    unsigned k = 1;
+    for (unsigned len = 128; len >= 16; len >>= 1) {
+        for (unsigned start = 0; start < 256; start += 2 * len) {
+            __m256i z = _mm256_set1_epi16(zetas[k]);
+            __m256i zq = _mm256_set1_epi16((int16_t)(zetas[k] * MLKEM_QINV));
+            k++;
+            for (unsigned j = start; j < start + len; j += 16) {
+                __m256i a = load(r + j);
+                __m256i t = fqmul(load(r + j + len), z, zq);
+                store(r + j + len, _mm256_sub_epi16(a, t));
+                store(r + j, _mm256_add_epi16(a, t));
+            }
+        }
+    }
+
+    for (unsigned pair = 0; pair < 8; pair++) {
+        __m256i a = load(r + 32 * pair);
+        __m256i b = load(r + 32 * pair + 16);
+        forwardShuffled<8>(a, b, ez.fwd[0][pair], ez.fwd_qinv[0][pair]);
+        forwardShuffled<4>(a, b, ez.fwd[1][pair], ez.fwd_qinv[1][pair]);
+        forwardShuffled<2>(a, b, ez.fwd[2][pair], ez.fwd_qinv[2][pair]);
+        store(r + 32 * pair, barrett(a));
+        store(r + 32 * pair + 16, barrett(b));
+    }
+}
+
+void mlKemInvNttAvx2(int16_t r[256]) {
+    const int16_t* zetas = mlKemZetas();
+    const ExpandedZetas& ez = expandedZetas();
+
+    for (unsigned pair = 0; pair < 8; pair++) {
+        __m256i a = load(r + 32 * pair);
+        __m256i b = load(r + 32 * pair + 16);
+        inverseShuffled<2>(a, b, ez.inv[0][pair], ez.inv_qinv[0][pair]);
+        inverseShuffled<4>(a, b, ez.inv[1][pair], ez.inv_qinv[1][pair]);
+        inverseShuffled<8>(a, b, ez.inv[2][pair], ez.inv_qinv[2][pair]);
+        store(r + 32 * pair, a);
+        store(r + 32 * pair + 16, b);
+    }
+
+    unsigned k = 15;
+    for (unsigned len = 16; len <= 128; len <<= 1) {
+        for (unsigned start = 0; start < 256; start += 2 * len) {
+            __m256i z = _mm256_set1_epi16(zetas[k]);
+            __m256i zq = _mm256_set1_epi16((int16_t)(zetas[k] * MLKEM_QINV));
+            k--;
+            for (unsigned j = start; j < start + len; j += 16) {
+                __m256i a = load(r + j);
+                __m256i b = load(r + j + len);
+                store(r + j, barrett(_mm256_add_epi16(a, b)));
+                store(r + j + len, fqmul(_mm256_sub_epi16(b, a), z, zq));
+            }
+        }
+    }
+
+    __m256i f = _mm256_set1_epi16(MLKEM_INVNTT_F);
+    __m256i fq = _mm256_set1_epi16((int16_t)(MLKEM_INVNTT_F * MLKEM_QINV));
+    for (unsigned j = 0; j < 256; j += 16) store(r + j, fqmul(load(r + j), f, fq));
+}
+
+// Lanes pares recebem a0 b0 + zeta a1 b1, ímpares a0 b1 + a1 b0
+void mlKemBasemulAvx2(int16_t r[256], const int16_t a[256], const int16_t b[256]) {
+    const ExpandedZetas& ez = expandedZetas();
+    for (unsigned v = 0; v < 16; v++) {
+        __m256i va = load(a + 16 * v);
+        __m256i vb = load(b + 16 * v);
+        __m256i vb_swapped = _mm256_or_si256(_mm256_slli_epi32(vb, 16), _mm256_srli_epi32(vb, 16));
+        __m256i p = fqmul(va, vb);              // pares: a0 b0, ímpares: a1 b1
+        __m256i s = fqmul(va, vb_swapped);      // pares: a0 b1, ímpares: a1 b0
+        __m256i tz = fqmul(_mm256_srli_epi32(p, 16), load(ez.mul[v]), load(ez.mul_qinv[v]));
+        __m256i even = _mm256_add_epi16(tz, p);
+        __m256i odd = _mm256_add_epi16(s, _mm256_slli_epi32(s, 16));
+        store(r + 16 * v, _mm256_blend_epi16(even, odd, 0xAA));
+    }
+}
+
+void mlKemReduceAvx2(int16_t r[256]) {
+    for (unsigned j = 0; j < 256; j += 16) store(r + j, barrett(load(r + j)));
+}
+
+} // namespace adilsoncrypto
+
+#endif
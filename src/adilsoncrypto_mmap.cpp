@@ -0,0 +1,107 @@
+#include "../include/adilsoncrypto_mmap.h"
+#include <cstdio>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace adilsoncrypto {
+
+bool MappedFile::open(const std::string& path, bool create, uint64_t bytes, bool writable) {
+    close();
+    this->writable = writable || create;
+#if defined(_WIN32)
+    const DWORD access = this->writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+    HANDLE file = CreateFileA(path.c_str(), access, FILE_SHARE_READ, nullptr, create ? CREATE_ALWAYS : OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    handle = file;
+    LARGE_INTEGER length;
+    if (create) {
+        length.QuadPart = (LONGLONG)bytes;
+        if (!SetFilePointerEx(file, length, nullptr, FILE_BEGIN) || !SetEndOfFile(file)) return false;
+    } else if (!GetFileSizeEx(file, &length)) {
+        return false;
+    }
+    size = (uint64_t)length.QuadPart;
+    if (size == 0) return false;
+    mapping = CreateFileMappingA(file, nullptr, this->writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) return false;
+    data = (uint8_t*)MapViewOfFile((HANDLE)mapping, this->writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0);
+    return data != nullptr;
+#else
+    int flags = this->writable ? O_RDWR : O_RDONLY;
+    if (create) flags |= O_CREAT | O_TRUNC;
+    fd = ::open(path.c_str(), flags, 0600);
+    if (fd < 0) return false;
+    struct stat st;
+    if (create) {
+        if (ftruncate(fd, (off_t)bytes) != 0 || fsync(fd) != 0) return false;
+        size = bytes;
+    } else {
+        if (fstat(fd, &st) != 0) return false;
+        size = (uint64_t)st.st_size;
+    }
+    if (size == 0) return false;
+    const int prot = this->writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void* mapped = mmap(nullptr, size, prot, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) return false;
+    data = (uint8_t*)mapped;
+    return true;
+#endif
+}
+
+void MappedFile::flush(const void* begin, size_t len) {
+    if (!data || !writable) return;
+#if defined(_WIN32)
+    FlushViewOfFile(begin, len);
+    FlushFileBuffers((HANDLE)handle);
+#else
+    static const uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t start = (uintptr_t)begin & ~(page - 1);
+    msync((void*)start, (uintptr_t)begin + len - start, MS_SYNC);
+#endif
+}
+
+void MappedFile::close() {
+#if defined(_WIN32)
+    if (data) UnmapViewOfFile(data);
+    if (mapping) CloseHandle((HANDLE)mapping);
+    if (handle) CloseHandle((HANDLE)handle);
+    mapping = nullptr;
+    handle = nullptr;
+#else
+    if (data) munmap(data, size);
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+bool replaceFile(const std::string& from, const std::string& to) {
+#if defined(_WIN32)
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    if (std::rename(from.c_str(), to.c_str()) != 0) return false;
+    // O rename só é durável depois do fsync do diretório
+    size_t slash = to.find_last_of('/');
+    std::string dir = slash == std::string::npos ? "." : (slash == 0 ? "/" : to.substr(0, slash));
+    int fd = ::open(dir.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        fsync(fd);
+        ::close(fd);
+    }
+    return true;
+#endif
+}
+
+} // namespace adilsoncrypto
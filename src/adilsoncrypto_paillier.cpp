@@ -0,0 +1,438 @@
+#include "../include/adilsoncrypto_paillier.h"
+#include "../include/adilsoncrypto_util.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <openssl/crypto.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const size_t DEFAULT_PRECOMPUTE = 256;
+const size_t SUM_GRAIN = 256;
+
+struct BnCtx {
+    BN_CTX* ctx;
+    BnCtx() : ctx(BN_CTX_new()) {}
+    ~BnCtx() { BN_CTX_free(ctx); }
+    operator BN_CTX*() const { return ctx; }
+};
+
+struct Bn {
+    BIGNUM* bn;
+    Bn() : bn(BN_new()) {}
+    ~Bn() { BN_clear_free(bn); }
+    operator BIGNUM*() const { return bn; }
+};
+
+BN_MONT_CTX* montFor(const BIGNUM* modulus, BN_CTX* ctx) {
+    BN_MONT_CTX* mont = BN_MONT_CTX_new();
+    if (mont && !BN_MONT_CTX_set(mont, modulus, ctx)) {
+        BN_MONT_CTX_free(mont);
+        return nullptr;
+    }
+    return mont;
+}
+
+// h = L(g^(p-1) mod p^2)^-1 mod p, com L(x) = (x - 1) / p
+bool crtHelper(const BIGNUM* g, const BIGNUM* prime, const BIGNUM* prime2, const BIGNUM* prime_minus_1,
+               BIGNUM* h, BN_CTX* ctx) {
+    Bn x;
+    return BN_mod_exp(x, g, prime_minus_1, prime2, ctx) && BN_sub_word(x, 1) &&
+           BN_div(x, nullptr, x, prime, ctx) && BN_mod_inverse(h, x, prime, ctx) != nullptr;
+}
+
+} // namespace
+
+Paillier::Paillier()
+    : n(nullptr), n2(nullptr), mont_n2(nullptr), cipher_bytes(0),
+      p(nullptr), q(nullptr), p2(nullptr), q2(nullptr), p_minus_1(nullptr), q_minus_1(nullptr),
+      hp(nullptr), hq(nullptr), q_inv_p(nullptr), q2_inv_p2(nullptr), n_mod_phi_p2(nullptr), n_mod_phi_q2(nullptr),
+      mont_p2(nullptr), mont_q2(nullptr), capacity(DEFAULT_PRECOMPUTE), stopping(false) {}
+
+Paillier::~Paillier() {
+    stopPrecompute();
+    clear();
+}
+
+void Paillier::clear() {
+    BN_free(n);
+    BN_free(n2);
+    BN_MONT_CTX_free(mont_n2);
+    for (BIGNUM* secret : { p, q, p2, q2, p_minus_1, q_minus_1, hp, hq, q_inv_p, q2_inv_p2, n_mod_phi_p2, n_mod_phi_q2 }) {
+        BN_clear_free(secret);
+    }
+    BN_MONT_CTX_free(mont_p2);
+    BN_MONT_CTX_free(mont_q2);
+    n = n2 = p = q = p2 = q2 = p_minus_1 = q_minus_1 = hp = hq = q_inv_p = q2_inv_p2 = nullptr;
+    n_mod_phi_p2 = n_mod_phi_q2 = nullptr;
+    mont_n2 = mont_p2 = mont_q2 = nullptr;
+    cipher_bytes = 0;
+    factors.clear();
+}
+
+bool Paillier::setPublicKey(const uint8_t* modulus, size_t len) {
+    stopPrecompute();
+    clear();
+    BnCtx ctx;
+    n = BN_bin2bn(modulus, (int)len, nullptr);
+    n2 = BN_new();
+    if (!n || !n2 || BN_is_zero(n) || !BN_is_odd(n) || !BN_sqr(n2, n, ctx) || !(mont_n2 = montFor(n2, ctx))) {
+        clear();
+        return false;
+    }
+    cipher_bytes = (size_t)BN_num_bytes(n2);
+    setPrecomputeCapacity(capacity);
+    return true;
+}
+
+bool Paillier::generateKey(int modulus_bits) {
+    stopPrecompute();
+    clear();
+    BnCtx ctx;
+    const int prime_bits = modulus_bits / 2;
+    p = BN_new();
+    q = BN_new();
+    bool ok = p && q;
+    // p e q do mesmo tamanho garantem gcd(pq, (p-1)(q-1)) = 1
+    do {
+        ok = ok && BN_generate_prime_ex(p, prime_bits, 0, nullptr, nullptr, nullptr) &&
+             BN_generate_prime_ex(q, prime_bits, 0, nullptr, nullptr, nullptr);
+    } while (ok && BN_cmp(p, q) == 0);
+
+    n = BN_new();
+    n2 = BN_new();
+    p2 = BN_new();
+    q2 = BN_new();
+    p_minus_1 = BN_new();
+    q_minus_1 = BN_new();
+    hp = BN_new();
+    hq = BN_new();
+    q_inv_p = BN_new();
+    q2_inv_p2 = BN_new();
+    n_mod_phi_p2 = BN_new();
+    n_mod_phi_q2 = BN_new();
+    Bn g, phi;
+    ok = ok && BN_mul(n, p, q, ctx) && BN_sqr(n2, n, ctx) && BN_sqr(p2, p, ctx) && BN_sqr(q2, q, ctx) &&
+         BN_copy(p_minus_1, p) && BN_sub_word(p_minus_1, 1) && BN_copy(q_minus_1, q) && BN_sub_word(q_minus_1, 1) &&
+         BN_copy(g, n) && BN_add_word(g, 1) &&
+         crtHelper(g, p, p2, p_minus_1, hp, ctx) && crtHelper(g, q, q2, q_minus_1, hq, ctx) &&
+         BN_mod_inverse(q_inv_p, q, p, ctx) && BN_mod_inverse(q2_inv_p2, q2, p2, ctx) &&
+         BN_mul(phi, p, p_minus_1, ctx) && BN_mod(n_mod_phi_p2, n, phi, ctx) &&
+         BN_mul(phi, q, q_minus_1, ctx) && BN_mod(n_mod_phi_q2, n, phi, ctx) &&
+         (mont_n2 = montFor(n2, ctx)) && (mont_p2 = montFor(p2, ctx)) && (mont_q2 = montFor(q2, ctx));
+    if (!ok) {
+        clear();
+        return false;
+    }
+    for (BIGNUM* secret : { p, q, p_minus_1, q_minus_1, n_mod_phi_p2, n_mod_phi_q2 }) {
+        BN_set_flags(secret, BN_FLG_CONSTTIME);
+    }
+    cipher_bytes = (size_t)BN_num_bytes(n2);
+    setPrecomputeCapacity(capacity);
+    return true;
+}
+
+int Paillier::modulusBits() const {
+    return n ? BN_num_bits(n) : 0;
+}
+
+std::vector<uint8_t> Paillier::publicKey() const {
+    std::vector<uint8_t> out(n ? (size_t)BN_num_bytes(n) : 0);
+    if (n) BN_bn2bin(n, out.data());
+    return out;
+}
+
+bool Paillier::randomFactor(BIGNUM* out, BN_CTX* ctx) const {
+    Bn r;
+    do {
+        if (!BN_priv_rand_range(r, n)) return false;
+    } while (BN_is_zero(r));
+
+    if (!p) {
+        return BN_mod_exp_mont(out, r, n, n2, ctx, mont_n2) && BN_to_montgomery(out, out, mont_n2, ctx);
+    }
+    // r^n mod p^2 e mod q^2 com expoente reduzido mod p(p-1) / q(q-1) e
+    // recombinação x = x_q + q^2 ((x_p - x_q) q^-2 mod p^2)
+    Bn xp, xq, t;
+    bool ok = BN_mod(t, r, p2, ctx) && BN_mod_exp_mont(xp, t, n_mod_phi_p2, p2, ctx, mont_p2) &&
+              BN_mod(t, r, q2, ctx) && BN_mod_exp_mont(xq, t, n_mod_phi_q2, q2, ctx, mont_q2) &&
+              BN_mod_sub(t, xp, xq, p2, ctx) && BN_mod_mul(t, t, q2_inv_p2, p2, ctx) &&
+              BN_mul(t, t, q2, ctx) && BN_add(out, t, xq);
+    return ok && BN_to_montgomery(out, out, mont_n2, ctx);
+}
+
+void Paillier::setPrecomputeCapacity(size_t new_capacity) {
+    stopPrecompute();
+    capacity = new_capacity;
+    if (capacity == 0 || !n) return;
+    stopping = false;
+    worker = std::thread(&Paillier::precomputeLoop, this);
+}
+
+size_t Paillier::precomputedAvailable() const {
+    std::lock_guard<std::mutex> lock(queue_mutex);
+    return factors.size();
+}
+
+void Paillier::stopPrecompute() {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stopping = true;
+    }
+    queue_wake.notify_all();
+    if (worker.joinable()) worker.join();
+    std::lock_guard<std::mutex> lock(queue_mutex);
+    for (std::vector<uint8_t>& factor : factors) OPENSSL_cleanse(factor.data(), factor.size());
+    factors.clear();
+}
+
+// Repõe a fila sempre que encrypt consome um fator
+void Paillier::precomputeLoop() {
+    BnCtx ctx;
+    Bn factor;
+    std::vector<uint8_t> bytes(cipher_bytes);
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    for (;;) {
+        queue_wake.wait(lock, [&] { return stopping || factors.size() < capacity; });
+        if (stopping) return;
+        lock.unlock();
+        bool ok = randomFactor(factor, ctx);
+        if (ok) store(factor, bytes.data());
+        lock.lock();
+        if (!ok) return;
+        factors.push_back(bytes);
+        OPENSSL_cleanse(bytes.data(), bytes.size());
+    }
+}
+
+bool Paillier::load(const uint8_t* c, BIGNUM* out) const {
+    return BN_bin2bn(c, (int)cipher_bytes, out) && BN_cmp(out, n2) < 0 && !BN_is_zero(out);
+}
+
+void Paillier::store(const BIGNUM* c, uint8_t* out) const {
+    BN_bn2binpad(c, out, (int)cipher_bytes);
+}
+
+bool Paillier::encrypt(int64_t m, uint8_t* out) const {
+    if (!n) return false;
+    BnCtx ctx;
+    Bn factor, c;
+
+    std::vector<uint8_t> pooled;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (!factors.empty()) {
+            pooled.swap(factors.front());
+            factors.pop_front();
+        }
+    }
+    if (!pooled.empty()) {
+        queue_wake.notify_one();
+        BN_bin2bn(pooled.data(), (int)pooled.size(), factor);
+        OPENSSL_cleanse(pooled.data(), pooled.size());
+    } else if (!randomFactor(factor, ctx)) {
+        return false;
+    }
+
+    // g^m = 1 + m n (mod n^2), com m representado em [0, n)
+    uint64_t magnitude = m < 0 ? 0 - (uint64_t)m : (uint64_t)m;
+    bool ok = BN_set_word(c, magnitude) && BN_mod(c, c, n, ctx);
+    if (ok && m < 0 && !BN_is_zero(c)) ok = BN_sub(c, n, c);
+    ok = ok && BN_mul(c, c, n, ctx) && BN_add_word(c, 1) && BN_mod_mul_montgomery(c, c, factor, mont_n2, ctx);
+    if (ok) store(c, out);
+    return ok;
+}
+
+bool Paillier::decrypt(const uint8_t* ciphertext, int64_t& m) const {
+    if (!p) return false;
+    BnCtx ctx;
+    Bn c, t, mp, mq;
+    if (!load(ciphertext, c)) return false;
+
+    // m_p = L_p(c^(p-1) mod p^2) h_p mod p, idem q; m = m_q + q ((m_p - m_q) q^-1 mod p)
+    auto half = [&](const BIGNUM* prime, const BIGNUM* prime2, const BIGNUM* exponent, BN_MONT_CTX* mont,
+                    const BIGNUM* h, BIGNUM* out) {
+        return BN_mod(t, c, prime2, ctx) && BN_mod_exp_mont(t, t, exponent, prime2, ctx, mont) &&
+               BN_sub_word(t, 1) && BN_div(t, nullptr, t, prime, ctx) && BN_mod_mul(out, t, h, prime, ctx);
+    };
+    bool ok = half(p, p2, p_minus_1, mont_p2, hp, mp) && half(q, q2, q_minus_1, mont_q2, hq, mq) &&
+              BN_mod_sub(t, mp, mq, p, ctx) && BN_mod_mul(t, t, q_inv_p, p, ctx) &&
+              BN_mul(t, t, q, ctx) && BN_add(t, t, mq);
+    if (!ok) return false;
+
+    // Valores acima de n / 2 são negativos
+    Bn half_n;
+    if (!BN_rshift1(half_n, n)) return false;
+    bool negative = BN_cmp(t, half_n) > 0;
+    if (negative && !BN_sub(t, n, t)) return false;
+    if (BN_num_bits(t) > 64) return false;
+    uint8_t bytes[8];
+    BN_bn2binpad(t, bytes, sizeof(bytes));
+    uint64_t magnitude = 0;
+    for (uint8_t b : bytes) magnitude = (magnitude << 8) | b;
+    // Negativos vão até 2^63 (INT64_MIN), positivos até 2^63 - 1
+    const uint64_t limit = ((uint64_t)1 << 63) - (negative ? 0 : 1);
+    if (magnitude > limit) return false;
+    m = negative ? (int64_t)(0 - magnitude) : (int64_t)magnitude;
+    return true;
+}
+
+bool Paillier::add(const uint8_t* a, const uint8_t* b, uint8_t* out) const {
+    if (!n) return false;
+    BnCtx ctx;
+    Bn x, y;
+    // (a R)(b) R^-1 = a b: uma conversão e uma multiplicação de Montgomery
+    bool ok = load(a, x) && load(b, y) && BN_to_montgomery(x, x, mont_n2, ctx) &&
+              BN_mod_mul_montgomery(x, x, y, mont_n2, ctx);
+    if (ok) store(x, out);
+    return ok;
+}
+
+bool Paillier::multiplyScalar(const uint8_t* c, int64_t k, uint8_t* out) const {
+    if (!n) return false;
+    BnCtx ctx;
+    Bn x, e;
+    uint64_t magnitude = k < 0 ? 0 - (uint64_t)k : (uint64_t)k;
+    bool ok = load(c, x) && BN_set_word(e, magnitude);
+    if (ok && k < 0) ok = BN_mod_inverse(x, x, n2, ctx) != nullptr;
+    ok = ok && BN_mod_exp_mont(x, x, e, n2, ctx, mont_n2);
+    if (ok) store(x, out);
+    return ok;
+}
+
+// Cada termo custa uma multiplicação de Montgomery sem conversões: após k
+// termos o acumulador vale (produto) R^-(k-1), corrigido no fim com uma
+// multiplicação por R^k (em forma de Montgomery, R^(k-1) mod n^2)
+bool Paillier::sum(const uint8_t* const* cs, size_t count, uint8_t* out, ThreadPool* pool) const {
+    if (!n) return false;
+    const size_t chunks = (count + SUM_GRAIN - 1) / SUM_GRAIN;
+    std::vector<uint8_t> partials(std::max<size_t>(chunks, 1) * cipher_bytes, 0);
+    std::vector<char> chunk_ok(chunks, 0);
+
+    auto reduce = [&](size_t begin, size_t end) {
+        BnCtx ctx;
+        Bn acc, x, correction;
+        for (size_t chunk = begin; chunk < end; chunk++) {
+            const size_t first = chunk * SUM_GRAIN, last = std::min(count, first + SUM_GRAIN);
+            bool ok = load(cs[first], acc);
+            for (size_t i = first + 1; ok && i < last; i++) {
+                ok = load(cs[i], x) && BN_mod_mul_montgomery(acc, acc, x, mont_n2, ctx);
+            }
+            ok = ok && BN_one(x) && BN_to_montgomery(x, x, mont_n2, ctx) && BN_set_word(correction, last - first) &&
+                 BN_mod_exp_mont(correction, x, correction, n2, ctx, mont_n2) &&
+                 BN_mod_mul_montgomery(acc, acc, correction, mont_n2, ctx);
+            if (ok) store(acc, &partials[chunk * cipher_bytes]);
+            chunk_ok[chunk] = ok;
+        }
+    };
+    if (pool) {
+        pool->parallelFor(chunks, 1, reduce);
+    } else {
+        reduce(0, chunks);
+    }
+
+    if (chunks == 0) {
+        partials[cipher_bytes - 1] = 1;
+    } else if (std::find(chunk_ok.begin(), chunk_ok.end(), 0) != chunk_ok.end()) {
+        return false;
+    }
+    for (size_t chunk = 1; chunk < chunks; chunk++) {
+        if (!add(partials.data(), &partials[chunk * cipher_bytes], partials.data())) return false;
+    }
+    std::memcpy(out, partials.data(), cipher_bytes);
+    return true;
+}
+
+} // namespace adilsoncrypto
+
+using namespace adilsoncrypto;
+
+// HomomorphicData: encrypted_value = texto cifrado em hex (tamanho fixo),
+// public_key = n em hex, parameters = "paillier-<bits>". Erros devolvem
+// HomomorphicData vazio (decrypt devolve 0).
+class PaillierEncryption : public IHomomorphicEncryption {
+private:
+    int modulus_bits;
+    Paillier engine;
+    std::string public_key_hex;
+    std::string parameters;
+
+    HomomorphicData wrap(const std::vector<uint8_t>& c) const {
+        HomomorphicData data;
+        data.encrypted_value = bytesToHex(c.data(), c.size());
+        data.public_key = public_key_hex;
+        data.parameters = parameters;
+        return data;
+    }
+
+    // Só aceita textos cifrados sob esta mesma chave
+    bool unwrap(const HomomorphicData& data, std::string& bytes) const {
+        return data.public_key == public_key_hex && hexToBytes(data.encrypted_value, bytes) &&
+               bytes.size() == engine.ciphertextBytes();
+    }
+
+public:
+    explicit PaillierEncryption(int bits) : modulus_bits(bits) {
+        if (engine.generateKey(bits)) {
+            std::vector<uint8_t> n = engine.publicKey();
+            public_key_hex = bytesToHex(n.data(), n.size());
+            parameters = "paillier-" + std::to_string(engine.modulusBits());
+        }
+    }
+
+    std::unique_ptr<IHomomorphicEncryption> createHomomorphicEncryption() override {
+        return createPaillierEncryption(modulus_bits);
+    }
+
+    HomomorphicData encrypt(int value) override {
+        std::vector<uint8_t> c(engine.ciphertextBytes());
+        return engine.encrypt(value, c.data()) ? wrap(c) : HomomorphicData();
+    }
+
+    HomomorphicData add(const HomomorphicData& a, const HomomorphicData& b) override {
+        std::string x, y;
+        std::vector<uint8_t> c(engine.ciphertextBytes());
+        if (!unwrap(a, x) || !unwrap(b, y)) return HomomorphicData();
+        return engine.add((const uint8_t*)x.data(), (const uint8_t*)y.data(), c.data()) ? wrap(c) : HomomorphicData();
+    }
+
+    // Paillier é só aditivo: o produto de dois valores cifrados não existe
+    // sem a chave privada. Use multiplyScalar com um dos fatores em claro.
+    HomomorphicData multiply(const HomomorphicData&, const HomomorphicData&) override {
+        return HomomorphicData();
+    }
+
+    HomomorphicData multiplyScalar(const HomomorphicData& a, int scalar) override {
+        std::string x;
+        std::vector<uint8_t> c(engine.ciphertextBytes());
+        if (!unwrap(a, x)) return HomomorphicData();
+        return engine.multiplyScalar((const uint8_t*)x.data(), scalar, c.data()) ? wrap(c) : HomomorphicData();
+    }
+
+    HomomorphicData sum(const std::vector<HomomorphicData>& values) override {
+        const size_t width = engine.ciphertextBytes();
+        std::vector<uint8_t> all(values.size() * width), c(width);
+        std::vector<const uint8_t*> ptrs(values.size());
+        for (size_t i = 0; i < values.size(); i++) {
+            if (values[i].public_key != public_key_hex ||
+                !hexToBytes(values[i].encrypted_value, &all[i * width], width)) {
+                return HomomorphicData();
+            }
+            ptrs[i] = &all[i * width];
+        }
+        return engine.sum(ptrs.data(), ptrs.size(), c.data(), &defaultThreadPool()) ? wrap(c) : HomomorphicData();
+    }
+
+    int decrypt(const HomomorphicData& encrypted) override {
+        std::string x;
+        int64_t m = 0;
+        if (!unwrap(encrypted, x) || !engine.decrypt((const uint8_t*)x.data(), m)) return 0;
+        return (int)m;
+    }
+};
+
+std::unique_ptr<IHomomorphicEncryption> createPaillierEncryption(int modulus_bits) {
+    return std::make_unique<PaillierEncryption>(modulus_bits);
+}
@@ -0,0 +1,177 @@
+#include "../include/adilsoncrypto_pool.h"
+#include <algorithm>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const uint64_t MAX_CHUNKS = 0xFFFFFFFFULL;
+
+inline uint64_t packRange(uint32_t begin, uint32_t end) {
+    return ((uint64_t)begin << 32) | end;
+}
+
+inline uint32_t rangeBegin(uint64_t bounds) {
+    return (uint32_t)(bounds >> 32);
+}
+
+inline uint32_t rangeEnd(uint64_t bounds) {
+    return (uint32_t)bounds;
+}
+
+} // namespace
+
+unsigned ThreadPool::defaultThreadCount() {
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw > 0 ? hw : 1;
+}
+
+ThreadPool::ThreadPool(unsigned threads)
+    : thread_count(1), busy(false), job(nullptr), job_count(0), job_grain(1), active(0), generation(0),
+      stopping(false) {
+    startWorkers(threads == 0 ? defaultThreadCount() : threads);
+}
+
+ThreadPool::~ThreadPool() {
+    stopWorkers();
+}
+
+void ThreadPool::startWorkers(unsigned threads) {
+    ranges.reset(new Range[threads]);
+    for (unsigned i = 0; i < threads; i++) ranges[i].bounds.store(0);
+    thread_count.store(threads, std::memory_order_relaxed);
+    for (unsigned i = 1; i < threads; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+void ThreadPool::stopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& t : workers) t.join();
+    workers.clear();
+    stopping = false;
+}
+
+void ThreadPool::resize(unsigned threads) {
+    if (threads == 0) threads = defaultThreadCount();
+    // Toma o pool como se fosse rodar um parallelFor: ninguém mais usa os
+    // workers enquanto eles são recriados
+    bool expected = false;
+    while (!busy.compare_exchange_weak(expected, true, std::memory_order_acquire)) {
+        expected = false;
+        std::this_thread::yield();
+    }
+    if (threads != size()) {
+        stopWorkers();
+        startWorkers(threads);
+    }
+    busy.store(false, std::memory_order_release);
+}
+
+void ThreadPool::workerLoop(unsigned index) {
+    std::unique_lock<std::mutex> lock(mutex);
+    unsigned long seen = generation;
+    for (;;) {
+        wake.wait(lock, [&] { return stopping || generation != seen; });
+        if (stopping) return;
+        seen = generation;
+        if (!job) continue;
+        active++;
+        lock.unlock();
+        participate(index);
+        lock.lock();
+        if (--active == 0) done.notify_all();
+    }
+}
+
+// O dono avança o início da própria faixa
+bool ThreadPool::popLocal(unsigned index, uint32_t& chunk) {
+    std::atomic<uint64_t>& bounds = ranges[index].bounds;
+    uint64_t current = bounds.load();
+    while (rangeBegin(current) < rangeEnd(current)) {
+        if (bounds.compare_exchange_weak(current, packRange(rangeBegin(current) + 1, rangeEnd(current)))) {
+            chunk = rangeBegin(current);
+            return true;
+        }
+    }
+    return false;
+}
+
+// O ladrão recua o fim da faixa da vítima, fica com o primeiro bloco tomado
+// e publica o resto como a sua nova faixa (que estava vazia)
+bool ThreadPool::steal(unsigned index, uint32_t& chunk) {
+    const unsigned participants = size();
+    for (unsigned k = 1; k < participants; k++) {
+        std::atomic<uint64_t>& victim = ranges[(index + k) % participants].bounds;
+        uint64_t current = victim.load();
+        while (rangeBegin(current) < rangeEnd(current)) {
+            uint32_t begin = rangeBegin(current);
+            uint32_t end = rangeEnd(current);
+            uint32_t split = end - (end - begin + 1) / 2;
+            if (victim.compare_exchange_weak(current, packRange(begin, split))) {
+                chunk = split;
+                ranges[index].bounds.store(packRange(split + 1, end));
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void ThreadPool::participate(unsigned index) {
+    uint32_t chunk;
+    while (popLocal(index, chunk) || steal(index, chunk)) {
+        size_t begin = (size_t)chunk * job_grain;
+        (*job)(begin, std::min(job_count, begin + job_grain));
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn) {
+    if (count == 0) return;
+    grain = std::max<size_t>(grain, 1);
+    bool expected = false;
+    if (size() == 1 || count <= grain || !busy.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+        fn(0, count);
+        return;
+    }
+
+    // Os índices de bloco cabem em 32 bits; entradas gigantes aumentam o grão
+    uint64_t chunks = (count + grain - 1) / grain;
+    if (chunks > MAX_CHUNKS) {
+        grain = (size_t)((count + MAX_CHUNKS - 1) / MAX_CHUNKS);
+        chunks = (count + grain - 1) / grain;
+    }
+    const unsigned participants = size();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    for (unsigned i = 0; i < participants; i++) {
+        ranges[i].bounds.store(packRange((uint32_t)(chunks * i / participants), (uint32_t)(chunks * (i + 1) / participants)));
+    }
+    job = &fn;
+    job_count = count;
+    job_grain = grain;
+    generation++;
+    lock.unlock();
+    wake.notify_all();
+
+    // A thread chamadora é o participante 0
+    participate(0);
+
+    lock.lock();
+    done.wait(lock, [&] { return active == 0; });
+    job = nullptr;
+    job_count = 0;
+    lock.unlock();
+    busy.store(false, std::memory_order_release);
+}
+
+ThreadPool& defaultThreadPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,420 @@
+#include "../include/adilsoncrypto_ring.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <openssl/bn.h>
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/obj_mac.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const char HASH_TO_POINT_TAG[] = "AdilsonCrypto/LSAG/Hp";
+const char CHALLENGE_TAG[] = "AdilsonCrypto/LSAG/c";
+const size_t MEMBER_GRAIN = 16;
+const size_t COMMITMENT_BYTES = 2 * RING_POINT_BYTES;    // L_i || R_i
+const size_t PAIR_BYTES = 2 * RING_SCALAR_BYTES;         // c_i || s_i
+
+// Grupo com a tabela do gerador pré-calculada (somente leitura após criado)
+const EC_GROUP* ringGroup() {
+    static EC_GROUP* group = [] {
+        EC_GROUP* g = EC_GROUP_new_by_curve_name(NID_secp256k1);
+        EC_GROUP_precompute_mult(g, nullptr);
+        return g;
+    }();
+    return group;
+}
+
+bool compressPoint(const EC_POINT* point, uint8_t out[RING_POINT_BYTES], BN_CTX* ctx) {
+    return EC_POINT_point2oct(ringGroup(), point, POINT_CONVERSION_COMPRESSED, out, RING_POINT_BYTES, ctx) ==
+           RING_POINT_BYTES;
+}
+
+// H_p: tenta x = SHA-256(tag || P || contador) até achar um ponto (y par).
+// Entrada pública, então o número variável de tentativas não vaza segredo.
+bool hashToPoint(const uint8_t compressed[RING_POINT_BYTES], EC_POINT* out, BN_CTX* ctx) {
+    const EC_GROUP* group = ringGroup();
+    BN_CTX_start(ctx);
+    BIGNUM* x = BN_CTX_get(ctx);
+    BIGNUM* p = BN_CTX_get(ctx);
+    bool ok = x && EC_GROUP_get_curve(group, p, nullptr, nullptr, ctx) == 1;
+    bool found = false;
+    for (unsigned counter = 0; ok && !found && counter < 256; counter++) {
+        uint8_t digest[32];
+        uint8_t c = (uint8_t)counter;
+        Sha256Hasher hasher;
+        hasher.update((const uint8_t*)HASH_TO_POINT_TAG, sizeof(HASH_TO_POINT_TAG) - 1)
+              .update(compressed, RING_POINT_BYTES)
+              .update(&c, 1);
+        hasher.finalize(digest);
+        BN_bin2bn(digest, 32, x);
+        if (BN_cmp(x, p) >= 0) continue;
+        ERR_set_mark();
+        found = EC_POINT_set_compressed_coordinates(group, out, x, 0, ctx) == 1;
+        ERR_pop_to_mark();
+    }
+    BN_CTX_end(ctx);
+    return found;
+}
+
+// L_i = s_i G + c_i P_i e R_i = s_i H_p(P_i) + c_i I (comprimidos) para os
+// membros [begin, end) exceto 'skip'. Os pontos do bloco são normalizados
+// para afim com uma única inversão.
+bool memberCommitments(const RingContext& ring, const EC_POINT* image, const uint8_t* pairs, size_t begin,
+                       size_t end, size_t skip, uint8_t* out) {
+    const EC_GROUP* group = ringGroup();
+    const BIGNUM* order = EC_GROUP_get0_order(group);
+    BN_CTX* ctx = BN_CTX_new();
+    BN_CTX_start(ctx);
+    BIGNUM* c = BN_CTX_get(ctx);
+    BIGNUM* s = BN_CTX_get(ctx);
+    std::vector<EC_POINT*> points;
+    std::vector<size_t> members;
+    points.reserve(2 * (end - begin));
+    bool ok = s != nullptr;
+
+    for (size_t i = begin; ok && i < end; i++) {
+        if (i == skip) continue;
+        BN_bin2bn(pairs + i * PAIR_BYTES, RING_SCALAR_BYTES, c);
+        BN_bin2bn(pairs + i * PAIR_BYTES + RING_SCALAR_BYTES, RING_SCALAR_BYTES, s);
+        EC_POINT* L = EC_POINT_new(group);
+        EC_POINT* R = EC_POINT_new(group);
+        points.push_back(L);
+        points.push_back(R);
+        members.push_back(i);
+        const EC_POINT* bases[2] = { ring.hashedKey(i), image };
+        const BIGNUM* scalars[2] = { s, c };
+        ok = L && R && BN_cmp(c, order) < 0 && BN_cmp(s, order) < 0 &&
+             EC_POINT_mul(group, L, s, ring.key(i), c, ctx) == 1 &&
+             EC_POINTs_mul(group, R, nullptr, 2, bases, scalars, ctx) == 1;
+    }
+    ok = ok && (points.empty() || EC_POINTs_make_affine(group, points.size(), points.data(), ctx) == 1);
+    for (size_t k = 0; ok && k < members.size(); k++) {
+        uint8_t* dst = out + members[k] * COMMITMENT_BYTES;
+        ok = compressPoint(points[2 * k], dst, ctx) && compressPoint(points[2 * k + 1], dst + RING_POINT_BYTES, ctx);
+    }
+
+    for (EC_POINT* point : points) EC_POINT_free(point);
+    BN_CTX_end(ctx);
+    BN_CTX_free(ctx);
+    return ok;
+}
+
+bool allCommitments(const RingContext& ring, const EC_POINT* image, const uint8_t* pairs, size_t skip,
+                    uint8_t* out, ThreadPool* pool) {
+    std::atomic<bool> ok(true);
+    auto work = [&](size_t begin, size_t end) {
+        if (!memberCommitments(ring, image, pairs, begin, end, skip, out)) ok = false;
+    };
+    if (pool) {
+        pool->parallelFor(ring.size(), MEMBER_GRAIN, work);
+    } else {
+        work(0, ring.size());
+    }
+    return ok;
+}
+
+// c = SHA-256(tag || hash do anel || I || SHA-256(m) || L_0 R_0 ... ) mod n
+void challenge(const RingContext& ring, const uint8_t* image, const uint8_t* message, size_t len,
+               const uint8_t* commitments, BIGNUM* c, BN_CTX* ctx) {
+    uint8_t message_hash[32], digest[32];
+    sha256Digest(message, len, message_hash);
+    Sha256Hasher hasher;
+    hasher.update((const uint8_t*)CHALLENGE_TAG, sizeof(CHALLENGE_TAG) - 1)
+          .update(ring.ringHash(), 32)
+          .update(image, RING_POINT_BYTES)
+          .update(message_hash, 32)
+          .update(commitments, ring.size() * COMMITMENT_BYTES);
+    hasher.finalize(digest);
+    BN_bin2bn(digest, 32, c);
+    BN_nnmod(c, c, EC_GROUP_get0_order(ringGroup()), ctx);
+}
+
+bool randomScalar(BIGNUM* out) {
+    const BIGNUM* order = EC_GROUP_get0_order(ringGroup());
+    do {
+        if (!BN_priv_rand_range(out, order)) return false;
+    } while (BN_is_zero(out));
+    return true;
+}
+
+} // namespace
+
+RingContext::~RingContext() {
+    clear();
+}
+
+void RingContext::clear() {
+    for (EC_POINT* point : keys) EC_POINT_free(point);
+    for (EC_POINT* point : hashed) EC_POINT_free(point);
+    keys.clear();
+    hashed.clear();
+    compressed.clear();
+}
+
+bool RingContext::init(const std::vector<ByteView>& public_keys) {
+    clear();
+    const EC_GROUP* group = ringGroup();
+    BN_CTX* ctx = BN_CTX_new();
+    bool ok = ctx != nullptr && !public_keys.empty();
+    compressed.resize(public_keys.size() * RING_POINT_BYTES);
+    for (size_t i = 0; ok && i < public_keys.size(); i++) {
+        EC_POINT* key = EC_POINT_new(group);
+        EC_POINT* hash = EC_POINT_new(group);
+        keys.push_back(key);
+        hashed.push_back(hash);
+        ok = key && hash && (public_keys[i].size == 33 || public_keys[i].size == 65) &&
+             EC_POINT_oct2point(group, key, public_keys[i].data, public_keys[i].size, ctx) == 1 &&
+             !EC_POINT_is_at_infinity(group, key) && compressPoint(key, &compressed[i * RING_POINT_BYTES], ctx) &&
+             hashToPoint(&compressed[i * RING_POINT_BYTES], hash, ctx);
+    }
+    if (ok) sha256Digest(compressed.data(), compressed.size(), ring_hash);
+    BN_CTX_free(ctx);
+    if (!ok) clear();
+    return ok;
+}
+
+long RingContext::indexOf(const uint8_t public_key[RING_POINT_BYTES]) const {
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (std::memcmp(compressedKey(i), public_key, RING_POINT_BYTES) == 0) return (long)i;
+    }
+    return -1;
+}
+
+size_t lsagSignatureBytes(size_t ring_size) {
+    return RING_POINT_BYTES + ring_size * PAIR_BYTES;
+}
+
+bool lsagSign(const RingContext& ring, const uint8_t* message, size_t len, const uint8_t private_key[32],
+              std::vector<uint8_t>& signature, ThreadPool* pool) {
+    const size_t n = ring.size();
+    if (n == 0) return false;
+    const EC_GROUP* group = ringGroup();
+    const BIGNUM* order = EC_GROUP_get0_order(group);
+    BN_CTX* ctx = BN_CTX_new();
+    BN_CTX_start(ctx);
+    BIGNUM* x = BN_CTX_get(ctx);
+    BIGNUM* alpha = BN_CTX_get(ctx);
+    BIGNUM* c = BN_CTX_get(ctx);
+    BIGNUM* t = BN_CTX_get(ctx);
+    EC_POINT* point = EC_POINT_new(group);
+    EC_POINT* image = EC_POINT_new(group);
+    uint8_t public_key[RING_POINT_BYTES];
+    std::vector<uint8_t> commitments(n * COMMITMENT_BYTES);
+    signature.assign(lsagSignatureBytes(n), 0);
+    uint8_t* pairs = signature.data() + RING_POINT_BYTES;
+
+    bool ok = t && point && image && BN_bin2bn(private_key, 32, x) && !BN_is_zero(x) && BN_cmp(x, order) < 0;
+    if (ok) {
+        BN_set_flags(x, BN_FLG_CONSTTIME);
+        BN_set_flags(alpha, BN_FLG_CONSTTIME);
+    }
+    ok = ok && EC_POINT_mul(group, point, x, nullptr, nullptr, ctx) == 1 && compressPoint(point, public_key, ctx);
+    const long signer = ok ? ring.indexOf(public_key) : -1;
+    ok = signer >= 0 && EC_POINT_mul(group, image, nullptr, ring.hashedKey(signer), x, ctx) == 1 &&
+         compressPoint(image, signature.data(), ctx);
+
+    // Membros simulados: c_i e s_i aleatórios
+    for (size_t i = 0; ok && i < n; i++) {
+        if ((long)i == signer) continue;
+        ok = randomScalar(t) && BN_bn2binpad(t, pairs + i * PAIR_BYTES, RING_SCALAR_BYTES) == RING_SCALAR_BYTES &&
+             randomScalar(t) &&
+             BN_bn2binpad(t, pairs + i * PAIR_BYTES + RING_SCALAR_BYTES, RING_SCALAR_BYTES) == RING_SCALAR_BYTES;
+    }
+    ok = ok && allCommitments(ring, image, pairs, (size_t)signer, commitments.data(), pool);
+
+    // Signatário: L = alpha G, R = alpha H_p(P), multiplicações de um escalar
+    uint8_t* own = commitments.data() + (size_t)signer * COMMITMENT_BYTES;
+    ok = ok && randomScalar(alpha) && EC_POINT_mul(group, point, alpha, nullptr, nullptr, ctx) == 1 &&
+         compressPoint(point, own, ctx) &&
+         EC_POINT_mul(group, point, nullptr, ring.hashedKey(signer), alpha, ctx) == 1 &&
+         compressPoint(point, own + RING_POINT_BYTES, ctx);
+
+    // c_pi = c - sum(c_i), s_pi = alpha - c_pi x
+    if (ok) {
+        challenge(ring, signature.data(), message, len, commitments.data(), c, ctx);
+        for (size_t i = 0; ok && i < n; i++) {
+            if ((long)i == signer) continue;
+            ok = BN_bin2bn(pairs + i * PAIR_BYTES, RING_SCALAR_BYTES, t) && BN_mod_sub(c, c, t, order, ctx);
+        }
+        uint8_t* pair = pairs + (size_t)signer * PAIR_BYTES;
+        ok = ok && BN_bn2binpad(c, pair, RING_SCALAR_BYTES) == RING_SCALAR_BYTES &&
+             BN_mod_mul(t, c, x, order, ctx) && BN_mod_sub(t, alpha, t, order, ctx) &&
+             BN_bn2binpad(t, pair + RING_SCALAR_BYTES, RING_SCALAR_BYTES) == RING_SCALAR_BYTES;
+    }
+
+    BN_clear(x);
+    BN_clear(alpha);
+    EC_POINT_free(point);
+    EC_POINT_free(image);
+    BN_CTX_end(ctx);
+    BN_CTX_free(ctx);
+    if (!ok) signature.clear();
+    return ok;
+}
+
+bool lsagVerify(const RingContext& ring, const uint8_t* message, size_t len, const uint8_t* signature,
+                size_t signature_len, ThreadPool* pool) {
+    const size_t n = ring.size();
+    if (n == 0 || signature_len != lsagSignatureBytes(n)) return false;
+    const EC_GROUP* group = ringGroup();
+    const BIGNUM* order = EC_GROUP_get0_order(group);
+    BN_CTX* ctx = BN_CTX_new();
+    BN_CTX_start(ctx);
+    BIGNUM* c = BN_CTX_get(ctx);
+    BIGNUM* sum = BN_CTX_get(ctx);
+    BIGNUM* t = BN_CTX_get(ctx);
+    EC_POINT* image = EC_POINT_new(group);
+    std::vector<uint8_t> commitments(n * COMMITMENT_BYTES);
+    const uint8_t* pairs = signature + RING_POINT_BYTES;
+
+    bool ok = t && image && EC_POINT_oct2point(group, image, signature, RING_POINT_BYTES, ctx) == 1 &&
+              !EC_POINT_is_at_infinity(group, image) &&
+              allCommitments(ring, image, pairs, n, commitments.data(), pool);
+    if (ok) {
+        challenge(ring, signature, message, len, commitments.data(), c, ctx);
+        BN_zero(sum);
+        for (size_t i = 0; ok && i < n; i++) {
+            ok = BN_bin2bn(pairs + i * PAIR_BYTES, RING_SCALAR_BYTES, t) && BN_mod_add(sum, sum, t, order, ctx);
+        }
+        ok = ok && BN_cmp(sum, c) == 0;
+    }
+
+    EC_POINT_free(image);
+    BN_CTX_end(ctx);
+    BN_CTX_free(ctx);
+    return ok;
+}
+
+size_t KeyImageSet::ImageHash::operator()(const Image& image) const {
+    size_t h;
+    std::memcpy(&h, image.data() + 1, sizeof(h));
+    return h;
+}
+
+bool KeyImageSet::insert(const uint8_t key_image[RING_POINT_BYTES]) {
+    Image image;
+    std::memcpy(image.data(), key_image, RING_POINT_BYTES);
+    Shard& shard = shards[key_image[RING_POINT_BYTES - 1] % SHARDS];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.images.insert(image).second;
+}
+
+bool KeyImageSet::contains(const uint8_t key_image[RING_POINT_BYTES]) const {
+    Image image;
+    std::memcpy(image.data(), key_image, RING_POINT_BYTES);
+    const Shard& shard = shards[key_image[RING_POINT_BYTES - 1] % SHARDS];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.images.count(image) != 0;
+}
+
+size_t KeyImageSet::size() const {
+    size_t total = 0;
+    for (const Shard& shard : shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        total += shard.images.size();
+    }
+    return total;
+}
+
+} // namespace adilsoncrypto
+
+using namespace adilsoncrypto;
+
+// Só assinaturas em anel: threshold e MPC não são suportados por este objeto
+class LsagRingSignature : public IMultiSignature {
+private:
+    int participants;
+    std::mutex cache_mutex;
+    std::vector<std::string> cached_keys;
+    std::shared_ptr<RingContext> cached_ring;
+
+    // O último anel usado fica decodificado (pontos e H_p) para as próximas
+    // assinaturas e verificações com as mesmas chaves
+    std::shared_ptr<RingContext> ringFor(const std::vector<std::string>& public_keys) {
+        if (participants > 0 && public_keys.size() != (size_t)participants) return nullptr;
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (cached_ring && cached_keys == public_keys) return cached_ring;
+
+        std::vector<std::string> bytes(public_keys.size());
+        std::vector<ByteView> views(public_keys.size());
+        for (size_t i = 0; i < public_keys.size(); i++) {
+            if (!hexToBytes(public_keys[i], bytes[i])) return nullptr;
+            views[i].data = (const uint8_t*)bytes[i].data();
+            views[i].size = bytes[i].size();
+        }
+        auto ring = std::make_shared<RingContext>();
+        if (!ring->init(views)) return nullptr;
+        cached_keys = public_keys;
+        cached_ring = ring;
+        return ring;
+    }
+
+public:
+    explicit LsagRingSignature(int participants) : participants(participants) {}
+
+    std::unique_ptr<IMultiSignature> createThresholdSignature(int, int) override {
+        return nullptr;
+    }
+
+    std::vector<std::string> generateShares(const std::string&) override {
+        return {};
+    }
+
+    Signature sign(const std::string&, const std::vector<std::string>&) override {
+        return Signature();
+    }
+
+    std::unique_ptr<IMultiSignature> createRingSignature(int ring_size) override {
+        return createLsagRingSignature(ring_size);
+    }
+
+    Signature signRing(const std::string& message, const std::string& private_key,
+                       const std::vector<std::string>& public_keys) override {
+        Signature signature;
+        std::shared_ptr<RingContext> ring = ringFor(public_keys);
+        BIGNUM* priv = nullptr;
+        uint8_t key[32];
+        std::vector<uint8_t> sig;
+        if (!ring || BN_hex2bn(&priv, private_key.c_str()) == 0) {
+            BN_free(priv);
+            return signature;
+        }
+        bool ok = BN_bn2binpad(priv, key, sizeof(key)) == (int)sizeof(key) &&
+                  lsagSign(*ring, (const uint8_t*)message.data(), message.size(), key, sig, &defaultThreadPool());
+        OPENSSL_cleanse(key, sizeof(key));
+        BN_clear_free(priv);
+        if (!ok) return signature;
+
+        signature.r = bytesToHex(sig.data(), RING_POINT_BYTES);
+        signature.s = bytesToHex(ring->ringHash(), 32);
+        signature.v = "lsag-secp256k1";
+        signature.proof = bytesToHex(sig.data(), sig.size());
+        return signature;
+    }
+
+    bool verifyRing(const std::string& message, const Signature& signature,
+                    const std::vector<std::string>& public_keys) override {
+        std::shared_ptr<RingContext> ring = ringFor(public_keys);
+        std::string sig;
+        if (!ring || signature.v != "lsag-secp256k1" || !hexToBytes(signature.proof, sig)) return false;
+        return lsagVerify(*ring, (const uint8_t*)message.data(), message.size(), (const uint8_t*)sig.data(), sig.size(),
+                          &defaultThreadPool());
+    }
+
+    std::unique_ptr<IMultiSignature> createMPC(int) override {
+        return nullptr;
+    }
+
+    std::string compute(const std::function<std::string(const std::vector<std::string>&)>&,
+                        const std::vector<std::string>&) override {
+        return "";
+    }
+};
+
+std::unique_ptr<IMultiSignature> createLsagRingSignature(int participants) {
+    return std::make_unique<LsagRingSignature>(participants);
+}
@@ -0,0 +1,206 @@
+#include "../include/adilsoncrypto_ripemd160.h"
+#include "../include/adilsoncrypto_ripemd160_lanes.h"
+#include "../include/adilsoncrypto_cpu.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace adilsoncrypto {
+
+const uint32_t RIPEMD160_IV[5] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 };
+
+namespace {
+
+struct ScalarOps {
+    typedef uint32_t vec;
+    static const size_t LANES = 1;
+    static inline vec load(const uint32_t* p) { return *p; }
+    static inline void store(uint32_t* p, vec v) { *p = v; }
+    static inline vec set1(uint32_t x) { return x; }
+    static inline vec add(vec a, vec b) { return a + b; }
+    static inline vec xor2(vec a, vec b) { return a ^ b; }
+    static inline vec and2(vec a, vec b) { return a & b; }
+    static inline vec or2(vec a, vec b) { return a | b; }
+    static inline vec andnot(vec a, vec b) { return ~a & b; }
+    static inline vec ornot(vec a, vec b) { return a | ~b; }
+    static inline vec rotl(vec x, int n) { return (x << n) | (x >> (32 - n)); }
+};
+
+#if defined(__SSE2__)
+struct Sse2Ops {
+    typedef __m128i vec;
+    static const size_t LANES = 4;
+    static inline vec load(const uint32_t* p) { return _mm_load_si128((const __m128i*)p); }
+    static inline void store(uint32_t* p, vec v) { _mm_store_si128((__m128i*)p, v); }
+    static inline vec set1(uint32_t x) { return _mm_set1_epi32((int)x); }
+    static inline vec add(vec a, vec b) { return _mm_add_epi32(a, b); }
+    static inline vec xor2(vec a, vec b) { return _mm_xor_si128(a, b); }
+    static inline vec and2(vec a, vec b) { return _mm_and_si128(a, b); }
+    static inline vec or2(vec a, vec b) { return _mm_or_si128(a, b); }
+    static inline vec andnot(vec a, vec b) { return _mm_andnot_si128(a, b); }
+    static inline vec ornot(vec a, vec b) { return _mm_or_si128(a, _mm_xor_si128(b, _mm_set1_epi32(-1))); }
+    static inline vec rotl(vec x, int n) { return _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - n)); }
+};
+
+void compressSse2(uint32_t* states, const uint8_t* const* blocks) {
+    Ripemd160Lanes<Sse2Ops>::compressBlocks(states, blocks);
+}
+#endif
+
+void compressScalar(uint32_t* states, const uint8_t* const* blocks) {
+    Ripemd160Lanes<ScalarOps>::compressBlocks(states, blocks);
+}
+
+const Ripemd160LaneBackend BACKEND_SCALAR = { "scalar", 1, compressScalar };
+#if defined(__SSE2__)
+const Ripemd160LaneBackend BACKEND_SSE2 = { "sse2", 4, compressSse2 };
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+const Ripemd160LaneBackend BACKEND_AVX2 = { "avx2", 8, ripemd160CompressAvx2 };
+const Ripemd160LaneBackend BACKEND_AVX512 = { "avx512", 16, ripemd160CompressAvx512 };
+#endif
+
+const Ripemd160LaneBackend* backendFor(Sha256Kernel kernel) {
+    switch (kernel) {
+    case Sha256Kernel::SCALAR: return &BACKEND_SCALAR;
+#if defined(__SSE2__)
+    case Sha256Kernel::SSE2: return &BACKEND_SSE2;
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+    case Sha256Kernel::AVX2: return cpuFeatures().avx2 ? &BACKEND_AVX2 : nullptr;
+    case Sha256Kernel::AVX512: return cpuFeatures().avx512f ? &BACKEND_AVX512 : nullptr;
+#endif
+    default: return nullptr;
+    }
+}
+
+const Ripemd160LaneBackend& bestBackend() {
+    static const Ripemd160LaneBackend* best = []() {
+        const Sha256Kernel order[] = { Sha256Kernel::AVX512, Sha256Kernel::AVX2, Sha256Kernel::SSE2 };
+        for (Sha256Kernel k : order) {
+            if (const Ripemd160LaneBackend* b = backendFor(k)) return b;
+        }
+        return &BACKEND_SCALAR;
+    }();
+    return *best;
+}
+
+void ripemd160StateToBytes(const uint32_t state[5], uint8_t out[20]) {
+    for (int i = 0; i < 5; i++) ripemd160StoreLe32(out + 4 * i, state[i]);
+}
+
+// hash160 de até RIPEMD160_MAX_LANES mensagens. Cada digest SHA-256 sai do
+// estado direto para o bloco do RIPEMD-160, que já tem o padding de uma
+// mensagem de 32 bytes (0x80 e o tamanho em bits, little-endian).
+void hash160Group(const Sha256LaneBackend& sha, const Ripemd160LaneBackend& ripemd, const uint8_t* const* messages,
+                  size_t len, size_t active, uint8_t* out) {
+    const size_t full_blocks = len / 64;
+    const size_t rem = len % 64;
+    const size_t tail_blocks = rem < 56 ? 1 : 2;
+    const uint64_t bits = (uint64_t)len * 8;
+
+    alignas(64) uint8_t tails[SHA256_MAX_LANES][128];
+    alignas(64) uint8_t blocks[RIPEMD160_MAX_LANES][64];
+    uint32_t sha_states[SHA256_MAX_LANES * 8];
+    uint32_t ripemd_states[RIPEMD160_MAX_LANES * 5];
+    const uint8_t* ptrs[RIPEMD160_MAX_LANES];
+
+    // Grupo cheio em múltiplos das lanes dos dois backends; lanes ociosas
+    // repetem a última mensagem e o resultado é descartado
+    const size_t lanes = std::max(sha.lanes, ripemd.lanes);
+    const size_t group = (active + lanes - 1) / lanes * lanes;
+
+    for (size_t base = 0; base < group; base += sha.lanes) {
+        for (size_t l = 0; l < sha.lanes; l++) {
+            const uint8_t* msg = messages[std::min(base + l, active - 1)];
+            std::memcpy(sha_states + 8 * l, SHA256_IV, 32);
+            uint8_t* tail = tails[l];
+            std::memset(tail, 0, 64 * tail_blocks);
+            std::memcpy(tail, msg + full_blocks * 64, rem);
+            tail[rem] = 0x80;
+            for (int i = 0; i < 8; i++) tail[64 * tail_blocks - 1 - i] = (uint8_t)(bits >> (8 * i));
+        }
+        for (size_t b = 0; b < full_blocks; b++) {
+            for (size_t l = 0; l < sha.lanes; l++) ptrs[l] = messages[std::min(base + l, active - 1)] + 64 * b;
+            sha.compress(sha_states, ptrs);
+        }
+        for (size_t b = 0; b < tail_blocks; b++) {
+            for (size_t l = 0; l < sha.lanes; l++) ptrs[l] = tails[l] + 64 * b;
+            sha.compress(sha_states, ptrs);
+        }
+        for (size_t l = 0; l < sha.lanes; l++) {
+            uint8_t* block = blocks[base + l];
+            sha256StateToBytes(sha_states + 8 * l, block);
+            std::memset(block + 32, 0, 32);
+            block[32] = 0x80;
+            block[57] = 0x01;   // 256 bits
+        }
+    }
+
+    for (size_t base = 0; base < group; base += ripemd.lanes) {
+        for (size_t l = 0; l < ripemd.lanes; l++) {
+            std::memcpy(ripemd_states + 5 * l, RIPEMD160_IV, 20);
+            ptrs[l] = blocks[base + l];
+        }
+        ripemd.compress(ripemd_states, ptrs);
+        for (size_t l = 0; l < ripemd.lanes && base + l < active; l++) {
+            ripemd160StateToBytes(ripemd_states + 5 * l, out + 20 * (base + l));
+        }
+    }
+}
+
+} // namespace
+
+const Ripemd160LaneBackend& ripemd160LaneBackend(Sha256Kernel kernel) {
+    if (kernel == Sha256Kernel::AUTO) return bestBackend();
+    const Ripemd160LaneBackend* b = backendFor(kernel);
+    return b ? *b : bestBackend();
+}
+
+void ripemd160Digest(const uint8_t* data, size_t len, uint8_t out[RIPEMD160_HASH_BYTES]) {
+    uint32_t state[5];
+    std::memcpy(state, RIPEMD160_IV, sizeof(state));
+    const uint8_t* block = data;
+    for (size_t i = 0; i + 64 <= len; i += 64) {
+        block = data + i;
+        compressScalar(state, &block);
+    }
+    uint8_t tail[128];
+    const size_t rem = len % 64;
+    const size_t tail_bytes = rem < 56 ? 64 : 128;
+    std::memset(tail, 0, tail_bytes);
+    if (rem) std::memcpy(tail, data + len - rem, rem);
+    tail[rem] = 0x80;
+    const uint64_t bits = (uint64_t)len * 8;
+    for (int i = 0; i < 8; i++) tail[tail_bytes - 8 + i] = (uint8_t)(bits >> (8 * i));
+    for (size_t i = 0; i < tail_bytes; i += 64) {
+        block = tail + i;
+        compressScalar(state, &block);
+    }
+    ripemd160StateToBytes(state, out);
+}
+
+void hash160Many(const uint8_t* const* messages, size_t len, size_t count, uint8_t* out, Sha256Kernel kernel) {
+    const Sha256LaneBackend& sha = sha256LaneBackend(kernel);
+    const Ripemd160LaneBackend& ripemd = ripemd160LaneBackend(kernel);
+    for (size_t base = 0; base < count; base += RIPEMD160_MAX_LANES) {
+        size_t active = std::min(RIPEMD160_MAX_LANES, count - base);
+        hash160Group(sha, ripemd, messages + base, len, active, out + 20 * base);
+    }
+}
+
+void hash160Contiguous(const uint8_t* in, size_t len, size_t count, uint8_t* out, Sha256Kernel kernel) {
+    const Sha256LaneBackend& sha = sha256LaneBackend(kernel);
+    const Ripemd160LaneBackend& ripemd = ripemd160LaneBackend(kernel);
+    const uint8_t* messages[RIPEMD160_MAX_LANES];
+    for (size_t base = 0; base < count; base += RIPEMD160_MAX_LANES) {
+        size_t active = std::min(RIPEMD160_MAX_LANES, count - base);
+        for (size_t i = 0; i < active; i++) messages[i] = in + len * (base + i);
+        hash160Group(sha, ripemd, messages, len, active, out + 20 * base);
+    }
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,36 @@
+// Kernel RIPEMD-160 de 8 lanes (AVX2). Compilado com -mavx2 e chamado apenas
+// quando cpuFeatures().avx2 é verdadeiro.
+#include "../include/adilsoncrypto_ripemd160_lanes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#ifndef __AVX2__
+#error "adilsoncrypto_ripemd160_avx2.cpp precisa ser compilado com -mavx2"
+#endif
+#include <immintrin.h>
+
+namespace adilsoncrypto {
+
+namespace {
+struct Avx2Ops {
+    typedef __m256i vec;
+    static const size_t LANES = 8;
+    static inline vec load(const uint32_t* p) { return _mm256_load_si256((const __m256i*)p); }
+    static inline void store(uint32_t* p, vec v) { _mm256_store_si256((__m256i*)p, v); }
+    static inline vec set1(uint32_t x) { return _mm256_set1_epi32((int)x); }
+    static inline vec add(vec a, vec b) { return _mm256_add_epi32(a, b); }
+    static inline vec xor2(vec a, vec b) { return _mm256_xor_si256(a, b); }
+    static inline vec and2(vec a, vec b) { return _mm256_and_si256(a, b); }
+    static inline vec or2(vec a, vec b) { return _mm256_or_si256(a, b); }
+    static inline vec andnot(vec a, vec b) { return _mm256_andnot_si256(a, b); }
+    static inline vec ornot(vec a, vec b) { return _mm256_or_si256(a, _mm256_xor_si256(b, _mm256_set1_epi32(-1))); }
+    static inline vec rotl(vec x, int n) { return _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - n)); }
+};
+} // namespace
+
+void ripemd160CompressAvx2(uint32_t* states, const uint8_t* const* blocks) {
+    Ripemd160Lanes<Avx2Ops>::compressBlocks(states, blocks);
+}
+
+} // namespace adilsoncrypto
+
+#endif
@@ -0,0 +1,42 @@
+// Kernel RIPEMD-160 de 16 lanes (AVX-512F). Usa vpternlogd para a|~b e a
+// rotação nativa (vprolvd). Chamado apenas quando cpuFeatures().avx512f.
+#include "../include/adilsoncrypto_ripemd160_lanes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#ifndef __AVX512F__
+#error "adilsoncrypto_ripemd160_avx512.cpp precisa ser compilado com -mavx512f"
+#endif
+// O GCC 12 acusa '__Y' não inicializado dentro de avx512fintrin.h
+// (_mm512_undefined_epi32 usado de propósito pelos intrínsecos)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+
+namespace adilsoncrypto {
+
+namespace {
+struct Avx512Ops {
+    typedef __m512i vec;
+    static const size_t LANES = 16;
+    static inline vec load(const uint32_t* p) { return _mm512_load_si512((const void*)p); }
+    static inline void store(uint32_t* p, vec v) { _mm512_store_si512((void*)p, v); }
+    static inline vec set1(uint32_t x) { return _mm512_set1_epi32((int)x); }
+    static inline vec add(vec a, vec b) { return _mm512_add_epi32(a, b); }
+    static inline vec xor2(vec a, vec b) { return _mm512_xor_si512(a, b); }
+    static inline vec and2(vec a, vec b) { return _mm512_and_si512(a, b); }
+    static inline vec or2(vec a, vec b) { return _mm512_or_si512(a, b); }
+    static inline vec andnot(vec a, vec b) { return _mm512_andnot_si512(a, b); }
+    static inline vec ornot(vec a, vec b) { return _mm512_ternarylogic_epi32(a, b, b, 0xF3); }
+    static inline vec rotl(vec x, int n) { return _mm512_rolv_epi32(x, _mm512_set1_epi32(n)); }
+};
+} // namespace
+
+void ripemd160CompressAvx512(uint32_t* states, const uint8_t* const* blocks) {
+    Ripemd160Lanes<Avx512Ops>::compressBlocks(states, blocks);
+}
+
+} // namespace adilsoncrypto
+
+#endif
@@ -0,0 +1,342 @@
+#include "../include/adilsoncrypto_secp256k1.h"
+#include "../include/adilsoncrypto_field.h"
+#include "../include/adilsoncrypto_secure.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <vector>
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+using Field = FixedField<Secp256k1FieldParams>;
+using Scalars = FixedField<Secp256k1OrderParams>;
+using Element = Field::Element;
+using Scalar = Scalars::Element;
+using JacobianCurve = WeierstrassCurve<Field>;
+
+const size_t LIMBS = 4;
+const size_t WINDOWS = 64;          // 256 bits em janelas de 4
+const size_t WINDOW_POINTS = 15;    // dígitos 1..15; o 0 não soma nada
+const uint64_t CURVE_B3 = 21;       // 3 b, das fórmulas completas (b = 7)
+const char* const GX = "79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798";
+const char* const GY = "483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8";
+
+const Field field;
+const Scalars scalars;
+
+struct AffinePoint {
+    Element x, y;
+};
+
+// Coordenadas projetivas homogêneas (x = X/Z, y = Y/Z; o infinito é (0:1:0))
+struct ProjectivePoint {
+    Element x, y, z;
+};
+
+// points[i][d - 1] = d 16^i G
+struct GeneratorTable {
+    AffinePoint points[WINDOWS][WINDOW_POINTS];
+    Element b3;
+};
+
+// Tudo que depende da chave ou do nonce. Só tipos triviais: o bloco é
+// zerado até key_slot ao fim de cada chamada.
+struct SignScratch {
+    Sha256Hasher hasher;
+    uint8_t pad[SHA256_BLOCK_BYTES];
+    uint8_t inner[32];
+    uint8_t hmac_k[32];
+    uint8_t hmac_v[32];
+    uint8_t message[32 + 1 + 32 + 32];   // V || separador || x || h1
+    uint64_t secret_raw[LIMBS];
+    uint64_t nonce_raw[LIMBS];
+    uint64_t out_raw[LIMBS];
+    Scalar d, e, k, r, s;
+    AffinePoint entry;
+    ProjectivePoint acc, sum;
+    Element x, y, z_inv;
+    // Chave de quem chama (Secp256k1KeySlot): sobrevive às chamadas e é
+    // zerada quando o slot é devolvido
+    uint8_t key_slot[SECP256K1_KEY_SLOT_BYTES];
+    bool key_slot_busy;
+};
+
+void bytesToLimbs(const uint8_t in[32], uint64_t out[LIMBS]) {
+    for (size_t i = 0; i < LIMBS; i++) {
+        uint64_t word = 0;
+        for (size_t j = 0; j < 8; j++) word = (word << 8) | in[32 - 8 * (i + 1) + j];
+        out[i] = word;
+    }
+}
+
+void limbsToBytes(const uint64_t in[LIMBS], uint8_t out[32]) {
+    for (size_t i = 0; i < LIMBS; i++) {
+        for (size_t j = 0; j < 8; j++) out[32 - 8 * (i + 1) + j] = (uint8_t)(in[i] >> (8 * (7 - j)));
+    }
+}
+
+// 1 <= a < n, sem desvio dependente do valor
+bool scalarInRange(const uint64_t a[LIMBS]) {
+    uint64_t borrow = 0, bits = 0;
+    for (size_t i = 0; i < LIMBS; i++) {
+        unsigned __int128 diff = (unsigned __int128)a[i] - Secp256k1OrderParams::MODULUS.p[i] - borrow;
+        borrow = (uint64_t)(diff >> 64) & 1;
+        bits |= a[i];
+    }
+    return (borrow & (uint64_t)(bits != 0)) != 0;
+}
+
+Element elementFromHex(const char* hex) {
+    uint64_t raw[LIMBS];
+    limbsFromHex(hex, raw);
+    return field.fromRaw(raw);
+}
+
+// Pontos jacobianos de JacobianCurve e conversão para afim com uma inversão
+// só para a tabela toda (truque de Montgomery). Fora do caminho quente e
+// sobre dados públicos, então as fórmulas com desvio servem.
+GeneratorTable* buildGeneratorTable() {
+    const JacobianCurve curve(field, field.zero(), field.fromUint(7));
+    const size_t count = WINDOWS * WINDOW_POINTS;
+    std::vector<JacobianCurve::Point> jacobian(count);
+    JacobianCurve::Point base = curve.fromAffine(elementFromHex(GX), elementFromHex(GY));
+    for (size_t i = 0; i < WINDOWS; i++) {
+        JacobianCurve::Point* row = &jacobian[i * WINDOW_POINTS];
+        row[0] = base;
+        for (size_t d = 1; d < WINDOW_POINTS; d++) curve.add(row[d], row[d - 1], base);
+        curve.add(base, row[WINDOW_POINTS - 1], base);
+    }
+
+    std::vector<Element> prefix(count);
+    Element product = field.one();
+    for (size_t j = 0; j < count; j++) {
+        prefix[j] = product;
+        field.mul(product, product, jacobian[j].z);
+    }
+    GeneratorTable* table = new GeneratorTable;
+    Element inverse = field.inverse(product);
+    for (size_t j = count; j-- > 0;) {
+        Element z_inv, z_inv2;
+        field.mul(z_inv, inverse, prefix[j]);
+        field.mul(inverse, inverse, jacobian[j].z);
+        field.sqr(z_inv2, z_inv);
+        AffinePoint& point = table->points[j / WINDOW_POINTS][j % WINDOW_POINTS];
+        field.mul(point.x, jacobian[j].x, z_inv2);
+        field.mul(z_inv2, z_inv2, z_inv);
+        field.mul(point.y, jacobian[j].y, z_inv2);
+    }
+    table->b3 = field.fromUint(CURVE_B3);
+    return table;
+}
+
+const GeneratorTable& generatorTable() {
+    static const GeneratorTable* table = buildGeneratorTable();
+    return *table;
+}
+
+// out = row[digit - 1] (ou zeros para digit = 0), lendo a linha inteira
+void selectPoint(AffinePoint& out, const AffinePoint* row, unsigned digit) {
+    uint64_t* dst = out.x.v;
+    const size_t words = sizeof(AffinePoint) / sizeof(uint64_t);
+    static_assert(sizeof(AffinePoint) == 2 * LIMBS * sizeof(uint64_t), "AffinePoint sem folga");
+    for (size_t w = 0; w < words; w++) dst[w] = 0;
+    for (size_t j = 0; j < WINDOW_POINTS; j++) {
+        const uint64_t mask = 0 - ((((uint64_t)(j + 1) ^ digit) - 1) >> 63);
+        const uint64_t* src = row[j].x.v;
+        for (size_t w = 0; w < words; w++) dst[w] |= src[w] & mask;
+    }
+}
+
+// r = mask ? a : r
+void conditionalMove(ProjectivePoint& r, const ProjectivePoint& a, uint64_t mask) {
+    static_assert(sizeof(ProjectivePoint) == 3 * LIMBS * sizeof(uint64_t), "ProjectivePoint sem folga");
+    uint64_t* dst = r.x.v;
+    const uint64_t* src = a.x.v;
+    for (size_t w = 0; w < 3 * LIMBS; w++) dst[w] ^= (dst[w] ^ src[w]) & mask;
+}
+
+// Soma mista completa para a = 0 (Renes-Costello-Batina 2016, algoritmo 8):
+// vale para qualquer p, inclusive o infinito e p = q; q é afim e não pode ser
+// o infinito.
+void addMixed(ProjectivePoint& r, const ProjectivePoint& p, const AffinePoint& q, const Element& b3) {
+    Element t0, t1, t2, t3, t4, x3, y3, z3;
+    field.mul(t0, p.x, q.x);
+    field.mul(t1, p.y, q.y);
+    field.add(t3, q.x, q.y);
+    field.add(t4, p.x, p.y);
+    field.mul(t3, t3, t4);
+    field.add(t4, t0, t1);
+    field.sub(t3, t3, t4);
+    field.mul(t4, q.y, p.z);
+    field.add(t4, t4, p.y);
+    field.mul(y3, q.x, p.z);
+    field.add(y3, y3, p.x);
+    field.add(x3, t0, t0);
+    field.add(t0, x3, t0);
+    field.mul(t2, b3, p.z);
+    field.add(z3, t1, t2);
+    field.sub(t1, t1, t2);
+    field.mul(y3, b3, y3);
+    field.mul(x3, t4, y3);
+    field.mul(t2, t3, t1);
+    field.sub(x3, t2, x3);
+    field.mul(y3, y3, t0);
+    field.mul(t1, t1, z3);
+    field.add(y3, t1, y3);
+    field.mul(t0, t0, t3);
+    field.mul(z3, z3, t4);
+    field.add(z3, z3, t0);
+    r.x = x3;
+    r.y = y3;
+    r.z = z3;
+}
+
+// s.acc = scalar G, scalar big-endian em [1, n); x/y afins em s.x, s.y
+void mulGenerator(SignScratch& s, const uint8_t scalar[32]) {
+    const GeneratorTable& table = generatorTable();
+    s.acc.x = field.zero();
+    s.acc.y = field.one();
+    s.acc.z = field.zero();
+    for (size_t i = 0; i < WINDOWS; i++) {
+        const unsigned digit = (scalar[31 - i / 2] >> (4 * (i % 2))) & 15;
+        selectPoint(s.entry, table.points[i], digit);
+        addMixed(s.sum, s.acc, s.entry, table.b3);
+        conditionalMove(s.acc, s.sum, 0 - (uint64_t)((digit + 15) >> 4));
+    }
+    s.z_inv = field.inverse(s.acc.z);
+    field.mul(s.x, s.acc.x, s.z_inv);
+    field.mul(s.y, s.acc.y, s.z_inv);
+}
+
+void hmacSha256(SignScratch& s, const uint8_t key[32], const uint8_t* data, size_t len, uint8_t out[32]) {
+    for (size_t i = 0; i < SHA256_BLOCK_BYTES; i++) s.pad[i] = (uint8_t)((i < 32 ? key[i] : 0) ^ 0x36);
+    s.hasher.reset();
+    s.hasher.update(s.pad, SHA256_BLOCK_BYTES).update(data, len).finalize(s.inner);
+    for (size_t i = 0; i < SHA256_BLOCK_BYTES; i++) s.pad[i] ^= 0x36 ^ 0x5c;
+    s.hasher.reset();
+    s.hasher.update(s.pad, SHA256_BLOCK_BYTES).update(s.inner, sizeof(s.inner)).finalize(out);
+}
+
+// K = HMAC_K(V || separador [|| x || h1]); V = HMAC_K(V)
+void rfc6979Step(SignScratch& s, uint8_t separator, bool with_key) {
+    std::memcpy(s.message, s.hmac_v, 32);
+    s.message[32] = separator;
+    hmacSha256(s, s.hmac_k, s.message, with_key ? sizeof(s.message) : 33, s.hmac_k);
+    hmacSha256(s, s.hmac_k, s.hmac_v, 32, s.hmac_v);
+}
+
+bool signWith(SignScratch& s, const uint8_t secret[32], const uint8_t digest[32], uint8_t out[64]) {
+    bytesToLimbs(secret, s.secret_raw);
+    if (!scalarInRange(s.secret_raw)) return false;
+    s.d = scalars.fromRaw(s.secret_raw);
+
+    // h1 = digest mod n (bits2octets); o hash tem o tamanho da ordem
+    bytesToLimbs(digest, s.out_raw);
+    s.e = scalars.fromRaw(s.out_raw);
+    scalars.toRaw(s.e, s.out_raw);
+
+    // RFC 6979, seção 3.2
+    std::memset(s.hmac_v, 0x01, 32);
+    std::memset(s.hmac_k, 0x00, 32);
+    std::memcpy(s.message + 33, secret, 32);
+    limbsToBytes(s.out_raw, s.message + 65);
+    rfc6979Step(s, 0x00, true);
+    rfc6979Step(s, 0x01, true);
+
+    for (;;) {
+        hmacSha256(s, s.hmac_k, s.hmac_v, 32, s.hmac_v);
+        bytesToLimbs(s.hmac_v, s.nonce_raw);
+        if (scalarInRange(s.nonce_raw)) {
+            mulGenerator(s, s.hmac_v);
+            // r = x mod n (x < p < R, então fromRaw reduz)
+            field.toRaw(s.x, s.out_raw);
+            s.r = scalars.fromRaw(s.out_raw);
+            if (!scalars.isZero(s.r)) {
+                s.k = scalars.fromRaw(s.nonce_raw);
+                scalars.mul(s.s, s.r, s.d);
+                scalars.add(s.s, s.s, s.e);
+                scalars.mul(s.s, s.s, scalars.inverse(s.k));
+                if (!scalars.isZero(s.s)) break;
+            }
+        }
+        rfc6979Step(s, 0x00, false);
+    }
+
+    scalars.toRaw(s.r, s.out_raw);
+    limbsToBytes(s.out_raw, out);
+    scalars.toRaw(s.s, s.out_raw);
+    limbsToBytes(s.out_raw, out + 32);
+    return true;
+}
+
+// Rascunho da thread, pego da arena na primeira chamada e devolvido (zerado)
+// quando a thread termina
+SignScratch* threadScratch() {
+    thread_local SecureBuffer block(sizeof(SignScratch));
+    thread_local SignScratch* scratch = block.valid() ? new (block.data()) SignScratch() : nullptr;
+    return scratch;
+}
+
+void clearScratch(SignScratch* s) {
+    OPENSSL_cleanse(s, offsetof(SignScratch, key_slot));
+}
+
+} // namespace
+
+Secp256k1KeySlot::Secp256k1KeySlot() : slot(nullptr) {
+    SignScratch* s = threadScratch();
+    if (s && !s->key_slot_busy) {
+        s->key_slot_busy = true;
+        slot = s->key_slot;
+    }
+}
+
+Secp256k1KeySlot::~Secp256k1KeySlot() {
+    if (!slot) return;
+    OPENSSL_cleanse(slot, SECP256K1_KEY_SLOT_BYTES);
+    threadScratch()->key_slot_busy = false;
+}
+
+bool secp256k1SecretValid(const uint8_t secret[SECP256K1_SECRET_BYTES]) {
+    uint64_t raw[LIMBS];
+    bytesToLimbs(secret, raw);
+    const bool valid = scalarInRange(raw);
+    OPENSSL_cleanse(raw, sizeof(raw));
+    return valid;
+}
+
+bool secp256k1RandomSecret(uint8_t secret[SECP256K1_SECRET_BYTES]) {
+    do {
+        if (RAND_priv_bytes(secret, (int)SECP256K1_SECRET_BYTES) != 1) return false;
+    } while (!secp256k1SecretValid(secret));
+    return true;
+}
+
+bool secp256k1PublicKey(const uint8_t secret[SECP256K1_SECRET_BYTES], uint8_t out[SECP256K1_PUBLIC_KEY_BYTES]) {
+    SignScratch* s = threadScratch();
+    if (!s || !secp256k1SecretValid(secret)) return false;
+    mulGenerator(*s, secret);
+    out[0] = 0x04;
+    field.toRaw(s->x, s->out_raw);
+    limbsToBytes(s->out_raw, out + 1);
+    field.toRaw(s->y, s->out_raw);
+    limbsToBytes(s->out_raw, out + 33);
+    clearScratch(s);
+    return true;
+}
+
+bool secp256k1SignDigest(const uint8_t secret[SECP256K1_SECRET_BYTES], const uint8_t digest[32],
+                         uint8_t out[SECP256K1_SIGNATURE_BYTES]) {
+    SignScratch* s = threadScratch();
+    if (!s) return false;
+    const bool ok = signWith(*s, secret, digest, out);
+    clearScratch(s);
+    return ok;
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,182 @@
+#include "../include/adilsoncrypto_secure.h"
+#include <utility>
+#include <openssl/crypto.h>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace adilsoncrypto {
+
+namespace {
+
+const uint8_t NO_CLASS = 0xFF;
+
+size_t systemPageSize() {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    return (size_t)sysconf(_SC_PAGESIZE);
+#endif
+}
+
+// Reserva guarda + páginas úteis + guarda; devolve a primeira útil
+uint8_t* mapPages(size_t page_size, size_t pages, bool& locked) {
+    const size_t total = (pages + 2) * page_size;
+#if defined(_WIN32)
+    uint8_t* base = (uint8_t*)VirtualAlloc(nullptr, total, MEM_RESERVE | MEM_COMMIT, PAGE_NOACCESS);
+    if (!base) return nullptr;
+    DWORD old;
+    if (!VirtualProtect(base + page_size, pages * page_size, PAGE_READWRITE, &old)) {
+        VirtualFree(base, 0, MEM_RELEASE);
+        return nullptr;
+    }
+    locked = VirtualLock(base + page_size, pages * page_size) != 0;
+#else
+    void* mapped = mmap(nullptr, total, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) return nullptr;
+    uint8_t* base = (uint8_t*)mapped;
+    if (mprotect(base + page_size, pages * page_size, PROT_READ | PROT_WRITE) != 0) {
+        munmap(base, total);
+        return nullptr;
+    }
+    locked = mlock(base + page_size, pages * page_size) == 0;
+#if defined(MADV_DONTDUMP)
+    madvise(base + page_size, pages * page_size, MADV_DONTDUMP);
+#endif
+#endif
+    return base + page_size;
+}
+
+void unmapPages(uint8_t* first, size_t page_size, size_t pages, bool locked) {
+    OPENSSL_cleanse(first, pages * page_size);
+#if defined(_WIN32)
+    if (locked) VirtualUnlock(first, pages * page_size);
+    VirtualFree(first - page_size, 0, MEM_RELEASE);
+#else
+    if (locked) munlock(first, pages * page_size);
+    munmap(first - page_size, (pages + 2) * page_size);
+#endif
+}
+
+} // namespace
+
+SecureArena::SecureArena(size_t region_bytes) : page_size(systemPageSize()), free_lists{} {
+    if (page_size < MAX_BLOCK) page_size = MAX_BLOCK;
+    region_pages = (region_bytes + page_size - 1) / page_size;
+    if (region_pages == 0) region_pages = 1;
+}
+
+SecureArena::~SecureArena() {
+    for (Region& region : regions) unmapPages(region.base, page_size, region.pages, region.locked);
+}
+
+size_t SecureArena::classOf(size_t size) {
+    size_t size_class = 0;
+    while ((MIN_BLOCK << size_class) < size) size_class++;
+    return size_class;
+}
+
+bool SecureArena::mapRegion(size_t pages) {
+    Region region;
+    region.pages = pages;
+    region.next_page = 0;
+    region.locked = false;
+    region.base = mapPages(page_size, pages, region.locked);
+    if (!region.base) return false;
+    region.page_class.assign(pages, NO_CLASS);
+    counters.regions++;
+    counters.mapped_bytes += pages * page_size;
+    if (region.locked) counters.locked_bytes += pages * page_size;
+    regions.push_back(std::move(region));
+    return true;
+}
+
+// Entrega uma página nova à classe, cortada em blocos na lista livre
+bool SecureArena::refill(size_t size_class) {
+    if (regions.empty() || regions.back().next_page == regions.back().pages) {
+        if (!mapRegion(region_pages)) return false;
+    }
+    Region& region = regions.back();
+    const size_t page = region.next_page++;
+    region.page_class[page] = (uint8_t)size_class;
+
+    const size_t block_size = MIN_BLOCK << size_class;
+    uint8_t* first = region.base + page * page_size;
+    for (size_t offset = page_size; offset >= block_size; offset -= block_size) {
+        void** block = (void**)(first + offset - block_size);
+        *block = free_lists[size_class];
+        free_lists[size_class] = block;
+    }
+    return true;
+}
+
+const SecureArena::Region* SecureArena::regionOf(const void* block) const {
+    const uint8_t* p = (const uint8_t*)block;
+    for (const Region& region : regions) {
+        if (p >= region.base && p < region.base + region.pages * page_size) return &region;
+    }
+    return nullptr;
+}
+
+void* SecureArena::allocate(size_t size) {
+    if (size == 0 || size > MAX_BLOCK) return nullptr;
+    const size_t size_class = classOf(size);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!free_lists[size_class] && !refill(size_class)) return nullptr;
+    void** block = (void**)free_lists[size_class];
+    free_lists[size_class] = *block;
+    *block = nullptr;   // o resto já está zerado
+    counters.allocations++;
+    counters.blocks_in_use++;
+    counters.bytes_in_use += MIN_BLOCK << size_class;
+    return block;
+}
+
+void SecureArena::deallocate(void* block) {
+    if (!block) return;
+    std::lock_guard<std::mutex> lock(mutex);
+    const Region* region = regionOf(block);
+    if (!region) return;   // não é desta arena: melhor vazar que corromper a lista
+    const size_t offset = (size_t)((const uint8_t*)block - region->base);
+    const uint8_t size_class = region->page_class[offset / page_size];
+    if (size_class == NO_CLASS) return;
+    const size_t block_size = MIN_BLOCK << size_class;
+    if (offset % block_size != 0) return;
+
+    OPENSSL_cleanse(block, block_size);
+    *(void**)block = free_lists[size_class];
+    free_lists[size_class] = block;
+    counters.blocks_in_use--;
+    counters.bytes_in_use -= block_size;
+}
+
+bool SecureArena::owns(const void* block) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return regionOf(block) != nullptr;
+}
+
+bool SecureArena::locked() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return counters.locked_bytes == counters.mapped_bytes;
+}
+
+SecureArena::Stats SecureArena::stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return counters;
+}
+
+SecureArena& secureArena() {
+    static SecureArena* arena = new SecureArena();
+    return *arena;
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,259 @@
+#include "../include/adilsoncrypto_serialize.h"
+#include "../include/adilsoncrypto_context.h"
+#include <cstring>
+#include <openssl/ec.h>
+#include <openssl/obj_mac.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const uint8_t BATCH_MAGIC[3] = { 'A', 'C', 'B' };
+const uint8_t BATCH_VERSION = 1;
+
+const EC_GROUP* secp256k1Group() {
+    static EC_GROUP* group = EC_GROUP_new_by_curve_name(NID_secp256k1);
+    return group;
+}
+
+// INTEGER DER de um valor de 32 bytes: sem zeros à esquerda, com 0x00 se o
+// bit mais alto estiver ligado
+size_t derInteger(const uint8_t value[32], uint8_t* out) {
+    size_t skip = 0;
+    while (skip < 31 && value[skip] == 0) skip++;
+    size_t len = 32 - skip;
+    bool pad = (value[skip] & 0x80) != 0;
+    out[0] = 0x02;
+    out[1] = (uint8_t)(len + pad);
+    out[2] = 0;
+    std::memcpy(out + 2 + pad, value + skip, len);
+    return 2 + pad + len;
+}
+
+bool derReadInteger(const uint8_t*& p, const uint8_t* end, uint8_t value[32]) {
+    if (end - p < 2 || p[0] != 0x02) return false;
+    size_t len = p[1];
+    const uint8_t* body = p + 2;
+    if (len == 0 || (size_t)(end - body) < len) return false;
+    if (body[0] & 0x80) return false;                                 // negativo
+    if (len > 1 && body[0] == 0 && !(body[1] & 0x80)) return false;   // zero desnecessário
+    if (body[0] == 0 && len > 1) {
+        body++;
+        len--;
+    }
+    if (len > 32) return false;
+    std::memset(value, 0, 32 - len);
+    std::memcpy(value + 32 - len, body, len);
+    p = body + len;
+    return true;
+}
+
+void writeUint32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out[i] = (uint8_t)(value >> (8 * i));
+}
+
+int hexDigitValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+uint32_t readUint32(const uint8_t* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+} // namespace
+
+std::string scalarToHex(const uint8_t* value, size_t len) {
+    size_t skip = 0;
+    while (skip + 1 < len && value[skip] == 0) skip++;
+    std::string hex = bytesToHex(value + skip, len - skip);
+    for (char& c : hex) {
+        if (c >= 'a' && c <= 'f') c = (char)(c - 'a' + 'A');
+    }
+    return hex;
+}
+
+// Lido do fim para o começo direto em 'out': nenhuma cópia do texto (que
+// costuma ser uma chave privada) vai para o heap
+bool scalarFromHex(const std::string& hex, uint8_t out[32]) {
+    if (hex.empty() || hex.size() > 64) return false;
+    std::memset(out, 0, 32);
+    for (size_t i = 0; i < hex.size(); i++) {
+        int digit = hexDigitValue(hex[hex.size() - 1 - i]);
+        if (digit < 0) {
+            std::memset(out, 0, 32);
+            return false;
+        }
+        out[31 - i / 2] |= (uint8_t)(digit << (4 * (i % 2)));
+    }
+    return true;
+}
+
+bool scalarHexCanonical(const std::string& hex) {
+    if (hex.size() < 2 || hex.size() > 64 || hex.size() % 2 || (hex.size() > 2 && hex[0] == '0' && hex[1] == '0')) {
+        return false;
+    }
+    for (char c : hex) {
+        if (!((c >= '0' && c <= '9') || (c >= 'A' && c <= 'F'))) return false;
+    }
+    return true;
+}
+
+size_t derEncodeSignature(const uint8_t r[32], const uint8_t s[32], uint8_t* out) {
+    size_t len = derInteger(r, out + 2);
+    len += derInteger(s, out + 2 + len);
+    out[0] = 0x30;
+    out[1] = (uint8_t)len;
+    return len + 2;
+}
+
+bool derDecodeSignature(const uint8_t* der, size_t len, uint8_t r[32], uint8_t s[32]) {
+    if (len < 8 || len > DER_SIGNATURE_MAX_BYTES || der[0] != 0x30 || der[1] != len - 2) return false;
+    const uint8_t* p = der + 2;
+    const uint8_t* end = der + len;
+    return derReadInteger(p, end, r) && derReadInteger(p, end, s) && p == end;
+}
+
+bool compressPublicKey(const uint8_t uncompressed[UNCOMPRESSED_KEY_BYTES], uint8_t compressed[COMPRESSED_KEY_BYTES]) {
+    if (uncompressed[0] != 0x04) return false;
+    compressed[0] = (uint8_t)(0x02 | (uncompressed[64] & 1));
+    std::memcpy(compressed + 1, uncompressed + 1, 32);
+    return true;
+}
+
+bool decompressPublicKey(const uint8_t compressed[COMPRESSED_KEY_BYTES], uint8_t uncompressed[UNCOMPRESSED_KEY_BYTES]) {
+    if (compressed[0] != 0x02 && compressed[0] != 0x03) return false;
+    const EC_GROUP* group = secp256k1Group();
+    ThreadContext& context = threadContext();
+    static const uint64_t group_id = newScratchGroupId();
+    EC_POINT* point = context.point(group_id, group, 0);
+    BN_CTX* ctx = context.bnCtx();
+    return point && EC_POINT_oct2point(group, point, compressed, COMPRESSED_KEY_BYTES, ctx) == 1 &&
+           EC_POINT_point2oct(group, point, POINT_CONVERSION_UNCOMPRESSED, uncompressed, UNCOMPRESSED_KEY_BYTES, ctx) ==
+               UNCOMPRESSED_KEY_BYTES;
+}
+
+size_t batchRecordBytes(BatchFormat format) {
+    switch (format) {
+    case BatchFormat::COMPACT_SIGNATURE: return COMPACT_SIGNATURE_BYTES;
+    case BatchFormat::RECOVERABLE_SIGNATURE: return RECOVERABLE_SIGNATURE_BYTES;
+    case BatchFormat::COMPRESSED_KEY: return COMPRESSED_KEY_BYTES;
+    case BatchFormat::UNCOMPRESSED_KEY: return UNCOMPRESSED_KEY_BYTES;
+    default: return 0;
+    }
+}
+
+size_t batchMaxEncodedSize(BatchFormat format, size_t count) {
+    size_t record = batchRecordBytes(format);
+    return BATCH_HEADER_BYTES + count * (record ? record : 1 + DER_SIGNATURE_MAX_BYTES);
+}
+
+BatchEncoder::BatchEncoder(BatchFormat format, size_t count, uint8_t* out, size_t capacity)
+    : format(format), record_bytes(batchRecordBytes(format)), expected(count), written(0), out(out),
+      capacity(capacity), used(BATCH_HEADER_BYTES), failed(false) {
+    bool known = record_bytes != 0 || format == BatchFormat::DER_SIGNATURE;
+    if (!known || count > BATCH_MAX_RECORDS || capacity < BATCH_HEADER_BYTES) {
+        failed = true;
+        return;
+    }
+    std::memcpy(out, BATCH_MAGIC, sizeof(BATCH_MAGIC));
+    out[3] = BATCH_VERSION;
+    out[4] = (uint8_t)format;
+    writeUint32(out + 5, (uint32_t)count);
+}
+
+uint8_t* BatchEncoder::reserve() {
+    if (failed || record_bytes == 0 || written == expected || capacity - used < record_bytes) {
+        failed = true;
+        return nullptr;
+    }
+    uint8_t* slot = out + used;
+    used += record_bytes;
+    written++;
+    return slot;
+}
+
+bool BatchEncoder::append(const uint8_t* record, size_t len) {
+    if (record_bytes != 0) {
+        if (len != record_bytes) {
+            failed = true;
+            return false;
+        }
+        uint8_t* slot = reserve();
+        if (slot) std::memcpy(slot, record, len);
+        return slot != nullptr;
+    }
+    if (failed || written == expected || len == 0 || len > DER_SIGNATURE_MAX_BYTES || capacity - used < 1 + len) {
+        failed = true;
+        return false;
+    }
+    out[used] = (uint8_t)len;
+    std::memcpy(out + used + 1, record, len);
+    used += 1 + len;
+    written++;
+    return true;
+}
+
+bool BatchEncoder::appendSignature(const uint8_t r[32], const uint8_t s[32], uint8_t v) {
+    if (format == BatchFormat::DER_SIGNATURE) {
+        if (failed || written == expected || capacity - used < 1 + DER_SIGNATURE_MAX_BYTES) {
+            failed = true;
+            return false;
+        }
+        size_t len = derEncodeSignature(r, s, out + used + 1);
+        out[used] = (uint8_t)len;
+        used += 1 + len;
+        written++;
+        return true;
+    }
+    if (format != BatchFormat::COMPACT_SIGNATURE && format != BatchFormat::RECOVERABLE_SIGNATURE) {
+        failed = true;
+        return false;
+    }
+    uint8_t* slot = reserve();
+    if (!slot) return false;
+    std::memcpy(slot, r, 32);
+    std::memcpy(slot + 32, s, 32);
+    if (format == BatchFormat::RECOVERABLE_SIGNATURE) slot[64] = v;
+    return true;
+}
+
+size_t BatchEncoder::finish() const {
+    return failed || written != expected ? 0 : used;
+}
+
+bool batchDecode(const uint8_t* data, size_t len, BatchFormat& format, std::vector<ByteView>& records) {
+    records.clear();
+    if (len < BATCH_HEADER_BYTES || std::memcmp(data, BATCH_MAGIC, sizeof(BATCH_MAGIC)) != 0 || data[3] != BATCH_VERSION) {
+        return false;
+    }
+    format = (BatchFormat)data[4];
+    const size_t count = readUint32(data + 5);
+    const size_t record = batchRecordBytes(format);
+    const uint8_t* p = data + BATCH_HEADER_BYTES;
+    const size_t payload = len - BATCH_HEADER_BYTES;
+
+    if (record != 0) {
+        if (payload / record != count || payload % record != 0) return false;
+        records.resize(count);
+        for (size_t i = 0; i < count; i++) records[i] = { p + i * record, record };
+        return true;
+    }
+    if (format != BatchFormat::DER_SIGNATURE || payload < count * 9) return false;   // 1 + DER mínimo de 8
+
+    records.resize(count);
+    const uint8_t* end = data + len;
+    for (size_t i = 0; i < count; i++) {
+        size_t size = p < end ? *p++ : 0;
+        if (size == 0 || size > DER_SIGNATURE_MAX_BYTES || (size_t)(end - p) < size) break;
+        records[i] = { p, size };
+        p += size;
+        if (i + 1 == count && p == end) return true;
+    }
+    records.clear();
+    return count == 0 && p == end;
+}
+
+} // namespace adilsoncrypto
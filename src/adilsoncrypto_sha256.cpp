@@ -0,0 +1,427 @@
+#include "../include/adilsoncrypto_sha256.h"
+#include "../include/adilsoncrypto_sha256_lanes.h"
+#include "../include/adilsoncrypto_cpu.h"
+#include <cstring>
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace adilsoncrypto {
+
+const uint32_t SHA256_IV[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+namespace {
+
+struct ScalarOps {
+    typedef uint32_t vec;
+    static const size_t LANES = 1;
+    static inline vec load(const uint32_t* p) { return *p; }
+    static inline void store(uint32_t* p, vec v) { *p = v; }
+    static inline vec set1(uint32_t x) { return x; }
+    static inline vec add(vec a, vec b) { return a + b; }
+    static inline vec xor3(vec a, vec b, vec c) { return a ^ b ^ c; }
+    static inline vec ch(vec e, vec f, vec g) { return g ^ (e & (f ^ g)); }
+    static inline vec maj(vec a, vec b, vec c) { return (a & b) | (c & (a | b)); }
+    template <int N> static inline vec rotr(vec x) { return (x >> N) | (x << (32 - N)); }
+    template <int N> static inline vec shr(vec x) { return x >> N; }
+};
+
+#if defined(__SSE2__)
+struct Sse2Ops {
+    typedef __m128i vec;
+    static const size_t LANES = 4;
+    static inline vec load(const uint32_t* p) { return _mm_load_si128((const __m128i*)p); }
+    static inline void store(uint32_t* p, vec v) { _mm_store_si128((__m128i*)p, v); }
+    static inline vec set1(uint32_t x) { return _mm_set1_epi32((int)x); }
+    static inline vec add(vec a, vec b) { return _mm_add_epi32(a, b); }
+    static inline vec xor3(vec a, vec b, vec c) { return _mm_xor_si128(_mm_xor_si128(a, b), c); }
+    static inline vec ch(vec e, vec f, vec g) { return _mm_xor_si128(g, _mm_and_si128(e, _mm_xor_si128(f, g))); }
+    static inline vec maj(vec a, vec b, vec c) { return _mm_or_si128(_mm_and_si128(a, b), _mm_and_si128(c, _mm_or_si128(a, b))); }
+    template <int N> static inline vec rotr(vec x) { return _mm_or_si128(_mm_srli_epi32(x, N), _mm_slli_epi32(x, 32 - N)); }
+    template <int N> static inline vec shr(vec x) { return _mm_srli_epi32(x, N); }
+};
+
+void compressSse2(uint32_t* states, const uint8_t* const* blocks) {
+    Sha256Lanes<Sse2Ops>::compressBlocks(states, blocks);
+}
+
+void noncesSse2(const uint32_t* midstate, const uint32_t* tail, uint32_t nonce, uint32_t* out) {
+    Sha256Lanes<Sse2Ops>::sha256dNonces(midstate, tail, nonce, out);
+}
+#endif
+
+void compressScalar(uint32_t* states, const uint8_t* const* blocks) {
+    Sha256Lanes<ScalarOps>::compressBlocks(states, blocks);
+}
+
+void noncesScalar(const uint32_t* midstate, const uint32_t* tail, uint32_t nonce, uint32_t* out) {
+    Sha256Lanes<ScalarOps>::sha256dNonces(midstate, tail, nonce, out);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+void compressShaniLane(uint32_t* states, const uint8_t* const* blocks) {
+    sha256CompressShani(states, blocks[0], 1);
+}
+
+void noncesShani(const uint32_t* midstate, const uint32_t* tail, uint32_t nonce, uint32_t* out) {
+    uint8_t block[64];
+    std::memset(block, 0, sizeof(block));
+    for (int i = 0; i < 3; i++) sha256StoreBe32(block + 4 * i, tail[i]);
+    std::memcpy(block + 12, &nonce, 4); // nonce é little-endian no cabeçalho
+    block[16] = 0x80;
+    block[62] = 0x02;
+    block[63] = 0x80;
+    uint32_t s[8];
+    std::memcpy(s, midstate, sizeof(s));
+    sha256CompressShani(s, block, 1);
+
+    std::memset(block, 0, sizeof(block));
+    for (int i = 0; i < 8; i++) sha256StoreBe32(block + 4 * i, s[i]);
+    block[32] = 0x80;
+    block[62] = 0x01;
+    std::memcpy(out, SHA256_IV, 32);
+    sha256CompressShani(out, block, 1);
+}
+#endif
+
+const Sha256LaneBackend BACKEND_SCALAR = { Sha256Kernel::SCALAR, "scalar", 1, compressScalar, noncesScalar };
+#if defined(__SSE2__)
+const Sha256LaneBackend BACKEND_SSE2 = { Sha256Kernel::SSE2, "sse2", 4, compressSse2, noncesSse2 };
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+const Sha256LaneBackend BACKEND_AVX2 = { Sha256Kernel::AVX2, "avx2", 8, sha256CompressAvx2, sha256dNoncesAvx2 };
+const Sha256LaneBackend BACKEND_AVX512 = { Sha256Kernel::AVX512, "avx512", 16, sha256CompressAvx512, sha256dNoncesAvx512 };
+const Sha256LaneBackend BACKEND_SHANI = { Sha256Kernel::SHANI, "sha-ni", 1, compressShaniLane, noncesShani };
+#endif
+
+const Sha256LaneBackend* backendFor(Sha256Kernel kernel) {
+    switch (kernel) {
+    case Sha256Kernel::SCALAR: return &BACKEND_SCALAR;
+#if defined(__SSE2__)
+    case Sha256Kernel::SSE2: return &BACKEND_SSE2;
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+    case Sha256Kernel::AVX2: return cpuFeatures().avx2 ? &BACKEND_AVX2 : nullptr;
+    case Sha256Kernel::AVX512: return cpuFeatures().avx512f ? &BACKEND_AVX512 : nullptr;
+    case Sha256Kernel::SHANI: return cpuFeatures().shani ? &BACKEND_SHANI : nullptr;
+#endif
+    default: return nullptr;
+    }
+}
+
+// Ordem de preferência para lotes independentes: mais lanes primeiro
+const Sha256LaneBackend& bestBackend() {
+    static const Sha256LaneBackend* best = []() {
+        const Sha256Kernel order[] = { Sha256Kernel::AVX512, Sha256Kernel::AVX2, Sha256Kernel::SHANI, Sha256Kernel::SSE2 };
+        for (Sha256Kernel k : order) {
+            if (const Sha256LaneBackend* b = backendFor(k)) return b;
+        }
+        return &BACKEND_SCALAR;
+    }();
+    return *best;
+}
+
+} // namespace
+
+const Sha256LaneBackend& sha256LaneBackend(Sha256Kernel kernel) {
+    if (kernel != Sha256Kernel::AUTO) {
+        if (const Sha256LaneBackend* b = backendFor(kernel)) return *b;
+    }
+    return bestBackend();
+}
+
+Sha256Kernel sha256KernelFromName(const std::string& name) {
+    if (name == "scalar") return Sha256Kernel::SCALAR;
+    if (name == "sse2") return Sha256Kernel::SSE2;
+    if (name == "avx2") return Sha256Kernel::AVX2;
+    if (name == "avx512") return Sha256Kernel::AVX512;
+    if (name == "sha-ni" || name == "shani") return Sha256Kernel::SHANI;
+    return Sha256Kernel::AUTO;
+}
+
+const char* sha256KernelName(Sha256Kernel kernel) {
+    switch (kernel) {
+    case Sha256Kernel::SCALAR: return "scalar";
+    case Sha256Kernel::SSE2: return "sse2";
+    case Sha256Kernel::AVX2: return "avx2";
+    case Sha256Kernel::AVX512: return "avx512";
+    case Sha256Kernel::SHANI: return "sha-ni";
+    default: return "auto";
+    }
+}
+
+bool sha256KernelSupported(Sha256Kernel kernel) {
+    return kernel == Sha256Kernel::AUTO || backendFor(kernel) != nullptr;
+}
+
+void sha256Compress(uint32_t state[8], const uint8_t* blocks, size_t nblocks) {
+#if defined(__x86_64__) || defined(__i386__)
+    if (cpuFeatures().shani) {
+        sha256CompressShani(state, blocks, nblocks);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < nblocks; i++) {
+        const uint8_t* block = blocks + 64 * i;
+        compressScalar(state, &block);
+    }
+}
+
+void sha256StateToBytes(const uint32_t state[8], uint8_t out[32]) {
+    for (int i = 0; i < 8; i++) sha256StoreBe32(out + 4 * i, state[i]);
+}
+
+// Implementação do hasher incremental
+Sha256Hasher::Sha256Hasher() {
+    reset();
+}
+
+void Sha256Hasher::reset() {
+    std::memcpy(h, SHA256_IV, sizeof(h));
+    buffered = 0;
+    total = 0;
+}
+
+Sha256Hasher& Sha256Hasher::update(const uint8_t* data, size_t len) {
+    total += len;
+    if (buffered > 0) {
+        size_t take = std::min(len, (size_t)64 - buffered);
+        std::memcpy(buffer + buffered, data, take);
+        buffered += take;
+        data += take;
+        len -= take;
+        if (buffered < 64) return *this;
+        sha256Compress(h, buffer, 1);
+        buffered = 0;
+    }
+    if (len >= 64) {
+        size_t blocks = len / 64;
+        sha256Compress(h, data, blocks);
+        data += blocks * 64;
+        len -= blocks * 64;
+    }
+    if (len > 0) {
+        std::memcpy(buffer, data, len);
+        buffered = len;
+    }
+    return *this;
+}
+
+Sha256Hasher& Sha256Hasher::update(const std::string& data) {
+    return update((const uint8_t*)data.data(), data.size());
+}
+
+void Sha256Hasher::finalize(uint8_t out[32]) {
+    uint64_t bits = total * 8;
+    buffer[buffered++] = 0x80;
+    if (buffered > 56) {
+        std::memset(buffer + buffered, 0, 64 - buffered);
+        sha256Compress(h, buffer, 1);
+        buffered = 0;
+    }
+    std::memset(buffer + buffered, 0, 56 - buffered);
+    for (int i = 0; i < 8; i++) buffer[56 + i] = (uint8_t)(bits >> (56 - 8 * i));
+    sha256Compress(h, buffer, 1);
+    sha256StateToBytes(h, out);
+}
+
+void sha256Digest(const uint8_t* data, size_t len, uint8_t out[32]) {
+    Sha256Hasher hasher;
+    hasher.update(data, len);
+    hasher.finalize(out);
+}
+
+void sha256dDigest(const uint8_t* data, size_t len, uint8_t out[32]) {
+    uint8_t first[32];
+    sha256Digest(data, len, first);
+    sha256Digest(first, 32, out);
+}
+
+std::string sha256Hex(const std::string& data) {
+    static const char digits[] = "0123456789abcdef";
+    uint8_t hash[32];
+    sha256Digest((const uint8_t*)data.data(), data.size(), hash);
+    std::string hex(64, '0');
+    for (int i = 0; i < 32; i++) {
+        hex[2 * i] = digits[hash[i] >> 4];
+        hex[2 * i + 1] = digits[hash[i] & 15];
+    }
+    return hex;
+}
+
+// Multi-buffer: todas as mensagens têm o mesmo tamanho, então todas as lanes
+// consomem o mesmo número de blocos e o padding é idêntico por lane.
+void sha256Many(const uint8_t* const* messages, size_t len, size_t count, uint8_t* out, Sha256Kernel kernel) {
+    const Sha256LaneBackend& backend = sha256LaneBackend(kernel);
+    const size_t lanes = backend.lanes;
+    const size_t full_blocks = len / 64;
+    const size_t rem = len % 64;
+    const size_t tail_blocks = rem < 56 ? 1 : 2;
+    const uint64_t bits = (uint64_t)len * 8;
+
+    alignas(64) uint8_t tails[SHA256_MAX_LANES][128];
+    uint32_t states[SHA256_MAX_LANES * 8];
+    const uint8_t* ptrs[SHA256_MAX_LANES];
+
+    for (size_t base = 0; base < count; base += lanes) {
+        size_t active = std::min(lanes, count - base);
+        for (size_t l = 0; l < lanes; l++) {
+            // Lanes ociosas repetem a última mensagem; o resultado é descartado
+            const uint8_t* msg = messages[base + std::min(l, active - 1)];
+            std::memcpy(states + 8 * l, SHA256_IV, 32);
+            uint8_t* tail = tails[l];
+            std::memset(tail, 0, 64 * tail_blocks);
+            std::memcpy(tail, msg + full_blocks * 64, rem);
+            tail[rem] = 0x80;
+            for (int i = 0; i < 8; i++) tail[64 * tail_blocks - 1 - i] = (uint8_t)(bits >> (8 * i));
+        }
+        for (size_t b = 0; b < full_blocks; b++) {
+            for (size_t l = 0; l < lanes; l++) ptrs[l] = messages[base + std::min(l, active - 1)] + 64 * b;
+            backend.compress(states, ptrs);
+        }
+        for (size_t b = 0; b < tail_blocks; b++) {
+            for (size_t l = 0; l < lanes; l++) ptrs[l] = tails[l] + 64 * b;
+            backend.compress(states, ptrs);
+        }
+        for (size_t l = 0; l < active; l++) {
+            sha256StateToBytes(states + 8 * l, out + 32 * (base + l));
+        }
+    }
+}
+
+void sha256dMany(const uint8_t* const* messages, size_t len, size_t count, uint8_t* out, Sha256Kernel kernel) {
+    const Sha256LaneBackend& backend = sha256LaneBackend(kernel);
+    const size_t lanes = backend.lanes;
+    alignas(64) uint8_t blocks[SHA256_MAX_LANES][64];
+    uint32_t states[SHA256_MAX_LANES * 8];
+    const uint8_t* ptrs[SHA256_MAX_LANES];
+
+    sha256Many(messages, len, count, out, kernel);
+
+    // Segunda passada: um único bloco por lane (32 bytes + padding de 256 bits)
+    for (size_t l = 0; l < lanes; l++) {
+        std::memset(blocks[l], 0, 64);
+        blocks[l][32] = 0x80;
+        blocks[l][62] = 0x01;
+        ptrs[l] = blocks[l];
+    }
+    for (size_t base = 0; base < count; base += lanes) {
+        size_t active = std::min(lanes, count - base);
+        for (size_t l = 0; l < lanes; l++) {
+            std::memcpy(blocks[l], out + 32 * (base + std::min(l, active - 1)), 32);
+            std::memcpy(states + 8 * l, SHA256_IV, 32);
+        }
+        backend.compress(states, ptrs);
+        for (size_t l = 0; l < active; l++) {
+            sha256StateToBytes(states + 8 * l, out + 32 * (base + l));
+        }
+    }
+}
+
+void sha256Batch(const uint8_t* const* messages, const size_t* lens, size_t count, uint8_t* out, Sha256Kernel kernel) {
+    struct Lane {
+        size_t index;
+        size_t block;
+        size_t full_blocks;
+        size_t total_blocks;
+        bool active;
+    };
+    const Sha256LaneBackend& backend = sha256LaneBackend(kernel);
+    const size_t lanes = backend.lanes;
+    alignas(64) uint8_t tails[SHA256_MAX_LANES][128];
+    alignas(64) uint8_t idle_block[64] = {};
+    uint32_t states[SHA256_MAX_LANES * 8];
+    const uint8_t* ptrs[SHA256_MAX_LANES];
+    Lane lane_info[SHA256_MAX_LANES];
+    size_t next = 0;
+    size_t running = 0;
+
+    auto refill = [&](size_t l) {
+        Lane& lane = lane_info[l];
+        lane.active = next < count;
+        if (!lane.active) return;
+        lane.index = next++;
+        size_t len = lens[lane.index];
+        size_t rem = len % 64;
+        size_t tail_blocks = rem < 56 ? 1 : 2;
+        uint64_t bits = (uint64_t)len * 8;
+        lane.block = 0;
+        lane.full_blocks = len / 64;
+        lane.total_blocks = lane.full_blocks + tail_blocks;
+        uint8_t* tail = tails[l];
+        std::memset(tail, 0, 128);
+        std::memcpy(tail, messages[lane.index] + lane.full_blocks * 64, rem);
+        tail[rem] = 0x80;
+        for (int i = 0; i < 8; i++) tail[64 * tail_blocks - 1 - i] = (uint8_t)(bits >> (8 * i));
+        std::memcpy(states + 8 * l, SHA256_IV, 32);
+        running++;
+    };
+
+    for (size_t l = 0; l < lanes; l++) refill(l);
+    while (running > 0) {
+        for (size_t l = 0; l < lanes; l++) {
+            const Lane& lane = lane_info[l];
+            if (!lane.active) {
+                ptrs[l] = idle_block;
+            } else if (lane.block < lane.full_blocks) {
+                ptrs[l] = messages[lane.index] + 64 * lane.block;
+            } else {
+                ptrs[l] = tails[l] + 64 * (lane.block - lane.full_blocks);
+            }
+        }
+        backend.compress(states, ptrs);
+        for (size_t l = 0; l < lanes; l++) {
+            Lane& lane = lane_info[l];
+            if (!lane.active || ++lane.block < lane.total_blocks) continue;
+            sha256StateToBytes(states + 8 * l, out + 32 * lane.index);
+            running--;
+            refill(l);
+        }
+    }
+}
+
+void sha256d64Many(const uint8_t* in, uint8_t* out, size_t count, Sha256Kernel kernel) {
+    const Sha256LaneBackend& backend = sha256LaneBackend(kernel);
+    const size_t lanes = backend.lanes;
+    // Bloco de padding de uma mensagem de 64 bytes (512 bits)
+    alignas(64) static const uint8_t PAD64[64] = {
+        0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02, 0x00
+    };
+    alignas(64) uint8_t second[SHA256_MAX_LANES][64];
+    uint32_t states[SHA256_MAX_LANES * 8];
+    const uint8_t* ptrs[SHA256_MAX_LANES];
+
+    for (size_t l = 0; l < lanes; l++) {
+        std::memset(second[l], 0, 64);
+        second[l][32] = 0x80;
+        second[l][62] = 0x01;
+    }
+    for (size_t base = 0; base < count; base += lanes) {
+        size_t active = std::min(lanes, count - base);
+        for (size_t l = 0; l < lanes; l++) {
+            ptrs[l] = in + 64 * (base + std::min(l, active - 1));
+            std::memcpy(states + 8 * l, SHA256_IV, 32);
+        }
+        backend.compress(states, ptrs);
+        for (size_t l = 0; l < lanes; l++) ptrs[l] = PAD64;
+        backend.compress(states, ptrs);
+        for (size_t l = 0; l < lanes; l++) {
+            sha256StateToBytes(states + 8 * l, second[l]);
+            std::memcpy(states + 8 * l, SHA256_IV, 32);
+            ptrs[l] = second[l];
+        }
+        backend.compress(states, ptrs);
+        for (size_t l = 0; l < active; l++) {
+            sha256StateToBytes(states + 8 * l, out + 32 * (base + l));
+        }
+    }
+}
+
+} // namespace adilsoncrypto
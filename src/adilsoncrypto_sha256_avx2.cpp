@@ -0,0 +1,39 @@
+// Kernel SHA-256 de 8 lanes (AVX2). Compilado com -mavx2 e chamado apenas
+// quando cpuFeatures().avx2 é verdadeiro.
+#include "../include/adilsoncrypto_sha256_lanes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#ifndef __AVX2__
+#error "adilsoncrypto_sha256_avx2.cpp precisa ser compilado com -mavx2"
+#endif
+#include <immintrin.h>
+
+namespace adilsoncrypto {
+
+namespace {
+struct Avx2Ops {
+    typedef __m256i vec;
+    static const size_t LANES = 8;
+    static inline vec load(const uint32_t* p) { return _mm256_load_si256((const __m256i*)p); }
+    static inline void store(uint32_t* p, vec v) { _mm256_store_si256((__m256i*)p, v); }
+    static inline vec set1(uint32_t x) { return _mm256_set1_epi32((int)x); }
+    static inline vec add(vec a, vec b) { return _mm256_add_epi32(a, b); }
+    static inline vec xor3(vec a, vec b, vec c) { return _mm256_xor_si256(_mm256_xor_si256(a, b), c); }
+    static inline vec ch(vec e, vec f, vec g) { return _mm256_xor_si256(g, _mm256_and_si256(e, _mm256_xor_si256(f, g))); }
+    static inline vec maj(vec a, vec b, vec c) { return _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b))); }
+    template <int N> static inline vec rotr(vec x) { return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N)); }
+    template <int N> static inline vec shr(vec x) { return _mm256_srli_epi32(x, N); }
+};
+} // namespace
+
+void sha256CompressAvx2(uint32_t* states, const uint8_t* const* blocks) {
+    Sha256Lanes<Avx2Ops>::compressBlocks(states, blocks);
+}
+
+void sha256dNoncesAvx2(const uint32_t* midstate, const uint32_t* tail, uint32_t nonce, uint32_t* out) {
+    Sha256Lanes<Avx2Ops>::sha256dNonces(midstate, tail, nonce, out);
+}
+
+} // namespace adilsoncrypto
+
+#endif
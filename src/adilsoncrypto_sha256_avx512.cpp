@@ -0,0 +1,45 @@
+// Kernel SHA-256 de 16 lanes (AVX-512F). Usa vpternlogd para Ch/Maj/XOR3 e
+// vprord para as rotações. Chamado apenas quando cpuFeatures().avx512f.
+#include "../include/adilsoncrypto_sha256_lanes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#ifndef __AVX512F__
+#error "adilsoncrypto_sha256_avx512.cpp precisa ser compilado com -mavx512f"
+#endif
+// O GCC 12 acusa '__Y' não inicializado dentro de avx512fintrin.h
+// (_mm512_undefined_epi32 usado de propósito pelos intrínsecos)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+
+namespace adilsoncrypto {
+
+namespace {
+struct Avx512Ops {
+    typedef __m512i vec;
+    static const size_t LANES = 16;
+    static inline vec load(const uint32_t* p) { return _mm512_load_si512((const void*)p); }
+    static inline void store(uint32_t* p, vec v) { _mm512_store_si512((void*)p, v); }
+    static inline vec set1(uint32_t x) { return _mm512_set1_epi32((int)x); }
+    static inline vec add(vec a, vec b) { return _mm512_add_epi32(a, b); }
+    static inline vec xor3(vec a, vec b, vec c) { return _mm512_ternarylogic_epi32(a, b, c, 0x96); }
+    static inline vec ch(vec e, vec f, vec g) { return _mm512_ternarylogic_epi32(e, f, g, 0xCA); }
+    static inline vec maj(vec a, vec b, vec c) { return _mm512_ternarylogic_epi32(a, b, c, 0xE8); }
+    template <int N> static inline vec rotr(vec x) { return _mm512_ror_epi32(x, N); }
+    template <int N> static inline vec shr(vec x) { return _mm512_srli_epi32(x, N); }
+};
+} // namespace
+
+void sha256CompressAvx512(uint32_t* states, const uint8_t* const* blocks) {
+    Sha256Lanes<Avx512Ops>::compressBlocks(states, blocks);
+}
+
+void sha256dNoncesAvx512(const uint32_t* midstate, const uint32_t* tail, uint32_t nonce, uint32_t* out) {
+    Sha256Lanes<Avx512Ops>::sha256dNonces(midstate, tail, nonce, out);
+}
+
+} // namespace adilsoncrypto
+
+#endif
@@ -0,0 +1,790 @@
+#include "../include/adilsoncrypto_slhdsa.h"
+#include "../include/adilsoncrypto_keccak.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include "../include/adilsoncrypto_util.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+#include <openssl/sha.h>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const unsigned W = 16;            // Winternitz (lg_w = 4)
+const unsigned MAX_N = 32;
+const unsigned MAX_LEN = 2 * MAX_N + 3;
+const unsigned MAX_D = 22;
+const unsigned MAX_K = 35;
+const unsigned LEAF_GROUP = 16;   // folhas WOTS+ por lote de cadeias
+
+#define SLH_PARAMS(SET, NAME, SHAKE, N, H, D, HP, A, K, M, SIG) \
+    { SlhDsaParamSet::SET, NAME, SHAKE, N, H, D, HP, A, K, M, 2 * N + 3, 2 * N, 4 * N, SIG }
+
+const SlhDsaParams PARAMS[12] = {
+    SLH_PARAMS(SHA2_128S, "SLH-DSA-SHA2-128s", false, 16, 63, 7, 9, 12, 14, 30, 7856),
+    SLH_PARAMS(SHA2_128F, "SLH-DSA-SHA2-128f", false, 16, 66, 22, 3, 6, 33, 34, 17088),
+    SLH_PARAMS(SHA2_192S, "SLH-DSA-SHA2-192s", false, 24, 63, 7, 9, 14, 17, 39, 16224),
+    SLH_PARAMS(SHA2_192F, "SLH-DSA-SHA2-192f", false, 24, 66, 22, 3, 8, 33, 42, 35664),
+    SLH_PARAMS(SHA2_256S, "SLH-DSA-SHA2-256s", false, 32, 64, 8, 8, 14, 22, 47, 29792),
+    SLH_PARAMS(SHA2_256F, "SLH-DSA-SHA2-256f", false, 32, 68, 17, 4, 9, 35, 49, 49856),
+    SLH_PARAMS(SHAKE_128S, "SLH-DSA-SHAKE-128s", true, 16, 63, 7, 9, 12, 14, 30, 7856),
+    SLH_PARAMS(SHAKE_128F, "SLH-DSA-SHAKE-128f", true, 16, 66, 22, 3, 6, 33, 34, 17088),
+    SLH_PARAMS(SHAKE_192S, "SLH-DSA-SHAKE-192s", true, 24, 63, 7, 9, 14, 17, 39, 16224),
+    SLH_PARAMS(SHAKE_192F, "SLH-DSA-SHAKE-192f", true, 24, 66, 22, 3, 8, 33, 42, 35664),
+    SLH_PARAMS(SHAKE_256S, "SLH-DSA-SHAKE-256s", true, 32, 64, 8, 8, 14, 22, 47, 29792),
+    SLH_PARAMS(SHAKE_256F, "SLH-DSA-SHAKE-256f", true, 32, 68, 17, 4, 9, 35, 49, 49856),
+};
+
+#undef SLH_PARAMS
+
+enum AdrsType : uint32_t {
+    WOTS_HASH = 0,
+    WOTS_PK = 1,
+    TREE = 2,
+    FORS_TREE = 3,
+    FORS_ROOTS = 4,
+    WOTS_PRF = 5,
+    FORS_PRF = 6
+};
+
+inline void putBe32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+inline uint32_t getBe32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Endereço de 32 bytes do FIPS 205 (camada, árvore, tipo e três palavras)
+struct Adrs {
+    uint8_t b[32] = {};
+
+    void setLayer(uint32_t layer) { putBe32(b, layer); }
+    void setTree(uint64_t tree) {
+        putBe32(b + 4, 0);
+        putBe32(b + 8, (uint32_t)(tree >> 32));
+        putBe32(b + 12, (uint32_t)tree);
+    }
+    void setType(uint32_t type) {
+        putBe32(b + 16, type);
+        std::memset(b + 20, 0, 12);
+    }
+    void setKeyPair(uint32_t index) { putBe32(b + 20, index); }
+    uint32_t keyPair() const { return getBe32(b + 20); }
+    void setChain(uint32_t index) { putBe32(b + 24, index); }
+    void setHash(uint32_t index) { putBe32(b + 28, index); }
+    void setTreeHeight(uint32_t height) { putBe32(b + 24, height); }
+    void setTreeIndex(uint32_t index) { putBe32(b + 28, index); }
+    uint32_t treeIndex() const { return getBe32(b + 28); }
+
+    // ADRSc (22 bytes) usado pelas instâncias SHA2
+    void compress(uint8_t out[22]) const {
+        out[0] = b[3];
+        std::memcpy(out + 1, b + 8, 8);
+        out[9] = b[19];
+        std::memcpy(out + 10, b + 20, 12);
+    }
+};
+
+// SHA-256 ou SHA-512 incremental (H_msg e PRF_msg da família SHA2)
+class Sha2Stream {
+public:
+    explicit Sha2Stream(bool wide) : wide(wide) {
+        if (wide) SHA512_Init(&h512);
+    }
+    void update(const uint8_t* data, size_t len) {
+        if (wide) {
+            SHA512_Update(&h512, data, len);
+        } else {
+            h256.update(data, len);
+        }
+    }
+    size_t finalize(uint8_t out[64]) {
+        if (wide) {
+            SHA512_Final(out, &h512);
+            return 64;
+        }
+        h256.finalize(out);
+        return 32;
+    }
+    size_t blockSize() const { return wide ? 128 : 64; }
+
+private:
+    bool wide;
+    Sha256Hasher h256;
+    SHA512_CTX h512;
+};
+
+// Contexto por chave: PK.seed (e SK.seed ao assinar) e os midstates de
+// PK.seed || 0^(64-n) e PK.seed || 0^(128-n), que são o primeiro bloco de
+// todas as chamadas F/H/T da família SHA2.
+struct Ctx {
+    const SlhDsaParams& p;
+    const uint8_t* pk_seed;
+    const uint8_t* sk_seed;
+    uint32_t mid256[8];
+    SHA512_CTX mid512;
+    const Sha256LaneBackend& lanes;
+
+    Ctx(const SlhDsaParams& params, const uint8_t* pk, const uint8_t* sk)
+        : p(params), pk_seed(pk), sk_seed(sk), lanes(sha256LaneBackend()) {
+        if (p.shake) return;
+        uint8_t block[128] = {};
+        std::memcpy(block, pk_seed, p.n);
+        std::memcpy(mid256, SHA256_IV, sizeof(mid256));
+        sha256Compress(mid256, block, 1);
+        if (p.n > 16) {
+            SHA512_Init(&mid512);
+            SHA512_Update(&mid512, block, 128);
+        }
+    }
+
+    // F/PRF usam sempre SHA-256; H e T_l usam SHA-512 nas categorias 3 e 5
+    bool wideHash(size_t mlen) const { return !p.shake && p.n > 16 && mlen > p.n; }
+};
+
+// Tweakable hash genérico: Trunc_n(Hash(PK.seed || pad || ADRS || in))
+void tweak(const Ctx& c, const Adrs& adrs, const uint8_t* in, size_t mlen, uint8_t* out) {
+    const unsigned n = c.p.n;
+    if (c.p.shake) {
+        KeccakSponge sponge(136, 0x1f);
+        sponge.absorb(c.pk_seed, n).absorb(adrs.b, 32).absorb(in, mlen);
+        sponge.squeeze(out, n);
+        return;
+    }
+    uint8_t adrsc[22];
+    adrs.compress(adrsc);
+    if (c.wideHash(mlen)) {
+        SHA512_CTX ctx = c.mid512;
+        uint8_t digest[64];
+        SHA512_Update(&ctx, adrsc, sizeof(adrsc));
+        SHA512_Update(&ctx, in, mlen);
+        SHA512_Final(digest, &ctx);
+        std::memcpy(out, digest, n);
+        return;
+    }
+
+    uint32_t state[8];
+    std::memcpy(state, c.mid256, sizeof(state));
+    uint8_t block[64];
+    size_t fill = 0;
+    auto feed = [&](const uint8_t* data, size_t len) {
+        while (len > 0) {
+            size_t take = std::min(len, 64 - fill);
+            std::memcpy(block + fill, data, take);
+            fill += take;
+            data += take;
+            len -= take;
+            if (fill == 64) {
+                sha256Compress(state, block, 1);
+                fill = 0;
+            }
+        }
+    };
+    feed(adrsc, sizeof(adrsc));
+    feed(in, mlen);
+    uint64_t bits = (uint64_t)(64 + sizeof(adrsc) + mlen) * 8;
+    block[fill++] = 0x80;
+    if (fill > 56) {
+        std::memset(block + fill, 0, 64 - fill);
+        sha256Compress(state, block, 1);
+        fill = 0;
+    }
+    std::memset(block + fill, 0, 56 - fill);
+    for (int i = 0; i < 8; i++) block[63 - i] = (uint8_t)(bits >> (8 * i));
+    sha256Compress(state, block, 1);
+    uint8_t digest[32];
+    sha256StateToBytes(state, digest);
+    std::memcpy(out, digest, n);
+}
+
+// out[i] = tweak(adrs[i], in[i]) para 'count' entradas de mlen bytes.
+// Lotes multi-lane: SHA-256 de um bloco após o midstate (F, PRF e o H da
+// categoria 1) ou SHAKE256 x4. Cada lote lê todas as entradas antes de
+// escrever, então out[i] pode coincidir com in[i].
+void tweakMany(const Ctx& c, const Adrs* adrs, const uint8_t* const* in, size_t mlen, uint8_t* const* out, size_t count) {
+    const unsigned n = c.p.n;
+    if (c.p.shake) {
+        uint8_t inputs[4][3 * MAX_N + 32];
+        uint8_t scratch[MAX_N];
+        const size_t in_len = n + 32 + mlen;
+        for (size_t base = 0; base < count; base += 4) {
+            const uint8_t* ip[4];
+            uint8_t* op[4];
+            for (size_t l = 0; l < 4; l++) {
+                size_t i = base + std::min(l, count - base - 1);
+                std::memcpy(inputs[l], c.pk_seed, n);
+                std::memcpy(inputs[l] + n, adrs[i].b, 32);
+                std::memcpy(inputs[l] + n + 32, in[i], mlen);
+                ip[l] = inputs[l];
+                op[l] = base + l < count ? out[base + l] : scratch;
+            }
+            shake256x4(ip, in_len, op, n);
+        }
+        return;
+    }
+
+    const size_t lanes = c.lanes.lanes;
+    if (lanes == 1 || c.wideHash(mlen) || 22 + mlen + 9 > 64) {
+        for (size_t i = 0; i < count; i++) tweak(c, adrs[i], in[i], mlen, out[i]);
+        return;
+    }
+
+    alignas(64) uint8_t blocks[SHA256_MAX_LANES][64];
+    alignas(64) uint32_t states[SHA256_MAX_LANES * 8];
+    const uint8_t* ptrs[SHA256_MAX_LANES];
+    const uint64_t bits = (uint64_t)(64 + 22 + mlen) * 8;
+    for (size_t l = 0; l < lanes; l++) {
+        std::memset(blocks[l], 0, 64);
+        blocks[l][22 + mlen] = 0x80;
+        for (int b = 0; b < 8; b++) blocks[l][63 - b] = (uint8_t)(bits >> (8 * b));
+        ptrs[l] = blocks[l];
+    }
+    for (size_t base = 0; base < count; base += lanes) {
+        size_t active = std::min(lanes, count - base);
+        for (size_t l = 0; l < lanes; l++) {
+            size_t i = base + std::min(l, active - 1);
+            adrs[i].compress(blocks[l]);
+            std::memcpy(blocks[l] + 22, in[i], mlen);
+            std::memcpy(states + 8 * l, c.mid256, 32);
+        }
+        c.lanes.compress(states, ptrs);
+        for (size_t l = 0; l < active; l++) {
+            uint8_t digest[32];
+            sha256StateToBytes(states + 8 * l, digest);
+            std::memcpy(out[base + l], digest, n);
+        }
+    }
+}
+
+// base_2b do FIPS 205 (bits em ordem big-endian)
+void base2b(const uint8_t* x, unsigned b, unsigned out_len, uint32_t* out) {
+    size_t in = 0;
+    unsigned bits = 0;
+    uint64_t total = 0;
+    for (unsigned i = 0; i < out_len; i++) {
+        while (bits < b) {
+            total = (total << 8) | x[in++];
+            bits += 8;
+        }
+        bits -= b;
+        out[i] = (uint32_t)((total >> bits) & ((1u << b) - 1));
+    }
+}
+
+// Dígitos base 16 da mensagem WOTS+ seguidos do checksum
+void wotsDigits(const SlhDsaParams& p, const uint8_t* msg, uint32_t* digits) {
+    const unsigned len1 = 2 * p.n;
+    base2b(msg, 4, len1, digits);
+    uint32_t csum = 0;
+    for (unsigned i = 0; i < len1; i++) csum += W - 1 - digits[i];
+    csum <<= 4;
+    uint8_t bytes[2] = { (uint8_t)(csum >> 8), (uint8_t)csum };
+    base2b(bytes, 4, 3, digits + len1);
+}
+
+// Avança as cadeias 'chains' de start[i] até end[i], uma etapa de hash por
+// lote: a etapa s processa todas as cadeias com start <= s < end.
+void advanceChains(const Ctx& c, const Adrs& base, const uint32_t* start, const uint32_t* end,
+                   uint8_t* chains, unsigned count) {
+    Adrs adrs[MAX_LEN];
+    const uint8_t* in[MAX_LEN];
+    uint8_t* out[MAX_LEN];
+    for (uint32_t s = 0; s < W - 1; s++) {
+        unsigned active = 0;
+        for (unsigned i = 0; i < count; i++) {
+            if (start[i] <= s && s < end[i]) {
+                adrs[active] = base;
+                adrs[active].setChain(i);
+                adrs[active].setHash(s);
+                in[active] = out[active] = chains + i * c.p.n;
+                active++;
+            }
+        }
+        if (active > 0) tweakMany(c, adrs, in, c.p.n, out, active);
+    }
+}
+
+// Chaves secretas das cadeias WOTS+ do par 'adrs.keyPair()'
+void wotsSecrets(const Ctx& c, const Adrs& wots_adrs, uint8_t* out) {
+    Adrs adrs[MAX_LEN];
+    const uint8_t* in[MAX_LEN];
+    uint8_t* outs[MAX_LEN];
+    for (unsigned i = 0; i < c.p.len; i++) {
+        adrs[i] = wots_adrs;
+        adrs[i].setType(WOTS_PRF);
+        adrs[i].setKeyPair(wots_adrs.keyPair());
+        adrs[i].setChain(i);
+        in[i] = c.sk_seed;
+        outs[i] = out + i * c.p.n;
+    }
+    tweakMany(c, adrs, in, c.p.n, outs, c.p.len);
+}
+
+void wotsCompress(const Ctx& c, const Adrs& wots_adrs, const uint8_t* chains, uint8_t* out) {
+    Adrs pk_adrs = wots_adrs;
+    pk_adrs.setType(WOTS_PK);
+    pk_adrs.setKeyPair(wots_adrs.keyPair());
+    tweak(c, pk_adrs, chains, c.p.len * c.p.n, out);
+}
+
+// wots_sign: 'wots_adrs' já com tipo WOTS_HASH e par de chaves
+void wotsSign(const Ctx& c, const Adrs& wots_adrs, const uint8_t* msg, uint8_t* sig) {
+    uint32_t digits[MAX_LEN], zeros[MAX_LEN] = {};
+    wotsDigits(c.p, msg, digits);
+    wotsSecrets(c, wots_adrs, sig);
+    advanceChains(c, wots_adrs, zeros, digits, sig, c.p.len);
+}
+
+void wotsPkFromSig(const Ctx& c, const Adrs& wots_adrs, const uint8_t* sig, const uint8_t* msg, uint8_t* pk) {
+    uint32_t digits[MAX_LEN], ends[MAX_LEN];
+    uint8_t chains[MAX_LEN * MAX_N];
+    wotsDigits(c.p, msg, digits);
+    for (unsigned i = 0; i < c.p.len; i++) ends[i] = W - 1;
+    std::memcpy(chains, sig, c.p.len * c.p.n);
+    advanceChains(c, wots_adrs, digits, ends, chains, c.p.len);
+    wotsCompress(c, wots_adrs, chains, pk);
+}
+
+// Folhas [first, first + count) da árvore XMSS de 'tree_adrs'. As cadeias de
+// até LEAF_GROUP folhas andam juntas, então cada lote multi-lane fica cheio
+// mesmo quando len não é múltiplo do número de lanes.
+void wotsLeaves(const Ctx& c, const Adrs& tree_adrs, uint32_t first, uint32_t count, uint8_t* leaves) {
+    const unsigned n = c.p.n, len = c.p.len;
+    std::vector<uint8_t> chains((size_t)LEAF_GROUP * len * n);
+    std::vector<Adrs> adrs((size_t)LEAF_GROUP * len);
+    std::vector<const uint8_t*> in((size_t)LEAF_GROUP * len);
+    std::vector<uint8_t*> out((size_t)LEAF_GROUP * len);
+
+    for (uint32_t group = first; group < first + count; group += LEAF_GROUP) {
+        const uint32_t leaves_in_group = std::min<uint32_t>(LEAF_GROUP, first + count - group);
+        const size_t items = (size_t)leaves_in_group * len;
+        for (size_t it = 0; it < items; it++) {
+            Adrs& a = adrs[it];
+            a = tree_adrs;
+            a.setType(WOTS_PRF);
+            a.setKeyPair(group + (uint32_t)(it / len));
+            a.setChain((uint32_t)(it % len));
+            in[it] = c.sk_seed;
+            out[it] = &chains[it * n];
+        }
+        tweakMany(c, adrs.data(), in.data(), n, out.data(), items);
+
+        for (size_t it = 0; it < items; it++) {
+            adrs[it].b[19] = WOTS_HASH;   // mesmo endereço, tipo WOTS_HASH
+            in[it] = out[it];
+        }
+        for (uint32_t s = 0; s < W - 1; s++) {
+            for (size_t it = 0; it < items; it++) adrs[it].setHash(s);
+            tweakMany(c, adrs.data(), in.data(), n, out.data(), items);
+        }
+
+        for (uint32_t l = 0; l < leaves_in_group; l++) {
+            Adrs wots_adrs = tree_adrs;
+            wots_adrs.setType(WOTS_HASH);
+            wots_adrs.setKeyPair(group + l);
+            wotsCompress(c, wots_adrs, &chains[(size_t)l * len * n], leaves + (size_t)(group - first + l) * n);
+        }
+    }
+}
+
+// Reduz 2^height nós (in place) até a raiz. O nó i do nível z tem índice
+// (offset << (height - z)) + i; 'auth' recebe o caminho da folha 'leaf'.
+void reduceTree(const Ctx& c, const Adrs& base, uint32_t offset, unsigned height, uint8_t* nodes,
+                uint32_t leaf, uint8_t* auth, uint8_t* root) {
+    const unsigned n = c.p.n;
+    const size_t max_count = (size_t)1 << (height > 0 ? height - 1 : 0);
+    std::vector<Adrs> adrs(max_count);
+    std::vector<const uint8_t*> in(max_count);
+    std::vector<uint8_t*> out(max_count);
+    for (unsigned z = 1; z <= height; z++) {
+        const size_t count = (size_t)1 << (height - z);
+        if (auth) std::memcpy(auth + (z - 1) * n, nodes + (size_t)((leaf >> (z - 1)) ^ 1) * n, n);
+        for (size_t i = 0; i < count; i++) {
+            adrs[i] = base;
+            adrs[i].setTreeHeight(z);
+            adrs[i].setTreeIndex((offset << (height - z)) + (uint32_t)i);
+            in[i] = nodes + 2 * i * n;
+            out[i] = nodes + i * n;
+        }
+        tweakMany(c, adrs.data(), in.data(), 2 * n, out.data(), count);
+    }
+    std::memcpy(root, nodes, n);
+}
+
+// Árvore XMSS inteira de 'tree_adrs' (camada e árvore definidas)
+void xmssTree(const Ctx& c, const Adrs& tree_adrs, uint32_t leaf, uint8_t* auth, uint8_t* root, ThreadPool* pool) {
+    const uint32_t leaves = 1u << c.p.hp;
+    std::vector<uint8_t> nodes((size_t)leaves * c.p.n);
+    if (pool) {
+        pool->parallelFor(leaves, LEAF_GROUP, [&](size_t begin, size_t end) {
+            wotsLeaves(c, tree_adrs, (uint32_t)begin, (uint32_t)(end - begin), &nodes[begin * c.p.n]);
+        });
+    } else {
+        wotsLeaves(c, tree_adrs, 0, leaves, nodes.data());
+    }
+    Adrs base = tree_adrs;
+    base.setType(TREE);
+    reduceTree(c, base, 0, c.p.hp, nodes.data(), leaf, auth, root);
+}
+
+// Árvore FORS 'tree': grava sk || auth em 'sig' e a raiz em 'root'
+void forsTree(const Ctx& c, const Adrs& fors_adrs, uint32_t tree, uint32_t leaf, uint8_t* sig, uint8_t* root) {
+    const unsigned n = c.p.n, a = c.p.a;
+    const size_t leaves = (size_t)1 << a;
+    const uint32_t offset = tree << a;
+    std::vector<uint8_t> nodes(leaves * n);
+    std::vector<Adrs> adrs(leaves);
+    std::vector<const uint8_t*> in(leaves);
+    std::vector<uint8_t*> out(leaves);
+
+    for (size_t j = 0; j < leaves; j++) {
+        adrs[j] = fors_adrs;
+        adrs[j].setType(FORS_PRF);
+        adrs[j].setKeyPair(fors_adrs.keyPair());
+        adrs[j].setTreeIndex(offset + (uint32_t)j);
+        in[j] = c.sk_seed;
+        out[j] = &nodes[j * n];
+    }
+    tweakMany(c, adrs.data(), in.data(), n, out.data(), leaves);
+    std::memcpy(sig, &nodes[(size_t)leaf * n], n);
+
+    for (size_t j = 0; j < leaves; j++) {
+        adrs[j] = fors_adrs;
+        adrs[j].setTreeHeight(0);
+        adrs[j].setTreeIndex(offset + (uint32_t)j);
+        in[j] = out[j];
+    }
+    tweakMany(c, adrs.data(), in.data(), n, out.data(), leaves);
+    reduceTree(c, fors_adrs, tree, a, nodes.data(), leaf, sig + n, root);
+}
+
+// Raízes FORS a partir da assinatura, subindo as k árvores em lote
+void forsPkFromSig(const Ctx& c, const Adrs& fors_adrs, const uint8_t* sig, const uint32_t* indices, uint8_t* pk) {
+    const unsigned n = c.p.n, a = c.p.a, k = c.p.k;
+    uint8_t nodes[MAX_K * MAX_N];
+    uint8_t pairs[MAX_K * 2 * MAX_N];
+    Adrs adrs[MAX_K];
+    const uint8_t* in[MAX_K];
+    uint8_t* out[MAX_K];
+    const size_t stride = (size_t)(a + 1) * n;
+
+    for (unsigned i = 0; i < k; i++) {
+        adrs[i] = fors_adrs;
+        adrs[i].setTreeHeight(0);
+        adrs[i].setTreeIndex((i << a) + indices[i]);
+        in[i] = sig + i * stride;
+        out[i] = nodes + i * n;
+    }
+    tweakMany(c, adrs, in, n, out, k);
+
+    for (unsigned j = 0; j < a; j++) {
+        for (unsigned i = 0; i < k; i++) {
+            const uint8_t* auth = sig + i * stride + (j + 1) * n;
+            uint8_t* pair = pairs + i * 2 * n;
+            uint32_t index = adrs[i].treeIndex();
+            adrs[i].setTreeHeight(j + 1);
+            if (((indices[i] >> j) & 1) == 0) {
+                adrs[i].setTreeIndex(index / 2);
+                std::memcpy(pair, nodes + i * n, n);
+                std::memcpy(pair + n, auth, n);
+            } else {
+                adrs[i].setTreeIndex((index - 1) / 2);
+                std::memcpy(pair, auth, n);
+                std::memcpy(pair + n, nodes + i * n, n);
+            }
+            in[i] = pair;
+        }
+        tweakMany(c, adrs, in, 2 * n, out, k);
+    }
+
+    Adrs roots_adrs = fors_adrs;
+    roots_adrs.setType(FORS_ROOTS);
+    roots_adrs.setKeyPair(fors_adrs.keyPair());
+    tweak(c, roots_adrs, nodes, (size_t)k * n, pk);
+}
+
+void xmssPkFromSig(const Ctx& c, const Adrs& tree_adrs, uint32_t leaf, const uint8_t* sig, const uint8_t* msg, uint8_t* root) {
+    const unsigned n = c.p.n;
+    Adrs adrs = tree_adrs;
+    adrs.setType(WOTS_HASH);
+    adrs.setKeyPair(leaf);
+    uint8_t node[MAX_N], pair[2 * MAX_N];
+    wotsPkFromSig(c, adrs, sig, msg, node);
+
+    const uint8_t* auth = sig + (size_t)c.p.len * n;
+    adrs.setType(TREE);
+    adrs.setTreeIndex(leaf);
+    for (unsigned z = 0; z < c.p.hp; z++) {
+        adrs.setTreeHeight(z + 1);
+        if (((leaf >> z) & 1) == 0) {
+            adrs.setTreeIndex(adrs.treeIndex() / 2);
+            std::memcpy(pair, node, n);
+            std::memcpy(pair + n, auth + z * n, n);
+        } else {
+            adrs.setTreeIndex((adrs.treeIndex() - 1) / 2);
+            std::memcpy(pair, auth + z * n, n);
+            std::memcpy(pair + n, node, n);
+        }
+        tweak(c, adrs, pair, 2 * n, node);
+    }
+    std::memcpy(root, node, n);
+}
+
+// M' = 0 || |ctx| || ctx || M, passado em partes para não copiar a mensagem
+struct MessageParts {
+    uint8_t prefix[2];
+    ByteView context;
+    ByteView message;
+
+    template <class Fn>
+    void feed(Fn fn) const {
+        fn(prefix, 2);
+        fn(context.data, context.size);
+        fn(message.data, message.size);
+    }
+};
+
+void prfMsg(const SlhDsaParams& p, const uint8_t* sk_prf, const uint8_t* opt_rand, const MessageParts& msg, uint8_t* out) {
+    if (p.shake) {
+        KeccakSponge sponge(136, 0x1f);
+        sponge.absorb(sk_prf, p.n).absorb(opt_rand, p.n);
+        msg.feed([&](const uint8_t* d, size_t l) { sponge.absorb(d, l); });
+        sponge.squeeze(out, p.n);
+        return;
+    }
+    // HMAC-SHA-256 (n = 16) ou HMAC-SHA-512
+    Sha2Stream inner(p.n > 16), outer(p.n > 16);
+    uint8_t pad[128] = {};
+    uint8_t digest[64];
+    const size_t block = inner.blockSize();
+    std::memcpy(pad, sk_prf, p.n);
+    for (size_t i = 0; i < block; i++) pad[i] ^= 0x36;
+    inner.update(pad, block);
+    inner.update(opt_rand, p.n);
+    msg.feed([&](const uint8_t* d, size_t l) { inner.update(d, l); });
+    size_t digest_len = inner.finalize(digest);
+    for (size_t i = 0; i < block; i++) pad[i] ^= 0x36 ^ 0x5c;
+    outer.update(pad, block);
+    outer.update(digest, digest_len);
+    outer.finalize(digest);
+    std::memcpy(out, digest, p.n);
+    OPENSSL_cleanse(pad, sizeof(pad));
+}
+
+void hashMsg(const SlhDsaParams& p, const uint8_t* r, const uint8_t* pk_seed, const uint8_t* pk_root,
+             const MessageParts& msg, uint8_t* out) {
+    if (p.shake) {
+        KeccakSponge sponge(136, 0x1f);
+        sponge.absorb(r, p.n).absorb(pk_seed, p.n).absorb(pk_root, p.n);
+        msg.feed([&](const uint8_t* d, size_t l) { sponge.absorb(d, l); });
+        sponge.squeeze(out, p.m);
+        return;
+    }
+    // MGF1-SHA-x(R || PK.seed || SHA-x(R || PK.seed || PK.root || M), m)
+    const bool wide = p.n > 16;
+    uint8_t seed[2 * MAX_N + 64 + 4];
+    Sha2Stream inner(wide);
+    inner.update(r, p.n);
+    inner.update(pk_seed, p.n);
+    inner.update(pk_root, p.n);
+    msg.feed([&](const uint8_t* d, size_t l) { inner.update(d, l); });
+    std::memcpy(seed, r, p.n);
+    std::memcpy(seed + p.n, pk_seed, p.n);
+    size_t seed_len = 2 * p.n + inner.finalize(seed + 2 * p.n);
+    for (uint32_t counter = 0, done = 0; done < p.m; counter++) {
+        uint8_t block[64];
+        putBe32(seed + seed_len, counter);
+        Sha2Stream mgf(wide);
+        mgf.update(seed, seed_len + 4);
+        size_t got = mgf.finalize(block);
+        size_t take = std::min<size_t>(got, p.m - done);
+        std::memcpy(out + done, block, take);
+        done += (uint32_t)take;
+    }
+}
+
+// Separa o digest em índices FORS, árvore e folha da hiperárvore
+void splitDigest(const SlhDsaParams& p, const uint8_t* digest, uint32_t* indices, uint64_t& tree, uint32_t& leaf) {
+    const size_t md_bytes = (p.k * p.a + 7) / 8;
+    const size_t tree_bytes = (p.h - p.hp + 7) / 8;
+    const size_t leaf_bytes = (p.hp + 7) / 8;
+    base2b(digest, p.a, p.k, indices);
+    tree = 0;
+    for (size_t i = 0; i < tree_bytes; i++) tree = (tree << 8) | digest[md_bytes + i];
+    const unsigned tree_bits = p.h - p.hp;
+    if (tree_bits < 64) tree &= ((uint64_t)1 << tree_bits) - 1;
+    leaf = 0;
+    for (size_t i = 0; i < leaf_bytes; i++) leaf = (leaf << 8) | digest[md_bytes + tree_bytes + i];
+    leaf &= (1u << p.hp) - 1;
+}
+
+} // namespace
+
+const SlhDsaParams& slhDsaParams(SlhDsaParamSet set) {
+    return PARAMS[(int)set];
+}
+
+bool slhDsaParamSetFromName(const std::string& name, SlhDsaParamSet& set) {
+    for (const SlhDsaParams& p : PARAMS) {
+        if (name == p.name) {
+            set = p.set;
+            return true;
+        }
+    }
+    return false;
+}
+
+void slhDsaKeyGenDerand(SlhDsaParamSet set, const uint8_t* sk_seed, const uint8_t* sk_prf, const uint8_t* pk_seed,
+                        uint8_t* public_key, uint8_t* secret_key, ThreadPool* pool) {
+    const SlhDsaParams& p = slhDsaParams(set);
+    const unsigned n = p.n;
+    std::memcpy(secret_key, sk_seed, n);
+    std::memcpy(secret_key + n, sk_prf, n);
+    std::memcpy(secret_key + 2 * n, pk_seed, n);
+
+    Ctx c(p, secret_key + 2 * n, secret_key);
+    Adrs top;
+    top.setLayer(p.d - 1);
+    xmssTree(c, top, 0, nullptr, secret_key + 3 * n, pool);
+    std::memcpy(public_key, secret_key + 2 * n, 2 * n);
+}
+
+bool slhDsaKeyGen(SlhDsaParamSet set, uint8_t* public_key, uint8_t* secret_key, ThreadPool* pool) {
+    uint8_t seeds[3 * MAX_N];
+    const unsigned n = slhDsaParams(set).n;
+    if (RAND_bytes(seeds, (int)(3 * n)) != 1) return false;
+    slhDsaKeyGenDerand(set, seeds, seeds + n, seeds + 2 * n, public_key, secret_key, pool);
+    OPENSSL_cleanse(seeds, sizeof(seeds));
+    return true;
+}
+
+bool slhDsaSign(SlhDsaParamSet set, const uint8_t* message, size_t len, const uint8_t* context, size_t context_len,
+                const uint8_t* secret_key, uint8_t* signature, bool randomized, ThreadPool* pool) {
+    const SlhDsaParams& p = slhDsaParams(set);
+    if (context_len > 255) return false;
+    const unsigned n = p.n;
+    const uint8_t* sk_seed = secret_key;
+    const uint8_t* sk_prf = secret_key + n;
+    const uint8_t* pk_seed = secret_key + 2 * n;
+    const uint8_t* pk_root = secret_key + 3 * n;
+
+    uint8_t opt_rand[MAX_N];
+    if (randomized) {
+        if (RAND_bytes(opt_rand, (int)n) != 1) return false;
+    } else {
+        std::memcpy(opt_rand, pk_seed, n);
+    }
+
+    MessageParts msg = { { 0, (uint8_t)context_len }, { context, context_len }, { message, len } };
+    uint8_t digest[64];
+    prfMsg(p, sk_prf, opt_rand, msg, signature);
+    hashMsg(p, signature, pk_seed, pk_root, msg, digest);
+
+    uint32_t indices[MAX_K];
+    uint64_t trees[MAX_D];
+    uint32_t leaves[MAX_D];
+    splitDigest(p, digest, indices, trees[0], leaves[0]);
+    for (unsigned j = 1; j < p.d; j++) {
+        leaves[j] = (uint32_t)(trees[j - 1] & ((1u << p.hp) - 1));
+        trees[j] = trees[j - 1] >> p.hp;
+    }
+
+    Ctx c(p, pk_seed, sk_seed);
+    Adrs fors_adrs;
+    fors_adrs.setTree(trees[0]);
+    fors_adrs.setType(FORS_TREE);
+    fors_adrs.setKeyPair(leaves[0]);
+
+    uint8_t* fors_sig = signature + n;
+    uint8_t* ht_sig = fors_sig + (size_t)p.k * (p.a + 1) * n;
+    const size_t xmss_sig_bytes = (size_t)(p.len + p.hp) * n;
+    uint8_t fors_roots[MAX_K * MAX_N];
+    uint8_t xmss_roots[MAX_D * MAX_N];
+
+    // As k árvores FORS e as d árvores XMSS não dependem umas das outras:
+    // a raiz de cada camada é a raiz da árvore, que a camada de cima assina.
+    auto buildTrees = [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; t++) {
+            if (t < p.k) {
+                forsTree(c, fors_adrs, (uint32_t)t, indices[t], fors_sig + t * (p.a + 1) * n, fors_roots + t * n);
+            } else {
+                unsigned j = (unsigned)(t - p.k);
+                Adrs tree_adrs;
+                tree_adrs.setLayer(j);
+                tree_adrs.setTree(trees[j]);
+                xmssTree(c, tree_adrs, leaves[j], ht_sig + j * xmss_sig_bytes + (size_t)p.len * n,
+                         xmss_roots + j * n, nullptr);
+            }
+        }
+    };
+    if (pool) {
+        pool->parallelFor(p.k + p.d, 1, buildTrees);
+    } else {
+        buildTrees(0, p.k + p.d);
+    }
+
+    uint8_t fors_pk[MAX_N];
+    Adrs roots_adrs = fors_adrs;
+    roots_adrs.setType(FORS_ROOTS);
+    roots_adrs.setKeyPair(leaves[0]);
+    tweak(c, roots_adrs, fors_roots, (size_t)p.k * n, fors_pk);
+
+    // Assinaturas WOTS+: a camada j assina a raiz da camada j - 1
+    const uint8_t* signed_root = fors_pk;
+    for (unsigned j = 0; j < p.d; j++) {
+        Adrs wots_adrs;
+        wots_adrs.setLayer(j);
+        wots_adrs.setTree(trees[j]);
+        wots_adrs.setType(WOTS_HASH);
+        wots_adrs.setKeyPair(leaves[j]);
+        wotsSign(c, wots_adrs, signed_root, ht_sig + j * xmss_sig_bytes);
+        signed_root = xmss_roots + j * n;
+    }
+    return true;
+}
+
+bool slhDsaVerify(SlhDsaParamSet set, const uint8_t* message, size_t len, const uint8_t* context, size_t context_len,
+                  const uint8_t* public_key, const uint8_t* signature) {
+    const SlhDsaParams& p = slhDsaParams(set);
+    if (context_len > 255) return false;
+    const unsigned n = p.n;
+    const uint8_t* pk_seed = public_key;
+    const uint8_t* pk_root = public_key + n;
+
+    MessageParts msg = { { 0, (uint8_t)context_len }, { context, context_len }, { message, len } };
+    uint8_t digest[64];
+    hashMsg(p, signature, pk_seed, pk_root, msg, digest);
+    uint32_t indices[MAX_K];
+    uint64_t tree;
+    uint32_t leaf;
+    splitDigest(p, digest, indices, tree, leaf);
+
+    Ctx c(p, pk_seed, nullptr);
+    Adrs fors_adrs;
+    fors_adrs.setTree(tree);
+    fors_adrs.setType(FORS_TREE);
+    fors_adrs.setKeyPair(leaf);
+    uint8_t node[MAX_N];
+    forsPkFromSig(c, fors_adrs, signature + n, indices, node);
+
+    const uint8_t* ht_sig = signature + n + (size_t)p.k * (p.a + 1) * n;
+    const size_t xmss_sig_bytes = (size_t)(p.len + p.hp) * n;
+    for (unsigned j = 0; j < p.d; j++) {
+        Adrs tree_adrs;
+        tree_adrs.setLayer(j);
+        tree_adrs.setTree(tree);
+        xmssPkFromSig(c, tree_adrs, leaf, ht_sig + j * xmss_sig_bytes, node, node);
+        leaf = (uint32_t)(tree & ((1u << p.hp) - 1));
+        tree >>= p.hp;
+    }
+    return CRYPTO_memcmp(node, pk_root, n) == 0;
+}
+
+} // namespace adilsoncrypto
@@ -0,0 +1,140 @@
+#include "../include/adilsoncrypto_solana.h"
+#include "../include/adilsoncrypto_bitcoin.h"
+#include "../include/adilsoncrypto_ethereum.h"
+#include <cstring>
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+
+namespace adilsoncrypto {
+
+// compact-u16 ("shortvec"): até 3 bytes, 7 bits por byte
+static bool readShortVec(const uint8_t*& p, const uint8_t* end, size_t& value) {
+    value = 0;
+    for (int i = 0; i < 3; i++) {
+        if (p == end) return false;
+        uint8_t b = *p++;
+        value |= (size_t)(b & 0x7f) << (7 * i);
+        if (!(b & 0x80)) return i == 0 || b != 0;
+    }
+    return false;
+}
+
+bool parseSolanaTransaction(const uint8_t* data, size_t size, SolanaTransactionView& tx) {
+    const uint8_t* p = data;
+    const uint8_t* end = data + size;
+    size_t count;
+    tx.signatures.clear();
+    tx.account_keys.clear();
+
+    if (!readShortVec(p, end, count) || count > (size_t)(end - p) / 64) return false;
+    for (size_t i = 0; i < count; i++, p += 64) tx.signatures.push_back(p);
+
+    tx.message.data = p;
+    tx.message.size = (size_t)(end - p);
+    if (p < end && (*p & 0x80)) p++;                 // prefixo de versão
+    if (end - p < 3) return false;
+    tx.num_required_signatures = p[0];
+    p += 3;                                          // cabeçalho da mensagem
+    if (!readShortVec(p, end, count) || count > (size_t)(end - p) / 32) return false;
+    for (size_t i = 0; i < count; i++, p += 32) tx.account_keys.push_back(p);
+
+    return tx.signatures.size() == tx.num_required_signatures && tx.account_keys.size() >= tx.signatures.size();
+}
+
+bool solanaVerifyTransactions(const std::vector<ByteView>& transactions, std::vector<bool>* valid, ThreadPool* pool) {
+    std::vector<const uint8_t*> messages, public_keys, signatures;
+    std::vector<size_t> lens, owner;
+    std::vector<bool> parsed(transactions.size(), false);
+    SolanaTransactionView tx;
+    for (size_t t = 0; t < transactions.size(); t++) {
+        if (!parseSolanaTransaction(transactions[t].data, transactions[t].size, tx)) continue;
+        parsed[t] = true;
+        for (size_t i = 0; i < tx.signatures.size(); i++) {
+            messages.push_back(tx.message.data);
+            lens.push_back(tx.message.size);
+            public_keys.push_back(tx.account_keys[i]);
+            signatures.push_back(tx.signatures[i]);
+            owner.push_back(t);
+        }
+    }
+
+    std::vector<bool> sig_valid;
+    bool ok = ed25519VerifyBatch(messages.data(), lens.data(), public_keys.data(), signatures.data(),
+                                 messages.size(), valid ? &sig_valid : nullptr, pool);
+    for (size_t t = 0; t < transactions.size(); t++) ok = ok && parsed[t];
+    if (valid) {
+        *valid = parsed;
+        for (size_t i = 0; i < owner.size(); i++) {
+            if (!sig_valid[i]) (*valid)[owner[i]] = false;
+        }
+    }
+    return ok;
+}
+
+} // namespace adilsoncrypto
+
+using namespace adilsoncrypto;
+
+// Interface Solana: chaves Ed25519, endereço = Base58 da chave pública.
+// private_key segue o formato de keypair do Solana: semente || chave
+// pública (64 bytes em hex); apenas a semente (32 bytes) também é aceita.
+class SolanaChainInterface : public IBlockchainInterface {
+public:
+    std::unique_ptr<IBlockchainInterface> createBitcoinInterface() override {
+        return createBitcoinChainInterface();
+    }
+
+    KeyPair generateKey() override {
+        KeyPair keypair;
+        uint8_t keys[64];
+        if (RAND_bytes(keys, 32) != 1) return keypair;
+        ed25519PublicKey(keys, keys + 32);
+        keypair.private_key = bytesToHex(keys, 64);
+        keypair.public_key = bytesToHex(keys + 32, 32);
+        keypair.address = base58Encode(keys + 32, 32);
+        OPENSSL_cleanse(keys, sizeof(keys));
+        return keypair;
+    }
+
+    std::string getAddress(const KeyPair& keypair) override {
+        uint8_t pub[32];
+        if (!hexToBytes(keypair.public_key, pub, 32)) return "";
+        return base58Encode(pub, 32);
+    }
+
+    // transaction: mensagem serializada em hex (os bytes que o Solana
+    // assina). Signature.r/s = metades R e S em hex; proof = assinatura de
+    // 64 bytes em Base58, como exibida pelos exploradores.
+    // Signature vazia se a mensagem ou a chave forem inválidas.
+    Signature sign(const std::string& transaction, const KeyPair& keypair) override {
+        Signature signature;
+        std::string message, secret;
+        if (!hexToBytes(transaction, message) || !hexToBytes(keypair.private_key, secret) ||
+            (secret.size() != 32 && secret.size() != 64)) {
+            if (!secret.empty()) OPENSSL_cleanse(&secret[0], secret.size());
+            return signature;
+        }
+        uint8_t pub[32];
+        uint8_t sig[64];
+        ed25519PublicKey((const uint8_t*)secret.data(), pub);
+        ed25519Sign((const uint8_t*)message.data(), message.size(), (const uint8_t*)secret.data(), pub, sig);
+        OPENSSL_cleanse(&secret[0], secret.size());
+
+        signature.r = bytesToHex(sig, 32);
+        signature.s = bytesToHex(sig + 32, 32);
+        signature.proof = base58Encode(sig, 64);
+        return signature;
+    }
+
+    std::unique_ptr<IBlockchainInterface> createEthereumInterface() override {
+        return createEthereumChainInterface();
+    }
+
+    std::unique_ptr<IBlockchainInterface> createSolanaInterface() override {
+        return createSolanaChainInterface();
+    }
+};
+
+std::unique_ptr<IBlockchainInterface> createSolanaChainInterface() {
+    return std::make_unique<SolanaChainInterface>();
+}
@@ -0,0 +1,524 @@
+#include "../include/adilsoncrypto_stark.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include "../include/adilsoncrypto_util.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace adilsoncrypto {
+
+namespace {
+
+const size_t LEAF_GRAIN = 4096;
+const size_t FOLD_GRAIN = 4096;
+const size_t COMPOSITION_GRAIN = 4096;
+const char TRANSCRIPT_TAG[] = "adilsoncrypto/stark/fibonacci/v1";
+
+void put64(std::vector<uint8_t>& out, uint64_t v) {
+    for (int i = 0; i < 8; i++) out.push_back((uint8_t)(v >> (8 * i)));
+}
+
+uint64_t load64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+void store64(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+bool read64(const uint8_t*& cursor, const uint8_t* end, uint64_t& v) {
+    if (end - cursor < 8) return false;
+    v = load64(cursor);
+    cursor += 8;
+    return v < GOLDILOCKS_P;
+}
+
+bool readHash(const uint8_t*& cursor, const uint8_t* end, Hash256& h) {
+    if (end - cursor < 32) return false;
+    std::memcpy(h.data(), cursor, 32);
+    cursor += 32;
+    return true;
+}
+
+bool readProof(const uint8_t*& cursor, const uint8_t* end, size_t index, size_t depth, MerkleProof& proof) {
+    proof.index = index;
+    proof.siblings.resize(depth);
+    for (size_t i = 0; i < depth; i++) {
+        if (!readHash(cursor, end, proof.siblings[i])) return false;
+    }
+    return true;
+}
+
+void appendProof(const MerkleProof& proof, std::vector<uint8_t>& out) {
+    for (const Hash256& sibling : proof.siblings) out.insert(out.end(), sibling.begin(), sibling.end());
+}
+
+// Folha = SHA-256 de 'width' elementos consecutivos em little-endian
+Hash256 leafHash(const uint64_t* values, size_t width) {
+    uint8_t bytes[16];
+    for (size_t i = 0; i < width; i++) store64(bytes + 8 * i, values[i]);
+    Hash256 h;
+    sha256Digest(bytes, 8 * width, h.data());
+    return h;
+}
+
+std::unique_ptr<MerkleTree> commitLeaves(const std::vector<uint64_t>& values, size_t width, ThreadPool* pool) {
+    size_t count = values.size() / width;
+    std::vector<uint8_t> leaves(32 * count);
+    auto hash = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            Hash256 h = leafHash(&values[i * width], width);
+            std::memcpy(&leaves[32 * i], h.data(), 32);
+        }
+    };
+    if (pool && pool->size() > 1) {
+        pool->parallelFor(count, LEAF_GRAIN, hash);
+    } else {
+        hash(0, count);
+    }
+    auto tree = std::make_unique<MerkleTree>(pool);
+    tree->build(leaves.data(), count);
+    return tree;
+}
+
+void parallel(ThreadPool* pool, size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn) {
+    if (pool && pool->size() > 1 && count > grain) {
+        pool->parallelFor(count, grain, fn);
+    } else {
+        fn(0, count);
+    }
+}
+
+unsigned log2Exact(size_t n) {
+    unsigned log = 0;
+    while (((size_t)1 << log) < n) log++;
+    return log;
+}
+
+// Restrições da sequência de Fibonacci avaliadas num ponto x do domínio
+struct FibonacciAir {
+    uint64_t a0, a1, result;
+    uint64_t n;
+    uint64_t g_last, g_before_last, g;   // g^(n-1), g^(n-2), g
+    uint64_t alpha[4];
+
+    FibonacciAir(uint64_t a0, uint64_t a1, uint64_t result, unsigned log_trace)
+        : a0(a0), a1(a1), result(result), n((uint64_t)1 << log_trace) {
+        g = glRootOfUnity(log_trace);
+        g_last = glInverse(g);
+        g_before_last = glMul(g_last, g_last);
+    }
+
+    // Denominadores: x^n - 1, x - 1, x - g, x - g^(n-1)
+    void denominators(uint64_t x, uint64_t x_n, uint64_t out[4]) const {
+        out[0] = glSub(x_n, 1);
+        out[1] = glSub(x, 1);
+        out[2] = glSub(x, g);
+        out[3] = glSub(x, g_last);
+    }
+
+    // t0 = T(x), t1 = T(gx), t2 = T(g^2 x); inv = inversos dos denominadores
+    uint64_t composition(uint64_t x, uint64_t t0, uint64_t t1, uint64_t t2, const uint64_t inv[4]) const {
+        // Transição vale em g^0 .. g^(n-3): divide por (x^n - 1)/((x - g^(n-2))(x - g^(n-1)))
+        uint64_t transition = glSub(glSub(t2, t1), t0);
+        transition = glMul(transition, glMul(glSub(x, g_before_last), glSub(x, g_last)));
+        uint64_t acc = glMul(alpha[0], glMul(transition, inv[0]));
+        acc = glAdd(acc, glMul(alpha[1], glMul(glSub(t0, a0), inv[1])));
+        acc = glAdd(acc, glMul(alpha[2], glMul(glSub(t0, a1), inv[2])));
+        acc = glAdd(acc, glMul(alpha[3], glMul(glSub(t0, result), inv[3])));
+        return acc;
+    }
+};
+
+void absorbPublic(StarkTranscript& transcript, uint64_t a0, uint64_t a1, unsigned log_trace, uint64_t result) {
+    std::vector<uint8_t> header(TRANSCRIPT_TAG, TRANSCRIPT_TAG + sizeof(TRANSCRIPT_TAG) - 1);
+    put64(header, a0);
+    put64(header, a1);
+    put64(header, log_trace);
+    put64(header, result);
+    transcript.absorb(header.data(), header.size());
+}
+
+} // namespace
+
+StarkTranscript::StarkTranscript() : counter(0) {
+    std::memset(state, 0, sizeof(state));
+}
+
+void StarkTranscript::absorb(const uint8_t* data, size_t len) {
+    Sha256Hasher hasher;
+    hasher.update(state, sizeof(state)).update(data, len);
+    hasher.finalize(state);
+    counter = 0;
+}
+
+void StarkTranscript::next(uint8_t out[32]) {
+    uint8_t block[40];
+    std::memcpy(block, state, 32);
+    store64(block + 32, counter++);
+    sha256Digest(block, sizeof(block), out);
+}
+
+uint64_t StarkTranscript::challengeField() {
+    uint8_t digest[32];
+    for (;;) {
+        next(digest);
+        for (int i = 0; i < 4; i++) {
+            uint64_t v = load64(digest + 8 * i);
+            if (v < GOLDILOCKS_P) return v;
+        }
+    }
+}
+
+size_t StarkTranscript::challengeIndex(size_t bound) {
+    uint8_t digest[32];
+    next(digest);
+    return (size_t)(load64(digest) & (bound - 1));
+}
+
+void FriProver::commit(std::vector<uint64_t> values, unsigned log_size, unsigned log_blowup, uint64_t shift,
+                       StarkTranscript& transcript) {
+    layers.clear();
+    trees.clear();
+    roots.clear();
+    const uint64_t inv2 = glInverse(2);
+    uint64_t omega = glRootOfUnity(log_size);
+
+    for (unsigned log = log_size; log > log_blowup; log--) {
+        size_t half = (size_t)1 << (log - 1);
+        std::vector<uint64_t> paired(2 * half);
+        parallel(pool, half, FOLD_GRAIN, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                paired[2 * i] = values[i];
+                paired[2 * i + 1] = values[i + half];
+            }
+        });
+        trees.push_back(commitLeaves(paired, 2, pool));
+        roots.push_back(trees.back()->root());
+        transcript.absorb(roots.back().data(), 32);
+        uint64_t beta = transcript.challengeField();
+
+        // f'(x_i^2) = (f(x_i) + f(-x_i))/2 + beta (f(x_i) - f(-x_i)) / (2 x_i), x_i = shift w^i
+        std::vector<uint64_t> folded(half);
+        uint64_t shift_inv = glInverse(shift), omega_inv = glInverse(omega);
+        parallel(pool, half, FOLD_GRAIN, [&](size_t begin, size_t end) {
+            uint64_t x_inv = glMul(shift_inv, glPow(omega_inv, begin));
+            for (size_t i = begin; i < end; i++) {
+                uint64_t f0 = paired[2 * i], f1 = paired[2 * i + 1];
+                uint64_t odd = glMul(glMul(glSub(f0, f1), x_inv), beta);
+                folded[i] = glMul(glAdd(glAdd(f0, f1), odd), inv2);
+                x_inv = glMul(x_inv, omega_inv);
+            }
+        });
+        layers.push_back(std::move(paired));
+        values = std::move(folded);
+        shift = glMul(shift, shift);
+        omega = glMul(omega, omega);
+    }
+
+    final_value = values.empty() ? 0 : values[0];
+    uint8_t bytes[8];
+    store64(bytes, final_value);
+    transcript.absorb(bytes, sizeof(bytes));
+}
+
+void FriProver::open(size_t index, std::vector<uint8_t>& out) const {
+    for (size_t l = 0; l < layers.size(); l++) {
+        size_t half = layers[l].size() / 2;
+        size_t pair = index & (half - 1);
+        put64(out, layers[l][2 * pair]);
+        put64(out, layers[l][2 * pair + 1]);
+        appendProof(trees[l]->proof(pair), out);
+        index = pair;
+    }
+}
+
+bool friVerifyQuery(const FriCommitment& commitment, size_t index, const uint8_t*& cursor, const uint8_t* end,
+                    uint64_t& value0) {
+    const uint64_t inv2 = glInverse(2);
+    uint64_t shift = commitment.shift;
+    uint64_t omega = glRootOfUnity(commitment.log_size);
+    uint64_t expected = 0;
+    MerkleProof proof;
+
+    for (size_t l = 0; l < commitment.roots.size(); l++) {
+        unsigned log_half = commitment.log_size - 1 - (unsigned)l;
+        size_t half = (size_t)1 << log_half;
+        size_t pair = index & (half - 1);
+        uint64_t f[2];
+        if (!read64(cursor, end, f[0]) || !read64(cursor, end, f[1])) return false;
+        if (!readProof(cursor, end, pair, log_half, proof)) return false;
+        if (!MerkleTree::verify(leafHash(f, 2), proof, commitment.roots[l])) return false;
+
+        uint64_t value = f[index >= half];
+        if (l == 0) {
+            value0 = value;
+        } else if (value != expected) {
+            return false;
+        }
+
+        uint64_t x_inv = glInverse(glMul(shift, glPow(omega, pair)));
+        uint64_t odd = glMul(glMul(glSub(f[0], f[1]), x_inv), commitment.betas[l]);
+        expected = glMul(glAdd(glAdd(f[0], f[1]), odd), inv2);
+        index = pair;
+        shift = glMul(shift, shift);
+        omega = glMul(omega, omega);
+    }
+    return commitment.roots.empty() || expected == commitment.final_value;
+}
+
+bool starkProveFibonacci(uint64_t a0, uint64_t a1, unsigned log_trace, uint64_t& result,
+                         std::vector<uint8_t>& proof, ThreadPool* pool) {
+    if (log_trace < STARK_MIN_LOG_TRACE || log_trace > STARK_MAX_LOG_TRACE) return false;
+    a0 %= GOLDILOCKS_P;
+    a1 %= GOLDILOCKS_P;
+    const size_t n = (size_t)1 << log_trace;
+    const unsigned log_domain = log_trace + STARK_LOG_BLOWUP;
+    const size_t domain = (size_t)1 << log_domain;
+    const size_t step = (size_t)1 << STARK_LOG_BLOWUP;   // T(gx) fica 'step' posições adiante
+
+    // Traço, interpolação e extensão para a classe lateral 7 * <w_domain>
+    std::vector<uint64_t> trace(n);
+    trace[0] = a0;
+    trace[1] = a1;
+    for (size_t i = 2; i < n; i++) trace[i] = glAdd(trace[i - 1], trace[i - 2]);
+    result = trace[n - 1];
+    glInverseNtt(trace.data(), log_trace, pool);
+    std::vector<uint64_t> lde(domain);
+    glCosetLde(trace.data(), log_trace, STARK_LOG_BLOWUP, GOLDILOCKS_GENERATOR, lde.data(), pool);
+
+    StarkTranscript transcript;
+    absorbPublic(transcript, a0, a1, log_trace, result);
+    std::unique_ptr<MerkleTree> trace_tree = commitLeaves(lde, 1, pool);
+    Hash256 trace_root = trace_tree->root();
+    transcript.absorb(trace_root.data(), 32);
+
+    FibonacciAir air(a0, a1, result, log_trace);
+    for (uint64_t& alpha : air.alpha) alpha = transcript.challengeField();
+
+    // Polinômio de composição no domínio; x^n só assume 8 valores (shift^n w_8^j)
+    std::vector<uint64_t> composition(domain);
+    const uint64_t omega = glRootOfUnity(log_domain);
+    const uint64_t shift_n = glPow(GOLDILOCKS_GENERATOR, n);
+    uint64_t x_n_values[step];
+    for (size_t j = 0; j < step; j++) x_n_values[j] = glMul(shift_n, glPow(glRootOfUnity(STARK_LOG_BLOWUP), j));
+    parallel(pool, domain, COMPOSITION_GRAIN, [&](size_t begin, size_t end) {
+        std::vector<uint64_t> den(4 * (end - begin)), inv(4 * (end - begin));
+        uint64_t x = glMul(GOLDILOCKS_GENERATOR, glPow(omega, begin));
+        for (size_t j = begin; j < end; j++) {
+            air.denominators(x, x_n_values[j & (step - 1)], &den[4 * (j - begin)]);
+            x = glMul(x, omega);
+        }
+        glBatchInverse(den.data(), inv.data(), den.size());
+        x = glMul(GOLDILOCKS_GENERATOR, glPow(omega, begin));
+        for (size_t j = begin; j < end; j++) {
+            composition[j] = air.composition(x, lde[j], lde[(j + step) & (domain - 1)],
+                                             lde[(j + 2 * step) & (domain - 1)], &inv[4 * (j - begin)]);
+            x = glMul(x, omega);
+        }
+    });
+
+    FriProver fri(pool);
+    fri.commit(std::move(composition), log_domain, STARK_LOG_BLOWUP, GOLDILOCKS_GENERATOR, transcript);
+
+    proof.assign(trace_root.begin(), trace_root.end());
+    for (size_t l = 0; l < fri.layerCount(); l++) {
+        proof.insert(proof.end(), fri.layerRoot(l).begin(), fri.layerRoot(l).end());
+    }
+    put64(proof, fri.finalValue());
+
+    for (unsigned q = 0; q < STARK_QUERIES; q++) {
+        size_t index = transcript.challengeIndex(domain);
+        for (size_t k = 0; k < 3; k++) {
+            size_t at = (index + k * step) & (domain - 1);
+            put64(proof, lde[at]);
+            appendProof(trace_tree->proof(at), proof);
+        }
+        fri.open(index, proof);
+    }
+    return true;
+}
+
+bool starkVerifyFibonacci(uint64_t a0, uint64_t a1, unsigned log_trace, uint64_t result, const uint8_t* proof,
+                          size_t len) {
+    if (log_trace < STARK_MIN_LOG_TRACE || log_trace > STARK_MAX_LOG_TRACE) return false;
+    if (a0 >= GOLDILOCKS_P || a1 >= GOLDILOCKS_P || result >= GOLDILOCKS_P) return false;
+    const unsigned log_domain = log_trace + STARK_LOG_BLOWUP;
+    const size_t domain = (size_t)1 << log_domain;
+    const size_t step = (size_t)1 << STARK_LOG_BLOWUP;
+    const uint8_t* cursor = proof;
+    const uint8_t* end = proof + len;
+
+    // Refaz a transcrição na mesma ordem do provador
+    StarkTranscript transcript;
+    absorbPublic(transcript, a0, a1, log_trace, result);
+    Hash256 trace_root;
+    if (!readHash(cursor, end, trace_root)) return false;
+    transcript.absorb(trace_root.data(), 32);
+
+    FibonacciAir air(a0, a1, result, log_trace);
+    for (uint64_t& alpha : air.alpha) alpha = transcript.challengeField();
+
+    FriCommitment fri;
+    fri.log_size = log_domain;
+    fri.shift = GOLDILOCKS_GENERATOR;
+    for (unsigned l = 0; l < log_trace; l++) {
+        Hash256 root;
+        if (!readHash(cursor, end, root)) return false;
+        transcript.absorb(root.data(), 32);
+        fri.roots.push_back(root);
+        fri.betas.push_back(transcript.challengeField());
+    }
+    if (!read64(cursor, end, fri.final_value)) return false;
+    uint8_t bytes[8];
+    store64(bytes, fri.final_value);
+    transcript.absorb(bytes, sizeof(bytes));
+
+    const uint64_t omega = glRootOfUnity(log_domain);
+    const uint64_t shift_n = glPow(GOLDILOCKS_GENERATOR, (uint64_t)1 << log_trace);
+    MerkleProof path;
+    for (unsigned q = 0; q < STARK_QUERIES; q++) {
+        size_t index = transcript.challengeIndex(domain);
+        uint64_t t[3];
+        for (size_t k = 0; k < 3; k++) {
+            size_t at = (index + k * step) & (domain - 1);
+            if (!read64(cursor, end, t[k]) || !readProof(cursor, end, at, log_domain, path)) return false;
+            if (!MerkleTree::verify(leafHash(&t[k], 1), path, trace_root)) return false;
+        }
+
+        uint64_t x = glMul(GOLDILOCKS_GENERATOR, glPow(omega, index));
+        uint64_t x_n = glMul(shift_n, glPow(glRootOfUnity(STARK_LOG_BLOWUP), index & (step - 1)));
+        uint64_t den[4], inv[4];
+        air.denominators(x, x_n, den);
+        glBatchInverse(den, inv, 4);
+        uint64_t expected = air.composition(x, t[0], t[1], t[2], inv);
+
+        uint64_t value0 = 0;
+        if (!friVerifyQuery(fri, index, cursor, end, value0) || value0 != expected) return false;
+    }
+    return cursor == end;
+}
+
+} // namespace adilsoncrypto
+
+using namespace adilsoncrypto;
+
+namespace {
+
+const char STARK_KEY[] = "fri-goldilocks";
+
+bool parseUnsigned(const std::string& text, uint64_t& value) {
+    if (text.empty() || text.size() > 20) return false;
+    value = 0;
+    for (char c : text) {
+        if (c < '0' || c > '9') return false;
+        uint64_t next = value * 10 + (uint64_t)(c - '0');
+        if (next < value) return false;
+        value = next;
+    }
+    return true;
+}
+
+std::vector<std::string> splitFields(const std::string& text) {
+    std::vector<std::string> fields;
+    size_t start = 0;
+    for (;;) {
+        size_t sep = text.find(':', start);
+        fields.push_back(text.substr(start, sep - start));
+        if (sep == std::string::npos) return fields;
+        start = sep + 1;
+    }
+}
+
+// "fibonacci:<passos>[:<a0>:<a1>]" ou texto livre (sementes do SHA-256)
+bool parseComputation(const std::string& computation, uint64_t& a0, uint64_t& a1, unsigned& log_trace) {
+    std::vector<std::string> fields = splitFields(computation);
+    if (fields[0] != "fibonacci") {
+        uint8_t digest[32];
+        sha256Digest((const uint8_t*)computation.data(), computation.size(), digest);
+        a0 = load64(digest) % GOLDILOCKS_P;
+        a1 = load64(digest + 8) % GOLDILOCKS_P;
+        log_trace = 10;
+        return true;
+    }
+    uint64_t steps = 0;
+    if ((fields.size() != 2 && fields.size() != 4) || !parseUnsigned(fields[1], steps)) return false;
+    if (steps == 0 || (steps & (steps - 1)) != 0) return false;
+    log_trace = log2Exact((size_t)steps);
+    a0 = 0;
+    a1 = 1;
+    if (fields.size() == 4 && (!parseUnsigned(fields[2], a0) || !parseUnsigned(fields[3], a1))) return false;
+    return a0 < GOLDILOCKS_P && a1 < GOLDILOCKS_P && log_trace >= STARK_MIN_LOG_TRACE &&
+           log_trace <= STARK_MAX_LOG_TRACE;
+}
+
+class StarkZeroKnowledge : public IZeroKnowledge {
+public:
+    std::unique_ptr<IZeroKnowledge> createZKSNARK() override {
+        return nullptr;
+    }
+
+    ZKProof prove(const std::string&, const std::string&) override {
+        return ZKProof();
+    }
+
+    bool verify(const std::string&, const ZKProof&) override {
+        return false;
+    }
+
+    std::unique_ptr<IZeroKnowledge> createZKSTARK() override {
+        return createStarkZeroKnowledge();
+    }
+
+    ZKProof proveSTARK(const std::string& computation) override {
+        ZKProof proof = ZKProof();
+        uint64_t a0, a1, result;
+        unsigned log_trace;
+        std::vector<uint8_t> bytes;
+        if (!parseComputation(computation, a0, a1, log_trace) ||
+            !starkProveFibonacci(a0, a1, log_trace, result, bytes, &defaultThreadPool())) {
+            return proof;
+        }
+        proof.proof_data = bytesToHex(bytes.data(), bytes.size());
+        proof.public_inputs = std::to_string((uint64_t)1 << log_trace) + ":" + std::to_string(a0) + ":" +
+                              std::to_string(a1) + ":" + std::to_string(result);
+        proof.verification_key = STARK_KEY;
+        proof.is_valid = true;
+        return proof;
+    }
+
+    bool verifySTARK(const std::string& computation, const ZKProof& proof) override {
+        uint64_t a0, a1, steps, claimed_a0, claimed_a1, result;
+        unsigned log_trace;
+        std::string bytes;
+        std::vector<std::string> inputs = splitFields(proof.public_inputs);
+        if (proof.verification_key != STARK_KEY || inputs.size() != 4 ||
+            !parseComputation(computation, a0, a1, log_trace) || !parseUnsigned(inputs[0], steps) ||
+            !parseUnsigned(inputs[1], claimed_a0) || !parseUnsigned(inputs[2], claimed_a1) ||
+            !parseUnsigned(inputs[3], result) || steps != ((uint64_t)1 << log_trace) || claimed_a0 != a0 ||
+            claimed_a1 != a1 || !hexToBytes(proof.proof_data, bytes)) {
+            return false;
+        }
+        return starkVerifyFibonacci(a0, a1, log_trace, result, (const uint8_t*)bytes.data(), bytes.size());
+    }
+
+    std::unique_ptr<IZeroKnowledge> createBulletproof() override {
+        return nullptr;
+    }
+
+    ZKProof proveRange(int, const std::string&) override {
+        return ZKProof();
+    }
+
+    bool verifyRange(const std::string&, const ZKProof&) override {
+        return false;
+    }
+};
+
+} // namespace
+
+std::unique_ptr<IZeroKnowledge> createStarkZeroKnowledge() {
+    return std::make_unique<StarkZeroKnowledge>();
+}
@@ -0,0 +1,126 @@
+#include "../include/adilsoncrypto_util.h"
+#include "../include/adilsoncrypto_sha256.h"
+#include <cstring>
+#include <vector>
+
+namespace adilsoncrypto {
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+std::string bytesToHex(const uint8_t* data, size_t len) {
+    std::string hex(len * 2, '0');
+    for (size_t i = 0; i < len; i++) {
+        hex[2 * i] = HEX_DIGITS[data[i] >> 4];
+        hex[2 * i + 1] = HEX_DIGITS[data[i] & 15];
+    }
+    return hex;
+}
+
+std::string bytesToHex(const std::string& data) {
+    return bytesToHex((const uint8_t*)data.data(), data.size());
+}
+
+static size_t hexPrefix(const std::string& hex) {
+    return (hex.size() >= 2 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X')) ? 2 : 0;
+}
+
+bool hexToBytes(const std::string& hex, uint8_t* out, size_t len) {
+    size_t start = hexPrefix(hex);
+    if (hex.size() - start != len * 2) return false;
+    for (size_t i = 0; i < len; i++) {
+        int hi = hexValue(hex[start + 2 * i]);
+        int lo = hexValue(hex[start + 2 * i + 1]);
+        if (hi < 0 || lo < 0) return false;
+        out[i] = (uint8_t)((hi << 4) | lo);
+    }
+    return true;
+}
+
+bool hexToBytes(const std::string& hex, std::string& out) {
+    size_t start = hexPrefix(hex);
+    if ((hex.size() - start) % 2 != 0) return false;
+    out.resize((hex.size() - start) / 2);
+    return hexToBytes(hex, (uint8_t*)out.data(), out.size());
+}
+
+static const char BASE58_ALPHABET[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+std::string base58Encode(const uint8_t* data, size_t len) {
+    size_t zeros = 0;
+    while (zeros < len && data[zeros] == 0) zeros++;
+
+    // log(256)/log(58) ~ 1.365; dígitos em base 58, mais significativo primeiro
+    std::vector<uint8_t> digits((len - zeros) * 138 / 100 + 1);
+    size_t used = 0;
+    for (size_t i = zeros; i < len; i++) {
+        int carry = data[i];
+        size_t j = 0;
+        for (auto it = digits.rbegin(); (carry != 0 || j < used) && it != digits.rend(); ++it, ++j) {
+            carry += 256 * (*it);
+            *it = (uint8_t)(carry % 58);
+            carry /= 58;
+        }
+        used = j;
+    }
+    size_t skip = digits.size() - used;
+    std::string out(zeros, '1');
+    out.reserve(zeros + used);
+    for (size_t i = skip; i < digits.size(); i++) out.push_back(BASE58_ALPHABET[digits[i]]);
+    return out;
+}
+
+bool base58Decode(const std::string& text, std::string& out) {
+    static int8_t map[256];
+    static bool map_ready = [] {
+        std::memset(map, -1, sizeof(map));
+        for (int i = 0; i < 58; i++) map[(uint8_t)BASE58_ALPHABET[i]] = (int8_t)i;
+        return true;
+    }();
+    (void)map_ready;
+
+    size_t zeros = 0;
+    while (zeros < text.size() && text[zeros] == '1') zeros++;
+    std::vector<uint8_t> bytes((text.size() - zeros) * 733 / 1000 + 1);
+    size_t used = 0;
+    for (size_t i = zeros; i < text.size(); i++) {
+        int carry = map[(uint8_t)text[i]];
+        if (carry < 0) return false;
+        size_t j = 0;
+        for (auto it = bytes.rbegin(); (carry != 0 || j < used) && it != bytes.rend(); ++it, ++j) {
+            carry += 58 * (*it);
+            *it = (uint8_t)(carry & 0xff);
+            carry >>= 8;
+        }
+        used = j;
+    }
+    out.assign(zeros, '\0');
+    out.append(bytes.end() - used, bytes.end());
+    return true;
+}
+
+std::string base58CheckEncode(const std::string& payload) {
+    uint8_t checksum[32];
+    sha256dDigest((const uint8_t*)payload.data(), payload.size(), checksum);
+    std::string data = payload;
+    data.append((const char*)checksum, 4);
+    return base58Encode((const uint8_t*)data.data(), data.size());
+}
+
+bool base58CheckDecode(const std::string& text, std::string& payload) {
+    std::string data;
+    if (!base58Decode(text, data) || data.size() < 4) return false;
+    uint8_t checksum[32];
+    sha256dDigest((const uint8_t*)data.data(), data.size() - 4, checksum);
+    if (std::memcmp(checksum, data.data() + data.size() - 4, 4) != 0) return false;
+    payload = data.substr(0, data.size() - 4);
+    return true;
+}
+
+} // namespace adilsoncrypto